@@ -6,6 +6,8 @@
 #include "Base/IniFile.h"
 #include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/Logging/LoggingSystem.h"
+#include "Base/Memory/FrameAllocator.h"
+#include "Base/Memory/MemoryTracking.h"
 
 #include "_AutoGenerated/EngineTypeRegistration.h"
 
@@ -446,6 +448,13 @@ namespace EE
 
                 m_renderingSystem.Update( m_updateContext );
                 m_pInputSystem->ClearFrameState();
+
+                // All frame work is complete, so it is now safe to release the previous frame's transient memory
+                Memory::AdvanceFrame();
+
+                #if EE_DEVELOPMENT_TOOLS
+                Memory::EndMemoryTrackingFrame();
+                #endif
             }
         }
 
@@ -6,6 +6,7 @@
 #include "Base/Render/RenderDevice.h"
 #include "Engine/UpdateContext.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
 #include "Base/Math/ViewVolume.h"
 #include "Engine/Entity/EntityWorld.h"
 #include <eastl/sort.h>
@@ -227,6 +228,7 @@ namespace EE::Render
         EE_ASSERT( m_pRenderDevice != nullptr );
         EE_ASSERT( ctx.GetUpdateStage() == UpdateStage::FrameEnd );
         EE_PROFILE_SCOPE_RENDER( "Rendering Post-Physics" );
+        EE_MEMORY_TAG_SCOPE( Rendering );
 
         //-------------------------------------------------------------------------
 
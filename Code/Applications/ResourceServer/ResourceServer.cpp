@@ -5,6 +5,7 @@
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "Base/Resource/ResourceProviders/ResourceNetworkMessages.h"
+#include "Base/Resource/ResourceArchive.h"
 #include "Base/IniFile.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/FileSystem/FileSystemUtils.h"
@@ -382,8 +383,8 @@ namespace EE::Resource
 
             if ( isComplete )
             {
+                m_packagingStage = WritePackagedResourceArchives() ? PackagingStage::Complete : PackagingStage::Failed;
                 m_packagingRequests.clear();
-                m_packagingStage = PackagingStage::Complete;
             }
         }
 
@@ -599,7 +600,7 @@ namespace EE::Resource
 
     bool ResourceServer::CanStartPackaging() const
     {
-        return ( m_packagingStage == PackagingStage::None || m_packagingStage == PackagingStage::Complete ) && !m_mapsToBePackaged.empty();
+        return !IsPackaging() && !m_mapsToBePackaged.empty();
     }
 
     void ResourceServer::StartPackaging()
@@ -609,6 +610,37 @@ namespace EE::Resource
         m_pPackagingTask = EE::New<PackagingTask>( m_context, m_mapsToBePackaged );
         m_taskSystem.ScheduleTask( m_pPackagingTask );
         m_packagingStage = PackagingStage::Preparing;
+        m_packagingErrorMessage.clear();
+    }
+
+    bool ResourceServer::WritePackagedResourceArchives()
+    {
+        // The packaging requests are in dependency order (each resource is followed by its install dependencies) which matches the order they are loaded in
+        ResourceArchiveBuilder archiveBuilder;
+        for ( auto pRequest : m_packagingRequests )
+        {
+            if ( pRequest->HasSucceeded() )
+            {
+                archiveBuilder.AddFile( pRequest->GetResourceID().GetResourcePath(), pRequest->GetDestinationFilePath() );
+            }
+        }
+
+        if ( !archiveBuilder.Write( m_settings.m_packagedBuildCompiledResourcePath, "Resources", &m_packagingErrorMessage ) )
+        {
+            EE_LOG_ERROR( "Resource", "Packaging", "Failed to write resource archives: %s", m_packagingErrorMessage.c_str() );
+            return false;
+        }
+
+        // The archived resources are only ever loaded from the archives in a packaged build, so remove the loose compiled files to avoid shipping every resource twice
+        for ( auto pRequest : m_packagingRequests )
+        {
+            if ( pRequest->HasSucceeded() && FileSystem::Exists( pRequest->GetDestinationFilePath() ) )
+            {
+                FileSystem::EraseFile( pRequest->GetDestinationFilePath() );
+            }
+        }
+
+        return true;
     }
 
     float ResourceServer::GetPackagingProgress() const
@@ -644,6 +676,7 @@ namespace EE::Resource
             break;
 
             case PackagingStage::Complete:
+            case PackagingStage::Failed:
             {
                 return 1.0f;
             }
@@ -39,7 +39,8 @@ namespace EE::Resource
             None, // Not Packaging
             Preparing,
             Packaging,
-            Complete
+            Complete,
+            Failed
         };
 
     public:
@@ -92,7 +93,7 @@ namespace EE::Resource
         TVector<ResourceID> const& GetMapsQueuedForPackaging() const { return m_mapsToBePackaged; }
 
         // Are we currently packaging a map
-        inline bool IsPackaging() const { return m_packagingStage != PackagingStage::None && m_packagingStage != PackagingStage::Complete; }
+        inline bool IsPackaging() const { return m_packagingStage == PackagingStage::Preparing || m_packagingStage == PackagingStage::Packaging; }
 
         // Get the current stage of packaging
         PackagingStage GetPackagingStage() const { return m_packagingStage; }
@@ -112,6 +113,9 @@ namespace EE::Resource
         // Start the packaging process
         void StartPackaging();
 
+        // Get the error from the last packaging operation (if it failed)
+        inline String const& GetPackagingErrorMessage() const { return m_packagingErrorMessage; }
+
     private:
 
         // Requests
@@ -121,6 +125,12 @@ namespace EE::Resource
         void ProcessCompletedRequests();
         void NotifyClientOnCompletedRequest( CompilationRequest* pRequest );
 
+        // Packaging
+        //-------------------------------------------------------------------------
+
+        // Store all successfully packaged resources in the resource archives, in the order they were requested (i.e. load order)
+        bool WritePackagedResourceArchives();
+
         // File system listener
         //-------------------------------------------------------------------------
 
@@ -152,6 +162,7 @@ namespace EE::Resource
         TVector<CompilationRequest const*>                          m_packagingRequests;
         PackagingTask*                                              m_pPackagingTask = nullptr;
         PackagingStage                                              m_packagingStage = PackagingStage::None;
+        String                                                      m_packagingErrorMessage;
 
         // File System Watcher
         FileSystem::FileSystemWatcher                               m_fileSystemWatcher;
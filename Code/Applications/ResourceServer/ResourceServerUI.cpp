@@ -635,12 +635,18 @@ namespace EE::Resource
 
                 ImGuiX::TextSeparator( "Progress" );
 
-                if ( packagingStage != ResourceServer::PackagingStage::Complete )
+                if ( m_resourceServer.IsPackaging() )
                 {
                     ImGui::Indent( 4.0f );
                     ImGuiX::DrawSpinner( "##Packaging" );
                     ImGui::Unindent( 4.0f );
                 }
+                else if ( packagingStage == ResourceServer::PackagingStage::Failed )
+                {
+                    ImGuiX::ScopedFont const sf( ImGuiX::Font::Medium, Colors::Red );
+                    ImGui::AlignTextToFramePadding();
+                    ImGui::Text( EE_ICON_ALERT_OCTAGON );
+                }
                 else
                 {
                     ImGuiX::ScopedFont const sf( ImGuiX::Font::Medium, Colors::Lime );
@@ -653,6 +659,11 @@ namespace EE::Resource
                 float const progress = m_resourceServer.GetPackagingProgress();
                 TInlineString<32> overlay( TInlineString<32>::CtorSprintf(), "%.2f%%", progress * 100 );
                 ImGui::ProgressBar( progress, ImVec2( -1, 0 ), overlay.c_str() );
+
+                if ( packagingStage == ResourceServer::PackagingStage::Failed )
+                {
+                    ImGui::TextColored( Colors::Red.ToFloat4(), "%s", m_resourceServer.GetPackagingErrorMessage().c_str() );
+                }
             }
         }
         ImGui::End();
@@ -0,0 +1,696 @@
+#include "AnimationBenchmarks.h"
+#include "BenchmarkUtils.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationBlender.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationSkeleton.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationClip.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_Sample.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_Blend.h"
+#include "Base/Resource/ResourceHeader.h"
+#include "Base/TypeSystem/TypeDescriptors.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Serialization/JsonSerialization.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Encoding/Quantization.h"
+#include "Base/Threading/TaskSystem.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::Benchmarks
+{
+    namespace
+    {
+        static int32_t const g_boneCounts[] = { 30, 80, 150, 300 };
+        static int32_t const g_characterCounts[] = { 1, 16, 64 };
+
+        static int32_t const g_numWarmupRuns = 5;
+        static int32_t const g_numSamples = 200;
+        static int32_t const g_numClipsPerSkeleton = 4;
+        static int32_t const g_numClipFrames = 31;
+
+        // The number of sampled clips in the wide blend tree, all samples are independent so this is the max parallelism available
+        static int32_t const g_wideBlendTreeWidth = 16;
+
+        // Serialized task lists need to fit into a single task serializer, so we use a narrower tree for serialization
+        static int32_t const g_serializedBlendTreeWidth = 8;
+    }
+
+    //-------------------------------------------------------------------------
+    // Synthetic Data
+    //-------------------------------------------------------------------------
+    // All resources are serialized in the same format as the resource compilers output and loaded/installed via the runtime loaders
+    // This ensures that the runtime data (decoding layouts, bone masks, LOD sets, etc...) is identical to that of real compiled resources
+
+    namespace
+    {
+        // Mirrors the serialized layout of 'TrackCompressionSettings' (the settings are only writable by the compiler)
+        struct SyntheticTrackSettings
+        {
+            EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_constantRotation, m_isRotationStatic, m_isTranslationStatic, m_isScaleStatic );
+
+            QuantizationRange                       m_translationRangeX;
+            QuantizationRange                       m_translationRangeY;
+            QuantizationRange                       m_translationRangeZ;
+            QuantizationRange                       m_scaleRange;
+            Quaternion                              m_constantRotation = Quaternion::Identity;
+            bool                                    m_isRotationStatic = false;
+            bool                                    m_isTranslationStatic = false;
+            bool                                    m_isScaleStatic = false;
+        };
+
+        // A resource ptr for a resource that we loaded ourselves (i.e. not via the resource system)
+        struct SyntheticResourcePtr : public Resource::ResourcePtr
+        {
+            SyntheticResourcePtr( Resource::ResourceRecord const* pRecord )
+            {
+                EE_ASSERT( pRecord != nullptr );
+                m_resourceID = pRecord->GetResourceID();
+                m_pResourceRecord = pRecord;
+            }
+        };
+
+        //-------------------------------------------------------------------------
+
+        class SyntheticDataSet
+        {
+        public:
+
+            SyntheticDataSet( TypeSystem::TypeRegistry const& typeRegistry )
+            {
+                m_clipLoader.SetTypeRegistryPtr( &typeRegistry );
+            }
+
+            ~SyntheticDataSet()
+            {
+                m_clipLUT.clear();
+
+                // Clips hold a reference to their skeleton, so unload them first
+                for ( auto pRecord : m_clipRecords )
+                {
+                    UnloadResource( m_clipLoader, pRecord );
+                }
+
+                for ( auto pRecord : m_skeletonRecords )
+                {
+                    UnloadResource( m_skeletonLoader, pRecord );
+                }
+
+                m_clipLoader.ClearTypeRegistryPtr();
+            }
+
+            inline ResourceLUT const& GetClipLUT() const { return m_clipLUT; }
+
+            // Create a skeleton made up of a set of short bone chains (similar to a humanoid hierarchy) with a single "upper body" bone mask
+            Skeleton const* CreateSkeleton( int32_t numBones )
+            {
+                EE_ASSERT( numBones > 1 );
+
+                TVector<StringID> boneIDs;
+                TVector<Transform> localReferencePose;
+                TVector<int32_t> parentIndices;
+                TVector<TBitFlags<BoneFlags>> boneFlags;
+                TVector<Skeleton::LOD> boneLODs;
+
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    // Start a new chain every six bones, parented to a bone in the first half of the hierarchy
+                    int32_t parentIdx = InvalidIndex;
+                    if ( boneIdx > 0 )
+                    {
+                        parentIdx = ( ( boneIdx % 6 ) == 1 ) ? ( boneIdx - 1 ) / 2 : boneIdx - 1;
+                    }
+
+                    float const angle = 0.1f * ( boneIdx % 7 );
+                    boneIDs.emplace_back( StringID( String( String::CtorSprintf(), "Bone_%03d", boneIdx ).c_str() ) );
+                    localReferencePose.emplace_back( Transform( Quaternion( Radians( angle ), Radians( 0.0f ), Radians( -angle ) ), Vector( 0.0f, 0.1f, 0.0f ) ) );
+                    parentIndices.emplace_back( parentIdx );
+                    boneFlags.emplace_back( TBitFlags<BoneFlags>() );
+                    boneLODs.emplace_back( Skeleton::LOD::Low );
+                }
+
+                // Bone mask
+                //-------------------------------------------------------------------------
+
+                TVector<BoneMaskDefinition> boneMaskDefinitions;
+                BoneMaskDefinition& maskDefinition = boneMaskDefinitions.emplace_back( StringID( "UpperBody" ) );
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    if ( boneIdx >= numBones / 2 )
+                    {
+                        maskDefinition.m_weights.emplace_back( boneIDs[boneIdx], 1.0f );
+                    }
+                    else if ( ( boneIdx % 7 ) == 0 )
+                    {
+                        maskDefinition.m_weights.emplace_back( boneIDs[boneIdx], 0.5f );
+                    }
+                }
+
+                // Serialize and load
+                //-------------------------------------------------------------------------
+
+                ResourceID const resourceID( String( String::CtorSprintf(), "data://Benchmarks/Skeleton_%d.skel", numBones ) );
+                EE_ASSERT( resourceID.GetResourceTypeID() == Skeleton::GetStaticResourceTypeID() );
+
+                Serialization::BinaryOutputArchive archive;
+                archive << Resource::ResourceHeader( 0, Skeleton::GetStaticResourceTypeID(), 0 );
+                archive << boneIDs << localReferencePose << parentIndices << boneFlags << boneLODs;
+                archive << boneMaskDefinitions;
+
+                auto pRecord = LoadResource( m_skeletonLoader, resourceID, archive, Resource::InstallDependencyList() );
+                m_skeletonRecords.emplace_back( pRecord );
+                return pRecord->GetResourceData<Skeleton>();
+            }
+
+            // Create a clip where most tracks are animated (a few rotation and most translation/scale tracks are static, as is typical for real data)
+            AnimationClip const* CreateClip( Skeleton const* pSkeleton, int32_t clipIdx, bool isAdditive )
+            {
+                Resource::ResourceRecord const* pSkeletonRecord = nullptr;
+                for ( auto pRecord : m_skeletonRecords )
+                {
+                    if ( pRecord->GetResourceData() == pSkeleton )
+                    {
+                        pSkeletonRecord = pRecord;
+                        break;
+                    }
+                }
+                EE_ASSERT( pSkeletonRecord != nullptr );
+
+                //-------------------------------------------------------------------------
+
+                int32_t const numBones = pSkeleton->GetNumBones();
+                float const magnitude = isAdditive ? 0.1f : 1.0f;
+
+                TVector<SyntheticTrackSettings> trackSettings;
+                trackSettings.resize( numBones );
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    SyntheticTrackSettings& settings = trackSettings[boneIdx];
+                    settings.m_isRotationStatic = ( boneIdx % 5 ) == 4;
+                    settings.m_isTranslationStatic = ( boneIdx != 0 ) && ( boneIdx % 4 ) != 0;
+                    settings.m_isScaleStatic = ( boneIdx % 16 ) != 8;
+
+                    if ( settings.m_isRotationStatic )
+                    {
+                        settings.m_constantRotation = isAdditive ? Quaternion::Identity : pSkeleton->GetLocalReferencePose()[boneIdx].GetRotation();
+                    }
+
+                    float const translationRangeStart = settings.m_isTranslationStatic ? ( isAdditive ? 0.0f : 0.1f ) : -magnitude;
+                    settings.m_translationRangeX = QuantizationRange( translationRangeStart, 2.0f * magnitude );
+                    settings.m_translationRangeY = QuantizationRange( translationRangeStart, 2.0f * magnitude );
+                    settings.m_translationRangeZ = QuantizationRange( translationRangeStart, 2.0f * magnitude );
+                    settings.m_scaleRange = settings.m_isScaleStatic ? QuantizationRange( 1.0f, 1.0f ) : QuantizationRange( 0.5f, 1.0f );
+                }
+
+                // Generate compressed poses
+                //-------------------------------------------------------------------------
+                // Layout: all animated rotations first, followed by the interleaved animated translations and scales (see AnimationClipLoader)
+
+                TVector<uint16_t> compressedPoseData;
+                TVector<uint32_t> compressedPoseOffsets;
+
+                for ( int32_t frameIdx = 0; frameIdx < g_numClipFrames; frameIdx++ )
+                {
+                    compressedPoseOffsets.emplace_back( (uint32_t) compressedPoseData.size() );
+
+                    for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                    {
+                        if ( !trackSettings[boneIdx].m_isRotationStatic )
+                        {
+                            float const angle = 0.4f * magnitude * Math::Sin( 0.21f * frameIdx + 0.7f * boneIdx + clipIdx );
+                            Quantization::EncodedQuaternion const encodedRotation( Quaternion( Radians( angle ), Radians( 0.5f * angle ), Radians( -0.3f * angle ) ) );
+                            compressedPoseData.emplace_back( encodedRotation.GetData0() );
+                            compressedPoseData.emplace_back( encodedRotation.GetData1() );
+                            compressedPoseData.emplace_back( encodedRotation.GetData2() );
+                        }
+                    }
+
+                    for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                    {
+                        SyntheticTrackSettings const& settings = trackSettings[boneIdx];
+                        float const value = 0.5f * Math::Sin( 0.13f * frameIdx + 0.3f * boneIdx + clipIdx );
+
+                        if ( !settings.m_isTranslationStatic )
+                        {
+                            compressedPoseData.emplace_back( Quantization::EncodeFloat( magnitude * value, settings.m_translationRangeX.m_rangeStart, settings.m_translationRangeX.m_rangeLength ) );
+                            compressedPoseData.emplace_back( Quantization::EncodeFloat( magnitude * -value, settings.m_translationRangeY.m_rangeStart, settings.m_translationRangeY.m_rangeLength ) );
+                            compressedPoseData.emplace_back( Quantization::EncodeFloat( magnitude * 0.5f * value, settings.m_translationRangeZ.m_rangeStart, settings.m_translationRangeZ.m_rangeLength ) );
+                        }
+
+                        if ( !settings.m_isScaleStatic )
+                        {
+                            compressedPoseData.emplace_back( Quantization::EncodeFloat( 1.0f + 0.25f * value, settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength ) );
+                        }
+                    }
+                }
+
+                RootMotionData rootMotion;
+                rootMotion.m_transforms.resize( g_numClipFrames, Transform::Identity );
+                rootMotion.m_totalDelta = Transform::Identity;
+
+                // Serialize and load
+                //-------------------------------------------------------------------------
+                // Must match the serialization order of the 'AnimationClip' members, followed by the sync event markers and the event collection
+
+                ResourceID const resourceID( String( String::CtorSprintf(), "data://Benchmarks/Clip_%d_%d%s.anim", numBones, clipIdx, isAdditive ? "_Additive" : "" ) );
+                EE_ASSERT( resourceID.GetResourceTypeID() == AnimationClip::GetStaticResourceTypeID() );
+
+                Resource::ResourceHeader header( 0, AnimationClip::GetStaticResourceTypeID(), 0 );
+                header.AddInstallDependency( pSkeletonRecord->GetResourceID() );
+
+                Serialization::BinaryOutputArchive archive;
+                archive << header;
+                archive << TResourcePtr<Skeleton>( pSkeletonRecord->GetResourceID() ) << uint32_t( g_numClipFrames ) << Seconds( 1.0f );
+                archive << compressedPoseData << compressedPoseOffsets << trackSettings << rootMotion << isAdditive;
+                archive << TInlineVector<SyncTrack::EventMarker, 10>();
+                archive << TypeSystem::TypeDescriptorCollection();
+
+                Resource::InstallDependencyList installDependencies;
+                installDependencies.emplace_back( SyntheticResourcePtr( pSkeletonRecord ) );
+
+                auto pRecord = LoadResource( m_clipLoader, resourceID, archive, installDependencies );
+                m_clipRecords.emplace_back( pRecord );
+                m_clipLUT.insert( TPair<uint32_t, Resource::ResourcePtr>( resourceID.GetPathID(), SyntheticResourcePtr( pRecord ) ) );
+                return pRecord->GetResourceData<AnimationClip>();
+            }
+
+        private:
+
+            Resource::ResourceRecord* LoadResource( Resource::ResourceLoader const& loader, ResourceID const& resourceID, Serialization::BinaryOutputArchive& archive, Resource::InstallDependencyList const& installDependencies )
+            {
+                Blob resourceData;
+                archive.GetAsBinaryBlob( resourceData );
+
+                auto pRecord = EE::New<Resource::ResourceRecord>( resourceID );
+                pRecord->SetLoadingStatus( LoadingStatus::Loading );
+
+                bool const wasLoaded = loader.Load( resourceID, resourceData, pRecord );
+                EE_ASSERT( wasLoaded );
+
+                Resource::InstallResult const installResult = loader.Install( resourceID, pRecord, installDependencies );
+                EE_ASSERT( installResult == Resource::InstallResult::Succeeded );
+
+                pRecord->SetLoadingStatus( LoadingStatus::Loaded );
+                return pRecord;
+            }
+
+            void UnloadResource( Resource::ResourceLoader const& loader, Resource::ResourceRecord*& pRecord )
+            {
+                pRecord->SetLoadingStatus( LoadingStatus::Unloading );
+                loader.Uninstall( pRecord->GetResourceID(), pRecord );
+                loader.Unload( pRecord->GetResourceID(), pRecord );
+                pRecord->SetLoadingStatus( LoadingStatus::Unloaded );
+                EE::Delete( pRecord );
+            }
+
+        private:
+
+            SkeletonLoader                          m_skeletonLoader;
+            AnimationClipLoader                     m_clipLoader;
+            TVector<Resource::ResourceRecord*>      m_skeletonRecords;
+            TVector<Resource::ResourceRecord*>      m_clipRecords;
+            ResourceLUT                             m_clipLUT;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+    // Measurement
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BenchmarkResult
+        {
+            String                                  m_name;
+            int32_t                                 m_numBones = 0;
+            int32_t                                 m_numCharacters = 0;
+            Benchmarking::SampleStatistics          m_timing; // Per sample (i.e. per frame for all characters)
+            double                                  m_allocationsPerSample = -1; // Only available with development tools enabled
+            int32_t                                 m_numPoseBufferAllocations = 0;
+        };
+
+        // Time the supplied function (that updates all characters once) and record the per-sample percentiles
+        template<typename BenchmarkFunction>
+        BenchmarkResult Measure( char const* pName, int32_t numBones, int32_t numCharacters, BenchmarkFunction&& function )
+        {
+            BenchmarkResult result;
+            result.m_name = pName;
+            result.m_numBones = numBones;
+            result.m_numCharacters = numCharacters;
+
+            result.m_timing = Benchmarking::Measure( g_numWarmupRuns, g_numSamples, function, &result.m_allocationsPerSample );
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        void WriteResults( Serialization::JsonWriter& writer, TVector<BenchmarkResult> const& results, uint32_t numWorkers )
+        {
+            writer.StartObject();
+
+            writer.Key( "NumWorkerThreads" );
+            writer.Uint( numWorkers );
+
+            writer.Key( "NumSamples" );
+            writer.Int( g_numSamples );
+
+            writer.Key( "Benchmarks" );
+            writer.StartArray();
+            for ( BenchmarkResult const& result : results )
+            {
+                double const numProcessedBones = double( result.m_numBones ) * result.m_numCharacters;
+
+                writer.StartObject();
+                writer.Key( "Name" );
+                writer.String( result.m_name.c_str() );
+                writer.Key( "NumBones" );
+                writer.Int( result.m_numBones );
+                writer.Key( "NumCharacters" );
+                writer.Int( result.m_numCharacters );
+                Benchmarking::WriteStatistics( writer, "", result.m_timing );
+                writer.Key( "P50NsPerCharacter" );
+                writer.Double( result.m_timing.m_p50 / result.m_numCharacters );
+                writer.Key( "P50NsPerBone" );
+                writer.Double( result.m_timing.m_p50 / numProcessedBones );
+                Benchmarking::WriteAllocationsPerSample( writer, result.m_allocationsPerSample );
+                writer.Key( "PoseBufferAllocations" );
+                writer.Int( result.m_numPoseBufferAllocations );
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Benchmarks
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Register a balanced blend tree that samples 'width' clips and then blends them pairwise down to a single pose
+        // All the samples (and all the blends in each level of the tree) are independent, so this is the best case for parallel execution
+        void RegisterWideBlendTree( TaskSystem& taskSystem, TInlineVector<AnimationClip const*, 5> const& clips, int32_t width, Percentage time )
+        {
+            TInlineVector<TaskIndex, 32> currentLevel;
+            for ( int32_t i = 0; i < width; i++ )
+            {
+                currentLevel.emplace_back( taskSystem.RegisterTask<Tasks::SampleTask>( (TaskSourceID) i, clips[i % clips.size()], time ) );
+            }
+
+            TaskSourceID sourceID = (TaskSourceID) width;
+            while ( currentLevel.size() > 1 )
+            {
+                TInlineVector<TaskIndex, 32> nextLevel;
+                for ( int32_t i = 0; i < (int32_t) currentLevel.size(); i += 2 )
+                {
+                    if ( ( i + 1 ) < (int32_t) currentLevel.size() )
+                    {
+                        nextLevel.emplace_back( taskSystem.RegisterTask<Tasks::BlendTask>( sourceID++, currentLevel[i], currentLevel[i + 1], 0.5f ) );
+                    }
+                    else
+                    {
+                        nextLevel.emplace_back( currentLevel[i] );
+                    }
+                }
+
+                currentLevel = nextLevel;
+            }
+        }
+
+        inline Percentage GetSampleTime( int32_t sampleIdx )
+        {
+            // Step through the clip at a rate that doesnt line up with the key frames, so most samples need to interpolate
+            return Percentage( Math::FModF( sampleIdx * 0.0137f, 1.0f ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        void RunPoseBenchmarks( TVector<BenchmarkResult>& results, Skeleton const* pSkeleton, TInlineVector<AnimationClip const*, 5> const& clips, AnimationClip const* pAdditiveClip, int32_t numCharacters )
+        {
+            int32_t const numBones = pSkeleton->GetNumBones();
+            BoneMask const* pBoneMask = pSkeleton->GetBoneMask( 0 );
+
+            TVector<Pose> sourcePoses;
+            TVector<Pose> targetPoses;
+            TVector<Pose> additivePoses;
+            TVector<Pose> resultPoses;
+            sourcePoses.reserve( numCharacters );
+            targetPoses.reserve( numCharacters );
+            additivePoses.reserve( numCharacters );
+            resultPoses.reserve( numCharacters );
+
+            for ( int32_t i = 0; i < numCharacters; i++ )
+            {
+                sourcePoses.emplace_back( pSkeleton );
+                targetPoses.emplace_back( pSkeleton );
+                additivePoses.emplace_back( pSkeleton, Pose::Type::ZeroPose );
+                resultPoses.emplace_back( pSkeleton );
+
+                clips[i % clips.size()]->GetPose( GetSampleTime( i ), &sourcePoses[i] );
+                clips[( i + 1 ) % clips.size()]->GetPose( GetSampleTime( i + 7 ), &targetPoses[i] );
+                pAdditiveClip->GetPose( GetSampleTime( i ), &additivePoses[i] );
+            }
+
+            // Sampling
+            //-------------------------------------------------------------------------
+
+            results.emplace_back( Measure( "AnimationClip::GetPose", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    clips[i % clips.size()]->GetPose( GetSampleTime( sampleIdx + i ), &resultPoses[i] );
+                }
+            } ) );
+
+            BoneSet const& lowLODBones = pSkeleton->GetLODBoneSet( Skeleton::LOD::Low );
+            BoneSet requiredBones( numBones );
+            requiredBones.SetFromBoneMask( *pBoneMask );
+            requiredBones.AddParentBones( pSkeleton );
+            requiredBones &= lowLODBones;
+
+            results.emplace_back( Measure( "AnimationClip::GetPose (Required Bones)", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    clips[i % clips.size()]->GetPose( GetSampleTime( sampleIdx + i ), &resultPoses[i], &requiredBones );
+                }
+            } ) );
+
+            // Blending
+            //-------------------------------------------------------------------------
+
+            results.emplace_back( Measure( "Blender::LocalBlend", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    Blender::LocalBlend( &sourcePoses[i], &targetPoses[i], 0.35f, nullptr, &resultPoses[i] );
+                }
+            } ) );
+
+            results.emplace_back( Measure( "Blender::LocalBlend (Masked)", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    Blender::LocalBlend( &sourcePoses[i], &targetPoses[i], 0.35f, pBoneMask, &resultPoses[i] );
+                }
+            } ) );
+
+            results.emplace_back( Measure( "Blender::AdditiveBlend", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    Blender::AdditiveBlend( &sourcePoses[i], &additivePoses[i], 0.75f, nullptr, &resultPoses[i] );
+                }
+            } ) );
+
+            results.emplace_back( Measure( "Blender::GlobalBlend", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    Blender::GlobalBlend( &sourcePoses[i], &targetPoses[i], 0.75f, pBoneMask, &resultPoses[i] );
+                }
+            } ) );
+
+            // Global Transforms
+            //-------------------------------------------------------------------------
+
+            results.emplace_back( Measure( "Pose::CalculateGlobalTransforms", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    resultPoses[i].ClearGlobalTransforms();
+                    resultPoses[i].CalculateGlobalTransforms();
+                }
+            } ) );
+
+            // Only a single bone (and its children) needs to be recalculated, i.e. a typical post-process IK fix-up
+            int32_t const modifiedBoneIdx = numBones / 2;
+            results.emplace_back( Measure( "Pose::CalculateGlobalTransforms (Incremental)", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    resultPoses[i].SetRotation( modifiedBoneIdx, Quaternion( Radians( 0.01f * sampleIdx ), Radians( 0.0f ), Radians( 0.0f ) ) );
+                    resultPoses[i].CalculateGlobalTransforms();
+                }
+            } ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        void RunTaskSystemBenchmarks( TVector<BenchmarkResult>& results, TypeSystem::TypeRegistry const& typeRegistry, EE::TaskSystem& taskScheduler, ResourceLUT const& clipLUT, Skeleton const* pSkeleton, TInlineVector<AnimationClip const*, 5> const& clips, int32_t numCharacters )
+        {
+            int32_t const numBones = pSkeleton->GetNumBones();
+
+            TVector<TaskSystem*> taskSystems;
+            for ( int32_t i = 0; i < numCharacters; i++ )
+            {
+                auto pTaskSystem = taskSystems.emplace_back( EE::New<TaskSystem>( pSkeleton ) );
+                pTaskSystem->ReservePoseBuffers( g_wideBlendTreeWidth + 1, 0 );
+                pTaskSystem->EnableSerialization( typeRegistry );
+            }
+
+            auto UpdateCharacters = [&] ( int32_t sampleIdx, int32_t width )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    TaskSystem* pTaskSystem = taskSystems[i];
+                    pTaskSystem->Reset();
+                    RegisterWideBlendTree( *pTaskSystem, clips, width, GetSampleTime( sampleIdx + i ) );
+                    pTaskSystem->UpdatePrePhysics( 1.0f / 30.0f, Transform::Identity, Transform::Identity );
+                    pTaskSystem->UpdatePostPhysics();
+                }
+            };
+
+            auto GetNumPoseBufferAllocations = [&] ()
+            {
+                int32_t numAllocations = 0;
+                for ( auto pTaskSystem : taskSystems )
+                {
+                    numAllocations += pTaskSystem->GetNumPoseBufferAllocationsSinceReset();
+                }
+                return numAllocations;
+            };
+
+            // Execution
+            //-------------------------------------------------------------------------
+            // The pose buffer allocation count is reset at the start of each update, so we need to accumulate it per sample
+
+            int32_t numPoseBufferAllocations = 0;
+            auto UpdateAndRecordAllocations = [&] ( int32_t sampleIdx )
+            {
+                UpdateCharacters( sampleIdx, g_wideBlendTreeWidth );
+                numPoseBufferAllocations += GetNumPoseBufferAllocations();
+            };
+
+            for ( auto pTaskSystem : taskSystems )
+            {
+                pTaskSystem->DisableParallelExecution();
+            }
+
+            numPoseBufferAllocations = 0;
+            BenchmarkResult& serialResult = results.emplace_back( Measure( "TaskSystem::ExecuteTasks (Wide Blend Tree, Serial)", numBones, numCharacters, UpdateAndRecordAllocations ) );
+            serialResult.m_numPoseBufferAllocations = numPoseBufferAllocations;
+
+            for ( auto pTaskSystem : taskSystems )
+            {
+                pTaskSystem->EnableParallelExecution( &taskScheduler );
+            }
+
+            numPoseBufferAllocations = 0;
+            BenchmarkResult& parallelResult = results.emplace_back( Measure( "TaskSystem::ExecuteTasks (Wide Blend Tree, Parallel)", numBones, numCharacters, UpdateAndRecordAllocations ) );
+            parallelResult.m_numPoseBufferAllocations = numPoseBufferAllocations;
+
+            for ( auto pTaskSystem : taskSystems )
+            {
+                pTaskSystem->DisableParallelExecution();
+            }
+
+            // Serialization
+            //-------------------------------------------------------------------------
+
+            TInlineVector<ResourceLUT const*, 10> LUTs;
+            LUTs.emplace_back( &clipLUT );
+
+            UpdateCharacters( 0, g_serializedBlendTreeWidth );
+
+            TVector<Blob> serializedTasks;
+            serializedTasks.resize( numCharacters );
+
+            results.emplace_back( Measure( "TaskSystem::SerializeTasks", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    serializedTasks[i].clear();
+                    bool const wasSerialized = taskSystems[i]->SerializeTasks( LUTs, serializedTasks[i] );
+                    EE_ASSERT( wasSerialized );
+                }
+            } ) );
+
+            results.emplace_back( Measure( "TaskSystem::DeserializeTasks", numBones, numCharacters, [&] ( int32_t sampleIdx )
+            {
+                for ( int32_t i = 0; i < numCharacters; i++ )
+                {
+                    taskSystems[i]->Reset();
+                    taskSystems[i]->DeserializeTasks( LUTs, serializedTasks[i] );
+                }
+            } ) );
+
+            //-------------------------------------------------------------------------
+
+            for ( auto& pTaskSystem : taskSystems )
+            {
+                EE::Delete( pTaskSystem );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Run( TypeSystem::TypeRegistry const& typeRegistry, char const* pOutputFilePath )
+    {
+        EE::TaskSystem taskScheduler;
+        taskScheduler.Initialize();
+
+        TVector<BenchmarkResult> results;
+
+        {
+            SyntheticDataSet dataSet( typeRegistry );
+
+            for ( int32_t numBones : g_boneCounts )
+            {
+                Skeleton const* pSkeleton = dataSet.CreateSkeleton( numBones );
+
+                TInlineVector<AnimationClip const*, 5> clips;
+                for ( int32_t clipIdx = 0; clipIdx < g_numClipsPerSkeleton; clipIdx++ )
+                {
+                    clips.emplace_back( dataSet.CreateClip( pSkeleton, clipIdx, false ) );
+                }
+
+                AnimationClip const* pAdditiveClip = dataSet.CreateClip( pSkeleton, 0, true );
+
+                //-------------------------------------------------------------------------
+
+                for ( int32_t numCharacters : g_characterCounts )
+                {
+                    std::cout << "Running animation benchmarks: " << numBones << " bones, " << numCharacters << " characters" << std::endl;
+                    RunPoseBenchmarks( results, pSkeleton, clips, pAdditiveClip, numCharacters );
+                    RunTaskSystemBenchmarks( results, typeRegistry, taskScheduler, dataSet.GetClipLUT(), pSkeleton, clips, numCharacters );
+                }
+            }
+        }
+
+        uint32_t const numWorkers = taskScheduler.GetNumWorkers();
+        taskScheduler.Shutdown();
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        Serialization::JsonArchiveWriter archive;
+        WriteResults( *archive.GetWriter(), results, numWorkers );
+        return Benchmarking::ReportResults( archive, pOutputFilePath );
+    }
+}
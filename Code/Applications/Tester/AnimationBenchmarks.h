@@ -0,0 +1,18 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem { class TypeRegistry; }
+
+//-------------------------------------------------------------------------
+// Animation Micro-Benchmarks
+//-------------------------------------------------------------------------
+// Headless benchmarks for the core animation runtime (no asset pipeline, no GPU)
+// Synthetic skeletons, clips and bone masks are generated in memory and loaded through the runtime resource loaders
+// Results are reported as JSON (to stdout and optionally to a file) so they can be compared across runs
+
+namespace EE::Animation::Benchmarks
+{
+    // Run all benchmarks, returns false if we failed to write the results file
+    bool Run( TypeSystem::TypeRegistry const& typeRegistry, char const* pOutputFilePath = nullptr );
+}
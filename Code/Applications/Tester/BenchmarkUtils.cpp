@@ -0,0 +1,87 @@
+#include "BenchmarkUtils.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Types/String.h"
+#include "EASTL/sort.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmarking
+{
+    double GetPercentile( TVector<double> const& sortedSamples, float percentile )
+    {
+        EE_ASSERT( !sortedSamples.empty() && percentile >= 0.0f && percentile <= 1.0f );
+        return sortedSamples[Math::Min( (int32_t) sortedSamples.size() - 1, (int32_t) ( percentile * sortedSamples.size() ) )];
+    }
+
+    SampleStatistics CalculateStatistics( TVector<double>& samples )
+    {
+        SampleStatistics statistics;
+        statistics.m_numSamples = (int32_t) samples.size();
+        if ( samples.empty() )
+        {
+            return statistics;
+        }
+
+        double total = 0;
+        for ( double sample : samples )
+        {
+            total += sample;
+        }
+        statistics.m_mean = total / samples.size();
+
+        eastl::sort( samples.begin(), samples.end() );
+        statistics.m_p50 = GetPercentile( samples, 0.50f );
+        statistics.m_p90 = GetPercentile( samples, 0.90f );
+        statistics.m_p99 = GetPercentile( samples, 0.99f );
+        return statistics;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void WriteStatistics( Serialization::JsonWriter& writer, char const* pKeyPrefix, SampleStatistics const& statistics )
+    {
+        EE_ASSERT( pKeyPrefix != nullptr );
+
+        auto WriteValue = [&] ( char const* pKeySuffix, double value )
+        {
+            InlineString const key( InlineString::CtorSprintf(), "%s%s", pKeyPrefix, pKeySuffix );
+            writer.Key( key.c_str() );
+            writer.Double( value );
+        };
+
+        WriteValue( "MeanNs", statistics.m_mean );
+        WriteValue( "P50Ns", statistics.m_p50 );
+        WriteValue( "P90Ns", statistics.m_p90 );
+        WriteValue( "P99Ns", statistics.m_p99 );
+    }
+
+    void WriteAllocationsPerSample( Serialization::JsonWriter& writer, double allocationsPerSample )
+    {
+        writer.Key( "AllocationsPerSample" );
+        if ( allocationsPerSample >= 0 )
+        {
+            writer.Double( allocationsPerSample );
+        }
+        else
+        {
+            writer.Null();
+        }
+    }
+
+    bool ReportResults( Serialization::JsonArchiveWriter& archive, char const* pOutputFilePath )
+    {
+        std::cout << archive.GetStringBuffer().GetString() << std::endl;
+
+        if ( pOutputFilePath != nullptr )
+        {
+            if ( !archive.WriteToFile( FileSystem::Path( pOutputFilePath ) ) )
+            {
+                std::cout << "Failed to write benchmark results to: " << pOutputFilePath << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Base/Types/Arrays.h"
+#include "Base/Time/Time.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Serialization/JsonSerialization.h"
+
+//-------------------------------------------------------------------------
+// Benchmark Utilities
+//-------------------------------------------------------------------------
+// Shared measurement and reporting helpers for all the tester benchmarks
+// All timings are recorded in nanoseconds, results are reported as JSON so they can be compared across runs
+
+namespace EE::Benchmarking
+{
+    // The timing statistics (in nanoseconds) for a set of samples
+    struct SampleStatistics
+    {
+        int32_t                                     m_numSamples = 0;
+        double                                      m_mean = 0;
+        double                                      m_p50 = 0;
+        double                                      m_p90 = 0;
+        double                                      m_p99 = 0;
+    };
+
+    // Get the specified percentile (0-1) from a sorted set of samples
+    double GetPercentile( TVector<double> const& sortedSamples, float percentile );
+
+    // Calculate the statistics for a set of samples, this will sort the samples
+    SampleStatistics CalculateStatistics( TVector<double>& samples );
+
+    // Time a single call of the supplied function
+    template<typename Function>
+    inline double TimeNanoseconds( Function&& function )
+    {
+        Nanoseconds const startTime = PlatformClock::GetTime();
+        function();
+        Nanoseconds const endTime = PlatformClock::GetTime();
+        return double( endTime.ToU64() - startTime.ToU64() );
+    }
+
+    // Counts the heap allocations made on the current thread, only available with development tools enabled
+    class AllocationCounter
+    {
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        AllocationCounter() : m_numAllocationsAtStart( Memory::GetNumAllocationsOnCurrentThread() ) {}
+        inline double GetAllocationsPerSample( int32_t numSamples ) const { return double( Memory::GetNumAllocationsOnCurrentThread() - m_numAllocationsAtStart ) / numSamples; }
+        #else
+        inline double GetAllocationsPerSample( int32_t numSamples ) const { return -1; }
+        #endif
+
+    private:
+
+        #if EE_DEVELOPMENT_TOOLS
+        uint64_t                                    m_numAllocationsAtStart = 0;
+        #endif
+    };
+
+    // Run the supplied function for the specified number of untimed warm-up runs and then time the specified number of samples
+    // The function is passed the index of the run, the allocations are only counted for the timed samples
+    template<typename Function>
+    inline SampleStatistics Measure( int32_t numWarmupRuns, int32_t numSamples, Function&& function, double* pOutAllocationsPerSample = nullptr )
+    {
+        for ( int32_t i = 0; i < numWarmupRuns; i++ )
+        {
+            function( i );
+        }
+
+        TVector<double> samples;
+        samples.reserve( numSamples );
+
+        AllocationCounter const allocationCounter;
+        for ( int32_t i = 0; i < numSamples; i++ )
+        {
+            samples.emplace_back( TimeNanoseconds( [&function, i] () { function( i ); } ) );
+        }
+
+        if ( pOutAllocationsPerSample != nullptr )
+        {
+            *pOutAllocationsPerSample = allocationCounter.GetAllocationsPerSample( numSamples );
+        }
+
+        return CalculateStatistics( samples );
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Write the statistics as '<prefix>MeanNs', '<prefix>P50Ns', '<prefix>P90Ns' and '<prefix>P99Ns' keys into the current JSON object
+    void WriteStatistics( Serialization::JsonWriter& writer, char const* pKeyPrefix, SampleStatistics const& statistics );
+
+    // Write the 'AllocationsPerSample' key into the current JSON object, this is null if allocation tracking is not available (negative count)
+    void WriteAllocationsPerSample( Serialization::JsonWriter& writer, double allocationsPerSample );
+
+    // Print the results to stdout and optionally write them to a file, returns false if we failed to write the results file
+    bool ReportResults( Serialization::JsonArchiveWriter& archive, char const* pOutputFilePath );
+}
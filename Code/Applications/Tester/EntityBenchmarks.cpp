@@ -0,0 +1,229 @@
+#include "EntityBenchmarks.h"
+#include "BenchmarkUtils.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "Engine/Entity/EntitySerialization.h"
+#include "Engine/Volumes/Components/Component_Volumes.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Engine/AI/Components/Component_AISpawn.h"
+#include "Engine/Animation/Systems/EntitySystem_Animation.h"
+#include "Base/TypeSystem/TypeInstancePool.h"
+#include "Base/Threading/TaskSystem.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel::Benchmarks
+{
+    namespace
+    {
+        static int32_t const g_entityCounts[] = { 16, 256, 4096 };
+
+        static int32_t const g_numWarmupRuns = 3;
+        static int32_t const g_numSamples = 50;
+    }
+
+    //-------------------------------------------------------------------------
+    // Synthetic Data
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Each entity has a small spatial hierarchy, a regular component and a system (a typical gameplay entity)
+        // The components have a few property overrides (a core type and a resource ptr) so that we also measure property setting
+        void CreateEntityCollection( TypeSystem::TypeRegistry const& typeRegistry, int32_t numEntities, SerializedEntityCollection& outCollection )
+        {
+            StringID const rootComponentName( "Root" );
+
+            TypeSystem::PropertyInfo const* pTransformPropertyInfo = typeRegistry.GetTypeInfo( SpatialEntityComponent::GetStaticTypeID() )->GetPropertyInfo( StringID( "m_transform" ) );
+            TypeSystem::PropertyInfo const* pEntityDescPropertyInfo = typeRegistry.GetTypeInfo( AI::AISpawnComponent::GetStaticTypeID() )->GetPropertyInfo( StringID( "m_AIEntityDesc" ) );
+            EE_ASSERT( pTransformPropertyInfo != nullptr && pEntityDescPropertyInfo != nullptr );
+
+            TypeSystem::PropertyDescriptor const transformProperty( typeRegistry, TypeSystem::PropertyPath( "m_transform" ), *pTransformPropertyInfo, "0,90,0,1,2,3,1" );
+            TypeSystem::PropertyDescriptor const entityDescProperty( typeRegistry, TypeSystem::PropertyPath( "m_AIEntityDesc" ), *pEntityDescPropertyInfo, "data://Benchmarks/AI.ec" );
+
+            TVector<SerializedEntityDescriptor> entityDescriptors;
+            entityDescriptors.resize( numEntities );
+
+            for ( int32_t entityIdx = 0; entityIdx < numEntities; entityIdx++ )
+            {
+                SerializedEntityDescriptor& entityDesc = entityDescriptors[entityIdx];
+                entityDesc.m_name = StringID( String( String::CtorSprintf(), "Entity_%d", entityIdx ).c_str() );
+
+                SerializedComponentDescriptor& rootComponentDesc = entityDesc.m_components.emplace_back();
+                rootComponentDesc.m_typeID = BoxVolumeComponent::GetStaticTypeID();
+                rootComponentDesc.m_name = rootComponentName;
+                rootComponentDesc.m_isSpatialComponent = true;
+                rootComponentDesc.m_properties.emplace_back( transformProperty );
+
+                SerializedComponentDescriptor& childComponentDesc = entityDesc.m_components.emplace_back();
+                childComponentDesc.m_typeID = AI::AISpawnComponent::GetStaticTypeID();
+                childComponentDesc.m_name = StringID( "Spawn" );
+                childComponentDesc.m_spatialParentName = rootComponentName;
+                childComponentDesc.m_isSpatialComponent = true;
+                childComponentDesc.m_properties.emplace_back( transformProperty );
+                childComponentDesc.m_properties.emplace_back( entityDescProperty );
+
+                SerializedComponentDescriptor& componentDesc = entityDesc.m_components.emplace_back();
+                componentDesc.m_typeID = AI::AIComponent::GetStaticTypeID();
+                componentDesc.m_name = StringID( "AI" );
+
+                entityDesc.m_numSpatialComponents = 2;
+                entityDesc.m_systems.emplace_back().m_typeID = Animation::AnimationSystem::GetStaticTypeID();
+            }
+
+            outCollection.SetCollectionData( eastl::move( entityDescriptors ) );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Measurement
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BenchmarkResult
+        {
+            String                                  m_name;
+            int32_t                                 m_numEntities = 0;
+            Benchmarking::SampleStatistics          m_spawn; // Per sample (i.e. for the whole collection)
+            Benchmarking::SampleStatistics          m_despawn;
+            double                                  m_allocationsPerSample = -1; // Only available with development tools enabled
+        };
+
+        // Spawn and despawn the whole collection repeatedly, pooled runs reuse the pool so we measure the steady state (i.e. after the first spawn)
+        BenchmarkResult Measure( char const* pName, TypeSystem::TypeRegistry const& typeRegistry, TaskSystem* pTaskSystem, SerializedEntityCollection const& collection, TypeSystem::TypeInstancePool* pInstancePool )
+        {
+            auto Spawn = [&] () { return Serializer::CreateEntities( pTaskSystem, typeRegistry, collection, pInstancePool ); };
+
+            auto Despawn = [pInstancePool] ( TVector<Entity*>& entities )
+            {
+                for ( Entity*& pEntity : entities )
+                {
+                    TypeSystem::TypeInstancePool::DestroyInstance( pInstancePool, pEntity );
+                }
+            };
+
+            for ( int32_t i = 0; i < g_numWarmupRuns; i++ )
+            {
+                TVector<Entity*> entities = Spawn();
+                Despawn( entities );
+            }
+
+            //-------------------------------------------------------------------------
+
+            TVector<double> spawnSamples;
+            TVector<double> despawnSamples;
+            spawnSamples.reserve( g_numSamples );
+            despawnSamples.reserve( g_numSamples );
+
+            Benchmarking::AllocationCounter const allocationCounter;
+            for ( int32_t i = 0; i < g_numSamples; i++ )
+            {
+                TVector<Entity*> entities;
+                spawnSamples.emplace_back( Benchmarking::TimeNanoseconds( [&] () { entities = Spawn(); } ) );
+                despawnSamples.emplace_back( Benchmarking::TimeNanoseconds( [&] () { Despawn( entities ); } ) );
+            }
+
+            //-------------------------------------------------------------------------
+
+            BenchmarkResult result;
+            result.m_name = pName;
+            result.m_numEntities = collection.GetNumEntityDescriptors();
+            result.m_allocationsPerSample = allocationCounter.GetAllocationsPerSample( g_numSamples );
+            result.m_spawn = Benchmarking::CalculateStatistics( spawnSamples );
+            result.m_despawn = Benchmarking::CalculateStatistics( despawnSamples );
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        void WriteResults( Serialization::JsonWriter& writer, TVector<BenchmarkResult> const& results, uint32_t numWorkers )
+        {
+            writer.StartObject();
+
+            writer.Key( "NumWorkerThreads" );
+            writer.Uint( numWorkers );
+
+            writer.Key( "NumSamples" );
+            writer.Int( g_numSamples );
+
+            writer.Key( "Benchmarks" );
+            writer.StartArray();
+            for ( BenchmarkResult const& result : results )
+            {
+                writer.StartObject();
+                writer.Key( "Name" );
+                writer.String( result.m_name.c_str() );
+                writer.Key( "NumEntities" );
+                writer.Int( result.m_numEntities );
+                Benchmarking::WriteStatistics( writer, "Spawn", result.m_spawn );
+                Benchmarking::WriteStatistics( writer, "Despawn", result.m_despawn );
+                writer.Key( "SpawnedEntitiesPerSecond" );
+                writer.Double( result.m_numEntities / ( result.m_spawn.m_p50 * 1e-9 ) );
+                writer.Key( "DespawnedEntitiesPerSecond" );
+                writer.Double( result.m_numEntities / ( result.m_despawn.m_p50 * 1e-9 ) );
+                Benchmarking::WriteAllocationsPerSample( writer, result.m_allocationsPerSample );
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Run( TypeSystem::TypeRegistry const& typeRegistry, char const* pOutputFilePath )
+    {
+        EE::TaskSystem taskScheduler;
+        taskScheduler.Initialize();
+
+        TVector<BenchmarkResult> results;
+
+        for ( int32_t numEntities : g_entityCounts )
+        {
+            std::cout << "Running entity benchmarks: " << numEntities << " entities" << std::endl;
+
+            SerializedEntityCollection collection;
+            CreateEntityCollection( typeRegistry, numEntities, collection );
+
+            results.emplace_back( Measure( "Spawn/Despawn (Heap, Serial)", typeRegistry, nullptr, collection, nullptr ) );
+            results.emplace_back( Measure( "Spawn/Despawn (Heap, Parallel)", typeRegistry, &taskScheduler, collection, nullptr ) );
+
+            {
+                TypeSystem::TypeInstancePool instancePool;
+                results.emplace_back( Measure( "Spawn/Despawn (Pooled, Serial)", typeRegistry, nullptr, collection, &instancePool ) );
+            }
+
+            {
+                TypeSystem::TypeInstancePool instancePool;
+                results.emplace_back( Measure( "Spawn/Despawn (Pooled, Parallel)", typeRegistry, &taskScheduler, collection, &instancePool ) );
+            }
+
+            // Compiled property setters (this is what the resource loader does for collections loaded from disk)
+            collection.CompilePropertySetters( typeRegistry );
+            results.emplace_back( Measure( "Spawn/Despawn (Heap, Serial, Compiled)", typeRegistry, nullptr, collection, nullptr ) );
+
+            {
+                TypeSystem::TypeInstancePool instancePool;
+                results.emplace_back( Measure( "Spawn/Despawn (Pooled, Serial, Compiled)", typeRegistry, nullptr, collection, &instancePool ) );
+            }
+
+            {
+                TypeSystem::TypeInstancePool instancePool;
+                results.emplace_back( Measure( "Spawn/Despawn (Pooled, Parallel, Compiled)", typeRegistry, &taskScheduler, collection, &instancePool ) );
+            }
+        }
+
+        uint32_t const numWorkers = taskScheduler.GetNumWorkers();
+        taskScheduler.Shutdown();
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        Serialization::JsonArchiveWriter archive;
+        WriteResults( *archive.GetWriter(), results, numWorkers );
+        return Benchmarking::ReportResults( archive, pOutputFilePath );
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem { class TypeRegistry; }
+
+//-------------------------------------------------------------------------
+// Entity Micro-Benchmarks
+//-------------------------------------------------------------------------
+// Headless benchmarks for entity spawning and despawning (no resources, no world)
+// Synthetic entity collections are instantiated and destroyed both via the general heap and via a type instance pool, with and without compiled property setters
+// Results are reported as JSON (to stdout and optionally to a file) so they can be compared across runs
+
+namespace EE::EntityModel::Benchmarks
+{
+    // Run all benchmarks, returns false if we failed to write the results file
+    bool Run( TypeSystem::TypeRegistry const& typeRegistry, char const* pOutputFilePath = nullptr );
+}
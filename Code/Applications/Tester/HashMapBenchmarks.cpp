@@ -0,0 +1,226 @@
+#include "HashMapBenchmarks.h"
+#include "BenchmarkUtils.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Types/FlatHashMap.h"
+#include "Base/Types/StringID.h"
+#include "Base/Types/UUID.h"
+#include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Resource/ResourceID.h"
+#include "Base/Math/MathRandom.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::HashMapBenchmarks
+{
+    namespace
+    {
+        static int32_t const g_mapSizes[] = { 64, 1024, 32768 };
+
+        static int32_t const g_numLookupPasses = 16;
+        static int32_t const g_numSamples = 10;
+    }
+
+    //-------------------------------------------------------------------------
+    // Measurement
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BenchmarkResult
+        {
+            String                                  m_name;
+            String                                  m_keyType;
+            String                                  m_mapType;
+            int32_t                                 m_mapSize = 0;
+            int64_t                                 m_numOperations = 0;    // Per sample
+            Benchmarking::SampleStatistics          m_timing;               // Per sample
+        };
+
+        BenchmarkResult MakeResult( char const* pName, char const* pKeyType, char const* pMapType, int32_t mapSize, int64_t numOperations, TVector<double>& samples )
+        {
+            BenchmarkResult result;
+            result.m_name = pName;
+            result.m_keyType = pKeyType;
+            result.m_mapType = pMapType;
+            result.m_mapSize = mapSize;
+            result.m_numOperations = numOperations;
+            result.m_timing = Benchmarking::CalculateStatistics( samples );
+            return result;
+        }
+
+        // Lookups are done in a shuffled order so that we dont just walk the memory linearly
+        TVector<int32_t> CreateLookupOrder( int32_t numKeys )
+        {
+            TVector<int32_t> order;
+            order.resize( numKeys );
+            for ( int32_t i = 0; i < numKeys; i++ )
+            {
+                order[i] = i;
+            }
+
+            Math::RNG const rng( 1234 );
+            for ( int32_t i = numKeys - 1; i > 0; i-- )
+            {
+                eastl::swap( order[i], order[rng.GetUInt( 0, i )] );
+            }
+
+            return order;
+        }
+
+        // 'keys' contains twice the map size: the first half is inserted, the second half is only used for failed lookups
+        template<typename Map, typename Key>
+        void MeasureMap( TVector<BenchmarkResult>& results, char const* pKeyType, char const* pMapType, TVector<Key> const& keys, int32_t mapSize )
+        {
+            TVector<int32_t> const lookupOrder = CreateLookupOrder( mapSize );
+            TVector<double> insertSamples, lookupSamples, missSamples, eraseSamples;
+            uint64_t checksum = 0;
+
+            for ( int32_t sampleIdx = 0; sampleIdx < g_numSamples; sampleIdx++ )
+            {
+                Map map;
+
+                // Insert
+                //-------------------------------------------------------------------------
+
+                insertSamples.emplace_back( Benchmarking::TimeNanoseconds( [&] ()
+                {
+                    for ( int32_t i = 0; i < mapSize; i++ )
+                    {
+                        map.insert( TPair<Key, int32_t>( keys[i], i ) );
+                    }
+                } ) );
+
+                // Successful Lookups
+                //-------------------------------------------------------------------------
+
+                lookupSamples.emplace_back( Benchmarking::TimeNanoseconds( [&] ()
+                {
+                    for ( int32_t passIdx = 0; passIdx < g_numLookupPasses; passIdx++ )
+                    {
+                        for ( int32_t keyIdx : lookupOrder )
+                        {
+                            checksum += map.find( keys[keyIdx] )->second;
+                        }
+                    }
+                } ) );
+
+                // Failed Lookups
+                //-------------------------------------------------------------------------
+
+                missSamples.emplace_back( Benchmarking::TimeNanoseconds( [&] ()
+                {
+                    for ( int32_t passIdx = 0; passIdx < g_numLookupPasses; passIdx++ )
+                    {
+                        for ( int32_t keyIdx : lookupOrder )
+                        {
+                            checksum += ( map.find( keys[mapSize + keyIdx] ) == map.end() ) ? 1 : 0;
+                        }
+                    }
+                } ) );
+
+                // Erase
+                //-------------------------------------------------------------------------
+
+                eraseSamples.emplace_back( Benchmarking::TimeNanoseconds( [&] ()
+                {
+                    for ( int32_t keyIdx : lookupOrder )
+                    {
+                        map.erase( keys[keyIdx] );
+                    }
+                } ) );
+
+                EE_ASSERT( map.empty() );
+            }
+
+            EE_ASSERT( checksum != 0xFFFFFFFFFFFFFFFF ); // Keep the work from being optimized out
+
+            int64_t const numLookups = (int64_t) mapSize * g_numLookupPasses;
+            results.emplace_back( MakeResult( "Insert", pKeyType, pMapType, mapSize, mapSize, insertSamples ) );
+            results.emplace_back( MakeResult( "Lookup", pKeyType, pMapType, mapSize, numLookups, lookupSamples ) );
+            results.emplace_back( MakeResult( "LookupMiss", pKeyType, pMapType, mapSize, numLookups, missSamples ) );
+            results.emplace_back( MakeResult( "Erase", pKeyType, pMapType, mapSize, mapSize, eraseSamples ) );
+        }
+
+        template<typename Key>
+        void MeasureKeyType( TVector<BenchmarkResult>& results, char const* pKeyType, TVector<Key> const& keys, int32_t mapSize )
+        {
+            std::cout << "Running hash map benchmarks: " << pKeyType << " - " << mapSize << " elements" << std::endl;
+            MeasureMap<THashMap<Key, int32_t>>( results, pKeyType, "THashMap", keys, mapSize );
+            MeasureMap<TFlatHashMap<Key, int32_t>>( results, pKeyType, "TFlatHashMap", keys, mapSize );
+        }
+
+        //-------------------------------------------------------------------------
+
+        void WriteResults( Serialization::JsonWriter& writer, TVector<BenchmarkResult> const& results )
+        {
+            writer.StartObject();
+
+            writer.Key( "NumSamples" );
+            writer.Int( g_numSamples );
+
+            writer.Key( "Benchmarks" );
+            writer.StartArray();
+            for ( BenchmarkResult const& result : results )
+            {
+                writer.StartObject();
+                writer.Key( "Name" );
+                writer.String( result.m_name.c_str() );
+                writer.Key( "KeyType" );
+                writer.String( result.m_keyType.c_str() );
+                writer.Key( "MapType" );
+                writer.String( result.m_mapType.c_str() );
+                writer.Key( "MapSize" );
+                writer.Int( result.m_mapSize );
+                writer.Key( "NumOperations" );
+                writer.Int64( result.m_numOperations );
+                Benchmarking::WriteStatistics( writer, "", result.m_timing );
+                writer.Key( "NsPerOperation" );
+                writer.Double( result.m_timing.m_p50 / result.m_numOperations );
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Run( char const* pOutputFilePath )
+    {
+        TVector<BenchmarkResult> results;
+
+        for ( int32_t mapSize : g_mapSizes )
+        {
+            // Generate all the keys up front so we only measure the maps
+            TVector<StringID> stringIDs;
+            TVector<UUID> UUIDs;
+            TVector<ResourceID> resourceIDs;
+
+            int32_t const numKeys = mapSize * 2;
+            stringIDs.reserve( numKeys );
+            UUIDs.reserve( numKeys );
+            resourceIDs.reserve( numKeys );
+
+            for ( int32_t i = 0; i < numKeys; i++ )
+            {
+                stringIDs.emplace_back( StringID( String( String::CtorSprintf(), "Bench_HashMap_%d", i ).c_str() ) );
+                UUIDs.emplace_back( UUID::GenerateID() );
+                resourceIDs.emplace_back( ResourceID( String( String::CtorSprintf(), "data://Benchmarks/HashMap_%d.bnch", i ) ) );
+            }
+
+            MeasureKeyType( results, "StringID", stringIDs, mapSize );
+            MeasureKeyType( results, "UUID", UUIDs, mapSize );
+            MeasureKeyType( results, "ResourceID", resourceIDs, mapSize );
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        Serialization::JsonArchiveWriter archive;
+        WriteResults( *archive.GetWriter(), results );
+        return Benchmarking::ReportResults( archive, pOutputFilePath );
+    }
+}
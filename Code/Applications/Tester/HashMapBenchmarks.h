@@ -0,0 +1,14 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+// Hash Map Micro-Benchmarks
+//-------------------------------------------------------------------------
+// Compares THashMap (node based) against TFlatHashMap (open addressing) for the key types used on our hot lookup paths
+// Each map is measured for inserts, successful lookups, failed lookups and erases at a few different sizes
+// Results are reported as JSON (to stdout and optionally to a file) so they can be compared across runs
+
+namespace EE::HashMapBenchmarks
+{
+    // Run all benchmarks, returns false if we failed to write the results file
+    bool Run( char const* pOutputFilePath = nullptr );
+}
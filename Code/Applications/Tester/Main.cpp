@@ -1,9 +1,16 @@
+#include "AnimationBenchmarks.h"
+#include "EntityBenchmarks.h"
+#include "HashMapBenchmarks.h"
+#include "ResourceBenchmarks.h"
+#include "SerializationBenchmarks.h"
+#include "StringIDBenchmarks.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Application/ApplicationGlobalState.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/Math/NumericRange.h"
 #include "Base/Types/Event.h"
+#include "Base/ThirdParty/cmdParser/cmdParser.h"
 
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 
@@ -95,6 +102,37 @@ struct Wah : public Bar
     StringID id;
 };
 
+//-------------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------------
+
+namespace
+{
+    struct BenchmarkArguments
+    {
+        TypeSystem::TypeRegistry const&     m_typeRegistry;
+        char const*                         m_pOutputFilePath = nullptr;
+        char const*                         m_pCompiledResourcePath = nullptr;
+    };
+
+    struct BenchmarkCommand
+    {
+        char const*                         m_pFlag = nullptr;
+        char const*                         m_pDescription = nullptr;
+        bool                                ( *m_pRunFunction )( BenchmarkArguments const& arguments ) = nullptr;
+    };
+
+    static BenchmarkCommand const g_benchmarkCommands[] =
+    {
+        { "animbench", "Run the animation micro-benchmarks.", [] ( BenchmarkArguments const& args ) { return Animation::Benchmarks::Run( args.m_typeRegistry, args.m_pOutputFilePath ); } },
+        { "entitybench", "Run the entity spawn/despawn micro-benchmarks.", [] ( BenchmarkArguments const& args ) { return EntityModel::Benchmarks::Run( args.m_typeRegistry, args.m_pOutputFilePath ); } },
+        { "stringidbench", "Run the StringID contention micro-benchmarks.", [] ( BenchmarkArguments const& args ) { return StringIDBenchmarks::Run( args.m_pOutputFilePath ); } },
+        { "resourcebench", "Run the resource loading benchmarks.", [] ( BenchmarkArguments const& args ) { return Resource::Benchmarks::Run( args.m_pOutputFilePath ); } },
+        { "hashmapbench", "Run the hash map micro-benchmarks.", [] ( BenchmarkArguments const& args ) { return HashMapBenchmarks::Run( args.m_pOutputFilePath ); } },
+        { "serializationbench", "Run the binary serialization format benchmarks (requires compiled resources).", [] ( BenchmarkArguments const& args ) { return args.m_pCompiledResourcePath != nullptr && Serialization::Benchmarks::Run( args.m_pCompiledResourcePath, args.m_pOutputFilePath ); } },
+    };
+}
+
 //-------------------------------------------------------------------------
 
 int main( int argc, char *argv[] )
@@ -104,6 +142,34 @@ int main( int argc, char *argv[] )
         TypeSystem::TypeRegistry typeRegistry;
         AutoGenerated::Tools::RegisterTypes( typeRegistry );
 
+        // Benchmarks
+        //-------------------------------------------------------------------------
+
+        cli::Parser cmdParser( argc, argv );
+        for ( BenchmarkCommand const& command : g_benchmarkCommands )
+        {
+            cmdParser.set_optional<bool>( command.m_pFlag, command.m_pFlag, false, command.m_pDescription );
+        }
+        cmdParser.set_optional<std::string>( "resources", "resources", "", "The compiled resource directory to use for the serialization benchmarks." );
+        cmdParser.set_optional<std::string>( "out", "out", "", "The file to write the benchmark results to." );
+
+        if ( cmdParser.run() )
+        {
+            std::string const outputFilePath = cmdParser.get<std::string>( "out" );
+            std::string const compiledResourcePath = cmdParser.get<std::string>( "resources" );
+
+            BenchmarkArguments const arguments = { typeRegistry, outputFilePath.empty() ? nullptr : outputFilePath.c_str(), compiledResourcePath.empty() ? nullptr : compiledResourcePath.c_str() };
+            for ( BenchmarkCommand const& command : g_benchmarkCommands )
+            {
+                if ( cmdParser.get<bool>( command.m_pFlag ) )
+                {
+                    bool const result = command.m_pRunFunction( arguments );
+                    AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                    return result ? 0 : 1;
+                }
+            }
+        }
+
         //-------------------------------------------------------------------------
 
         Vector v;
@@ -0,0 +1,429 @@
+#include "ResourceBenchmarks.h"
+#include "BenchmarkUtils.h"
+#include "Base/Resource/ResourceSystem.h"
+#include "Base/Resource/ResourceProvider.h"
+#include "Base/Resource/ResourceRequest.h"
+#include "Base/Resource/ResourceLoader.h"
+#include "Base/Resource/ResourceHeader.h"
+#include "Base/Resource/ResourceArchive.h"
+#include "Base/Resource/ResourceProviders/ArchiveResourceProvider.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Threading/TaskSystem.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource::Benchmarks
+{
+    namespace
+    {
+        static int32_t const g_resourceCounts[] = { 256, 4096 };
+        static uint32_t const g_maxConcurrentFileReads[] = { 1, 4, 8 };
+
+        static int32_t const g_numSharedResourcesDivisor = 16; // One shared resource (install dependency) for every N resources
+        static int32_t const g_numPayloadElements = 16 * 1024;
+        static int32_t const g_numWarmupRuns = 1;
+        static int32_t const g_numSamples = 5;
+    }
+
+    //-------------------------------------------------------------------------
+    // Synthetic Data
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        class BenchmarkResource : public IResource
+        {
+            EE_RESOURCE( 'bnch', "Benchmark Resource" );
+            friend class BenchmarkResourceLoader;
+
+        public:
+
+            virtual bool IsValid() const override { return !m_payload.empty(); }
+
+        private:
+
+            TVector<float>              m_payload;
+            float                       m_checksum = 0.0f;
+        };
+
+        //-------------------------------------------------------------------------
+
+        class BenchmarkResourceLoader final : public ResourceLoader
+        {
+        public:
+
+            BenchmarkResourceLoader( bool supportsParallelLoading )
+                : m_supportsParallelLoading( supportsParallelLoading )
+            {
+                m_loadableTypes.push_back( BenchmarkResource::GetStaticResourceTypeID() );
+            }
+
+            virtual bool SupportsParallelLoading() const override { return m_supportsParallelLoading; }
+
+        private:
+
+            virtual bool LoadInternal( ResourceID const& resourceID, ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const override
+            {
+                auto pResource = EE::New<BenchmarkResource>();
+                archive << pResource->m_payload;
+
+                // Some post-load processing, so that loading isnt purely a memcpy
+                for ( float value : pResource->m_payload )
+                {
+                    pResource->m_checksum += value;
+                }
+
+                pResourceRecord->SetResourceData( pResource );
+                return true;
+            }
+
+        private:
+
+            bool                        m_supportsParallelLoading = true;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Resolves resource requests directly to the compiled files (i.e. the loose file packaged provider)
+        class BenchmarkResourceProvider final : public ResourceProvider
+        {
+        public:
+
+            using ResourceProvider::ResourceProvider;
+
+            virtual bool IsReady() const override { return true; }
+            virtual bool Initialize() override { return true; }
+
+            virtual void RequestRawResource( ResourceRequest* pRequest ) override
+            {
+                FileSystem::Path const resourceFilePath = pRequest->GetResourceID().GetResourcePath().ToFileSystemPath( m_settings.m_compiledResourcePath );
+                pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str() );
+                m_numFilesOpened++;
+            }
+
+            virtual void CancelRequest( ResourceRequest* pRequest ) override {}
+
+            inline uint32_t GetNumFilesOpened() const { return m_numFilesOpened; }
+
+        private:
+
+            uint32_t                    m_numFilesOpened = 0;
+        };
+
+        //-------------------------------------------------------------------------
+
+        inline ResourceID GetSharedResourceID( int32_t resourceIdx )
+        {
+            return ResourceID( String( String::CtorSprintf(), "data://Benchmarks/Shared_%d.bnch", resourceIdx ) );
+        }
+
+        inline ResourceID GetResourceID( int32_t resourceIdx )
+        {
+            return ResourceID( String( String::CtorSprintf(), "data://Benchmarks/Resource_%d.bnch", resourceIdx ) );
+        }
+
+        inline int32_t GetNumSharedResources( int32_t numResources )
+        {
+            return Math::Max( 1, numResources / g_numSharedResourcesDivisor );
+        }
+
+        bool WriteResourceFile( FileSystem::Path const& compiledResourcePath, ResourceID const& resourceID, TInlineVector<ResourceID, 2> const& installDependencies )
+        {
+            TVector<float> payload;
+            payload.resize( g_numPayloadElements );
+            for ( int32_t i = 0; i < g_numPayloadElements; i++ )
+            {
+                payload[i] = float( i );
+            }
+
+            ResourceHeader header( 0, BenchmarkResource::GetStaticResourceTypeID(), 0 );
+            for ( ResourceID const& dependencyID : installDependencies )
+            {
+                header.AddInstallDependency( dependencyID );
+            }
+
+            Serialization::BinaryOutputArchive archive;
+            archive << header << payload;
+            return archive.WriteToFile( resourceID.GetResourcePath().ToFileSystemPath( compiledResourcePath ) );
+        }
+
+        // Every map resource has two install dependencies on a smaller set of shared resources (i.e. the meshes/textures that are used all over the map)
+        bool CreateSyntheticMap( FileSystem::Path const& compiledResourcePath, int32_t numResources )
+        {
+            int32_t const numSharedResources = GetNumSharedResources( numResources );
+            for ( int32_t i = 0; i < numSharedResources; i++ )
+            {
+                if ( !WriteResourceFile( compiledResourcePath, GetSharedResourceID( i ), {} ) )
+                {
+                    return false;
+                }
+            }
+
+            for ( int32_t i = 0; i < numResources; i++ )
+            {
+                TInlineVector<ResourceID, 2> const installDependencies = { GetSharedResourceID( i % numSharedResources ), GetSharedResourceID( ( i + numSharedResources / 2 ) % numSharedResources ) };
+                if ( !WriteResourceFile( compiledResourcePath, GetResourceID( i ), installDependencies ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Store the whole map in an archive, in the order it is loaded (map resources followed by the shared resources)
+        bool CreateSyntheticMapArchive( FileSystem::Path const& compiledResourcePath, int32_t numResources )
+        {
+            ResourceArchiveBuilder archiveBuilder;
+
+            for ( int32_t i = 0; i < numResources; i++ )
+            {
+                ResourceID const resourceID = GetResourceID( i );
+                archiveBuilder.AddFile( resourceID.GetResourcePath(), resourceID.GetResourcePath().ToFileSystemPath( compiledResourcePath ) );
+            }
+
+            int32_t const numSharedResources = GetNumSharedResources( numResources );
+            for ( int32_t i = 0; i < numSharedResources; i++ )
+            {
+                ResourceID const resourceID = GetSharedResourceID( i );
+                archiveBuilder.AddFile( resourceID.GetResourcePath(), resourceID.GetResourcePath().ToFileSystemPath( compiledResourcePath ) );
+            }
+
+            String errorMessage;
+            if ( !archiveBuilder.Write( compiledResourcePath, "Resources", &errorMessage ) )
+            {
+                std::cout << errorMessage.c_str() << std::endl;
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Measurement
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BenchmarkResult
+        {
+            String                                  m_name;
+            int32_t                                 m_numResources = 0;     // Including the shared resources
+            uint32_t                                m_maxConcurrentFileReads = 0;
+            double                                  m_firstLoadNanoseconds = 0; // The first load with a newly created provider
+            double                                  m_filesOpenedPerLoad = 0;
+            Benchmarking::SampleStatistics          m_load; // Per sample (i.e. for the whole map)
+            Benchmarking::SampleStatistics          m_unload;
+        };
+
+        // Load and unload the whole map repeatedly, we time from the load request until every request is complete
+        // The provider needs to be newly created, since we also report the first load (this is not a true cold load since the files are in the OS file cache)
+        BenchmarkResult Measure( char const* pName, TaskSystem& taskSystem, ResourceProvider& provider, int32_t numResources, bool supportsParallelLoading, TFunction<uint32_t()> const& getNumFilesOpened )
+        {
+            BenchmarkResourceLoader loader( supportsParallelLoading );
+
+            ResourceSystem resourceSystem( taskSystem );
+            resourceSystem.Initialize( &provider );
+            resourceSystem.RegisterResourceLoader( &loader );
+
+            TVector<ResourcePtr> resourcePtrs;
+            resourcePtrs.reserve( numResources );
+            for ( int32_t i = 0; i < numResources; i++ )
+            {
+                resourcePtrs.emplace_back( GetResourceID( i ) );
+            }
+
+            auto Load = [&] ()
+            {
+                for ( ResourcePtr& resourcePtr : resourcePtrs )
+                {
+                    resourceSystem.LoadResource( resourcePtr );
+                }
+                resourceSystem.WaitForAllRequestsToComplete();
+
+                for ( ResourcePtr const& resourcePtr : resourcePtrs )
+                {
+                    EE_ASSERT( resourcePtr.IsLoaded() );
+                }
+            };
+
+            auto Unload = [&] ()
+            {
+                for ( ResourcePtr& resourcePtr : resourcePtrs )
+                {
+                    resourceSystem.UnloadResource( resourcePtr );
+                }
+                resourceSystem.WaitForAllRequestsToComplete();
+            };
+
+            double const firstLoadNanoseconds = Benchmarking::TimeNanoseconds( Load );
+            Unload();
+
+            for ( int32_t i = 0; i < g_numWarmupRuns; i++ )
+            {
+                Load();
+                Unload();
+            }
+
+            //-------------------------------------------------------------------------
+
+            TVector<double> loadSamples;
+            TVector<double> unloadSamples;
+            uint32_t const numFilesOpenedBefore = getNumFilesOpened();
+            for ( int32_t i = 0; i < g_numSamples; i++ )
+            {
+                loadSamples.emplace_back( Benchmarking::TimeNanoseconds( Load ) );
+                unloadSamples.emplace_back( Benchmarking::TimeNanoseconds( Unload ) );
+            }
+
+            uint32_t const numFilesOpened = getNumFilesOpened() - numFilesOpenedBefore;
+
+            resourceSystem.UnregisterResourceLoader( &loader );
+            resourceSystem.Shutdown();
+
+            //-------------------------------------------------------------------------
+
+            BenchmarkResult result;
+            result.m_name = pName;
+            result.m_numResources = numResources + GetNumSharedResources( numResources );
+            result.m_maxConcurrentFileReads = provider.GetSettings().m_maxConcurrentFileReads;
+            result.m_firstLoadNanoseconds = firstLoadNanoseconds;
+            result.m_filesOpenedPerLoad = double( numFilesOpened ) / g_numSamples;
+            result.m_load = Benchmarking::CalculateStatistics( loadSamples );
+            result.m_unload = Benchmarking::CalculateStatistics( unloadSamples );
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        void WriteResults( Serialization::JsonWriter& writer, TVector<BenchmarkResult> const& results, uint32_t numWorkers )
+        {
+            writer.StartObject();
+
+            writer.Key( "NumWorkerThreads" );
+            writer.Uint( numWorkers );
+
+            writer.Key( "NumSamples" );
+            writer.Int( g_numSamples );
+
+            writer.Key( "ResourceSizeBytes" );
+            writer.Int( g_numPayloadElements * (int32_t) sizeof( float ) );
+
+            writer.Key( "Benchmarks" );
+            writer.StartArray();
+            for ( BenchmarkResult const& result : results )
+            {
+                writer.StartObject();
+                writer.Key( "Name" );
+                writer.String( result.m_name.c_str() );
+                writer.Key( "NumResources" );
+                writer.Int( result.m_numResources );
+                writer.Key( "MaxConcurrentFileReads" );
+                writer.Uint( result.m_maxConcurrentFileReads );
+                writer.Key( "FirstLoadNs" );
+                writer.Double( result.m_firstLoadNanoseconds );
+                writer.Key( "FilesOpenedPerLoad" );
+                writer.Double( result.m_filesOpenedPerLoad );
+                Benchmarking::WriteStatistics( writer, "Load", result.m_load );
+                Benchmarking::WriteStatistics( writer, "Unload", result.m_unload );
+                writer.Key( "LoadedResourcesPerSecond" );
+                writer.Double( result.m_numResources / ( result.m_load.m_p50 * 1e-9 ) );
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Run( char const* pOutputFilePath )
+    {
+        FileSystem::Path compiledResourcePath = FileSystem::GetCurrentProcessPath() + "ResourceBenchmarks";
+        compiledResourcePath.MakeIntoDirectoryPath();
+
+        EE::TaskSystem taskSystem;
+        taskSystem.Initialize();
+
+        TVector<BenchmarkResult> results;
+        bool createdTestData = true;
+
+        for ( int32_t numResources : g_resourceCounts )
+        {
+            std::cout << "Running resource benchmarks: " << numResources << " resources" << std::endl;
+
+            if ( !CreateSyntheticMap( compiledResourcePath, numResources ) )
+            {
+                std::cout << "Failed to create benchmark resources in: " << compiledResourcePath.c_str() << std::endl;
+                createdTestData = false;
+                break;
+            }
+
+            if ( !CreateSyntheticMapArchive( compiledResourcePath, numResources ) )
+            {
+                std::cout << "Failed to create benchmark resource archive in: " << compiledResourcePath.c_str() << std::endl;
+                createdTestData = false;
+                break;
+            }
+
+            auto MeasureLooseFiles = [&] ( char const* pName, uint32_t maxConcurrentFileReads, bool supportsParallelLoading )
+            {
+                ResourceSettings settings;
+                settings.m_compiledResourcePath = compiledResourcePath;
+                settings.m_maxConcurrentFileReads = maxConcurrentFileReads;
+
+                BenchmarkResourceProvider provider( settings );
+                results.emplace_back( Measure( pName, taskSystem, provider, numResources, supportsParallelLoading, [&provider] () { return provider.GetNumFilesOpened(); } ) );
+            };
+
+            MeasureLooseFiles( "Load/Unload (Serial)", 1, false );
+
+            for ( uint32_t maxConcurrentFileReads : g_maxConcurrentFileReads )
+            {
+                MeasureLooseFiles( "Load/Unload (Parallel)", maxConcurrentFileReads, true );
+            }
+
+            // The archive provider maps the archives once on initialization, so only resources missing from the archives open files
+            {
+                ResourceSettings settings;
+                settings.m_compiledResourcePath = compiledResourcePath;
+
+                ArchiveResourceProvider provider( settings );
+                if ( !provider.Initialize() || provider.GetNumArchives() == 0 )
+                {
+                    std::cout << "Failed to open benchmark resource archive in: " << compiledResourcePath.c_str() << std::endl;
+                    createdTestData = false;
+                    break;
+                }
+
+                results.emplace_back( Measure( "Load/Unload (Parallel, Archive)", taskSystem, provider, numResources, true, [&provider] () { return provider.GetNumLooseFileRequests(); } ) );
+                provider.Shutdown();
+            }
+        }
+
+        uint32_t const numWorkers = taskSystem.GetNumWorkers();
+        taskSystem.Shutdown();
+
+        if ( compiledResourcePath.Exists() )
+        {
+            FileSystem::EraseDir( compiledResourcePath );
+        }
+
+        if ( !createdTestData )
+        {
+            return false;
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        Serialization::JsonArchiveWriter archive;
+        WriteResults( *archive.GetWriter(), results, numWorkers );
+        return Benchmarking::ReportResults( archive, pOutputFilePath );
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+// Resource Loading Benchmarks
+//-------------------------------------------------------------------------
+// Headless load-time benchmarks for the resource system (no engine loaders, no world)
+// A synthetic map (a large set of compiled resource files with shared install dependencies) is loaded and unloaded via the resource system
+// We compare serial loading (the loader doesnt allow parallel loads) against parallel loading with different file read limits
+// We also compare loading from loose files against loading from a resource archive (number of files opened and load times)
+// Note: the files are read repeatedly so this measures loading with a warm file cache, the first load is reported separately but the data will still be in the OS file cache
+// Results are reported as JSON (to stdout and optionally to a file) so they can be compared across runs
+
+namespace EE::Resource::Benchmarks
+{
+    // Run all benchmarks, returns false if we failed to create the test data or to write the results file
+    bool Run( char const* pOutputFilePath = nullptr );
+}
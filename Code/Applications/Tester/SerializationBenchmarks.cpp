@@ -0,0 +1,261 @@
+#include "SerializationBenchmarks.h"
+#include "BenchmarkUtils.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationSyncTrack.h"
+#include "Engine/Render/Mesh/StaticMesh.h"
+#include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "Base/Resource/ResourceHeader.h"
+#include "Base/TypeSystem/TypeDescriptors.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include <tuple>
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Serialization::Benchmarks
+{
+    namespace
+    {
+        static int32_t const g_maxFilesPerResourceType = 256;
+        static int32_t const g_numWarmupRuns = 2;
+        static int32_t const g_numSamples = 20;
+    }
+
+    //-------------------------------------------------------------------------
+    // Resource Deserialization
+    //-------------------------------------------------------------------------
+    // Each resource type is read exactly like its loader does, i.e. the header, the resource and any extra data that follows it
+
+    namespace
+    {
+        template<typename ResourceType, typename... ExtraTypes>
+        struct CompiledResourceData
+        {
+            Resource::ResourceHeader                m_header;
+            ResourceType                            m_resource;
+            std::tuple<ExtraTypes...>               m_extraData;
+
+            template<typename Archive>
+            void Serialize( Archive& archive )
+            {
+                archive << m_header << m_resource;
+                std::apply( [&archive] ( auto&... extraData ) { ( archive << ... << extraData ); }, m_extraData );
+            }
+        };
+
+        // Read the compiled data (in any format) and write it back out in the requested format
+        template<typename ResourceType, typename... ExtraTypes>
+        void Transcode( Blob const& inData, BinaryFormat format, Blob& outData )
+        {
+            CompiledResourceData<ResourceType, ExtraTypes...> data;
+
+            BinaryInputArchive inputArchive;
+            inputArchive.ReadFromBlob( inData );
+            data.Serialize( inputArchive );
+
+            BinaryOutputArchive outputArchive( format );
+            data.Serialize( outputArchive );
+            outputArchive.GetAsBinaryBlob( outData );
+        }
+
+        template<typename ResourceType, typename... ExtraTypes>
+        void Read( Blob const& inData )
+        {
+            CompiledResourceData<ResourceType, ExtraTypes...> data;
+
+            BinaryInputArchive inputArchive;
+            inputArchive.ReadFromBlob( inData );
+            data.Serialize( inputArchive );
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct ResourceTypeInfo
+        {
+            char const*                             m_pExtension;
+            void                                    ( *m_transcodeFunction )( Blob const&, BinaryFormat, Blob& );
+            void                                    ( *m_readFunction )( Blob const& );
+        };
+
+        #define EE_BENCHMARK_RESOURCE_TYPE( Extension, ... ) { Extension, &Transcode<__VA_ARGS__>, &Read<__VA_ARGS__> }
+
+        static ResourceTypeInfo const g_resourceTypes[] =
+        {
+            EE_BENCHMARK_RESOURCE_TYPE( "skel", Animation::Skeleton, TVector<Animation::BoneMaskDefinition> ),
+            EE_BENCHMARK_RESOURCE_TYPE( "anim", Animation::AnimationClip, TInlineVector<Animation::SyncTrack::EventMarker, 10>, TypeSystem::TypeDescriptorCollection ),
+            EE_BENCHMARK_RESOURCE_TYPE( "msh", Render::StaticMesh ),
+            EE_BENCHMARK_RESOURCE_TYPE( "smsh", Render::SkeletalMesh ),
+            EE_BENCHMARK_RESOURCE_TYPE( "ec", EntityModel::SerializedEntityCollection ),
+            EE_BENCHMARK_RESOURCE_TYPE( "map", EntityModel::SerializedEntityMap ),
+        };
+
+        #undef EE_BENCHMARK_RESOURCE_TYPE
+    }
+
+    //-------------------------------------------------------------------------
+    // Measurement
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BenchmarkResult
+        {
+            String                                  m_resourceType;
+            int32_t                                 m_numResources = 0;
+            size_t                                  m_messagePackBytes = 0;
+            size_t                                  m_flatBytes = 0;
+            Benchmarking::SampleStatistics          m_messagePack;          // Per sample (i.e. for all the resources of this type)
+            Benchmarking::SampleStatistics          m_flat;
+        };
+
+        // Reads all the resources once per sample, we alternate the formats so that they see the same cache and clock conditions
+        void Measure( ResourceTypeInfo const& typeInfo, TVector<Blob> const& messagePackData, TVector<Blob> const& flatData, BenchmarkResult& result )
+        {
+            auto ReadAll = [&typeInfo] ( TVector<Blob> const& data )
+            {
+                return Benchmarking::TimeNanoseconds( [&typeInfo, &data] ()
+                {
+                    for ( Blob const& resourceData : data )
+                    {
+                        typeInfo.m_readFunction( resourceData );
+                    }
+                } );
+            };
+
+            for ( int32_t i = 0; i < g_numWarmupRuns; i++ )
+            {
+                ReadAll( messagePackData );
+                ReadAll( flatData );
+            }
+
+            TVector<double> messagePackSamples;
+            TVector<double> flatSamples;
+            for ( int32_t i = 0; i < g_numSamples; i++ )
+            {
+                messagePackSamples.emplace_back( ReadAll( messagePackData ) );
+                flatSamples.emplace_back( ReadAll( flatData ) );
+            }
+
+            result.m_messagePack = Benchmarking::CalculateStatistics( messagePackSamples );
+            result.m_flat = Benchmarking::CalculateStatistics( flatSamples );
+        }
+
+        //-------------------------------------------------------------------------
+
+        void WriteResults( JsonWriter& writer, TVector<BenchmarkResult> const& results )
+        {
+            writer.StartObject();
+
+            writer.Key( "NumSamples" );
+            writer.Int( g_numSamples );
+
+            writer.Key( "Benchmarks" );
+            writer.StartArray();
+            for ( BenchmarkResult const& result : results )
+            {
+                writer.StartObject();
+                writer.Key( "ResourceType" );
+                writer.String( result.m_resourceType.c_str() );
+                writer.Key( "NumResources" );
+                writer.Int( result.m_numResources );
+                writer.Key( "MessagePackBytes" );
+                writer.Uint64( result.m_messagePackBytes );
+                writer.Key( "FlatBytes" );
+                writer.Uint64( result.m_flatBytes );
+                Benchmarking::WriteStatistics( writer, "MessagePack", result.m_messagePack );
+                Benchmarking::WriteStatistics( writer, "Flat", result.m_flat );
+                writer.Key( "Speedup" );
+                writer.Double( result.m_messagePack.m_p50 / Math::Max( result.m_flat.m_p50, 1.0 ) );
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Run( char const* pCompiledResourcePath, char const* pOutputFilePath )
+    {
+        FileSystem::Path compiledResourcePath( pCompiledResourcePath );
+        compiledResourcePath.MakeIntoDirectoryPath();
+
+        TVector<BenchmarkResult> results;
+
+        for ( ResourceTypeInfo const& typeInfo : g_resourceTypes )
+        {
+            TVector<FileSystem::Path> resourceFilePaths;
+            if ( !FileSystem::GetDirectoryContents( compiledResourcePath, resourceFilePaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::Expand, { typeInfo.m_pExtension } ) )
+            {
+                std::cout << "Failed to read compiled resource directory: " << compiledResourcePath.c_str() << std::endl;
+                return false;
+            }
+
+            if ( resourceFilePaths.empty() )
+            {
+                continue;
+            }
+
+            if ( (int32_t) resourceFilePaths.size() > g_maxFilesPerResourceType )
+            {
+                resourceFilePaths.resize( g_maxFilesPerResourceType );
+            }
+
+            std::cout << "Running serialization benchmarks: " << resourceFilePaths.size() << " '" << typeInfo.m_pExtension << "' resources" << std::endl;
+
+            // Transcode all the resources into both formats and verify that the flat data contains exactly the same data
+            //-------------------------------------------------------------------------
+
+            BenchmarkResult& result = results.emplace_back();
+            result.m_resourceType = typeInfo.m_pExtension;
+
+            TVector<Blob> messagePackData;
+            TVector<Blob> flatData;
+            Blob fileData, roundTripData;
+
+            for ( FileSystem::Path const& resourceFilePath : resourceFilePaths )
+            {
+                if ( !FileSystem::LoadFile( resourceFilePath, fileData ) || fileData.empty() )
+                {
+                    std::cout << "Failed to load compiled resource: " << resourceFilePath.c_str() << std::endl;
+                    return false;
+                }
+
+                typeInfo.m_transcodeFunction( fileData, BinaryFormat::MessagePack, messagePackData.emplace_back() );
+                typeInfo.m_transcodeFunction( fileData, BinaryFormat::Flat, flatData.emplace_back() );
+                typeInfo.m_transcodeFunction( flatData.back(), BinaryFormat::MessagePack, roundTripData );
+
+                if ( roundTripData != messagePackData.back() )
+                {
+                    std::cout << "Flat serialization round trip failed for: " << resourceFilePath.c_str() << std::endl;
+                    return false;
+                }
+
+                result.m_messagePackBytes += messagePackData.back().size();
+                result.m_flatBytes += flatData.back().size();
+            }
+
+            result.m_numResources = (int32_t) resourceFilePaths.size();
+            Measure( typeInfo, messagePackData, flatData, result );
+        }
+
+        if ( results.empty() )
+        {
+            std::cout << "No compiled resources found in: " << compiledResourcePath.c_str() << std::endl;
+            return false;
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        JsonArchiveWriter archive;
+        WriteResults( *archive.GetWriter(), results );
+        return Benchmarking::ReportResults( archive, pOutputFilePath );
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+// Binary Serialization Benchmarks
+//-------------------------------------------------------------------------
+// Load-time comparison of the binary formats (msgpack vs flat) on real compiled resources
+// Every supported compiled resource in the supplied directory is transcoded to both formats (this also verifies the flat round trip)
+// We then time deserializing each resource the same way its loader does, excluding any post-load processing or GPU installation
+// Note: the file data is already in memory so this only measures the deserialization cost, not the IO
+// Results are reported as JSON (to stdout and optionally to a file) so they can be compared across runs
+
+namespace EE::Serialization::Benchmarks
+{
+    // Run all benchmarks, returns false if we didnt find any resources to test, if the round trip failed or if we failed to write the results file
+    bool Run( char const* pCompiledResourcePath, char const* pOutputFilePath = nullptr );
+}
@@ -0,0 +1,205 @@
+#include "StringIDBenchmarks.h"
+#include "BenchmarkUtils.h"
+#include "Base/Types/StringID.h"
+#include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Time/Time.h"
+#include <atomic>
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::StringIDBenchmarks
+{
+    namespace
+    {
+        static int32_t const g_threadCounts[] = { 1, 4, 16, 32 };
+
+        static int32_t const g_numStrings = 4096;
+        static int32_t const g_numOperationsPerThread = 100000;
+        static int32_t const g_numSamples = 10;
+    }
+
+    //-------------------------------------------------------------------------
+    // Measurement
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BenchmarkResult
+        {
+            String                                  m_name;
+            int32_t                                 m_numThreads = 0;
+            int64_t                                 m_numOperations = 0;    // Per sample (i.e. for all threads)
+            Benchmarking::SampleStatistics          m_timing;               // Per sample
+        };
+
+        // Creates 'numThreads' threads that all call the work function at the same time, returns the time it took for all threads to complete
+        template<typename WorkFunction>
+        Nanoseconds RunThreads( int32_t numThreads, WorkFunction&& workFunction )
+        {
+            std::atomic<int32_t> numReadyThreads = 0;
+            std::atomic<bool> start = false;
+
+            TVector<Threading::Thread> threads;
+            threads.reserve( numThreads );
+            for ( int32_t threadIdx = 0; threadIdx < numThreads; threadIdx++ )
+            {
+                threads.emplace_back( [&, threadIdx] ()
+                {
+                    numReadyThreads++;
+                    while ( !start.load( std::memory_order_acquire ) ) {}
+                    workFunction( threadIdx );
+                } );
+            }
+
+            while ( numReadyThreads.load() != numThreads ) {}
+
+            Nanoseconds const startTime = PlatformClock::GetTime();
+            start.store( true, std::memory_order_release );
+            for ( Threading::Thread& thread : threads )
+            {
+                thread.join();
+            }
+            return PlatformClock::GetTime() - startTime;
+        }
+
+        // All threads create IDs from the same set of strings that are already in the table (i.e. the common case at runtime)
+        BenchmarkResult MeasureLookups( int32_t numThreads, TVector<String> const& strings )
+        {
+            for ( String const& str : strings )
+            {
+                StringID const ID( str );
+            }
+
+            auto Work = [&strings] ( int32_t threadIdx )
+            {
+                uint32_t checksum = 0;
+                int32_t stringIdx = ( threadIdx * 97 ) % g_numStrings;
+                for ( int32_t i = 0; i < g_numOperationsPerThread; i++ )
+                {
+                    checksum += StringID( strings[stringIdx].c_str() ).ToUint();
+                    stringIdx = ( stringIdx + 1 ) % g_numStrings;
+                }
+                EE_ASSERT( checksum != 0xFFFFFFFF ); // Keep the work from being optimized out
+            };
+
+            TVector<double> samples;
+            for ( int32_t i = 0; i < g_numSamples; i++ )
+            {
+                samples.emplace_back( double( RunThreads( numThreads, Work ).ToU64() ) );
+            }
+
+            BenchmarkResult result;
+            result.m_name = "Lookup";
+            result.m_numThreads = numThreads;
+            result.m_numOperations = (int64_t) numThreads * g_numOperationsPerThread;
+            result.m_timing = Benchmarking::CalculateStatistics( samples );
+            return result;
+        }
+
+        // Every thread interns its own new strings, this is what happens during parallel loading/compilation
+        BenchmarkResult MeasureInserts( int32_t numThreads )
+        {
+            static int32_t s_runIdx = 0;
+            int32_t const numStringsPerThread = g_numStrings;
+
+            TVector<double> samples;
+            for ( int32_t sampleIdx = 0; sampleIdx < g_numSamples; sampleIdx++ )
+            {
+                // Generate unique strings for this run up front so we only measure the table
+                TVector<TVector<String>> threadStrings;
+                threadStrings.resize( numThreads );
+                for ( int32_t threadIdx = 0; threadIdx < numThreads; threadIdx++ )
+                {
+                    threadStrings[threadIdx].reserve( numStringsPerThread );
+                    for ( int32_t i = 0; i < numStringsPerThread; i++ )
+                    {
+                        threadStrings[threadIdx].emplace_back( String( String::CtorSprintf(), "Bench_Insert_%d_%d_%d", s_runIdx, threadIdx, i ) );
+                    }
+                }
+                s_runIdx++;
+
+                auto Work = [&threadStrings] ( int32_t threadIdx )
+                {
+                    for ( String const& str : threadStrings[threadIdx] )
+                    {
+                        StringID const ID( str );
+                    }
+                };
+
+                samples.emplace_back( double( RunThreads( numThreads, Work ).ToU64() ) );
+            }
+
+            BenchmarkResult result;
+            result.m_name = "Insert";
+            result.m_numThreads = numThreads;
+            result.m_numOperations = (int64_t) numThreads * numStringsPerThread;
+            result.m_timing = Benchmarking::CalculateStatistics( samples );
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        void WriteResults( Serialization::JsonWriter& writer, TVector<BenchmarkResult> const& results )
+        {
+            writer.StartObject();
+
+            writer.Key( "NumHardwareThreads" );
+            writer.Uint( Threading::Thread::hardware_concurrency() );
+
+            writer.Key( "NumSamples" );
+            writer.Int( g_numSamples );
+
+            writer.Key( "Benchmarks" );
+            writer.StartArray();
+            for ( BenchmarkResult const& result : results )
+            {
+                writer.StartObject();
+                writer.Key( "Name" );
+                writer.String( result.m_name.c_str() );
+                writer.Key( "NumThreads" );
+                writer.Int( result.m_numThreads );
+                writer.Key( "NumOperations" );
+                writer.Int64( result.m_numOperations );
+                Benchmarking::WriteStatistics( writer, "", result.m_timing );
+                writer.Key( "NsPerOperation" );
+                writer.Double( result.m_timing.m_p50 / result.m_numOperations );
+                writer.Key( "OperationsPerSecond" );
+                writer.Double( result.m_numOperations / ( result.m_timing.m_p50 * 1e-9 ) );
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Run( char const* pOutputFilePath )
+    {
+        TVector<String> strings;
+        strings.reserve( g_numStrings );
+        for ( int32_t i = 0; i < g_numStrings; i++ )
+        {
+            strings.emplace_back( String( String::CtorSprintf(), "Bench_Lookup_%d", i ) );
+        }
+
+        TVector<BenchmarkResult> results;
+        for ( int32_t numThreads : g_threadCounts )
+        {
+            std::cout << "Running StringID benchmarks: " << numThreads << " threads" << std::endl;
+            results.emplace_back( MeasureLookups( numThreads, strings ) );
+            results.emplace_back( MeasureInserts( numThreads ) );
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        Serialization::JsonArchiveWriter archive;
+        WriteResults( *archive.GetWriter(), results );
+        return Benchmarking::ReportResults( archive, pOutputFilePath );
+    }
+}
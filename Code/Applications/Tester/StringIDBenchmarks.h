@@ -0,0 +1,14 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+// StringID Micro-Benchmarks
+//-------------------------------------------------------------------------
+// Contention benchmarks for the global StringID string table
+// Multiple threads create StringIDs at the same time, both for strings that are already interned (lookups) and for new strings (inserts)
+// Results are reported as JSON (to stdout and optionally to a file) so they can be compared across runs
+
+namespace EE::StringIDBenchmarks
+{
+    // Run all benchmarks, returns false if we failed to write the results file
+    bool Run( char const* pOutputFilePath = nullptr );
+}
@@ -592,7 +592,7 @@ namespace EE
         bool const shutdownResult = Shutdown();
         m_initialized = false;
 
-        Log::System::SaveToFile();
+        Log::System::Flush();
 
         //-------------------------------------------------------------------------
 
@@ -7,10 +7,14 @@
 
 namespace EE::Hash
 {
-    namespace XXHash
-    {
-        constexpr static uint32_t const g_hashSeed = 'EE8';
-    }
+    // The compile-time hash needs to produce exactly the same values as XXH32 (these are the XXH32 results for our seed)
+    static_assert( XXHash::ConstExpr::GetHash32( "a" ) == 0x2666E547, "Compile-time XXHash doesnt match XXH32" );
+    static_assert( XXHash::ConstExpr::GetHash32( "Root" ) == 0x59C8A2D2, "Compile-time XXHash doesnt match XXH32" );
+    static_assert( XXHash::ConstExpr::GetHash32( "ReferencePose" ) == 0xC42F9C7F, "Compile-time XXHash doesnt match XXH32" );
+    static_assert( XXHash::ConstExpr::GetHash32( "AnimationGraphDefinition" ) == 0x103492F2, "Compile-time XXHash doesnt match XXH32" );
+    static_assert( XXHash::ConstExpr::GetHash32( "Ragdoll Physics Root Body Name For Test" ) == 0x91862A2C, "Compile-time XXHash doesnt match XXH32" );
+
+    //-------------------------------------------------------------------------
 
     uint32_t XXHash::GetHash32( void const* pData, size_t size )
     {
@@ -14,6 +14,8 @@ namespace EE::Hash
 
     namespace XXHash
     {
+        constexpr static uint32_t const g_hashSeed = 'EE8';
+
         EE_BASE_API uint32_t GetHash32( void const* pData, size_t size );
 
         EE_FORCE_INLINE uint32_t GetHash32( String const& string )
@@ -49,6 +51,91 @@ namespace EE::Hash
         {
             return GetHash64( data.data(), data.size() );
         }
+
+        // Compile-time version of the 32bit hash, produces the same values as 'GetHash32' so can be used to generate IDs for string literals
+        // This is a straight port of XXH32, it is a lot slower than the runtime version so dont use it for runtime data
+        namespace ConstExpr
+        {
+            constexpr uint32_t const g_prime32_1 = 0x9E3779B1U;
+            constexpr uint32_t const g_prime32_2 = 0x85EBCA77U;
+            constexpr uint32_t const g_prime32_3 = 0xC2B2AE3DU;
+            constexpr uint32_t const g_prime32_4 = 0x27D4EB2FU;
+            constexpr uint32_t const g_prime32_5 = 0x165667B1U;
+
+            constexpr inline uint32_t RotateLeft( uint32_t value, uint32_t numBits )
+            {
+                return ( value << numBits ) | ( value >> ( 32 - numBits ) );
+            }
+
+            constexpr inline uint32_t Read32( char const* pData )
+            {
+                return uint32_t( uint8_t( pData[0] ) ) | ( uint32_t( uint8_t( pData[1] ) ) << 8 ) | ( uint32_t( uint8_t( pData[2] ) ) << 16 ) | ( uint32_t( uint8_t( pData[3] ) ) << 24 );
+            }
+
+            constexpr inline uint32_t Round( uint32_t accumulator, uint32_t input )
+            {
+                return RotateLeft( accumulator + input * g_prime32_2, 13 ) * g_prime32_1;
+            }
+
+            constexpr inline uint32_t GetHash32( char const* pData, size_t size, uint32_t seed = g_hashSeed )
+            {
+                char const* const pEnd = pData + size;
+                uint32_t hash = 0;
+
+                if ( size >= 16 )
+                {
+                    uint32_t v1 = seed + g_prime32_1 + g_prime32_2;
+                    uint32_t v2 = seed + g_prime32_2;
+                    uint32_t v3 = seed;
+                    uint32_t v4 = seed - g_prime32_1;
+
+                    char const* const pLimit = pEnd - 15;
+                    do
+                    {
+                        v1 = Round( v1, Read32( pData ) );
+                        v2 = Round( v2, Read32( pData + 4 ) );
+                        v3 = Round( v3, Read32( pData + 8 ) );
+                        v4 = Round( v4, Read32( pData + 12 ) );
+                        pData += 16;
+                    } while ( pData < pLimit );
+
+                    hash = RotateLeft( v1, 1 ) + RotateLeft( v2, 7 ) + RotateLeft( v3, 12 ) + RotateLeft( v4, 18 );
+                }
+                else
+                {
+                    hash = seed + g_prime32_5;
+                }
+
+                hash += (uint32_t) size;
+
+                // Remaining bytes
+                for ( ; pData + 4 <= pEnd; pData += 4 )
+                {
+                    hash += Read32( pData ) * g_prime32_3;
+                    hash = RotateLeft( hash, 17 ) * g_prime32_4;
+                }
+
+                for ( ; pData < pEnd; pData++ )
+                {
+                    hash += uint32_t( uint8_t( *pData ) ) * g_prime32_5;
+                    hash = RotateLeft( hash, 11 ) * g_prime32_1;
+                }
+
+                // Avalanche
+                hash ^= hash >> 15;
+                hash *= g_prime32_2;
+                hash ^= hash >> 13;
+                hash *= g_prime32_3;
+                hash ^= hash >> 16;
+                return hash;
+            }
+
+            template<size_t N>
+            constexpr inline uint32_t GetHash32( char const ( &str )[N] )
+            {
+                return GetHash32( str, N - 1 );
+            }
+        }
     }
 
     // FNV1a
@@ -61,6 +61,39 @@ namespace EE::FileSystem
 
     EE_BASE_API bool LoadFile( char const* filePath, Blob& fileData );
     EE_FORCE_INLINE bool LoadFile( String const& filePath, Blob& fileData ) { return LoadFile( filePath.c_str(), fileData ); }
+
+    // Memory Mapped Files
+    //-------------------------------------------------------------------------
+    // Read-only view of an entire file, the data is paged in on demand by the OS and the view is page aligned
+    // The file cannot be modified while it is mapped so only use this for data that doesnt change at runtime
+
+    class EE_BASE_API MappedFile
+    {
+    public:
+
+        MappedFile() = default;
+        MappedFile( MappedFile const& ) = delete;
+        MappedFile( MappedFile&& rhs ) { *this = eastl::move( rhs ); }
+        ~MappedFile() { Close(); }
+
+        MappedFile& operator=( MappedFile const& ) = delete;
+        MappedFile& operator=( MappedFile&& rhs );
+
+        bool Open( char const* filePath );
+        EE_FORCE_INLINE bool Open( String const& filePath ) { return Open( filePath.c_str() ); }
+        void Close();
+
+        inline bool IsOpen() const { return m_pData != nullptr; }
+        inline uint8_t const* GetData() const { return m_pData; }
+        inline size_t GetSize() const { return m_size; }
+
+    private:
+
+        uint8_t const*          m_pData = nullptr;
+        size_t                  m_size = 0;
+        void*                   m_pFileHandle = nullptr;
+        void*                   m_pMappingHandle = nullptr;
+    };
     
     // Directory Functions
     //-------------------------------------------------------------------------
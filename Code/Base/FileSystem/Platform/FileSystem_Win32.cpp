@@ -192,6 +192,89 @@ namespace EE::FileSystem
         CloseHandle( hFile );
         return true;
     }
+
+    //-------------------------------------------------------------------------
+
+    MappedFile& MappedFile::operator=( MappedFile&& rhs )
+    {
+        Close();
+
+        m_pData = rhs.m_pData;
+        m_size = rhs.m_size;
+        m_pFileHandle = rhs.m_pFileHandle;
+        m_pMappingHandle = rhs.m_pMappingHandle;
+
+        rhs.m_pData = nullptr;
+        rhs.m_size = 0;
+        rhs.m_pFileHandle = nullptr;
+        rhs.m_pMappingHandle = nullptr;
+        return *this;
+    }
+
+    bool MappedFile::Open( char const* pPath )
+    {
+        EE_ASSERT( pPath != nullptr );
+        EE_ASSERT( !IsOpen() );
+
+        // Open file handle
+        HANDLE hFile = CreateFile( pPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS | FILE_FLAG_POSIX_SEMANTICS, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        // Get file size, empty files cannot be mapped
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart == 0 )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        // Map the whole file
+        HANDLE hMapping = CreateFileMapping( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( hMapping == nullptr )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        void* pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( pView == nullptr )
+        {
+            CloseHandle( hMapping );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        m_pData = (uint8_t const*) pView;
+        m_size = (size_t) fileSizeLI.QuadPart;
+        m_pFileHandle = hFile;
+        m_pMappingHandle = hMapping;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if ( m_pData != nullptr )
+        {
+            UnmapViewOfFile( m_pData );
+            m_pData = nullptr;
+            m_size = 0;
+        }
+
+        if ( m_pMappingHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pMappingHandle );
+            m_pMappingHandle = nullptr;
+        }
+
+        if ( m_pFileHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pFileHandle );
+            m_pFileHandle = nullptr;
+        }
+    }
 }
 
 #endif
\ No newline at end of file
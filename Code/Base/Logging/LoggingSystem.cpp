@@ -1,8 +1,10 @@
 #include "LoggingSystem.h"
 #include "Base/Threading/Threading.h"
 #include "Base/FileSystem/FileSystem.h"
-#include "Base/FileSystem/FileStreams.h"
 #include "Base/FileSystem/FileSystemPath.h"
+#include <EASTL/sort.h>
+#include <atomic>
+#include <cstdio>
 #include <ctime>
 
 //-------------------------------------------------------------------------
@@ -13,18 +15,473 @@ namespace EE::Log
     {
         static char const* const g_severityLabels[] = { "Message", "Warning", "Error", "Fatal Error" };
 
+        constexpr static uint32_t const g_ringBufferCapacity = 256; // Must be a power of 2
+        constexpr static uint32_t const g_entryTextSize = 1000;
+        constexpr static uint32_t const g_maxPackedStringLength = 255;
+        constexpr static uint32_t const g_maxWindowEntries = 8192;
+        constexpr static uint32_t const g_maxUnhandledEntries = 1024;
+        constexpr static uint64_t const g_maxLogFileSize = 32 * 1024 * 1024;
+        constexpr static int32_t const g_numRotatedLogFiles = 3;
+        constexpr static int32_t const g_logThreadUpdateIntervalMS = 10;
+
+        static_assert( ( g_ringBufferCapacity & ( g_ringBufferCapacity - 1 ) ) == 0, "Ring buffer capacity must be a power of 2" );
+
+        // Incremented whenever the log system is initialized or shutdown, this ensures we dont reuse a buffer from a previous initialization of the log system
+        static std::atomic<uint32_t>        g_logGeneration = 0;
+
+        // Held while releasing the thread buffers on shutdown, so that an exiting thread never flags a buffer that is being deleted
+        static Threading::Mutex             g_threadBufferReleaseMutex;
+
+        //-------------------------------------------------------------------------
+
+        // A log entry as recorded by the calling thread. All strings are packed into a fixed buffer so recording a typical entry never allocates.
+        // The category is always at the start of the buffer, all other strings are stored at the specified offsets.
+        // Messages that dont fit in the buffer are stored on the heap and released by the log thread once the entry is processed.
+        struct RawLogEntry
+        {
+            uint64_t                        m_sequenceID;
+            time_t                          m_time;
+            uint32_t                        m_lineNumber;
+            Severity                        m_severity;
+            uint16_t                        m_sourceInfoOffset;
+            uint16_t                        m_filenameOffset;
+            uint16_t                        m_messageOffset;
+            char*                           m_pLongMessage = nullptr;
+            char                            m_text[g_entryTextSize];
+        };
+
+        // Single producer (the owning thread), single consumer (the log thread) ring buffer
+        struct ThreadLogBuffer
+        {
+            alignas( 64 ) std::atomic<uint32_t>     m_writeIdx = 0;
+            alignas( 64 ) std::atomic<uint32_t>     m_readIdx = 0;
+            std::atomic<bool>                       m_hasThreadExited = false;
+            RawLogEntry                             m_entries[g_ringBufferCapacity];
+        };
+
+        // Flags the thread's buffer once the thread exits, so that the log thread can release it once it has been drained
+        struct ThreadLogBufferHandle
+        {
+            ~ThreadLogBufferHandle()
+            {
+                if ( m_pBuffer != nullptr )
+                {
+                    Threading::ScopeLock lock( g_threadBufferReleaseMutex );
+                    if ( m_generation == g_logGeneration.load( std::memory_order_relaxed ) )
+                    {
+                        m_pBuffer->m_hasThreadExited.store( true, std::memory_order_release );
+                    }
+                }
+            }
+
+            ThreadLogBuffer*                        m_pBuffer = nullptr;
+            uint32_t                                m_generation = 0;
+        };
+
         struct LogData
         {
-            TVector<LogEntry>               m_logEntries;
-            TVector<LogEntry>               m_unhandledWarningsAndErrors;
+            // Producers - buffers from exited threads are only released once all their entries have been processed
+            TVector<ThreadLogBuffer*>       m_threadBuffers;
+            Threading::Mutex                m_threadBuffersMutex;
+            std::atomic<uint64_t>           m_nextSequenceID = 0;
+            std::atomic<uint32_t>           m_numPendingDroppedEntries = 0;
+            std::atomic<uint32_t>           m_numDroppedEntries = 0;
+            std::atomic<int32_t>            m_numWarnings = 0;
+            std::atomic<int32_t>            m_numErrors = 0;
+            std::atomic<bool>               m_fatalErrorOccurred = false;
+
+            // Warnings and errors that didnt fit in their thread's buffer, these are heap allocated and released by the log thread
+            TVector<RawLogEntry*>           m_overflowEntries;
+            Threading::Mutex                m_overflowMutex;
+
+            // Log thread
+            Threading::Thread               m_logThread;
+            Threading::Mutex                m_wakeMutex;
+            Threading::ConditionVariable    m_wakeCondition;
+            std::atomic<bool>               m_wakeRequested = false;
+            std::atomic<bool>               m_exitRequested = false;
+
+            // Processing - only ever accessed while holding the processing mutex
+            Threading::Mutex                m_processingMutex;
+            TVector<RawLogEntry*>           m_pendingEntries;
+            TVector<uint32_t>               m_pendingWriteIndices;
+            TVector<RawLogEntry*>           m_pendingOverflowEntries;
             FileSystem::Path                m_logPath;
-            Threading::Mutex                m_mutex;
-            int32_t                         m_fatalErrorIndex = InvalidIndex;
-            int32_t                         m_numWarnings = 0;
-            int32_t                         m_numErrors = 0;
+            FILE*                           m_pLogFile = nullptr;
+            uint64_t                        m_logFileSize = 0;
+
+            // Window - only ever accessed while holding the window mutex
+            Threading::Mutex                m_windowMutex;
+            TVector<LogEntry>               m_window;
+            uint32_t                        m_windowStartIdx = 0;
+            std::atomic<uint64_t>           m_numProcessedEntries = 0;
+            TVector<LogEntry>               m_unhandledWarningsAndErrors;
+            LogEntry                        m_fatalError;
         };
 
         static LogData*                     g_pLog = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static ThreadLogBuffer* GetThreadLogBuffer()
+        {
+            thread_local ThreadLogBufferHandle t_bufferHandle;
+
+            uint32_t const logGeneration = g_logGeneration.load( std::memory_order_relaxed );
+            if ( t_bufferHandle.m_pBuffer == nullptr || t_bufferHandle.m_generation != logGeneration )
+            {
+                t_bufferHandle.m_pBuffer = EE::New<ThreadLogBuffer>();
+                t_bufferHandle.m_generation = logGeneration;
+
+                Threading::ScopeLock lock( g_pLog->m_threadBuffersMutex );
+                g_pLog->m_threadBuffers.emplace_back( t_bufferHandle.m_pBuffer );
+            }
+
+            return t_bufferHandle.m_pBuffer;
+        }
+
+        static void RequestLogThreadWake()
+        {
+            if ( !g_pLog->m_wakeRequested.exchange( true, std::memory_order_relaxed ) )
+            {
+                g_pLog->m_wakeCondition.notify_one();
+            }
+        }
+
+        static uint16_t PackString( RawLogEntry& entry, uint32_t& offset, char const* pString )
+        {
+            uint16_t const stringOffset = (uint16_t) offset;
+            size_t length = 0;
+            if ( pString != nullptr )
+            {
+                length = strlen( pString );
+                length = ( length > g_maxPackedStringLength ) ? g_maxPackedStringLength : length;
+                memcpy( &entry.m_text[offset], pString, length );
+            }
+            entry.m_text[offset + length] = 0;
+            offset += (uint32_t) length + 1;
+            return stringOffset;
+        }
+
+        // Packs all the strings into the entry, formatting into the final log entry is deferred to the log thread
+        static void RecordEntry( RawLogEntry& entry, Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int pLineNumber, char const* pMessageFormat, va_list args )
+        {
+            entry.m_sequenceID = g_pLog->m_nextSequenceID.fetch_add( 1, std::memory_order_relaxed );
+            entry.m_time = std::time( nullptr );
+            entry.m_lineNumber = pLineNumber;
+            entry.m_severity = severity;
+
+            uint32_t textOffset = 0;
+            PackString( entry, textOffset, pCategory );
+            entry.m_sourceInfoOffset = PackString( entry, textOffset, pSourceInfo );
+            entry.m_filenameOffset = PackString( entry, textOffset, pFilename );
+            entry.m_messageOffset = (uint16_t) textOffset;
+
+            // Messages that dont fit in the entry are formatted again into a heap allocation, this is rare so we accept the cost
+            va_list longMessageArgs;
+            va_copy( longMessageArgs, args );
+
+            uint32_t const maxMessageSize = g_entryTextSize - textOffset;
+            int32_t const messageLength = vsnprintf( &entry.m_text[textOffset], maxMessageSize, pMessageFormat, args );
+            entry.m_pLongMessage = nullptr;
+            if ( messageLength >= (int32_t) maxMessageSize )
+            {
+                entry.m_pLongMessage = (char*) EE::Alloc( (size_t) messageLength + 1 );
+                vsnprintf( entry.m_pLongMessage, (size_t) messageLength + 1, pMessageFormat, longMessageArgs );
+            }
+
+            va_end( longMessageArgs );
+        }
+
+        //-------------------------------------------------------------------------
+        // File Sink
+        //-------------------------------------------------------------------------
+
+        static FileSystem::Path GetRotatedLogFilePath( FileSystem::Path const& logPath, int32_t index )
+        {
+            auto const extension = logPath.GetExtensionAsString();
+
+            FileSystem::Path rotatedPath = logPath;
+            if ( extension.empty() )
+            {
+                rotatedPath.ReplaceExtension( InlineString( InlineString::CtorSprintf(), "%d", index ).c_str() );
+            }
+            else
+            {
+                rotatedPath.ReplaceExtension( InlineString( InlineString::CtorSprintf(), "%d.%s", index, extension.c_str() ).c_str() );
+            }
+            return rotatedPath;
+        }
+
+        // Shifts all existing log files along by one (Log.txt -> Log.1.txt -> Log.2.txt ...), discarding the oldest
+        static void RotateLogFiles( FileSystem::Path const& logPath )
+        {
+            FileSystem::Path const oldestLogPath = GetRotatedLogFilePath( logPath, g_numRotatedLogFiles );
+            if ( oldestLogPath.Exists() )
+            {
+                FileSystem::EraseFile( oldestLogPath );
+            }
+
+            for ( int32_t i = g_numRotatedLogFiles - 1; i > 0; i-- )
+            {
+                FileSystem::Path const rotatedLogPath = GetRotatedLogFilePath( logPath, i );
+                if ( rotatedLogPath.Exists() )
+                {
+                    std::rename( rotatedLogPath.c_str(), GetRotatedLogFilePath( logPath, i + 1 ).c_str() );
+                }
+            }
+
+            if ( logPath.Exists() )
+            {
+                std::rename( logPath.c_str(), GetRotatedLogFilePath( logPath, 1 ).c_str() );
+            }
+        }
+
+        static void CloseLogFile()
+        {
+            if ( g_pLog->m_pLogFile != nullptr )
+            {
+                fclose( g_pLog->m_pLogFile );
+                g_pLog->m_pLogFile = nullptr;
+                g_pLog->m_logFileSize = 0;
+            }
+        }
+
+        static bool OpenLogFile()
+        {
+            EE_ASSERT( g_pLog->m_pLogFile == nullptr );
+
+            if ( !g_pLog->m_logPath.IsValid() || !g_pLog->m_logPath.IsFilePath() )
+            {
+                return false;
+            }
+
+            g_pLog->m_logPath.EnsureDirectoryExists();
+            RotateLogFiles( g_pLog->m_logPath );
+
+            g_pLog->m_pLogFile = fopen( g_pLog->m_logPath.c_str(), "wb" );
+            g_pLog->m_logFileSize = 0;
+            return g_pLog->m_pLogFile != nullptr;
+        }
+
+        static void WriteToLogFile( LogEntry const& entry )
+        {
+            if ( g_pLog->m_pLogFile == nullptr )
+            {
+                return;
+            }
+
+            InlineString logLine;
+            if ( entry.m_sourceInfo.empty() )
+            {
+                logLine.sprintf( "[%s] %s >>> %s: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
+            }
+            else
+            {
+                logLine.sprintf( "[%s] %s >>> %s: %s, Source: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_sourceInfo.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
+            }
+
+            fwrite( logLine.c_str(), 1, logLine.length(), g_pLog->m_pLogFile );
+            g_pLog->m_logFileSize += logLine.length();
+
+            // Start a new file once we exceed the max size
+            if ( g_pLog->m_logFileSize >= g_maxLogFileSize )
+            {
+                CloseLogFile();
+                OpenLogFile();
+            }
+        }
+
+        //-------------------------------------------------------------------------
+        // Processing
+        //-------------------------------------------------------------------------
+
+        static void ProcessEntry( LogEntry&& entry )
+        {
+            // Immediate display of log
+            //-------------------------------------------------------------------------
+            // This uses a less verbose format, if you want more info look at the saved log
+
+            InlineString traceMessage;
+            if ( entry.m_sourceInfo.empty() )
+            {
+                traceMessage.sprintf( "[%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_message.c_str() );
+            }
+            else
+            {
+                traceMessage.sprintf( "[%s][%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_sourceInfo.c_str(), entry.m_message.c_str() );
+            }
+
+            // Print to debug trace
+            EE_TRACE_MSG( traceMessage.c_str() );
+
+            // Print to std out
+            printf( "%s\n", traceMessage.c_str() );
+
+            // Stream to file
+            //-------------------------------------------------------------------------
+
+            WriteToLogFile( entry );
+
+            // Update window
+            //-------------------------------------------------------------------------
+
+            Threading::ScopeLock lock( g_pLog->m_windowMutex );
+
+            if ( entry.m_severity > Severity::Message )
+            {
+                if ( entry.m_severity == Severity::FatalError )
+                {
+                    g_pLog->m_fatalError = entry;
+                }
+
+                if ( g_pLog->m_unhandledWarningsAndErrors.size() < g_maxUnhandledEntries )
+                {
+                    g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
+                }
+            }
+
+            if ( g_pLog->m_window.size() < g_maxWindowEntries )
+            {
+                g_pLog->m_window.emplace_back( eastl::move( entry ) );
+            }
+            else // Overwrite the oldest entry
+            {
+                g_pLog->m_window[g_pLog->m_windowStartIdx] = eastl::move( entry );
+                g_pLog->m_windowStartIdx = ( g_pLog->m_windowStartIdx + 1 ) % g_maxWindowEntries;
+            }
+
+            g_pLog->m_numProcessedEntries.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        // Drains all thread buffers and processes the entries in the order they were recorded
+        static void ProcessPendingEntries()
+        {
+            Threading::ScopeLock processingLock( g_pLog->m_processingMutex );
+
+            // Gather entries from all threads
+            //-------------------------------------------------------------------------
+
+            g_pLog->m_pendingEntries.clear();
+            g_pLog->m_pendingWriteIndices.clear();
+
+            {
+                Threading::ScopeLock lock( g_pLog->m_threadBuffersMutex );
+                for ( ThreadLogBuffer* pBuffer : g_pLog->m_threadBuffers )
+                {
+                    uint32_t const readIdx = pBuffer->m_readIdx.load( std::memory_order_relaxed );
+                    uint32_t const writeIdx = pBuffer->m_writeIdx.load( std::memory_order_acquire );
+                    for ( uint32_t i = readIdx; i != writeIdx; i++ )
+                    {
+                        g_pLog->m_pendingEntries.emplace_back( &pBuffer->m_entries[i & ( g_ringBufferCapacity - 1 )] );
+                    }
+                    g_pLog->m_pendingWriteIndices.emplace_back( writeIdx );
+                }
+            }
+
+            {
+                Threading::ScopeLock lock( g_pLog->m_overflowMutex );
+                g_pLog->m_pendingOverflowEntries.swap( g_pLog->m_overflowEntries );
+            }
+
+            g_pLog->m_pendingEntries.insert( g_pLog->m_pendingEntries.end(), g_pLog->m_pendingOverflowEntries.begin(), g_pLog->m_pendingOverflowEntries.end() );
+
+            eastl::sort( g_pLog->m_pendingEntries.begin(), g_pLog->m_pendingEntries.end(), [] ( RawLogEntry const* pA, RawLogEntry const* pB ) { return pA->m_sequenceID < pB->m_sequenceID; } );
+
+            // Format and process entries
+            //-------------------------------------------------------------------------
+
+            char timestamp[9];
+            for ( RawLogEntry* pRawEntry : g_pLog->m_pendingEntries )
+            {
+                strftime( timestamp, 9, "%H:%M:%S", std::localtime( &pRawEntry->m_time ) );
+
+                LogEntry entry;
+                entry.m_timestamp = timestamp;
+                entry.m_category = pRawEntry->m_text;
+                entry.m_sourceInfo = &pRawEntry->m_text[pRawEntry->m_sourceInfoOffset];
+                entry.m_filename = &pRawEntry->m_text[pRawEntry->m_filenameOffset];
+                entry.m_message = ( pRawEntry->m_pLongMessage != nullptr ) ? pRawEntry->m_pLongMessage : &pRawEntry->m_text[pRawEntry->m_messageOffset];
+                entry.m_lineNumber = pRawEntry->m_lineNumber;
+                entry.m_severity = pRawEntry->m_severity;
+                ProcessEntry( eastl::move( entry ) );
+
+                if ( pRawEntry->m_pLongMessage != nullptr )
+                {
+                    EE::Free( (void*&) pRawEntry->m_pLongMessage );
+                }
+            }
+
+            for ( RawLogEntry* pOverflowEntry : g_pLog->m_pendingOverflowEntries )
+            {
+                EE::Delete( pOverflowEntry );
+            }
+            g_pLog->m_pendingOverflowEntries.clear();
+
+            // Release the processed slots back to the producers
+            // Buffers are only ever removed here, so the indices still match the gathered buffers (any new buffers are appended after them)
+            // Buffers from exited threads are released once they are drained, we iterate backwards since removal moves the last buffer into the removed slot
+            {
+                Threading::ScopeLock lock( g_pLog->m_threadBuffersMutex );
+                for ( int32_t i = (int32_t) g_pLog->m_pendingWriteIndices.size() - 1; i >= 0; i-- )
+                {
+                    ThreadLogBuffer* pBuffer = g_pLog->m_threadBuffers[i];
+                    uint32_t const readIdx = g_pLog->m_pendingWriteIndices[i];
+                    pBuffer->m_readIdx.store( readIdx, std::memory_order_release );
+
+                    if ( pBuffer->m_hasThreadExited.load( std::memory_order_acquire ) && pBuffer->m_writeIdx.load( std::memory_order_acquire ) == readIdx )
+                    {
+                        EE::Delete( pBuffer );
+                        g_pLog->m_threadBuffers.erase_unsorted( g_pLog->m_threadBuffers.begin() + i );
+                    }
+                }
+            }
+
+            // Report any dropped entries
+            //-------------------------------------------------------------------------
+
+            uint32_t const numDroppedEntries = g_pLog->m_numPendingDroppedEntries.exchange( 0, std::memory_order_relaxed );
+            if ( numDroppedEntries > 0 )
+            {
+                time_t const t = std::time( nullptr );
+                strftime( timestamp, 9, "%H:%M:%S", std::localtime( &t ) );
+
+                LogEntry entry;
+                entry.m_timestamp = timestamp;
+                entry.m_category = "Log";
+                entry.m_message.sprintf( "%u log messages were dropped since a thread's log buffer was full!", numDroppedEntries );
+                entry.m_filename = __FILE__;
+                entry.m_lineNumber = __LINE__;
+                entry.m_severity = Severity::Warning;
+                ProcessEntry( eastl::move( entry ) );
+            }
+
+            //-------------------------------------------------------------------------
+
+            if ( g_pLog->m_pLogFile != nullptr )
+            {
+                fflush( g_pLog->m_pLogFile );
+            }
+        }
+
+        static void LogThreadMain()
+        {
+            Memory::InitializeThreadHeap();
+            Threading::SetCurrentThreadName( "Log Thread" );
+
+            while ( !g_pLog->m_exitRequested.load( std::memory_order_relaxed ) )
+            {
+                {
+                    Threading::Lock lock( g_pLog->m_wakeMutex );
+                    g_pLog->m_wakeCondition.wait_for( lock, std::chrono::milliseconds( g_logThreadUpdateIntervalMS ), [] () { return g_pLog->m_wakeRequested.load( std::memory_order_relaxed ) || g_pLog->m_exitRequested.load( std::memory_order_relaxed ); } );
+                    g_pLog->m_wakeRequested.store( false, std::memory_order_relaxed );
+                }
+
+                ProcessPendingEntries();
+            }
+
+            Memory::ShutdownThreadHeap();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -40,11 +497,49 @@ namespace EE::Log
     {
         EE_ASSERT( g_pLog == nullptr );
         g_pLog = EE::New<LogData>();
+        g_pLog->m_window.reserve( g_maxWindowEntries );
+        g_logGeneration++;
+
+        g_pLog->m_logThread = Threading::Thread( LogThreadMain );
     }
 
     void System::Shutdown()
     {
         EE_ASSERT( g_pLog != nullptr );
+
+        {
+            Threading::ScopeLock lock( g_pLog->m_wakeMutex );
+            g_pLog->m_exitRequested = true;
+        }
+        g_pLog->m_wakeCondition.notify_one();
+        g_pLog->m_logThread.join();
+
+        // Process anything that was logged after the log thread's last update
+        ProcessPendingEntries();
+        CloseLogFile();
+
+        // Any threads that are still running will create new buffers if the log system is reinitialized
+        {
+            Threading::ScopeLock lock( g_threadBufferReleaseMutex );
+
+            for ( ThreadLogBuffer* pBuffer : g_pLog->m_threadBuffers )
+            {
+                EE::Delete( pBuffer );
+            }
+
+            g_logGeneration++;
+        }
+
+        // Release anything that was spilled after the final update
+        for ( RawLogEntry* pOverflowEntry : g_pLog->m_overflowEntries )
+        {
+            if ( pOverflowEntry->m_pLongMessage != nullptr )
+            {
+                EE::Free( (void*&) pOverflowEntry->m_pLongMessage );
+            }
+            EE::Delete( pOverflowEntry );
+        }
+
         EE::Delete( g_pLog );
     }
 
@@ -55,51 +550,53 @@ namespace EE::Log
 
     //-------------------------------------------------------------------------
 
-    TVector<EE::Log::LogEntry> const& System::GetLogEntries()
+    uint64_t System::GetNumProcessedEntries()
     {
         EE_ASSERT( IsInitialized() );
-        return g_pLog->m_logEntries;
+        return g_pLog->m_numProcessedEntries.load( std::memory_order_relaxed );
     }
 
-    //-------------------------------------------------------------------------
-
-    void System::SetLogFilePath( FileSystem::Path const& logFilePath )
+    void System::ForEachLogEntry( TFunction<void( LogEntry const& )> const& function )
     {
         EE_ASSERT( IsInitialized() );
-        g_pLog->m_logPath = logFilePath;
+        Threading::ScopeLock lock( g_pLog->m_windowMutex );
+
+        size_t const numEntries = g_pLog->m_window.size();
+        for ( size_t i = 0; i < numEntries; i++ )
+        {
+            function( g_pLog->m_window[( g_pLog->m_windowStartIdx + i ) % numEntries] );
+        }
     }
 
-    void System::SaveToFile()
+    //-------------------------------------------------------------------------
+
+    void System::SetLogFilePath( FileSystem::Path const& logFilePath )
     {
         EE_ASSERT( IsInitialized() );
+        Threading::ScopeLock processingLock( g_pLog->m_processingMutex );
+
+        CloseLogFile();
+        g_pLog->m_logPath = logFilePath;
 
-        if ( !g_pLog->m_logPath.IsValid() || !g_pLog->m_logPath.IsFilePath() )
+        if ( !OpenLogFile() )
         {
             return;
         }
 
-        g_pLog->m_logPath.EnsureDirectoryExists();
-
-        String logData;
-        InlineString logLine;
-
-        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
-        for ( auto const& entry : g_pLog->m_logEntries )
+        // Write out everything that was logged before we had a file to stream to
+        Threading::ScopeLock windowLock( g_pLog->m_windowMutex );
+        size_t const numEntries = g_pLog->m_window.size();
+        for ( size_t i = 0; i < numEntries && g_pLog->m_pLogFile != nullptr; i++ )
         {
-            if ( entry.m_sourceInfo.empty() )
-            {
-                logLine.sprintf( "[%s] %s >>> %s: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
-            }
-            else
-            {
-                logLine.sprintf( "[%s] %s >>> %s: %s, Source: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_sourceInfo.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
-            }
-
-            logData.append( logLine.c_str() );
+            WriteToLogFile( g_pLog->m_window[( g_pLog->m_windowStartIdx + i ) % numEntries] );
         }
+        fflush( g_pLog->m_pLogFile );
+    }
 
-        FileSystem::OutputFileStream logFile( g_pLog->m_logPath );
-        logFile.Write( (void*) logData.data(), logData.size() );
+    void System::Flush()
+    {
+        EE_ASSERT( IsInitialized() );
+        ProcessPendingEntries();
     }
 
     //-------------------------------------------------------------------------
@@ -107,13 +604,13 @@ namespace EE::Log
     bool System::HasFatalErrorOccurred()
     {
         EE_ASSERT( IsInitialized() );
-        return g_pLog->m_fatalErrorIndex != InvalidIndex;
+        return g_pLog->m_fatalErrorOccurred.load( std::memory_order_acquire );
     }
 
     LogEntry const& System::GetFatalError()
     {
-        EE_ASSERT( IsInitialized() && g_pLog->m_fatalErrorIndex != InvalidIndex );
-        return g_pLog->m_logEntries[g_pLog->m_fatalErrorIndex];
+        EE_ASSERT( IsInitialized() && HasFatalErrorOccurred() );
+        return g_pLog->m_fatalError;
     }
 
     //-------------------------------------------------------------------------
@@ -121,23 +618,29 @@ namespace EE::Log
     TVector<Log::LogEntry> System::GetUnhandledWarningsAndErrors()
     {
         EE_ASSERT( IsInitialized() );
-        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+        Threading::ScopeLock lock( g_pLog->m_windowMutex );
 
-        TVector<Log::LogEntry> outEntries = g_pLog->m_unhandledWarningsAndErrors;
-        g_pLog->m_unhandledWarningsAndErrors.clear();
+        TVector<Log::LogEntry> outEntries;
+        outEntries.swap( g_pLog->m_unhandledWarningsAndErrors );
         return outEntries;
     }
 
     int32_t System::GetNumWarnings()
     {
         EE_ASSERT( IsInitialized() );
-        return g_pLog->m_numWarnings;
+        return g_pLog->m_numWarnings.load( std::memory_order_relaxed );
     }
 
     int32_t System::GetNumErrors()
     {
         EE_ASSERT( IsInitialized() );
-        return g_pLog->m_numErrors;
+        return g_pLog->m_numErrors.load( std::memory_order_relaxed );
+    }
+
+    uint32_t System::GetNumDroppedEntries()
+    {
+        EE_ASSERT( IsInitialized() );
+        return g_pLog->m_numDroppedEntries.load( std::memory_order_relaxed );
     }
 }
 
@@ -159,64 +662,55 @@ namespace EE::Log
         EE_ASSERT( System::IsInitialized() );
         EE_ASSERT( pCategory != nullptr && pFilename != nullptr && pMessageFormat != nullptr );
 
-        {
-            std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
-
-            if ( severity == Severity::FatalError )
-            {
-                g_pLog->m_fatalErrorIndex = (int32_t) g_pLog->m_logEntries.size();
-            }
+        g_pLog->m_numWarnings.fetch_add( ( severity == Severity::Warning ) ? 1 : 0, std::memory_order_relaxed );
+        g_pLog->m_numErrors.fetch_add( ( severity == Severity::Error ) ? 1 : 0, std::memory_order_relaxed );
 
-            auto& entry = g_pLog->m_logEntries.emplace_back( LogEntry() );
+        // Acquire a slot
+        //-------------------------------------------------------------------------
 
-            //-------------------------------------------------------------------------
+        ThreadLogBuffer* pBuffer = GetThreadLogBuffer();
+        uint32_t const writeIdx = pBuffer->m_writeIdx.load( std::memory_order_relaxed );
+        uint32_t const readIdx = pBuffer->m_readIdx.load( std::memory_order_acquire );
 
-            entry.m_category = pCategory;
-            entry.m_sourceInfo = ( pSourceInfo != nullptr ) ? pSourceInfo : String();
-            entry.m_filename = pFilename;
-            entry.m_lineNumber = pLineNumber;
-            entry.m_severity = severity;
-            entry.m_timestamp.resize( 9 );
-
-            // Message
-            entry.m_message.sprintf_va_list( pMessageFormat, args );
-            va_end( args );
-
-            // Timestamp
-            entry.m_timestamp.resize( 9 );
-            time_t const t = std::time( nullptr );
-            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &t ) );
-
-            // Immediate display of log
-            //-------------------------------------------------------------------------
-            // This uses a less verbose format, if you want more info look at the saved log
-
-            InlineString traceMessage;
-            if ( entry.m_sourceInfo.empty() )
+        if ( writeIdx - readIdx == g_ringBufferCapacity )
+        {
+            // Only messages are ever dropped, anything more important is spilled to the overflow list for the log thread to pick up
+            if ( severity == Severity::Message )
             {
-                traceMessage.sprintf( "[%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_message.c_str() );
+                g_pLog->m_numPendingDroppedEntries.fetch_add( 1, std::memory_order_relaxed );
+                g_pLog->m_numDroppedEntries.fetch_add( 1, std::memory_order_relaxed );
             }
             else
             {
-                traceMessage.sprintf( "[%s][%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_sourceInfo.c_str(), entry.m_message.c_str() );
-            }
-
-            // Print to debug trace
-            EE_TRACE_MSG( traceMessage.c_str() );
+                RawLogEntry* pOverflowEntry = EE::New<RawLogEntry>();
+                RecordEntry( *pOverflowEntry, severity, pCategory, pSourceInfo, pFilename, pLineNumber, pMessageFormat, args );
 
-            // Print to std out
-            printf( "%s\n", traceMessage.c_str() );
+                Threading::ScopeLock lock( g_pLog->m_overflowMutex );
+                g_pLog->m_overflowEntries.emplace_back( pOverflowEntry );
+            }
 
-            // Track unhandled warnings and errors
-            //-------------------------------------------------------------------------
+            RequestLogThreadWake();
+        }
+        else
+        {
+            RecordEntry( pBuffer->m_entries[writeIdx & ( g_ringBufferCapacity - 1 )], severity, pCategory, pSourceInfo, pFilename, pLineNumber, pMessageFormat, args );
+            pBuffer->m_writeIdx.store( writeIdx + 1, std::memory_order_release );
 
-            if ( entry.m_severity > Severity::Message )
+            // Only wake the log thread early for important entries or when the buffer is filling up, it will pick up everything else on its next update
+            if ( severity > Severity::Message || ( writeIdx + 1 - readIdx ) >= ( g_ringBufferCapacity / 2 ) )
             {
-                g_pLog->m_numWarnings += ( entry.m_severity == Severity::Warning ) ? 1 : 0;
-                g_pLog->m_numErrors += ( entry.m_severity == Severity::Error ) ? 1 : 0;
-                g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
+                RequestLogThreadWake();
             }
         }
+
+        // Fatal errors need to be processed immediately since we are about to halt
+        //-------------------------------------------------------------------------
+
+        if ( severity == Severity::FatalError )
+        {
+            System::Flush();
+            g_pLog->m_fatalErrorOccurred.store( true, std::memory_order_release );
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -241,4 +735,4 @@ namespace EE::Log
 
         LogAssert( pFile, line, &buffer[0] );
     }
-}
\ No newline at end of file
+}
@@ -1,9 +1,16 @@
 #pragma once
 #include "Log.h"
 #include "Base/Types/String.h"
+#include "Base/Types/Function.h"
 #include "Base/Types/Containers_ForwardDecl.h"
 
 //-------------------------------------------------------------------------
+// Logging System
+//-------------------------------------------------------------------------
+// Log entries are recorded into per-thread lock-free ring buffers and never block the calling thread.
+// A background log thread drains these buffers, formats the entries and streams them to a rotating log file.
+// Only a bounded window of the most recent entries is kept in memory for display in the tools.
+// If a thread's ring buffer is full, its messages are dropped (a warning reporting the drop count is logged) while warnings and errors are spilled to a shared overflow list.
 
 namespace EE::FileSystem { class Path; }
 
@@ -39,9 +46,15 @@ namespace EE::Log
         // Accessors
         //-------------------------------------------------------------------------
 
-        static TVector<LogEntry> const& GetLogEntries();
+        // Returns the number of entries processed by the log thread so far, use this to detect when the log window has changed
+        static uint64_t GetNumProcessedEntries();
+
+        // Visits all entries in the in-memory log window (oldest first). The log thread is blocked from adding entries while this runs.
+        static void ForEachLogEntry( TFunction<void( LogEntry const& )> const& function );
+
         static int32_t GetNumWarnings();
         static int32_t GetNumErrors();
+        static uint32_t GetNumDroppedEntries();
 
         static bool HasFatalErrorOccurred();
         static LogEntry const& GetFatalError();
@@ -53,7 +66,10 @@ namespace EE::Log
         // Output
         //-------------------------------------------------------------------------
 
+        // Sets the log file path and opens the file sink. Any previous log files at that path are rotated out.
         static void SetLogFilePath( FileSystem::Path const& logFilePath );
-        static void SaveToFile();
+
+        // Synchronously process all pending entries and flush the log file - blocks the calling thread!
+        static void Flush();
     };
-}
\ No newline at end of file
+}
@@ -240,7 +240,8 @@ namespace EE::Math
 
     //-------------------------------------------------------------------------
 
-    void AABBTree::FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, TVector<uint64_t>& outResults ) const
+    template<typename VectorType>
+    void AABBTree::FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, VectorType& outResults ) const
     {
         Node const& currentNode = m_nodes[currentNodeIdx];
         if ( currentNode.IsLeafNode() )
@@ -271,6 +272,19 @@ namespace EE::Math
         return outResults.size() > 0;
     }
 
+    bool AABBTree::FindOverlaps( AABB const& queryBox, TFrameVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        FindAllOverlappingLeafNodes( m_rootNodeIdx, queryBox, outResults );
+        return outResults.size() > 0;
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
@@ -2,6 +2,7 @@
 
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Types/Arrays.h"
+#include "Base/Memory/FrameAllocator.h"
 
 //-------------------------------------------------------------------------
 
@@ -49,6 +50,7 @@ namespace EE::Math
         EE_FORCE_INLINE void RemoveBox( void* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
 
         bool FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const;
+        bool FindOverlaps( AABB const& queryBox, TFrameVector<uint64_t>& outResults ) const;
 
         template<typename T>
         bool FindOverlaps( AABB const& queryBox, TVector<T*>& outResults ) const
@@ -56,6 +58,12 @@ namespace EE::Math
             return FindOverlaps( queryBox, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
         }
 
+        template<typename T>
+        bool FindOverlaps( AABB const& queryBox, TFrameVector<T*>& outResults ) const
+        {
+            return FindOverlaps( queryBox, reinterpret_cast<TFrameVector<uint64_t>&>( outResults ) );
+        }
+
         #if EE_DEVELOPMENT_TOOLS
         void DrawDebug( Drawing::DrawContext& drawingContext ) const;
         #endif
@@ -70,7 +78,8 @@ namespace EE::Math
         void ReleaseNode( int32_t nodeIdx );
 
         int32_t FindBestLeafNodeToCreateSiblingFor( int32_t startNodeIdx, AABB const& newBox ) const;
-        void FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, TVector<uint64_t>& outResults ) const;
+        template<typename VectorType>
+        void FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, VectorType& outResults ) const;
         void FindAllOverlappingLeafNodes( int32_t currentNodeIdx, OBB const& queryBox, TVector<uint64_t>& outResults ) const;
 
         #if EE_DEVELOPMENT_TOOLS
@@ -25,6 +25,7 @@ namespace EE
     struct EE_BASE_API AABB
     {
         EE_SERIALIZE( m_center, m_halfExtents );
+        EE_SERIALIZE_FLAT_POD( AABB, m_center, m_halfExtents );
 
     public:
 
@@ -147,6 +148,7 @@ namespace EE
     struct EE_BASE_API OBB
     {
         EE_SERIALIZE( m_center, m_extents, m_orientation );
+        EE_SERIALIZE_FLAT_POD( OBB, m_center, m_extents, m_orientation );
 
         OBB() = default;
         OBB( Vector center, Vector extents, Quaternion orientation = Quaternion::Identity );
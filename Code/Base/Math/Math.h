@@ -268,6 +268,7 @@ namespace EE
     struct EE_BASE_API Int2
     {
         EE_SERIALIZE( m_x, m_y );
+        EE_SERIALIZE_FLAT_POD( Int2, m_x, m_y );
 
         static Int2 const Zero;
 
@@ -318,6 +319,7 @@ namespace EE
     struct EE_BASE_API Int4
     {
         EE_SERIALIZE( m_x, m_y, m_z, m_w );
+        EE_SERIALIZE_FLAT_POD( Int4, m_x, m_y, m_z, m_w );
 
         static Int4 const Zero;
 
@@ -367,6 +369,7 @@ namespace EE
     struct EE_BASE_API Float2
     {
         EE_SERIALIZE( m_x, m_y );
+        EE_SERIALIZE_FLAT_POD( Float2, m_x, m_y );
 
         static Float2 const Zero;
         static Float2 const One;
@@ -420,6 +423,7 @@ namespace EE
     struct EE_BASE_API Float3
     {
         EE_SERIALIZE( m_x, m_y, m_z );
+        EE_SERIALIZE_FLAT_POD( Float3, m_x, m_y, m_z );
 
         static Float3 const Zero;
         static Float3 const One;
@@ -478,6 +482,7 @@ namespace EE
     struct EE_BASE_API Float4
     {
         EE_SERIALIZE( m_x, m_y, m_z, m_w );
+        EE_SERIALIZE_FLAT_POD( Float4, m_x, m_y, m_z, m_w );
 
         static Float4 const Zero;
         static Float4 const One;
@@ -569,6 +574,7 @@ namespace EE
     struct Degrees
     {
         EE_SERIALIZE( m_value );
+        EE_SERIALIZE_FLAT_POD( Degrees, m_value );
 
     public:
 
@@ -718,6 +724,7 @@ namespace EE
     struct EE_BASE_API Radians
     {
         EE_SERIALIZE( m_value );
+        EE_SERIALIZE_FLAT_POD( Radians, m_value );
 
         static Radians const Pi;
         static Radians const TwoPi;
@@ -945,6 +952,7 @@ namespace EE
     struct EulerAngles
     {
         EE_SERIALIZE( m_x, m_y, m_z );
+        EE_SERIALIZE_FLAT_POD( EulerAngles, m_x, m_y, m_z );
 
     public:
 
@@ -1017,6 +1025,7 @@ namespace EE
     struct AxisAngle
     {
         EE_SERIALIZE( m_axis, m_angle );
+        EE_SERIALIZE_FLAT_POD( AxisAngle, m_axis, m_angle );
 
     public:
 
@@ -29,6 +29,8 @@ namespace EE
 
     public:
 
+        EE_SERIALIZE_FLAT_POD( Matrix, m_rows );
+
         static Matrix const Identity;
 
     public:
@@ -11,6 +11,7 @@ namespace EE
     struct FloatRange
     {
         EE_SERIALIZE( m_begin, m_end );
+        EE_SERIALIZE_FLAT_POD( FloatRange, m_begin, m_end );
 
         FloatRange() = default;
 
@@ -190,6 +191,7 @@ namespace EE
     struct IntRange
     {
         EE_SERIALIZE( m_begin, m_end );
+        EE_SERIALIZE_FLAT_POD( IntRange, m_begin, m_end );
 
         IntRange() = default;
 
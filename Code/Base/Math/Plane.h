@@ -17,6 +17,8 @@ namespace EE
 
     public:
 
+        EE_SERIALIZE_FLAT_POD( Plane, a, b, c, d );
+
         // Explicit constructors since the default ones can be easily misused
         static EE_FORCE_INLINE Plane FromNormal( Vector const& normal ) { return Plane( normal ); }
         static EE_FORCE_INLINE Plane FromNormalAndPoint( Vector const& normal, Vector const& point ) { return Plane( normal, point ); }
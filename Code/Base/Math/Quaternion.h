@@ -29,6 +29,8 @@ namespace EE
 
     public:
 
+        EE_SERIALIZE_FLAT_POD( Quaternion, m_data );
+
         static Quaternion const Identity;
 
         // Calculate the rotation required to align the source vector to the target vector (shortest path)
@@ -64,6 +64,41 @@ namespace EE
             }
         }
 
+        // Float Operations
+        //-------------------------------------------------------------------------
+        // Lane-wise helpers for structure-of-arrays code (i.e. one register per component, one lane per element)
+
+        namespace Float
+        {
+            // Returns V2 for every lane where the control mask is set, V1 otherwise
+            EE_FORCE_INLINE __m128 Select( __m128 V1, __m128 V2, __m128 control )
+            {
+                return _mm_or_ps( _mm_andnot_ps( control, V1 ), _mm_and_ps( V2, control ) );
+            }
+
+            // result = addend + ( V1 * V2 )
+            EE_FORCE_INLINE __m128 MultiplyAdd( __m128 V1, __m128 V2, __m128 addend )
+            {
+                return _mm_add_ps( _mm_mul_ps( V1, V2 ), addend );
+            }
+
+            // Lane-wise 4 component dot product of two SoA blocks
+            EE_FORCE_INLINE __m128 Dot4( __m128 x0, __m128 y0, __m128 z0, __m128 w0, __m128 x1, __m128 y1, __m128 z1, __m128 w1 )
+            {
+                __m128 result = _mm_mul_ps( x0, x1 );
+                result = MultiplyAdd( y0, y1, result );
+                result = MultiplyAdd( z0, z1, result );
+                result = MultiplyAdd( w0, w1, result );
+                return result;
+            }
+
+            // In-place 4x4 transpose, used to convert between AoS and SoA layouts
+            EE_FORCE_INLINE void Transpose( __m128& r0, __m128& r1, __m128& r2, __m128& r3 )
+            {
+                _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+            }
+        }
+
         //-------------------------------------------------------------------------
 
         static __m128 const g_sinCoefficients0 = { -0.16666667f, +0.0083333310f, -0.00019840874f, +2.7525562e-06f };
@@ -18,6 +18,8 @@ namespace EE
 
     public:
 
+        EE_SERIALIZE_FLAT_POD( Transform, m_rotation, m_translationScale );
+
         static Transform const Identity;
 
         EE_FORCE_INLINE static Transform FromRotation( Quaternion const& rotation ) { return Transform( rotation ); }
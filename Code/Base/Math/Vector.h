@@ -32,6 +32,8 @@ namespace EE
 
     public:
 
+        EE_SERIALIZE_FLAT_POD( Vector, m_data );
+
         static Vector const UnitX;
         static Vector const UnitY;
         static Vector const UnitZ;
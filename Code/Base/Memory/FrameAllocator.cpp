@@ -0,0 +1,290 @@
+#include "FrameAllocator.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Math/Math.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    namespace
+    {
+        constexpr static size_t const g_arenaAlignment = 16;
+
+        #if EE_DEVELOPMENT_TOOLS
+        constexpr static uint32_t const g_allocationMagic = 0xEEF4A3E5;
+        constexpr static uint8_t const g_guardByte = 0xFD;
+        constexpr static uint8_t const g_releasedMemoryByte = 0xDD;
+        constexpr static size_t const g_guardSize = 16;
+
+        // In development builds, each allocation is prefixed by a header so that we can walk the arena and check the guard bytes after each allocation
+        struct AllocationHeader
+        {
+            uint32_t                                m_magic;
+            uint32_t                                m_blockSize;
+            uint32_t                                m_dataOffset;
+            uint32_t                                m_size;
+        };
+
+        static_assert( sizeof( AllocationHeader ) == g_arenaAlignment, "Blocks need to remain aligned" );
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        struct FrameArena
+        {
+            uint8_t*                                m_pMemory = nullptr;
+            std::atomic<size_t>                     m_offset = 0;
+            TVector<void*>                          m_overflowAllocations;
+            size_t                                  m_overflowBytes = 0;
+        };
+
+        struct FrameAllocatorState
+        {
+            inline FrameArena& GetCurrentArena() { return m_arenas[m_frameIndex.load( std::memory_order_relaxed ) & 1]; }
+
+        public:
+
+            FrameArena                              m_arenas[2];
+            size_t                                  m_arenaSize = 0;
+            std::atomic<uint32_t>                   m_frameIndex = 0;
+            Threading::Mutex                        m_overflowMutex;
+            Threading::Mutex                        m_arenaAllocationMutex;
+            FrameAllocatorStats                     m_stats;
+            std::atomic<bool>                       m_areArenasAllocated = false;   // The arenas are only allocated on the first frame allocation
+            bool                                    m_isInitialized = false;
+        };
+
+        static FrameAllocatorState g_frameAllocator;
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        static void ValidateArena( FrameArena const& arena )
+        {
+            size_t const usedSize = Math::Min( arena.m_offset.load( std::memory_order_relaxed ), g_frameAllocator.m_arenaSize );
+
+            // Blocks are contiguous from the start of the arena, the first block that didnt fit was never written (and so has no valid header)
+            size_t blockOffset = 0;
+            while ( blockOffset + sizeof( AllocationHeader ) <= usedSize )
+            {
+                auto pHeader = reinterpret_cast<AllocationHeader const*>( arena.m_pMemory + blockOffset );
+                if ( pHeader->m_magic != g_allocationMagic )
+                {
+                    break;
+                }
+
+                uint8_t const* pGuard = reinterpret_cast<uint8_t const*>( pHeader ) + pHeader->m_dataOffset + pHeader->m_size;
+                for ( size_t i = 0; i < g_guardSize; i++ )
+                {
+                    if ( pGuard[i] != g_guardByte )
+                    {
+                        EE_LOG_ERROR( "Memory", "Frame Allocator", "Frame allocation overrun detected! (Allocation size: %u)", pHeader->m_size );
+                        EE_HALT();
+                        break;
+                    }
+                }
+
+                blockOffset += pHeader->m_blockSize;
+            }
+        }
+        #endif
+
+        static void AllocateArenas()
+        {
+            Threading::ScopeLock lock( g_frameAllocator.m_arenaAllocationMutex );
+
+            // Another thread might have allocated the arenas while we were waiting for the lock
+            if ( g_frameAllocator.m_areArenasAllocated.load( std::memory_order_relaxed ) )
+            {
+                return;
+            }
+
+            for ( FrameArena& arena : g_frameAllocator.m_arenas )
+            {
+                arena.m_pMemory = (uint8_t*) EE::Alloc( g_frameAllocator.m_arenaSize, g_arenaAlignment );
+
+                #if EE_DEVELOPMENT_TOOLS
+                memset( arena.m_pMemory, g_releasedMemoryByte, g_frameAllocator.m_arenaSize );
+                #endif
+            }
+
+            g_frameAllocator.m_areArenasAllocated.store( true, std::memory_order_release );
+        }
+
+        static void ReleaseArena( FrameArena& arena )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            size_t const usedSize = Math::Min( arena.m_offset.load( std::memory_order_relaxed ), g_frameAllocator.m_arenaSize );
+            if ( usedSize > 0 )
+            {
+                ValidateArena( arena );
+
+                // Fill the released memory so that any use after the end of the frame is obvious
+                memset( arena.m_pMemory, g_releasedMemoryByte, usedSize );
+            }
+            #endif
+
+            for ( void*& pOverflowAllocation : arena.m_overflowAllocations )
+            {
+                EE::Free( pOverflowAllocation );
+            }
+
+            arena.m_overflowAllocations.clear();
+            arena.m_overflowBytes = 0;
+            arena.m_offset.store( 0, std::memory_order_relaxed );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void InitializeFrameAllocator( size_t arenaSize )
+    {
+        EE_ASSERT( !g_frameAllocator.m_isInitialized );
+        EE_ASSERT( arenaSize > 0 && arenaSize % g_arenaAlignment == 0 );
+
+        g_frameAllocator.m_arenaSize = arenaSize;
+        g_frameAllocator.m_frameIndex = 0;
+        g_frameAllocator.m_stats = FrameAllocatorStats();
+        g_frameAllocator.m_stats.m_arenaSize = arenaSize;
+
+        // The arena memory is only allocated once something uses the frame allocator
+        for ( FrameArena& arena : g_frameAllocator.m_arenas )
+        {
+            arena.m_pMemory = nullptr;
+            arena.m_offset = 0;
+        }
+
+        g_frameAllocator.m_areArenasAllocated = false;
+        g_frameAllocator.m_isInitialized = true;
+    }
+
+    void ShutdownFrameAllocator()
+    {
+        EE_ASSERT( g_frameAllocator.m_isInitialized );
+
+        for ( FrameArena& arena : g_frameAllocator.m_arenas )
+        {
+            ReleaseArena( arena );
+            arena.m_overflowAllocations.shrink_to_fit();
+
+            if ( arena.m_pMemory != nullptr )
+            {
+                EE::Free( arena.m_pMemory );
+            }
+        }
+
+        g_frameAllocator.m_areArenasAllocated = false;
+        g_frameAllocator.m_isInitialized = false;
+    }
+
+    bool IsFrameAllocatorInitialized()
+    {
+        return g_frameAllocator.m_isInitialized;
+    }
+
+    void AdvanceFrame()
+    {
+        EE_ASSERT( g_frameAllocator.m_isInitialized );
+
+        // Update stats for the completed frame
+        //-------------------------------------------------------------------------
+
+        FrameArena& completedArena = g_frameAllocator.GetCurrentArena();
+        FrameAllocatorStats& stats = g_frameAllocator.m_stats;
+        stats.m_usedBytes = Math::Min( completedArena.m_offset.load( std::memory_order_relaxed ), g_frameAllocator.m_arenaSize );
+        stats.m_overflowBytes = completedArena.m_overflowBytes;
+        stats.m_numOverflowAllocations = (uint32_t) completedArena.m_overflowAllocations.size();
+
+        size_t const totalUsedBytes = stats.m_usedBytes + stats.m_overflowBytes;
+        if ( totalUsedBytes > stats.m_highWaterMark )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            if ( stats.m_overflowBytes > 0 )
+            {
+                EE_LOG_WARNING( "Memory", "Frame Allocator", "Frame allocator overflowed by %zu bytes (%u heap allocations), consider increasing the frame arena size (%zu)", stats.m_overflowBytes, stats.m_numOverflowAllocations, g_frameAllocator.m_arenaSize );
+            }
+            #endif
+
+            stats.m_highWaterMark = totalUsedBytes;
+        }
+
+        // Switch arenas, the arena we switch to contains the previous frame's allocations
+        //-------------------------------------------------------------------------
+
+        g_frameAllocator.m_frameIndex.fetch_add( 1, std::memory_order_relaxed );
+        ReleaseArena( g_frameAllocator.GetCurrentArena() );
+    }
+
+    uint32_t GetFrameAllocatorFrameIndex()
+    {
+        return g_frameAllocator.m_frameIndex.load( std::memory_order_relaxed );
+    }
+
+    FrameAllocatorStats GetFrameAllocatorStats()
+    {
+        return g_frameAllocator.m_stats;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* FrameAlloc( size_t size, size_t alignment )
+    {
+        EE_ASSERT( g_frameAllocator.m_isInitialized );
+        EE_ASSERT( Math::IsPowerOf2( alignment ) );
+
+        if ( size == 0 )
+        {
+            return nullptr;
+        }
+
+        if ( !g_frameAllocator.m_areArenasAllocated.load( std::memory_order_acquire ) )
+        {
+            AllocateArenas();
+        }
+
+        FrameArena& arena = g_frameAllocator.GetCurrentArena();
+
+        // Reserve space for the worst case alignment padding, this keeps the allocation to a single atomic operation
+        #if EE_DEVELOPMENT_TOOLS
+        size_t const blockSize = sizeof( AllocationHeader ) + ( alignment - 1 ) + size + g_guardSize;
+        #else
+        size_t const blockSize = ( alignment - 1 ) + size;
+        #endif
+
+        size_t const alignedBlockSize = blockSize + CalculatePaddingForAlignment( (uintptr_t) blockSize, g_arenaAlignment );
+        size_t const blockOffset = arena.m_offset.fetch_add( alignedBlockSize, std::memory_order_relaxed );
+        if ( blockOffset + alignedBlockSize <= g_frameAllocator.m_arenaSize )
+        {
+            uint8_t* pBlock = arena.m_pMemory + blockOffset;
+
+            #if EE_DEVELOPMENT_TOOLS
+            uint8_t* pData = pBlock + sizeof( AllocationHeader );
+            pData += CalculatePaddingForAlignment( pData, alignment );
+            memset( pData + size, g_guardByte, g_guardSize );
+
+            auto pHeader = reinterpret_cast<AllocationHeader*>( pBlock );
+            pHeader->m_magic = g_allocationMagic;
+            pHeader->m_blockSize = (uint32_t) alignedBlockSize;
+            pHeader->m_dataOffset = (uint32_t) ( pData - pBlock );
+            pHeader->m_size = (uint32_t) size;
+            return pData;
+            #else
+            return pBlock + CalculatePaddingForAlignment( pBlock, alignment );
+            #endif
+        }
+
+        // The arena is full, so fallback to the heap, these allocations are freed when the arena is released
+        //-------------------------------------------------------------------------
+
+        void* pMemory = EE::Alloc( size, alignment );
+        {
+            Threading::ScopeLock lock( g_frameAllocator.m_overflowMutex );
+            arena.m_overflowAllocations.emplace_back( pMemory );
+            arena.m_overflowBytes += size;
+        }
+
+        return pMemory;
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Base/Memory/Memory.h"
+#include "EASTL/vector.h"
+
+//-------------------------------------------------------------------------
+// Frame Allocator
+//-------------------------------------------------------------------------
+// A double-buffered linear allocator for transient data that only needs to live for the current frame
+// Allocations are a single atomic bump so this can be used from any thread, there is no free, all memory is released when the frame advances
+// Memory allocated during frame N remains valid until the end of frame N+1 (i.e. it can be handed off to the next frame's render/debug drawing)
+//
+// When an arena is full, allocations fall back to the heap and are freed when the arena is reset, so running out of frame memory is slow but safe
+// Development builds check allocations for overruns (guard bytes), fill released memory with a pattern and validate that frame containers are not used after their frame
+// The arenas are only allocated on the first frame allocation, so the allocator has no memory cost until something uses it
+//
+// Note: 'AdvanceFrame' must only be called when no other threads can be allocating (i.e. at the end of the frame once all tasks are complete)
+
+namespace EE::Memory
+{
+    struct FrameAllocatorStats
+    {
+        size_t      m_arenaSize = 0;            // The size of each of the two arenas
+        size_t      m_usedBytes = 0;            // Bytes used by the last completed frame
+        size_t      m_highWaterMark = 0;        // The most bytes used in a single frame
+        size_t      m_overflowBytes = 0;        // Bytes that didnt fit in the arena during the last completed frame
+        uint32_t    m_numOverflowAllocations = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    constexpr static size_t const g_defaultFrameArenaSize = 8 * 1024 * 1024;
+
+    EE_BASE_API void InitializeFrameAllocator( size_t arenaSize = g_defaultFrameArenaSize );
+    EE_BASE_API void ShutdownFrameAllocator();
+    EE_BASE_API bool IsFrameAllocatorInitialized();
+
+    // Release the memory allocated two frames ago and start allocating from that arena
+    EE_BASE_API void AdvanceFrame();
+
+    // The index of the current frame, incremented by 'AdvanceFrame'
+    EE_BASE_API uint32_t GetFrameAllocatorFrameIndex();
+
+    // Is memory allocated during the specified frame still valid
+    EE_FORCE_INLINE bool IsFrameMemoryValid( uint32_t frameIndex )
+    {
+        uint32_t const currentFrameIndex = GetFrameAllocatorFrameIndex();
+        return frameIndex == currentFrameIndex || frameIndex + 1 == currentFrameIndex;
+    }
+
+    EE_BASE_API FrameAllocatorStats GetFrameAllocatorStats();
+
+    [[nodiscard]] EE_BASE_API void* FrameAlloc( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT );
+
+    // Construct an object in frame memory, the destructor is never called so this should only be used for trivially destructible types
+    template< typename T, typename ... ConstructorParams >
+    [[nodiscard]] EE_FORCE_INLINE T* FrameNew( ConstructorParams&&... params )
+    {
+        static_assert( std::is_trivially_destructible<T>::value, "Frame allocated objects are never destroyed" );
+        void* pMemory = FrameAlloc( sizeof( T ), alignof( T ) );
+        return new( pMemory ) T( std::forward<ConstructorParams>( params )... );
+    }
+
+    //-------------------------------------------------------------------------
+    // EASTL allocator adapter
+    //-------------------------------------------------------------------------
+    // Containers using this allocator must not outlive the next frame, deallocation is a no-op
+
+    class FrameAllocatorAdapter
+    {
+    public:
+
+        explicit FrameAllocatorAdapter( char const* pName = nullptr )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            m_frameIndex = GetFrameAllocatorFrameIndex();
+            #endif
+        }
+
+        FrameAllocatorAdapter( FrameAllocatorAdapter const& rhs, char const* pName = nullptr ) : FrameAllocatorAdapter( pName ) {}
+
+        // Assigning an adapter rebinds the container to the adapter's frame, this allows persistent containers to be reused across frames:
+        // 'container.reset_lose_memory(); container.set_allocator( FrameAllocatorAdapter() );'
+        FrameAllocatorAdapter& operator=( FrameAllocatorAdapter const& rhs )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            m_frameIndex = rhs.m_frameIndex;
+            #endif
+            return *this;
+        }
+
+        inline void* allocate( size_t n, int flags = 0 )
+        {
+            return allocate( n, EASTL_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
+        }
+
+        inline void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_ASSERT( IsFrameMemoryValid( m_frameIndex ) ); // Frame container used after its frame ended
+            #endif
+
+            return FrameAlloc( n, alignment );
+        }
+
+        inline void deallocate( void* p, size_t n )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_ASSERT( p == nullptr || IsFrameMemoryValid( m_frameIndex ) ); // Frame container destroyed after its frame ended
+            #endif
+        }
+
+        inline char const* get_name() const { return "EE Frame Allocator"; }
+        inline void set_name( char const* pName ) {}
+
+        inline bool operator==( FrameAllocatorAdapter const& rhs ) const { return true; }
+        inline bool operator!=( FrameAllocatorAdapter const& rhs ) const { return false; }
+
+    private:
+
+        #if EE_DEVELOPMENT_TOOLS
+        uint32_t                    m_frameIndex = 0;
+        #endif
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    template<typename T> using TFrameVector = eastl::vector<T, Memory::FrameAllocatorAdapter>;
+}
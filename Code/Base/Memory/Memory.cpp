@@ -1,4 +1,7 @@
 #include "Memory.h"
+#include "ScratchAllocator.h"
+#include "MemoryTracking.h"
+#include "Base/Math/Math.h"
 
 //-------------------------------------------------------------------------
 
@@ -22,6 +25,56 @@ namespace EE
         static bool g_isMemorySystemInitialized = false;
         static rpmalloc_config_t g_rpmallocConfig;
 
+        #if EE_DEVELOPMENT_TOOLS
+        static thread_local uint64_t g_numAllocationsOnCurrentThread = 0;
+
+        // In development builds, every allocation is prefixed with a small header so that we can attribute frees to the tag the memory was allocated with
+        // The header is placed directly before the returned address, and the offset lets us find the start of the underlying allocation
+        struct AllocationHeader
+        {
+            uint64_t    m_size;
+            uint32_t    m_offset;
+            MemoryTag   m_tag;
+            uint8_t     m_padding[3];
+        };
+
+        static_assert( sizeof( AllocationHeader ) == 16, "Allocation header size changed, this will break the alignment of allocations" );
+
+        EE_FORCE_INLINE AllocationHeader* GetAllocationHeader( void* pMemory )
+        {
+            return reinterpret_cast<AllocationHeader*>( pMemory ) - 1;
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE void* SystemAlloc( size_t size, size_t alignment )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            return rpaligned_alloc( alignment, size );
+            #elif _WIN32
+            return _aligned_malloc( size, alignment );
+            #endif
+        }
+
+        EE_FORCE_INLINE void* SystemRealloc( void* pMemory, size_t newSize, size_t alignment )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            return rprealloc( pMemory, newSize );
+            #elif _WIN32
+            return _aligned_realloc( pMemory, newSize, alignment );
+            #endif
+        }
+
+        EE_FORCE_INLINE void SystemFree( void* pMemory )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            rpfree( pMemory );
+            #elif _WIN32
+            _aligned_free( pMemory );
+            #endif
+        }
+
         //-------------------------------------------------------------------------
 
         static void CustomAssert( char const* pMessage )
@@ -47,6 +100,7 @@ namespace EE
         void Shutdown()
         {
             EE_ASSERT( g_isMemorySystemInitialized );
+            ReleaseThreadScratchMemory();
             g_isMemorySystemInitialized = false;
 
             #if EE_USE_CUSTOM_ALLOCATOR
@@ -66,6 +120,8 @@ namespace EE
 
         void ShutdownThreadHeap()
         {
+            ReleaseThreadScratchMemory();
+
             #if EE_USE_CUSTOM_ALLOCATOR
             rpmalloc_thread_finalize( 1 );
             #endif
@@ -94,6 +150,13 @@ namespace EE
             return 0;
             #endif
         }
+
+        #if EE_DEVELOPMENT_TOOLS
+        uint64_t GetNumAllocationsOnCurrentThread()
+        {
+            return g_numAllocationsOnCurrentThread;
+        }
+        #endif
     }
 
     //-------------------------------------------------------------------------
@@ -104,12 +167,22 @@ namespace EE
 
         if ( size == 0 ) return nullptr;
 
-        void* pMemory = nullptr;
+        #if EE_DEVELOPMENT_TOOLS
+        Memory::g_numAllocationsOnCurrentThread++;
+
+        // The offset needs to be a multiple of the alignment, so that the returned address remains aligned
+        size_t const offset = Math::Max( alignment, sizeof( Memory::AllocationHeader ) );
+        uint8_t* pAllocation = (uint8_t*) Memory::SystemAlloc( size + offset, alignment );
+        EE_ASSERT( pAllocation != nullptr );
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        pMemory = rpaligned_alloc( alignment, size );
-        #elif _WIN32
-        pMemory = _aligned_malloc( size, alignment );
+        void* pMemory = pAllocation + offset;
+        Memory::AllocationHeader* pHeader = Memory::GetAllocationHeader( pMemory );
+        pHeader->m_size = size;
+        pHeader->m_offset = (uint32_t) offset;
+        pHeader->m_tag = Memory::GetCurrentMemoryTag();
+        Memory::Tracking::OnAllocation( pHeader->m_tag, size );
+        #else
+        void* pMemory = Memory::SystemAlloc( size, alignment );
         #endif
 
         EE_ASSERT( Memory::IsAligned( pMemory, alignment ) );
@@ -120,12 +193,44 @@ namespace EE
     {
         EE_ASSERT( EE::Memory::g_isMemorySystemInitialized );
 
+        #if EE_DEVELOPMENT_TOOLS
+        if ( pMemory == nullptr )
+        {
+            return Alloc( newSize, originalAlignment );
+        }
+
+        Memory::g_numAllocationsOnCurrentThread++;
+
+        // Reallocated memory keeps the tag it was originally allocated with
+        Memory::AllocationHeader const originalHeader = *Memory::GetAllocationHeader( pMemory );
+        Memory::Tracking::OnFree( originalHeader.m_tag, originalHeader.m_size );
+
         void* pReallocatedMemory = nullptr;
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        pReallocatedMemory = rprealloc( pMemory, newSize );
-        #elif _WIN32
-        pReallocatedMemory = _aligned_realloc( pMemory, newSize, originalAlignment );
+        // The system realloc only guarantees the default alignment, so over-aligned allocations need to be moved manually
+        if ( originalHeader.m_offset == sizeof( Memory::AllocationHeader ) && originalAlignment <= sizeof( Memory::AllocationHeader ) )
+        {
+            uint8_t* pAllocation = (uint8_t*) pMemory - originalHeader.m_offset;
+            uint8_t* pReallocatedAllocation = (uint8_t*) Memory::SystemRealloc( pAllocation, newSize + originalHeader.m_offset, originalAlignment );
+            EE_ASSERT( pReallocatedAllocation != nullptr );
+            pReallocatedMemory = pReallocatedAllocation + originalHeader.m_offset;
+        }
+        else
+        {
+            uint8_t* pReallocatedAllocation = (uint8_t*) Memory::SystemAlloc( newSize + originalHeader.m_offset, originalAlignment );
+            EE_ASSERT( pReallocatedAllocation != nullptr );
+            pReallocatedMemory = pReallocatedAllocation + originalHeader.m_offset;
+            memcpy( pReallocatedMemory, pMemory, Math::Min( (size_t) originalHeader.m_size, newSize ) );
+            Memory::SystemFree( (uint8_t*) pMemory - originalHeader.m_offset );
+        }
+
+        Memory::AllocationHeader* pHeader = Memory::GetAllocationHeader( pReallocatedMemory );
+        pHeader->m_size = newSize;
+        pHeader->m_offset = originalHeader.m_offset;
+        pHeader->m_tag = originalHeader.m_tag;
+        Memory::Tracking::OnAllocation( pHeader->m_tag, newSize );
+        #else
+        void* pReallocatedMemory = Memory::SystemRealloc( pMemory, newSize, originalAlignment );
         #endif
 
         EE_ASSERT( pReallocatedMemory != nullptr );
@@ -136,10 +241,15 @@ namespace EE
     {
         EE_ASSERT( EE::Memory::g_isMemorySystemInitialized );
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        rpfree( (uint8_t*) pMemory );
-        #elif _WIN32
-        _aligned_free( pMemory );
+        #if EE_DEVELOPMENT_TOOLS
+        if ( pMemory != nullptr )
+        {
+            Memory::AllocationHeader const* pHeader = Memory::GetAllocationHeader( pMemory );
+            Memory::Tracking::OnFree( pHeader->m_tag, pHeader->m_size );
+            Memory::SystemFree( (uint8_t*) pMemory - pHeader->m_offset );
+        }
+        #else
+        Memory::SystemFree( pMemory );
         #endif
 
         pMemory = nullptr;
@@ -77,6 +77,11 @@ namespace EE
 
         EE_BASE_API size_t GetTotalRequestedMemory();
         EE_BASE_API size_t GetTotalAllocatedMemory();
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Get the number of allocations (and reallocations) made on the calling thread, useful to verify that a piece of code doesnt allocate
+        EE_BASE_API uint64_t GetNumAllocationsOnCurrentThread();
+        #endif
     }
 
     //-------------------------------------------------------------------------
@@ -0,0 +1,314 @@
+#include "MemoryTracking.h"
+#include "Base/Math/Math.h"
+
+#if EE_DEVELOPMENT_TOOLS
+#include <atomic>
+#include <mutex>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <dbghelp.h>
+#endif
+
+//-------------------------------------------------------------------------
+// Note: None of the code in here is allowed to allocate memory through EE::Alloc, since it is called from within it
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    namespace
+    {
+        constexpr static uint32_t const g_numTagCounterShards = 16;
+        constexpr static uint32_t const g_maxAllocationSamples = 256;
+        constexpr static uint32_t const g_numTags = (uint32_t) MemoryTag::Count;
+
+        // Each thread only updates its own shard to reduce contention, the shards are summed when reading the stats
+        struct alignas( 64 ) TagCounterShard
+        {
+            struct Counters
+            {
+                std::atomic<int64_t>                m_liveBytes = 0;
+                std::atomic<int64_t>                m_numLiveAllocations = 0;
+                std::atomic<uint64_t>               m_totalAllocatedBytes = 0;
+                std::atomic<uint64_t>               m_totalAllocations = 0;
+            };
+
+            Counters                                m_counters[g_numTags];
+        };
+
+        struct FrameStats
+        {
+            uint64_t                                m_lastTotalAllocatedBytes = 0;
+            uint64_t                                m_lastTotalAllocations = 0;
+            uint64_t                                m_frameAllocatedBytes = 0;
+            uint64_t                                m_frameAllocations = 0;
+            uint64_t                                m_peakFrameAllocatedBytes = 0;
+            uint64_t                                m_history[g_memoryTrackingFrameHistorySize] = {};
+        };
+
+        static TagCounterShard                      g_tagCounterShards[g_numTagCounterShards];
+        static std::atomic<uint32_t>                g_nextShardIdx = 0;
+        static thread_local uint32_t const          g_threadShardIdx = g_nextShardIdx.fetch_add( 1, std::memory_order_relaxed ) % g_numTagCounterShards;
+        static thread_local MemoryTag               g_currentThreadTag = MemoryTag::Untagged;
+
+        // Frame stats are only touched by the frame update and the tools, never by the allocation functions
+        static std::mutex                           g_frameStatsMutex;
+        static FrameStats                           g_frameStats[g_numTags];
+        static std::atomic<uint64_t>                g_frameIndex = 0;
+
+        // Sampling
+        static std::atomic<uint32_t>                g_samplingRate = 0;
+        static thread_local uint32_t                g_numThreadAllocationsSinceLastSample = 0;
+        static std::mutex                           g_samplesMutex;
+        static AllocationSample                     g_samples[g_maxAllocationSamples];
+        static uint32_t                             g_nextSampleIdx = 0;
+        static uint32_t                             g_numSamples = 0;
+
+        //-------------------------------------------------------------------------
+
+        static void SumShards( MemoryTag tag, MemoryTagStats& outStats )
+        {
+            uint32_t const tagIdx = (uint32_t) tag;
+            for ( auto const& shard : g_tagCounterShards )
+            {
+                auto const& counters = shard.m_counters[tagIdx];
+                outStats.m_liveBytes += counters.m_liveBytes.load( std::memory_order_relaxed );
+                outStats.m_numLiveAllocations += counters.m_numLiveAllocations.load( std::memory_order_relaxed );
+                outStats.m_totalAllocatedBytes += counters.m_totalAllocatedBytes.load( std::memory_order_relaxed );
+                outStats.m_totalAllocations += counters.m_totalAllocations.load( std::memory_order_relaxed );
+            }
+        }
+
+        static void RecordSample( MemoryTag tag, size_t size )
+        {
+            AllocationSample sample;
+            sample.m_size = size;
+            sample.m_tag = tag;
+            sample.m_frameIndex = g_frameIndex.load( std::memory_order_relaxed );
+
+            // Skip the tracking and allocation functions
+            constexpr static uint32_t const numFramesToSkip = 3;
+
+            #ifdef _WIN32
+            sample.m_callstackDepth = RtlCaptureStackBackTrace( numFramesToSkip, AllocationSample::s_maxCallstackDepth, reinterpret_cast<PVOID*>( sample.m_callstack ), nullptr );
+            #endif
+
+            //-------------------------------------------------------------------------
+
+            std::lock_guard<std::mutex> lock( g_samplesMutex );
+            g_samples[g_nextSampleIdx] = sample;
+            g_nextSampleIdx = ( g_nextSampleIdx + 1 ) % g_maxAllocationSamples;
+            g_numSamples = Math::Min( g_numSamples + 1, g_maxAllocationSamples );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    char const* GetMemoryTagName( MemoryTag tag )
+    {
+        switch ( tag )
+        {
+            case MemoryTag::Untagged: return "Untagged";
+            case MemoryTag::Resource: return "Resource";
+            case MemoryTag::Entity: return "Entity";
+            case MemoryTag::Animation: return "Animation";
+            case MemoryTag::Physics: return "Physics";
+            case MemoryTag::Navigation: return "Navigation";
+            case MemoryTag::Rendering: return "Rendering";
+
+            default:
+            EE_UNREACHABLE_CODE();
+            return "Unknown";
+        }
+    }
+
+    MemoryTag GetCurrentMemoryTag()
+    {
+        return g_currentThreadTag;
+    }
+
+    MemoryTag SetCurrentMemoryTag( MemoryTag tag )
+    {
+        EE_ASSERT( tag < MemoryTag::Count );
+        MemoryTag const previousTag = g_currentThreadTag;
+        g_currentThreadTag = tag;
+        return previousTag;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EndMemoryTrackingFrame()
+    {
+        std::lock_guard<std::mutex> lock( g_frameStatsMutex );
+
+        uint64_t const frameIndex = g_frameIndex.load( std::memory_order_relaxed );
+        uint32_t const historyIdx = frameIndex % g_memoryTrackingFrameHistorySize;
+
+        for ( uint32_t i = 0; i < g_numTags; i++ )
+        {
+            MemoryTagStats stats;
+            SumShards( (MemoryTag) i, stats );
+
+            FrameStats& frameStats = g_frameStats[i];
+            frameStats.m_frameAllocatedBytes = stats.m_totalAllocatedBytes - frameStats.m_lastTotalAllocatedBytes;
+            frameStats.m_frameAllocations = stats.m_totalAllocations - frameStats.m_lastTotalAllocations;
+            frameStats.m_peakFrameAllocatedBytes = Math::Max( frameStats.m_peakFrameAllocatedBytes, frameStats.m_frameAllocatedBytes );
+            frameStats.m_lastTotalAllocatedBytes = stats.m_totalAllocatedBytes;
+            frameStats.m_lastTotalAllocations = stats.m_totalAllocations;
+            frameStats.m_history[historyIdx] = frameStats.m_frameAllocatedBytes;
+        }
+
+        g_frameIndex.store( frameIndex + 1, std::memory_order_relaxed );
+    }
+
+    uint64_t GetMemoryTrackingFrameIndex()
+    {
+        return g_frameIndex.load( std::memory_order_relaxed );
+    }
+
+    MemoryTagStats GetMemoryTagStats( MemoryTag tag )
+    {
+        EE_ASSERT( tag < MemoryTag::Count );
+
+        MemoryTagStats stats;
+        SumShards( tag, stats );
+
+        std::lock_guard<std::mutex> lock( g_frameStatsMutex );
+        FrameStats const& frameStats = g_frameStats[(uint32_t) tag];
+        stats.m_frameAllocatedBytes = frameStats.m_frameAllocatedBytes;
+        stats.m_frameAllocations = frameStats.m_frameAllocations;
+        stats.m_peakFrameAllocatedBytes = frameStats.m_peakFrameAllocatedBytes;
+        return stats;
+    }
+
+    void GetMemoryTagFrameHistory( MemoryTag tag, float* pOutHistory )
+    {
+        EE_ASSERT( tag < MemoryTag::Count && pOutHistory != nullptr );
+
+        std::lock_guard<std::mutex> lock( g_frameStatsMutex );
+        FrameStats const& frameStats = g_frameStats[(uint32_t) tag];
+
+        // The next slot to be written is the oldest one
+        uint64_t const oldestIdx = g_frameIndex.load( std::memory_order_relaxed );
+        for ( uint32_t i = 0; i < g_memoryTrackingFrameHistorySize; i++ )
+        {
+            pOutHistory[i] = (float) frameStats.m_history[( oldestIdx + i ) % g_memoryTrackingFrameHistorySize];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SetAllocationSamplingRate( uint32_t sampleEveryNthAllocation )
+    {
+        g_samplingRate.store( sampleEveryNthAllocation, std::memory_order_relaxed );
+    }
+
+    uint32_t GetAllocationSamplingRate()
+    {
+        return g_samplingRate.load( std::memory_order_relaxed );
+    }
+
+    uint32_t GetAllocationSamples( AllocationSample* pOutSamples, uint32_t maxSamples )
+    {
+        EE_ASSERT( pOutSamples != nullptr );
+
+        std::lock_guard<std::mutex> lock( g_samplesMutex );
+        uint32_t const numSamplesToCopy = Math::Min( maxSamples, g_numSamples );
+        for ( uint32_t i = 0; i < numSamplesToCopy; i++ )
+        {
+            uint32_t const sampleIdx = ( g_nextSampleIdx + g_maxAllocationSamples - 1 - i ) % g_maxAllocationSamples;
+            pOutSamples[i] = g_samples[sampleIdx];
+        }
+
+        return numSamplesToCopy;
+    }
+
+    void ClearAllocationSamples()
+    {
+        std::lock_guard<std::mutex> lock( g_samplesMutex );
+        g_nextSampleIdx = 0;
+        g_numSamples = 0;
+    }
+
+    void ResolveCallstackSymbols( uint64_t const* pAddresses, uint32_t numAddresses, TVector<String>& outSymbols )
+    {
+        EE_ASSERT( pAddresses != nullptr || numAddresses == 0 );
+
+        outSymbols.clear();
+        outSymbols.reserve( numAddresses );
+
+        #ifdef _WIN32
+        // The symbol handler is only kept alive for the duration of the call, since the crash handler also needs to initialize it
+        HANDLE process = GetCurrentProcess();
+        SymSetOptions( SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES | SYMOPT_UNDNAME );
+        bool const symbolsInitialized = SymInitialize( process, nullptr, true );
+
+        for ( uint32_t i = 0; i < numAddresses; i++ )
+        {
+            uint64_t const address = pAddresses[i];
+
+            ULONG64 buffer[( sizeof( SYMBOL_INFO ) + MAX_SYM_NAME * sizeof( char ) + sizeof( ULONG64 ) - 1u ) / sizeof( ULONG64 )] = {};
+            SYMBOL_INFO* pSymbolInfo = reinterpret_cast<SYMBOL_INFO*>( buffer );
+            pSymbolInfo->SizeOfStruct = sizeof( SYMBOL_INFO );
+            pSymbolInfo->MaxNameLen = MAX_SYM_NAME;
+
+            DWORD64 symbolDisplacement = 0u;
+            if ( symbolsInitialized && SymFromAddr( process, address, &symbolDisplacement, pSymbolInfo ) )
+            {
+                DWORD lineDisplacement = 0u;
+                IMAGEHLP_LINE64 line = {};
+                line.SizeOfStruct = sizeof( IMAGEHLP_LINE64 );
+                if ( SymGetLineFromAddr64( process, address, &lineDisplacement, &line ) )
+                {
+                    outSymbols.emplace_back().sprintf( "%s (%s:%u)", pSymbolInfo->Name, line.FileName, line.LineNumber );
+                }
+                else
+                {
+                    outSymbols.emplace_back( pSymbolInfo->Name );
+                }
+            }
+            else
+            {
+                outSymbols.emplace_back().sprintf( "0x%016llX", address );
+            }
+        }
+
+        if ( symbolsInitialized )
+        {
+            SymCleanup( process );
+        }
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace Tracking
+    {
+        void OnAllocation( MemoryTag tag, size_t size )
+        {
+            auto& counters = g_tagCounterShards[g_threadShardIdx].m_counters[(uint32_t) tag];
+            counters.m_liveBytes.fetch_add( (int64_t) size, std::memory_order_relaxed );
+            counters.m_numLiveAllocations.fetch_add( 1, std::memory_order_relaxed );
+            counters.m_totalAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+            counters.m_totalAllocations.fetch_add( 1, std::memory_order_relaxed );
+
+            //-------------------------------------------------------------------------
+
+            uint32_t const samplingRate = g_samplingRate.load( std::memory_order_relaxed );
+            if ( samplingRate > 0 && ++g_numThreadAllocationsSinceLastSample >= samplingRate )
+            {
+                g_numThreadAllocationsSinceLastSample = 0;
+                RecordSample( tag, size );
+            }
+        }
+
+        void OnFree( MemoryTag tag, size_t size )
+        {
+            // Frees are attributed to the shard of the freeing thread, so individual shards can go negative
+            auto& counters = g_tagCounterShards[g_threadShardIdx].m_counters[(uint32_t) tag];
+            counters.m_liveBytes.fetch_sub( (int64_t) size, std::memory_order_relaxed );
+            counters.m_numLiveAllocations.fetch_sub( 1, std::memory_order_relaxed );
+        }
+    }
+}
+#endif
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "Base/Esoterica.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/String.h"
+#include <stddef.h>
+
+//-------------------------------------------------------------------------
+// Memory Tracking
+//-------------------------------------------------------------------------
+// In development builds, every allocation made through EE::Alloc is attributed to the calling thread's current memory tag
+// Use 'EE_MEMORY_TAG_SCOPE( Animation )' to tag all allocations within a scope, nested scopes override outer ones
+// Allocations keep their tag for their whole lifetime, so it doesnt matter where they are freed
+//
+// Counters are sharded across threads to keep the overhead low, so stats are only approximate while other threads are allocating
+// Optionally, the callstack for every Nth allocation can be recorded to find out who is allocating
+//
+// All of this is compiled out when EE_DEVELOPMENT_TOOLS is disabled
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Memory
+{
+    enum class MemoryTag : uint8_t
+    {
+        Untagged = 0,
+        Resource,
+        Entity,
+        Animation,
+        Physics,
+        Navigation,
+        Rendering,
+
+        Count
+    };
+
+    EE_BASE_API char const* GetMemoryTagName( MemoryTag tag );
+
+    //-------------------------------------------------------------------------
+
+    struct MemoryTagStats
+    {
+        int64_t                         m_liveBytes = 0;
+        int64_t                         m_numLiveAllocations = 0;
+        uint64_t                        m_totalAllocatedBytes = 0;
+        uint64_t                        m_totalAllocations = 0;
+
+        // Allocations made during the last completed frame (i.e. the churn)
+        uint64_t                        m_frameAllocatedBytes = 0;
+        uint64_t                        m_frameAllocations = 0;
+        uint64_t                        m_peakFrameAllocatedBytes = 0;
+    };
+
+    struct AllocationSample
+    {
+        constexpr static uint32_t const s_maxCallstackDepth = 16;
+
+        uint64_t                        m_callstack[s_maxCallstackDepth];
+        size_t                          m_size = 0;
+        uint64_t                        m_frameIndex = 0;
+        uint32_t                        m_callstackDepth = 0;
+        MemoryTag                       m_tag = MemoryTag::Untagged;
+    };
+
+    //-------------------------------------------------------------------------
+
+    EE_BASE_API MemoryTag GetCurrentMemoryTag();
+
+    // Set the tag for the calling thread, returns the previous tag
+    EE_BASE_API MemoryTag SetCurrentMemoryTag( MemoryTag tag );
+
+    class [[nodiscard]] ScopedMemoryTag
+    {
+    public:
+
+        ScopedMemoryTag( MemoryTag tag ) : m_previousTag( SetCurrentMemoryTag( tag ) ) {}
+        ~ScopedMemoryTag() { SetCurrentMemoryTag( m_previousTag ); }
+
+        ScopedMemoryTag( ScopedMemoryTag const& ) = delete;
+        ScopedMemoryTag& operator=( ScopedMemoryTag const& ) = delete;
+
+    private:
+
+        MemoryTag                       m_previousTag;
+    };
+
+    //-------------------------------------------------------------------------
+
+    constexpr static uint32_t const g_memoryTrackingFrameHistorySize = 128;
+
+    // Calculate the per-frame stats and start a new frame, needs to be called once per frame
+    EE_BASE_API void EndMemoryTrackingFrame();
+
+    EE_BASE_API uint64_t GetMemoryTrackingFrameIndex();
+
+    EE_BASE_API MemoryTagStats GetMemoryTagStats( MemoryTag tag );
+
+    // Get the bytes allocated each frame for the last 'g_memoryTrackingFrameHistorySize' frames (oldest first)
+    EE_BASE_API void GetMemoryTagFrameHistory( MemoryTag tag, float* pOutHistory );
+
+    //-------------------------------------------------------------------------
+
+    // Record the callstack for every Nth allocation, set to 0 to disable sampling
+    EE_BASE_API void SetAllocationSamplingRate( uint32_t sampleEveryNthAllocation );
+    EE_BASE_API uint32_t GetAllocationSamplingRate();
+
+    // Copy out the recorded samples, returns the number of samples copied (most recent first)
+    EE_BASE_API uint32_t GetAllocationSamples( AllocationSample* pOutSamples, uint32_t maxSamples );
+    EE_BASE_API void ClearAllocationSamples();
+
+    // Resolve callstack addresses into readable symbols, this is slow and is only intended for tools
+    EE_BASE_API void ResolveCallstackSymbols( uint64_t const* pAddresses, uint32_t numAddresses, TVector<String>& outSymbols );
+
+    //-------------------------------------------------------------------------
+
+    // Called by the allocation functions
+    namespace Tracking
+    {
+        void OnAllocation( MemoryTag tag, size_t size );
+        void OnFree( MemoryTag tag, size_t size );
+    }
+}
+
+//-------------------------------------------------------------------------
+
+#define EE_MEMORY_TAG_SCOPE_NAME_IMPL( a, b ) a##b
+#define EE_MEMORY_TAG_SCOPE_NAME( a, b ) EE_MEMORY_TAG_SCOPE_NAME_IMPL( a, b )
+#define EE_MEMORY_TAG_SCOPE( tag ) EE::Memory::ScopedMemoryTag const EE_MEMORY_TAG_SCOPE_NAME( _memoryTagScope, __LINE__ )( EE::Memory::MemoryTag::tag )
+
+#else
+
+#define EE_MEMORY_TAG_SCOPE( tag )
+
+#endif
@@ -0,0 +1,163 @@
+#include "ScratchAllocator.h"
+#include "Base/Math/Math.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    namespace
+    {
+        constexpr static size_t const g_overflowBlockHeaderSize = 16;
+
+        #if EE_DEVELOPMENT_TOOLS
+        constexpr static uint8_t const g_releasedMemoryByte = 0xDD;
+        constexpr static uint32_t const g_maxMarkerDepth = 32;
+        #endif
+
+        // Heap allocations made when the stack is full, these form a list (most recent first) so that markers can free everything allocated after them
+        struct OverflowBlock
+        {
+            OverflowBlock*                          m_pNext = nullptr;
+        };
+
+        static_assert( sizeof( OverflowBlock ) <= g_overflowBlockHeaderSize, "Overflow block header doesnt fit" );
+
+        struct ScratchStack
+        {
+            uint8_t*                                m_pMemory = nullptr;
+            size_t                                  m_capacity = 0;
+            size_t                                  m_offset = 0;
+            OverflowBlock*                          m_pOverflowHead = nullptr;
+            uint32_t                                m_markerDepth = 0;
+
+            #if EE_DEVELOPMENT_TOOLS
+            uint32_t                                m_nextMarkerSerial = 1;
+            uint32_t                                m_markerSerials[g_maxMarkerDepth] = {};
+            #endif
+        };
+
+        static thread_local ScratchStack* g_pThreadScratchStack = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static ScratchStack* GetOrCreateThreadScratchStack()
+        {
+            if ( g_pThreadScratchStack == nullptr )
+            {
+                g_pThreadScratchStack = EE::New<ScratchStack>();
+                g_pThreadScratchStack->m_capacity = g_defaultScratchStackSize;
+                g_pThreadScratchStack->m_pMemory = (uint8_t*) EE::Alloc( g_defaultScratchStackSize, 16 );
+            }
+
+            return g_pThreadScratchStack;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* ScratchAlloc( size_t size, size_t alignment )
+    {
+        ScratchStack* pStack = g_pThreadScratchStack;
+        EE_ASSERT( pStack != nullptr && pStack->m_markerDepth > 0 ); // Scratch allocations require an active marker
+        EE_ASSERT( Math::IsPowerOf2( alignment ) );
+
+        if ( size == 0 )
+        {
+            return nullptr;
+        }
+
+        uint8_t* pTop = pStack->m_pMemory + pStack->m_offset;
+        size_t const requiredSize = CalculatePaddingForAlignment( pTop, alignment ) + size;
+        if ( pStack->m_offset + requiredSize <= pStack->m_capacity )
+        {
+            pStack->m_offset += requiredSize;
+            return pTop + ( requiredSize - size );
+        }
+
+        // The stack is full, so fallback to the heap, this is freed when the current marker is released
+        //-------------------------------------------------------------------------
+
+        size_t const dataOffset = Math::Max( alignment, g_overflowBlockHeaderSize );
+        auto pBlock = new( EE::Alloc( dataOffset + size, dataOffset ) ) OverflowBlock();
+        pBlock->m_pNext = pStack->m_pOverflowHead;
+        pStack->m_pOverflowHead = pBlock;
+        return reinterpret_cast<uint8_t*>( pBlock ) + dataOffset;
+    }
+
+    void ReleaseThreadScratchMemory()
+    {
+        if ( g_pThreadScratchStack != nullptr )
+        {
+            EE_ASSERT( g_pThreadScratchStack->m_markerDepth == 0 && g_pThreadScratchStack->m_pOverflowHead == nullptr );
+            EE::Free( g_pThreadScratchStack->m_pMemory );
+            EE::Delete( g_pThreadScratchStack );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    ScopedScratchMarker::ScopedScratchMarker()
+    {
+        ScratchStack* pStack = GetOrCreateThreadScratchStack();
+        m_offset = pStack->m_offset;
+        m_pOverflowHead = pStack->m_pOverflowHead;
+        m_depth = ++pStack->m_markerDepth;
+
+        #if EE_DEVELOPMENT_TOOLS
+        EE_ASSERT( m_depth <= g_maxMarkerDepth );
+        pStack->m_markerSerials[m_depth - 1] = pStack->m_nextMarkerSerial++;
+        #endif
+    }
+
+    ScopedScratchMarker::~ScopedScratchMarker()
+    {
+        ScratchStack* pStack = g_pThreadScratchStack;
+        EE_ASSERT( pStack != nullptr && pStack->m_markerDepth == m_depth ); // Markers must be released in reverse order
+
+        // Free any heap allocations made after this marker was created
+        while ( pStack->m_pOverflowHead != m_pOverflowHead )
+        {
+            void* pBlock = pStack->m_pOverflowHead;
+            pStack->m_pOverflowHead = pStack->m_pOverflowHead->m_pNext;
+            EE::Free( pBlock );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        memset( pStack->m_pMemory + m_offset, g_releasedMemoryByte, pStack->m_offset - m_offset );
+        pStack->m_markerSerials[m_depth - 1] = 0;
+        #endif
+
+        pStack->m_offset = m_offset;
+        pStack->m_markerDepth--;
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    ScratchMarkerID GetCurrentScratchMarkerID()
+    {
+        ScratchMarkerID markerID;
+
+        ScratchStack const* pStack = g_pThreadScratchStack;
+        if ( pStack != nullptr && pStack->m_markerDepth > 0 )
+        {
+            markerID.m_pStack = pStack;
+            markerID.m_depth = pStack->m_markerDepth;
+            markerID.m_serial = pStack->m_markerSerials[pStack->m_markerDepth - 1];
+        }
+
+        return markerID;
+    }
+
+    bool IsScratchMarkerActive( ScratchMarkerID const& markerID )
+    {
+        ScratchStack const* pStack = g_pThreadScratchStack;
+        if ( pStack == nullptr || markerID.m_pStack != pStack || markerID.m_depth == 0 || markerID.m_depth > pStack->m_markerDepth )
+        {
+            return false;
+        }
+
+        return pStack->m_markerSerials[markerID.m_depth - 1] == markerID.m_serial;
+    }
+    #endif
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Base/Memory/Memory.h"
+#include "EASTL/vector.h"
+#include "EASTL/fixed_vector.h"
+
+//-------------------------------------------------------------------------
+// Scratch Allocator
+//-------------------------------------------------------------------------
+// Each thread has its own scratch stack for temporary allocations that dont outlive a function (e.g. the intermediate buffers for a pose blend)
+// Allocations are only valid within a 'ScopedScratchMarker' scope, releasing the marker returns the stack to where it was when the marker was created
+// No synchronization is needed since the stack is only ever accessed by the owning thread
+//
+// When the stack is full, allocations fall back to the heap and are freed when the marker is released
+// Development builds validate that markers are released in order, that scratch containers are only used on their owning thread within their marker's scope and fill released memory with a pattern
+
+namespace EE::Memory
+{
+    constexpr static size_t const g_defaultScratchStackSize = 1024 * 1024;
+
+    // Allocate memory from the calling thread's scratch stack, there must be an active marker on this thread
+    [[nodiscard]] EE_BASE_API void* ScratchAlloc( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT );
+
+    // Free the calling thread's scratch stack, called automatically when the thread's heap is shutdown
+    EE_BASE_API void ReleaseThreadScratchMemory();
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API [[nodiscard]] ScopedScratchMarker
+    {
+    public:
+
+        ScopedScratchMarker();
+        ~ScopedScratchMarker();
+
+        ScopedScratchMarker( ScopedScratchMarker const& ) = delete;
+        ScopedScratchMarker& operator=( ScopedScratchMarker const& ) = delete;
+
+    private:
+
+        size_t                      m_offset = 0;
+        void*                       m_pOverflowHead = nullptr;
+        uint32_t                    m_depth = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    // Identifies a specific marker on a specific thread
+    struct ScratchMarkerID
+    {
+        inline bool operator==( ScratchMarkerID const& rhs ) const { return m_pStack == rhs.m_pStack && m_depth == rhs.m_depth && m_serial == rhs.m_serial; }
+        inline bool operator!=( ScratchMarkerID const& rhs ) const { return !operator==( rhs ); }
+
+        void const*                 m_pStack = nullptr;
+        uint32_t                    m_depth = 0;
+        uint32_t                    m_serial = 0;
+    };
+
+    // Get the ID of the innermost active marker on the calling thread
+    EE_BASE_API ScratchMarkerID GetCurrentScratchMarkerID();
+
+    // Is the specified marker still active on the calling thread
+    EE_BASE_API bool IsScratchMarkerActive( ScratchMarkerID const& markerID );
+    #endif
+
+    //-------------------------------------------------------------------------
+    // EASTL allocator adapter
+    //-------------------------------------------------------------------------
+    // Containers using this allocator belong to the innermost marker at the time of their creation and must not outlive it, deallocation is a no-op
+    // Since allocations always come from the top of the stack, containers can only grow while their own marker is the innermost one
+
+    class ScratchAllocatorAdapter
+    {
+    public:
+
+        explicit ScratchAllocatorAdapter( char const* pName = nullptr )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            m_markerID = GetCurrentScratchMarkerID();
+            EE_ASSERT( m_markerID.m_depth > 0 ); // Scratch containers require an active marker
+            #endif
+        }
+
+        ScratchAllocatorAdapter( ScratchAllocatorAdapter const& rhs, char const* pName = nullptr ) : ScratchAllocatorAdapter( pName ) {}
+        ScratchAllocatorAdapter& operator=( ScratchAllocatorAdapter const& rhs ) { return *this; }
+
+        inline void* allocate( size_t n, int flags = 0 )
+        {
+            return allocate( n, EASTL_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
+        }
+
+        inline void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_ASSERT( GetCurrentScratchMarkerID() == m_markerID ); // Scratch container grown on another thread or within a nested marker
+            #endif
+
+            return ScratchAlloc( n, alignment );
+        }
+
+        inline void deallocate( void* p, size_t n )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_ASSERT( p == nullptr || IsScratchMarkerActive( m_markerID ) ); // Scratch container outlived its marker
+            #endif
+        }
+
+        inline char const* get_name() const { return "EE Scratch Allocator"; }
+        inline void set_name( char const* pName ) {}
+
+        inline bool operator==( ScratchAllocatorAdapter const& rhs ) const { return true; }
+        inline bool operator!=( ScratchAllocatorAdapter const& rhs ) const { return false; }
+
+    private:
+
+        #if EE_DEVELOPMENT_TOOLS
+        ScratchMarkerID             m_markerID;
+        #endif
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    template<typename T> using TScratchVector = eastl::vector<T, Memory::ScratchAllocatorAdapter>;
+    template<typename T, eastl_size_t S> using TInlineScratchVector = eastl::fixed_vector<T, S, true, Memory::ScratchAllocatorAdapter>;
+}
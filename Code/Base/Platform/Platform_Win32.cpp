@@ -222,7 +222,7 @@ namespace EE::Platform
             case EXCEPTION_SINGLE_STEP:
             {
                 GenerateCrashDump( pExceptionPtrs );
-                Log::System::SaveToFile();
+                Log::System::Flush();
             }
             break;
         }
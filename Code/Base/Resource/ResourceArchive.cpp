@@ -0,0 +1,326 @@
+#include "ResourceArchive.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Math/Math.h"
+#include "Base/Profiling.h"
+#include "EASTL/sort.h"
+#include <stdio.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    void ResourceArchive::GetArchivesInDirectory( FileSystem::Path const& directoryPath, TVector<FileSystem::Path>& outArchivePaths )
+    {
+        outArchivePaths.clear();
+
+        if ( !directoryPath.Exists() )
+        {
+            return;
+        }
+
+        FileSystem::GetDirectoryContents( directoryPath, outArchivePaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::DontExpand, { ResourceArchiveFormat::s_fileExtension } );
+        eastl::sort( outArchivePaths.begin(), outArchivePaths.end(), [] ( FileSystem::Path const& a, FileSystem::Path const& b ) { return strcmp( a.c_str(), b.c_str() ) < 0; } );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ResourceArchive::Open( FileSystem::Path const& archivePath )
+    {
+        EE_ASSERT( !IsOpen() );
+
+        if ( !m_mappedFile.Open( archivePath.c_str() ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to open archive: %s", archivePath.c_str() );
+            return false;
+        }
+
+        // Validate the header and table of contents
+        //-------------------------------------------------------------------------
+
+        auto IsValidArchive = [this] ()
+        {
+            if ( m_mappedFile.GetSize() < sizeof( ResourceArchiveFormat::Header ) )
+            {
+                return false;
+            }
+
+            auto pHeader = reinterpret_cast<ResourceArchiveFormat::Header const*>( m_mappedFile.GetData() );
+            if ( pHeader->m_magic != ResourceArchiveFormat::s_magic || pHeader->m_version != ResourceArchiveFormat::s_version )
+            {
+                return false;
+            }
+
+            uint64_t const tocSize = uint64_t( pHeader->m_numEntries ) * sizeof( ResourceArchiveFormat::Entry );
+            if ( pHeader->m_tocOffset % alignof( ResourceArchiveFormat::Entry ) != 0 || pHeader->m_tocOffset + tocSize > m_mappedFile.GetSize() )
+            {
+                return false;
+            }
+
+            m_pEntries = reinterpret_cast<ResourceArchiveFormat::Entry const*>( m_mappedFile.GetData() + pHeader->m_tocOffset );
+            m_numEntries = pHeader->m_numEntries;
+
+            for ( uint32_t i = 0; i < m_numEntries; i++ )
+            {
+                ResourceArchiveFormat::Entry const& entry = m_pEntries[i];
+                if ( entry.m_offset + entry.m_size > pHeader->m_tocOffset || ( i > 0 && !( m_pEntries[i - 1] < entry ) ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        if ( !IsValidArchive() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Invalid or corrupt archive: %s", archivePath.c_str() );
+            Close();
+            return false;
+        }
+
+        m_path = archivePath;
+        return true;
+    }
+
+    void ResourceArchive::Close()
+    {
+        m_mappedFile.Close();
+        m_pEntries = nullptr;
+        m_numEntries = 0;
+        m_path.Clear();
+    }
+
+    bool ResourceArchive::FindResourceData( ResourcePath const& resourcePath, uint8_t const*& pOutData, size_t& outDataSize ) const
+    {
+        EE_ASSERT( IsOpen() );
+
+        ResourceArchiveFormat::Entry searchEntry;
+        searchEntry.m_pathHash = ResourceArchiveFormat::GetPathHash( resourcePath );
+
+        ResourceArchiveFormat::Entry const* pEntriesEnd = m_pEntries + m_numEntries;
+        ResourceArchiveFormat::Entry const* pFoundEntry = eastl::lower_bound( m_pEntries, pEntriesEnd, searchEntry );
+        if ( pFoundEntry == pEntriesEnd || pFoundEntry->m_pathHash != searchEntry.m_pathHash )
+        {
+            return false;
+        }
+
+        if ( pFoundEntry->m_compression != ResourceArchiveFormat::Compression::None )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Unsupported compression for resource %s in archive: %s", resourcePath.c_str(), m_path.c_str() );
+            return false;
+        }
+
+        pOutData = m_mappedFile.GetData() + pFoundEntry->m_offset;
+        outDataSize = (size_t) pFoundEntry->m_size;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceArchiveBuilder::AddFile( ResourcePath const& resourcePath, FileSystem::Path const& compiledFilePath )
+    {
+        EE_ASSERT( resourcePath.IsValid() && compiledFilePath.IsFilePath() );
+
+        uint64_t const pathHash = ResourceArchiveFormat::GetPathHash( resourcePath );
+        auto const foundIter = m_pathHashToFileIdx.find( pathHash );
+        if ( foundIter != m_pathHashToFileIdx.end() )
+        {
+            // Different paths with the same hash cannot be stored in the same archive set
+            ResourcePath const& existingPath = m_files[foundIter->second].m_resourcePath;
+            if ( existingPath != resourcePath )
+            {
+                m_collisionErrors.append_sprintf( "Resource path hash collision: %s and %s\n", existingPath.c_str(), resourcePath.c_str() );
+            }
+
+            return;
+        }
+
+        m_pathHashToFileIdx.insert( { pathHash, (uint32_t) m_files.size() } );
+        m_files.push_back( { resourcePath, compiledFilePath } );
+    }
+
+    bool ResourceArchiveBuilder::Write( FileSystem::Path const& outputDirectoryPath, char const* pArchiveName, String* pOutErrorMessage ) const
+    {
+        EE_PROFILE_FUNCTION();
+        EE_ASSERT( outputDirectoryPath.IsDirectoryPath() && pArchiveName != nullptr );
+
+        auto Error = [pOutErrorMessage] ( String const& message )
+        {
+            if ( pOutErrorMessage != nullptr )
+            {
+                *pOutErrorMessage = message;
+            }
+
+            return false;
+        };
+
+        if ( !m_collisionErrors.empty() )
+        {
+            return Error( m_collisionErrors );
+        }
+
+        if ( !outputDirectoryPath.EnsureDirectoryExists() )
+        {
+            return Error( String( String::CtorSprintf(), "Failed to create output directory: %s", outputDirectoryPath.c_str() ) );
+        }
+
+        // The archives are written to temporary files and only renamed once they have all been written successfully
+        // This ensures that we never leave partially written archives on disk (or remove the previous archives if we fail)
+        auto GetArchivePath = [&] ( int32_t archiveIdx, bool isTemporaryFile )
+        {
+            return outputDirectoryPath + String( String::CtorSprintf(), isTemporaryFile ? "%s_%02d.%s.tmp" : "%s_%02d.%s", pArchiveName, archiveIdx, ResourceArchiveFormat::s_fileExtension );
+        };
+
+        //-------------------------------------------------------------------------
+
+        uint8_t const padding[ResourceArchiveFormat::s_entryAlignment] = {};
+
+        FILE* pFile = nullptr;
+        FileSystem::Path archivePath;
+        uint64_t currentOffset = 0;
+        TVector<ResourceArchiveFormat::Entry> entries;
+        int32_t numArchives = 0;
+        Blob fileData;
+
+        auto WritePadding = [&] ( uint64_t alignment )
+        {
+            uint64_t const paddingSize = Memory::CalculatePaddingForAlignment( (uintptr_t) currentOffset, (size_t) alignment );
+            if ( paddingSize > 0 )
+            {
+                fwrite( padding, paddingSize, 1, pFile );
+                currentOffset += paddingSize;
+            }
+        };
+
+        auto BeginArchive = [&] ()
+        {
+            archivePath = GetArchivePath( numArchives, true );
+            numArchives++;
+
+            pFile = fopen( archivePath.c_str(), "wb" );
+            if ( pFile == nullptr )
+            {
+                return false;
+            }
+
+            // Reserve space for the header, it is written once we know where the table of contents is
+            ResourceArchiveFormat::Header const header;
+            fwrite( &header, sizeof( header ), 1, pFile );
+            currentOffset = sizeof( header );
+            entries.clear();
+            return true;
+        };
+
+        auto EndArchive = [&] ()
+        {
+            WritePadding( alignof( ResourceArchiveFormat::Entry ) );
+
+            ResourceArchiveFormat::Header header;
+            header.m_numEntries = (uint32_t) entries.size();
+            header.m_tocOffset = currentOffset;
+
+            eastl::sort( entries.begin(), entries.end() );
+            fwrite( entries.data(), sizeof( ResourceArchiveFormat::Entry ), entries.size(), pFile );
+
+            fseek( pFile, 0, SEEK_SET );
+            fwrite( &header, sizeof( header ), 1, pFile );
+
+            bool const succeeded = ferror( pFile ) == 0;
+            fclose( pFile );
+            pFile = nullptr;
+            return succeeded;
+        };
+
+        // Close the current archive and remove all the temporary files we have written
+        auto Fail = [&] ( String const& message )
+        {
+            if ( pFile != nullptr )
+            {
+                fclose( pFile );
+                pFile = nullptr;
+            }
+
+            for ( int32_t i = 0; i < numArchives; i++ )
+            {
+                FileSystem::EraseFile( GetArchivePath( i, true ) );
+            }
+
+            return Error( message );
+        };
+
+        //-------------------------------------------------------------------------
+
+        if ( !BeginArchive() )
+        {
+            return Fail( String( String::CtorSprintf(), "Failed to create archive: %s", archivePath.c_str() ) );
+        }
+
+        for ( FileToArchive const& file : m_files )
+        {
+            if ( !FileSystem::LoadFile( file.m_filePath, fileData ) )
+            {
+                return Fail( String( String::CtorSprintf(), "Failed to read compiled resource: %s", file.m_filePath.c_str() ) );
+            }
+
+            // Start a new archive if we would go over the size limit
+            if ( !entries.empty() && currentOffset + fileData.size() > m_maxArchiveSize )
+            {
+                if ( !EndArchive() )
+                {
+                    return Fail( String( String::CtorSprintf(), "Failed to write archive: %s", archivePath.c_str() ) );
+                }
+
+                if ( !BeginArchive() )
+                {
+                    return Fail( String( String::CtorSprintf(), "Failed to create archive: %s", archivePath.c_str() ) );
+                }
+            }
+
+            WritePadding( ResourceArchiveFormat::s_entryAlignment );
+
+            ResourceArchiveFormat::Entry& entry = entries.emplace_back();
+            entry.m_pathHash = ResourceArchiveFormat::GetPathHash( file.m_resourcePath );
+            entry.m_offset = currentOffset;
+            entry.m_size = fileData.size();
+            entry.m_uncompressedSize = fileData.size();
+            entry.m_compression = ResourceArchiveFormat::Compression::None;
+
+            if ( !fileData.empty() )
+            {
+                fwrite( fileData.data(), fileData.size(), 1, pFile );
+                currentOffset += fileData.size();
+            }
+        }
+
+        if ( !EndArchive() )
+        {
+            return Fail( String( String::CtorSprintf(), "Failed to write archive: %s", archivePath.c_str() ) );
+        }
+
+        // Replace any previously written archives, otherwise stale archives could be picked up at runtime
+        //-------------------------------------------------------------------------
+
+        TVector<FileSystem::Path> existingArchives;
+        ResourceArchive::GetArchivesInDirectory( outputDirectoryPath, existingArchives );
+        for ( FileSystem::Path const& existingArchivePath : existingArchives )
+        {
+            FileSystem::EraseFile( existingArchivePath );
+        }
+
+        for ( int32_t i = 0; i < numArchives; i++ )
+        {
+            FileSystem::Path const finalArchivePath = GetArchivePath( i, false );
+            if ( rename( GetArchivePath( i, true ).c_str(), finalArchivePath.c_str() ) != 0 )
+            {
+                for ( int32_t j = 0; j < i; j++ )
+                {
+                    FileSystem::EraseFile( GetArchivePath( j, false ) );
+                }
+
+                return Fail( String( String::CtorSprintf(), "Failed to rename archive: %s", finalArchivePath.c_str() ) );
+            }
+        }
+
+        return true;
+    }
+}
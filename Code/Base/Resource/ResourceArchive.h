@@ -0,0 +1,137 @@
+#pragma once
+
+#include "ResourcePath.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Resource Archive
+//-------------------------------------------------------------------------
+// Packaged builds store the compiled resources in a few large archive files rather than thousands of loose files
+//
+// Layout: [Header][Entry data, each entry is 4KB aligned and stored in load order][Table of contents]
+// The table of contents is sorted by the 64bit hash of the resource path so we can binary search it in-place
+// The entries are stored in the order they were added (the packaging step adds them in load order) so loading a map reads the archive mostly sequentially
+// Entries are 4KB aligned so that when the archive is memory mapped, each entry has the same alignment as a mapped loose file (i.e. resources can reference the data in-place)
+//
+// Note: Entries have a compression field but only uncompressed entries are currently supported, compressed entries cannot be referenced in-place
+
+namespace EE::Resource
+{
+    struct ResourceArchiveFormat
+    {
+        constexpr static uint32_t const s_magic = 0x4B415045; // "EPAK"
+        constexpr static uint32_t const s_version = 1;
+        constexpr static uint64_t const s_entryAlignment = 4096;
+        constexpr static char const* const s_fileExtension = "pak";
+
+        enum class Compression : uint32_t
+        {
+            None = 0,
+        };
+
+        struct Header
+        {
+            uint32_t                        m_magic = s_magic;
+            uint32_t                        m_version = s_version;
+            uint32_t                        m_numEntries = 0;
+            uint32_t                        m_padding = 0;
+            uint64_t                        m_tocOffset = 0;
+        };
+
+        struct Entry
+        {
+            inline bool operator<( Entry const& rhs ) const { return m_pathHash < rhs.m_pathHash; }
+
+            uint64_t                        m_pathHash = 0;
+            uint64_t                        m_offset = 0;
+            uint64_t                        m_size = 0;             // The size of the stored data
+            uint64_t                        m_uncompressedSize = 0;
+            Compression                     m_compression = Compression::None;
+            uint32_t                        m_padding = 0;
+        };
+
+        static_assert( sizeof( Header ) == 24, "Archive header layout changed, bump the version" );
+        static_assert( sizeof( Entry ) == 40, "Archive entry layout changed, bump the version" );
+
+        // The hash used to key the table of contents, resource paths are always lowercase
+        // Note: hash the c-string (same as the path ID) since deserialized path strings can contain a trailing null
+        inline static uint64_t GetPathHash( ResourcePath const& resourcePath ) { return Hash::GetHash64( resourcePath.c_str() ); }
+    };
+
+    //-------------------------------------------------------------------------
+    // Archive Reader
+    //-------------------------------------------------------------------------
+    // The archive is memory mapped for its whole lifetime, so any data returned from it remains valid until it is closed
+
+    class EE_BASE_API ResourceArchive
+    {
+    public:
+
+        // Get all the archive files in a directory (sorted by name)
+        static void GetArchivesInDirectory( FileSystem::Path const& directoryPath, TVector<FileSystem::Path>& outArchivePaths );
+
+    public:
+
+        ResourceArchive() = default;
+        ResourceArchive( ResourceArchive&& ) = default;
+        ResourceArchive& operator=( ResourceArchive&& ) = default;
+
+        bool Open( FileSystem::Path const& archivePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_mappedFile.IsOpen(); }
+        inline uint32_t GetNumEntries() const { return m_numEntries; }
+        inline FileSystem::Path const& GetPath() const { return m_path; }
+
+        // Find the data for a resource, returns false if the archive doesnt contain it
+        bool FindResourceData( ResourcePath const& resourcePath, uint8_t const*& pOutData, size_t& outDataSize ) const;
+
+    private:
+
+        FileSystem::Path                    m_path;
+        FileSystem::MappedFile              m_mappedFile;
+        ResourceArchiveFormat::Entry const* m_pEntries = nullptr;
+        uint32_t                            m_numEntries = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Archive Builder
+    //-------------------------------------------------------------------------
+    // Collects compiled resource files (in load order) and writes them out as one or more archives
+    // A new archive is started once the current one exceeds the max archive size (a single large resource can still exceed it)
+
+    class EE_BASE_API ResourceArchiveBuilder
+    {
+        struct FileToArchive
+        {
+            ResourcePath                    m_resourcePath;
+            FileSystem::Path                m_filePath;
+        };
+
+    public:
+
+        constexpr static uint64_t const s_defaultMaxArchiveSize = 2ull * 1024 * 1024 * 1024;
+
+    public:
+
+        ResourceArchiveBuilder( uint64_t maxArchiveSize = s_defaultMaxArchiveSize ) : m_maxArchiveSize( maxArchiveSize ) {}
+
+        // Add a compiled resource file, files are stored in the order they are added and duplicates are ignored
+        void AddFile( ResourcePath const& resourcePath, FileSystem::Path const& compiledFilePath );
+
+        inline uint32_t GetNumFiles() const { return (uint32_t) m_files.size(); }
+
+        // Write the archives to the output directory (i.e. "<dir>/<name>_00.pak", "<dir>/<name>_01.pak", ...), any existing archives in that directory are replaced
+        // Fails if any of the files cannot be read or if two resource paths have the same hash, no partially written archives are left on disk if we fail
+        bool Write( FileSystem::Path const& outputDirectoryPath, char const* pArchiveName, String* pOutErrorMessage = nullptr ) const;
+
+    private:
+
+        TVector<FileToArchive>              m_files;
+        THashMap<uint64_t, uint32_t>        m_pathHashToFileIdx;
+        String                              m_collisionErrors;
+        uint64_t                            m_maxArchiveSize = s_defaultMaxArchiveSize;
+    };
+}
@@ -1,6 +1,7 @@
 #include "ResourceLoader.h"
 #include "ResourceHeader.h"
 #include "Base/Serialization/BinarySerialization.h"
+#include "Base/FileSystem/FileSystem.h"
 
 
 //-------------------------------------------------------------------------
@@ -11,7 +12,42 @@ namespace EE::Resource
     {
         Serialization::BinaryInputArchive archive;
         archive.ReadFromBlob( rawData );
+        return LoadFromArchive( resourceID, archive, pResourceRecord );
+    }
+
+    bool ResourceLoader::Load( ResourceID const& resourceID, FileSystem::MappedFile& mappedFile, ResourceRecord* pResourceRecord ) const
+    {
+        EE_ASSERT( mappedFile.IsOpen() );
+        EE_ASSERT( !pResourceRecord->m_mappedFile.IsOpen() );
+
+        Serialization::BinaryInputArchive archive;
+        archive.ReadFromMappedData( mappedFile.GetData(), mappedFile.GetSize() );
+        bool const result = LoadFromArchive( resourceID, archive, pResourceRecord );
+
+        // Keep the mapping alive for as long as the resource is loaded, otherwise we can release it immediately
+        if ( archive.HasReferencedMappedData() )
+        {
+            pResourceRecord->m_mappedFile = eastl::move( mappedFile );
+        }
+        else
+        {
+            mappedFile.Close();
+        }
+
+        return result;
+    }
 
+    bool ResourceLoader::Load( ResourceID const& resourceID, uint8_t const* pData, size_t dataSize, ResourceRecord* pResourceRecord ) const
+    {
+        EE_ASSERT( pData != nullptr && dataSize > 0 );
+
+        Serialization::BinaryInputArchive archive;
+        archive.ReadFromMappedData( pData, dataSize );
+        return LoadFromArchive( resourceID, archive, pResourceRecord );
+    }
+
+    bool ResourceLoader::LoadFromArchive( ResourceID const& resourceID, Serialization::BinaryInputArchive& archive, ResourceRecord* pResourceRecord ) const
+    {
         // Read resource header
         Resource::ResourceHeader header;
         archive << header;
@@ -34,6 +70,13 @@ namespace EE::Resource
             return false;
         }
 
+        // Invalid reads (i.e. truncated or corrupted data) dont stop the load, so we need to check for them once we are done reading
+        if ( !archive.EndReading() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Loader", "Failed to load resource: %s, the resource data is invalid!", resourceID.c_str() );
+            return false;
+        }
+
         // Loaders must always set a valid resource data ptr, even if the resource internally is invalid
         // This is enforced to prevent leaks from occurring when a loader allocates a resource, then tries to 
         // load it unsuccessfully and then forgets to release the allocated data.
@@ -67,6 +110,9 @@ namespace EE::Resource
         EE_ASSERT( pResourceRecord->IsUnloading() || pResourceRecord->HasLoadingFailed() );
         UnloadInternal( resourceID, pResourceRecord );
         pResourceRecord->m_installDependencyResourceIDs.clear();
+
+        // The resource is destroyed so nothing can be referencing the mapped file anymore
+        pResourceRecord->m_mappedFile.Close();
     }
 
     void ResourceLoader::UnloadInternal( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const
@@ -9,6 +9,7 @@
 namespace EE
 {
     namespace Serialization { class BinaryInputArchive; }
+    namespace FileSystem { class MappedFile; }
 
     //-------------------------------------------------------------------------
 
@@ -53,9 +54,18 @@ namespace EE
 
             TVector<ResourceTypeID> const& GetLoadableTypes() const { return m_loadableTypes; }
 
+            // Can multiple resources be loaded by this loader at the same time (from different threads), override this if your load function modifies shared state
+            virtual bool SupportsParallelLoading() const { return true; }
+
             // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
             bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const;
 
+            // Load directly from a memory mapped compiled resource file, if the resource references any of the mapped data, the mapping is transferred to the record
+            bool Load( ResourceID const& resourceID, FileSystem::MappedFile& mappedFile, ResourceRecord* pResourceRecord ) const;
+
+            // Load from compiled resource data that outlives the resource (i.e. a mapped resource archive), the resource can reference the data in-place
+            bool Load( ResourceID const& resourceID, uint8_t const* pData, size_t dataSize, ResourceRecord* pResourceRecord ) const;
+
             // This function will destroy the created resource object
             void Unload( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
 
@@ -68,6 +78,10 @@ namespace EE
             // This function is called to check the installation state of an installing resource
             virtual InstallResult UpdateInstall( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
 
+        private:
+
+            bool LoadFromArchive( ResourceID const& resourceID, Serialization::BinaryInputArchive& archive, ResourceRecord* pResourceRecord ) const;
+
         protected:
 
             // (Required) Override this function to implement you custom deserialization and creation logic, resource header has already been read at this point
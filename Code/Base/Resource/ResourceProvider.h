@@ -46,6 +46,10 @@ namespace EE::Resource
         // Cancel a prior request
         virtual void CancelRequest( ResourceRequest* pRequest ) = 0;
 
+        // Can the compiled resource files be memory mapped when loading, this allows resources to reference their data in-place
+        // Mapped files are kept open while the resource is loaded so this should only be enabled when the files are never updated at runtime
+        virtual bool SupportsMemoryMappedFiles() const { return false; }
+
         // Get any externally updated resource for this update
         #if EE_DEVELOPMENT_TOOLS
         virtual TVector<ResourceID> const& GetExternallyUpdatedResources() const
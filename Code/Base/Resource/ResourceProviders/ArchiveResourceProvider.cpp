@@ -0,0 +1,79 @@
+#include "ArchiveResourceProvider.h"
+#include "Base/Resource/ResourceRequest.h"
+#include "Base/Resource/ResourceSettings.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ArchiveResourceProvider::IsReady() const
+    {
+        return m_isInitialized;
+    }
+
+    bool ArchiveResourceProvider::Initialize()
+    {
+        TVector<FileSystem::Path> archivePaths;
+        ResourceArchive::GetArchivesInDirectory( m_settings.m_compiledResourcePath, archivePaths );
+
+        m_archives.reserve( archivePaths.size() );
+        for ( FileSystem::Path const& archivePath : archivePaths )
+        {
+            ResourceArchive& archive = m_archives.emplace_back();
+            if ( !archive.Open( archivePath ) )
+            {
+                m_archives.clear();
+                return false;
+            }
+        }
+
+        if ( m_archives.empty() )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_LOG_WARNING( "Resource", "Archive Resource Provider", "No resource archives found in %s, all resources will be loaded from loose files", m_settings.m_compiledResourcePath.c_str() );
+            #else
+            EE_LOG_ERROR( "Resource", "Archive Resource Provider", "No resource archives found in %s", m_settings.m_compiledResourcePath.c_str() );
+            return false;
+            #endif
+        }
+
+        m_isInitialized = true;
+        return true;
+    }
+
+    void ArchiveResourceProvider::Shutdown()
+    {
+        m_archives.clear();
+        m_isInitialized = false;
+    }
+
+    void ArchiveResourceProvider::RequestRawResource( ResourceRequest* pRequest )
+    {
+        ResourcePath const& resourcePath = pRequest->GetResourceID().GetResourcePath();
+
+        uint8_t const* pData = nullptr;
+        size_t dataSize = 0;
+        for ( ResourceArchive const& archive : m_archives )
+        {
+            if ( archive.FindResourceData( resourcePath, pData, dataSize ) )
+            {
+                pRequest->OnRawResourceRequestComplete( pData, dataSize );
+                return;
+            }
+        }
+
+        // Fallback to the loose compiled file, packaged builds only contain the archives so this is only supported in development builds
+        #if EE_DEVELOPMENT_TOOLS
+        m_numLooseFileRequests++;
+        FileSystem::Path const resourceFilePath = resourcePath.ToFileSystemPath( m_settings.m_compiledResourcePath );
+        pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str() );
+        #else
+        pRequest->OnRawResourceRequestComplete( String() );
+        #endif
+    }
+
+    void ArchiveResourceProvider::CancelRequest( ResourceRequest* pRequest )
+    {
+         // Do Nothing
+    }
+}
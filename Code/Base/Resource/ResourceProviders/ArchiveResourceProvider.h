@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Base/Resource/ResourceProvider.h"
+#include "Base/Resource/ResourceArchive.h"
+
+//-------------------------------------------------------------------------
+// Serves resource requests from the packaged resource archives (see 'ResourceArchive.h')
+//-------------------------------------------------------------------------
+// All archives in the compiled resource directory are memory mapped on initialization, so a map load doesnt open any files
+// In development builds, resources that are not in any of the archives are loaded from the loose compiled files (same as the 'PackagedResourceProvider')
+
+namespace EE::Resource
+{
+    class EE_BASE_API ArchiveResourceProvider final : public ResourceProvider
+    {
+
+    public:
+
+        ArchiveResourceProvider( ResourceSettings const& settings ) : ResourceProvider( settings ) {}
+        virtual bool IsReady() const override final;
+
+        // Packaged resources are never modified at runtime
+        virtual bool SupportsMemoryMappedFiles() const override { return true; }
+
+        // Get the number of opened archives
+        inline int32_t GetNumArchives() const { return (int32_t) m_archives.size(); }
+
+        // Get the number of requests that were not found in any of the archives and so had to be loaded from a loose file
+        inline uint32_t GetNumLooseFileRequests() const { return m_numLooseFileRequests; }
+
+        virtual bool Initialize() override;
+        virtual void Shutdown() override;
+
+    private:
+
+        virtual void RequestRawResource( ResourceRequest* pRequest ) override;
+        virtual void CancelRequest( ResourceRequest* pRequest ) override;
+
+    private:
+
+        TVector<ResourceArchive>            m_archives;
+        uint32_t                            m_numLooseFileRequests = 0;
+        bool                                m_isInitialized = false;
+    };
+}
@@ -18,6 +18,9 @@ namespace EE::Resource
         PackagedResourceProvider( ResourceSettings const& settings ) : ResourceProvider( settings ) {}
         virtual bool IsReady() const override final;
 
+        // Packaged resources are never modified at runtime
+        virtual bool SupportsMemoryMappedFiles() const override { return true; }
+
     private:
 
         virtual bool Initialize() override;
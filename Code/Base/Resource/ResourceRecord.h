@@ -5,6 +5,8 @@
 #include "Base/Types/LoadingStatus.h"
 #include "Base/Types/UUID.h"
 #include "Base/Time/Time.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Threading/Threading.h"
 #include <atomic>
 
 //-------------------------------------------------------------------------
@@ -15,6 +17,7 @@ namespace EE::Resource
     // A unique record for each requested resource
     //-------------------------------------------------------------------------
     // The resource record is not threadsafe so the resource system needs to ensure that all external access is threadsafe
+    // The resource system uses the record's mutex to guard changes to the reference list (and the load/unload requests that those changes generate)
 
     class EE_BASE_API ResourceRecord
     {
@@ -84,6 +87,8 @@ namespace EE::Resource
         std::atomic<LoadingStatus>              m_loadingStatus = LoadingStatus::Unloaded;      // The state of this resource (atomic since it will be modify by resource requests which run across multiple frames)
         TVector<ResourceRequesterID>            m_references;                                   // The list of references to this resources
         TInlineVector<ResourceID, 4>            m_installDependencyResourceIDs;                 // The list of resources that need to be loaded and installed before we can install this resource
+        FileSystem::MappedFile                  m_mappedFile;                                   // The compiled resource file, only kept if the resource references data in it directly (released on unload)
+        mutable Threading::Mutex                m_mutex;                                        // Guards the reference list, only used by the resource system
 
         #if EE_DEVELOPMENT_TOOLS
         uint64_t                                m_sourceResourceHash = 0;
@@ -56,10 +56,18 @@ namespace EE::Resource
         else // Continue the load operation
         {
             m_rawResourcePath = filePath;
-            m_stage = ResourceRequest::Stage::LoadResource;
+            m_stage = ResourceRequest::Stage::ReadResourceFile;
         }
     }
 
+    void ResourceRequest::OnRawResourceRequestComplete( uint8_t const* pData, size_t dataSize )
+    {
+        EE_ASSERT( pData != nullptr && dataSize > 0 );
+        m_pPersistentResourceData = pData;
+        m_persistentResourceDataSize = dataSize;
+        m_stage = ResourceRequest::Stage::LoadResource;
+    }
+
     void ResourceRequest::SwitchToLoadTask()
     {
         EE_ASSERT( m_type == Type::Unload );
@@ -121,8 +129,13 @@ namespace EE::Resource
             }
             break;
 
+            case Stage::ReadResourceFile:
             case Stage::LoadResource:
             {
+                m_rawResourceData.clear();
+                m_mappedResourceFile.Close();
+                m_pPersistentResourceData = nullptr;
+                m_persistentResourceDataSize = 0;
                 m_stage = Stage::Complete;
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
             }
@@ -175,6 +188,12 @@ namespace EE::Resource
             }
             break;
 
+            case ResourceRequest::Stage::ReadResourceFile:
+            {
+                ReadResourceFile( requestContext );
+            }
+            break;
+
             case ResourceRequest::Stage::LoadResource:
             {
                 LoadResource( requestContext );
@@ -265,32 +284,43 @@ namespace EE::Resource
         requestContext.m_createRawRequestRequestFunction( this );
     }
 
-    void ResourceRequest::LoadResource( RequestContext& requestContext )
+    void ResourceRequest::ReadResourceFile( RequestContext& requestContext )
     {
-        EE_PROFILE_FUNCTION_RESOURCE();
-        EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
+        EE_PROFILE_SCOPE_IO( "Read File" );
+        EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
+        EE_ASSERT( m_stage == ResourceRequest::Stage::ReadResourceFile );
         EE_ASSERT( m_rawResourcePath.IsValid() );
 
-        // Read file
-        //-------------------------------------------------------------------------
+        // If supported, we memory map the file rather than reading it, resources can then reference the data in the file directly
+        bool fileReadResult = false;
 
         {
-            EE_PROFILE_SCOPE_IO( "Read File" );
-            EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
-
             #if EE_DEVELOPMENT_TOOLS
             ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_fileReadTime );
             #endif
 
-            if ( !FileSystem::LoadFile( m_rawResourcePath, m_rawResourceData ) )
-            {
-                EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
-                m_stage = ResourceRequest::Stage::Complete;
-                m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
-                return;
-            }
+            fileReadResult = requestContext.m_useMemoryMappedFiles ? m_mappedResourceFile.Open( m_rawResourcePath.c_str() ) : FileSystem::LoadFile( m_rawResourcePath, m_rawResourceData );
+        }
+
+        if ( !fileReadResult )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+            return;
         }
 
+        m_stage = ResourceRequest::Stage::LoadResource;
+    }
+
+    void ResourceRequest::LoadResource( RequestContext& requestContext )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
+
+        bool const usePersistentData = m_pPersistentResourceData != nullptr;
+        bool const useMappedFile = m_mappedResourceFile.IsOpen();
+
         // Load resource
         //-------------------------------------------------------------------------
 
@@ -304,13 +334,29 @@ namespace EE::Resource
             #endif
 
             // Load the resource
-            EE_ASSERT( !m_rawResourceData.empty() );
+            EE_ASSERT( usePersistentData || useMappedFile || !m_rawResourceData.empty() );
 
             #if EE_DEVELOPMENT_TOOLS
             ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_loadTime );
             #endif
 
-            if ( !m_pResourceLoader->Load( GetResourceID(), m_rawResourceData, m_pResourceRecord ) )
+            bool loadResult = false;
+            if ( usePersistentData )
+            {
+                loadResult = m_pResourceLoader->Load( GetResourceID(), m_pPersistentResourceData, m_persistentResourceDataSize, m_pResourceRecord );
+                m_pPersistentResourceData = nullptr;
+                m_persistentResourceDataSize = 0;
+            }
+            else if ( useMappedFile )
+            {
+                loadResult = m_pResourceLoader->Load( GetResourceID(), m_mappedResourceFile, m_pResourceRecord );
+            }
+            else
+            {
+                loadResult = m_pResourceLoader->Load( GetResourceID(), m_rawResourceData, m_pResourceRecord );
+            }
+
+            if ( !loadResult )
             {
                 EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load compiled resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
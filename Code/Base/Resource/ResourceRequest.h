@@ -20,6 +20,7 @@ namespace EE::Resource
             // Load Stages
             RequestRawResource,
             WaitForRawResourceRequest,
+            ReadResourceFile,
             LoadResource,
             WaitForLoadDependencies,
             InstallResource,
@@ -58,6 +59,7 @@ namespace EE::Resource
             TFunction<void( ResourceRequest* )> m_cancelRawRequestRequestFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_loadResourceFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_unloadResourceFunction;
+            bool m_useMemoryMappedFiles = false;
         };
 
     public:
@@ -73,6 +75,9 @@ namespace EE::Resource
 
         inline Stage GetStage() const { return m_stage; }
 
+        // Can the read and load stages of this request be run in parallel with other requests
+        inline bool SupportsParallelLoading() const { return m_pResourceLoader->SupportsParallelLoading(); }
+
         inline ResourceRecord const* GetResourceRecord() const { return m_pResourceRecord; }
         inline ResourceID const& GetResourceID() const { return m_pResourceRecord->GetResourceID(); }
         inline ResourceTypeID GetResourceTypeID() const { return m_pResourceRecord->GetResourceTypeID(); }
@@ -89,6 +94,10 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath );
 
+        // Called by the resource provider when the raw resource data is already in memory (i.e. in a mapped archive), this skips the file read
+        // The data is referenced in-place so it needs to remain valid until the resource is unloaded
+        void OnRawResourceRequestComplete( uint8_t const* pData, size_t dataSize );
+
         // This will interrupt a load task and convert it into an unload task
         void SwitchToLoadTask();
 
@@ -98,6 +107,7 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         void RequestRawResource( RequestContext& requestContext );
+        void ReadResourceFile( RequestContext& requestContext );
         void LoadResource( RequestContext& requestContext );
         void WaitForLoadDependencies( RequestContext& requestContext );
         void InstallResource( RequestContext& requestContext );
@@ -114,6 +124,9 @@ namespace EE::Resource
         ResourceLoader*                         m_pResourceLoader = nullptr;
         FileSystem::Path                        m_rawResourcePath;
         Blob                                    m_rawResourceData;
+        FileSystem::MappedFile                  m_mappedResourceFile;
+        uint8_t const*                          m_pPersistentResourceData = nullptr;
+        size_t                                  m_persistentResourceDataSize = 0;
         InstallDependencyList                   m_pendingInstallDependencies;
         InstallDependencyList                   m_installDependencies;
         Type                                    m_type = Type::Invalid;
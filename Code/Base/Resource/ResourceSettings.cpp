@@ -34,6 +34,13 @@ namespace EE::Resource
             return false;
         }
 
+        // Optional, we use the default value if not set
+        uint32_t maxConcurrentFileReads = 0;
+        if ( ini.TryGetUInt( "Resource:MaxConcurrentFileReads", maxConcurrentFileReads ) )
+        {
+            m_maxConcurrentFileReads = Math::Max( 1u, maxConcurrentFileReads );
+        }
+
         // Development only settings
         //-------------------------------------------------------------------------
 
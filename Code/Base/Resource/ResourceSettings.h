@@ -22,6 +22,7 @@ namespace EE::Resource
 
         FileSystem::Path        m_workingDirectoryPath;
         FileSystem::Path        m_compiledResourcePath;
+        uint32_t                m_maxConcurrentFileReads = 4;  // How many resource files can be read at the same time, loading (deserialization) is spread across all worker threads
 
         #if EE_DEVELOPMENT_TOOLS
         FileSystem::Path        m_packagedBuildCompiledResourcePath;
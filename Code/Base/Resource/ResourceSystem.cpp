@@ -2,6 +2,8 @@
 #include "ResourceProvider.h"
 #include "ResourceRequest.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -46,6 +48,7 @@ namespace EE::Resource
             return true;
         }
 
+        Threading::ScopeLock lock( m_pendingRequestsLock );
         if ( !m_pendingRequests.empty() )
         {
             return true;
@@ -59,9 +62,15 @@ namespace EE::Resource
     void ResourceSystem::GetUsersForResource( ResourceRecord const* pResourceRecord, TVector<ResourceRequesterID>& userIDs ) const
     {
         EE_ASSERT( pResourceRecord != nullptr );
-        Threading::RecursiveScopeLock lock( m_accessLock );
 
-        for ( auto const& requesterID : pResourceRecord->m_references )
+        // Copy the references so that we dont hold the record lock while recursing into the install dependencies
+        TInlineVector<ResourceRequesterID, 8> references;
+        {
+            Threading::ScopeLock recordLock( pResourceRecord->m_mutex );
+            references.assign( pResourceRecord->m_references.begin(), pResourceRecord->m_references.end() );
+        }
+
+        for ( auto const& requesterID : references )
         {
             // Internal user i.e. install dependency
             if ( requesterID.IsInstallDependencyRequest() )
@@ -119,7 +128,6 @@ namespace EE::Resource
     ResourceRecord* ResourceSystem::FindOrCreateResourceRecord( ResourceID const& resourceID )
     {
         EE_ASSERT( resourceID.IsValid() );
-        Threading::RecursiveScopeLock lock( m_accessLock );
 
         ResourceRecord* pRecord = nullptr;
         auto const recordIter = m_resourceRecords.find( resourceID );
@@ -139,19 +147,61 @@ namespace EE::Resource
     ResourceRecord* ResourceSystem::FindExistingResourceRecord( ResourceID const& resourceID )
     {
         EE_ASSERT( resourceID.IsValid() );
-        Threading::RecursiveScopeLock lock( m_accessLock );
 
         auto const recordIter = m_resourceRecords.find( resourceID );
         EE_ASSERT( recordIter != m_resourceRecords.end() );
         return recordIter->second;
     }
 
+    void ResourceSystem::DestroyResourceRecordIfUnused( ResourceID const& resourceID )
+    {
+        EE_ASSERT( !m_isAsyncTaskRunning );
+        Threading::ScopeLock recordsLock( m_recordsLock );
+
+        // We might have already destroyed this record (i.e. a completed unload request and an unload pending request in the same update)
+        auto const recordIter = m_resourceRecords.find( resourceID );
+        if ( recordIter == m_resourceRecords.end() )
+        {
+            return;
+        }
+
+        ResourceRecord* pRecord = recordIter->second;
+        if ( TryFindActiveRequest( pRecord ) != nullptr )
+        {
+            return;
+        }
+
+        // Other threads can only reach the record via the map (which we hold the lock for), so once we've checked that it is unused it is safe to delete
+        {
+            Threading::ScopeLock recordLock( pRecord->m_mutex );
+            if ( pRecord->HasReferences() )
+            {
+                return;
+            }
+
+            // A load and unload could have been requested since we started processing the pending requests
+            Threading::ScopeLock pendingRequestsLock( m_pendingRequestsLock );
+            auto predicate = [] ( PendingRequest const& request, ResourceRecord const* pRecord ) { return request.m_pRecord == pRecord; };
+            if ( VectorContains( m_pendingRequests, pRecord, predicate ) )
+            {
+                return;
+            }
+        }
+
+        EE_ASSERT( pRecord->IsUnloaded() || pRecord->HasLoadingFailed() );
+        m_resourceRecords.erase( recordIter );
+        EE::Delete( pRecord );
+    }
+
     void ResourceSystem::LoadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID )
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        // We lock the record before releasing the records lock, this ensures that the record cannot be destroyed before we've added our reference
+        Threading::Lock recordsLock( m_recordsLock );
+        auto pRecord = FindOrCreateResourceRecord( resourcePtr.GetResourceID() );
+        Threading::ScopeLock recordLock( pRecord->m_mutex );
+        recordsLock.unlock();
 
         // Immediately update the resource ptr
-        auto pRecord = FindOrCreateResourceRecord( resourcePtr.GetResourceID() );
         resourcePtr.m_pResourceRecord = pRecord;
 
         //-------------------------------------------------------------------------
@@ -166,14 +216,16 @@ namespace EE::Resource
 
     void ResourceSystem::UnloadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID )
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        Threading::Lock recordsLock( m_recordsLock );
+        auto pRecord = FindExistingResourceRecord( resourcePtr.GetResourceID() );
+        Threading::ScopeLock recordLock( pRecord->m_mutex );
+        recordsLock.unlock();
 
         // Immediately update the resource ptr
         resourcePtr.m_pResourceRecord = nullptr;
 
         //-------------------------------------------------------------------------
 
-        auto pRecord = FindExistingResourceRecord( resourcePtr.GetResourceID() );
         pRecord->RemoveReference( requesterID );
 
         if ( !pRecord->HasReferences() )
@@ -184,7 +236,7 @@ namespace EE::Resource
 
     void ResourceSystem::AddPendingRequest( PendingRequest&& request )
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        Threading::ScopeLock lock( m_pendingRequestsLock );
 
         // Try find a pending request for this resource ID
         auto predicate = [] ( PendingRequest const& request, ResourceID const& resourceID ) { return request.m_pRecord->GetResourceID() == resourceID; };
@@ -206,7 +258,6 @@ namespace EE::Resource
         EE_ASSERT( pResourceRecord != nullptr );
         EE_ASSERT( !m_isAsyncTaskRunning );
 
-        Threading::RecursiveScopeLock lock( m_accessLock );
         auto predicate = [] ( ResourceRequest const* pRequest, ResourceRecord const* pResourceRecord ) { return pRequest->GetResourceRecord() == pResourceRecord; };
         int32_t const foundIdx = VectorFindIndex( m_activeRequests, pResourceRecord, predicate );
 
@@ -222,7 +273,7 @@ namespace EE::Resource
 
     void ResourceSystem::UpdateResourceProvider()
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        EE_ASSERT( !m_isAsyncTaskRunning );
         m_pResourceProvider->Update();
 
         //-------------------------------------------------------------------------
@@ -238,15 +289,10 @@ namespace EE::Resource
     void ResourceSystem::Update( bool waitForAsyncTask )
     {
         EE_PROFILE_FUNCTION_RESOURCE();
+        EE_MEMORY_TAG_SCOPE( Resource );
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_pResourceProvider != nullptr );
 
-        // Update resource provider
-        //-------------------------------------------------------------------------
-        // This will also update the hot-reload data
-
-        UpdateResourceProvider();
-
         // Wait for async task to complete
         //-------------------------------------------------------------------------
 
@@ -263,14 +309,30 @@ namespace EE::Resource
 
         m_isAsyncTaskRunning = false;
 
+        // Update resource provider
+        //-------------------------------------------------------------------------
+        // This will also update the hot-reload data
+        // The provider is also used by the async task (to request raw resources) so we only update it once that task has completed
+
+        UpdateResourceProvider();
+
         // Process and Update requests
         //-------------------------------------------------------------------------
+        // Other threads are free to keep adding pending requests while we process the current ones
 
         {
-            Threading::RecursiveScopeLock lock( m_accessLock );
+            {
+                Threading::ScopeLock lock( m_pendingRequestsLock );
+                m_pendingRequestsToProcess.swap( m_pendingRequests );
+            }
 
-            for ( auto& pendingRequest : m_pendingRequests )
+            TInlineVector<ResourceID, 16> recordsToDestroy;
+
+            for ( auto& pendingRequest : m_pendingRequestsToProcess )
             {
+                // Prevent the record's references from changing while we process the request
+                Threading::ScopeLock recordLock( pendingRequest.m_pRecord->m_mutex );
+
                 // Get existing active request
                 auto pActiveRequest = TryFindActiveRequest( pendingRequest.m_pRecord );
 
@@ -308,12 +370,7 @@ namespace EE::Resource
                     {
                         if ( !pendingRequest.m_pRecord->HasReferences() )
                         {
-                            auto recordIter = m_resourceRecords.find( pendingRequest.m_pRecord->m_resourceID );
-                            EE_ASSERT( recordIter != m_resourceRecords.end() );
-                            EE_ASSERT( recordIter->second == pendingRequest.m_pRecord );
-
-                            EE::Delete( pendingRequest.m_pRecord );
-                            m_resourceRecords.erase( recordIter );
+                            recordsToDestroy.emplace_back( pendingRequest.m_pRecord->GetResourceID() );
                         }
                     }
                     else // Create new request
@@ -325,7 +382,7 @@ namespace EE::Resource
                 }
             }
 
-            m_pendingRequests.clear();
+            m_pendingRequestsToProcess.clear();
 
             // Process completed requests
             //-------------------------------------------------------------------------
@@ -339,18 +396,10 @@ namespace EE::Resource
                 m_history.emplace_back( CompletedRequestLog( pCompletedRequest->IsLoadRequest() ? PendingRequest::Type::Load : PendingRequest::Type::Unload, resourceID ) );
                 #endif
 
+                // Check if we can remove the record, we may have had a load request for it in the meantime
                 if ( pCompletedRequest->IsUnloadRequest() )
                 {
-                    // Check if we can remove the record, we may have had a load request for it in the meantime
-                    if ( !pCompletedRequest->GetResourceRecord()->HasReferences() )
-                    {
-                        auto recordIter = m_resourceRecords.find( resourceID );
-                        EE_ASSERT( recordIter != m_resourceRecords.end() );
-                        EE_ASSERT( recordIter->second == pCompletedRequest->GetResourceRecord() );
-
-                        EE::Delete( recordIter->second );
-                        m_resourceRecords.erase( recordIter );
-                    }
+                    recordsToDestroy.emplace_back( resourceID );
                 }
 
                 // Delete request
@@ -358,6 +407,15 @@ namespace EE::Resource
             }
 
             m_completedRequests.clear();
+
+            // Destroy unused records
+            //-------------------------------------------------------------------------
+            // This is done last since a record might be both in the pending and the completed lists
+
+            for ( ResourceID const& resourceID : recordsToDestroy )
+            {
+                DestroyResourceRecordIfUnused( resourceID );
+            }
         }
 
         // Kick off new async task
@@ -381,37 +439,140 @@ namespace EE::Resource
     void ResourceSystem::ProcessResourceRequests()
     {
         EE_PROFILE_FUNCTION_RESOURCE();
+        EE_MEMORY_TAG_SCOPE( Resource );
+
+        // The active request list is only modified on the main thread while this task is not running, so we can safely iterate it
+        // The context functions are threadsafe, since they are also called from the parallel read/load tasks
+
+        ResourceRequest::RequestContext context;
+        context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
+        context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
+        context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
+        context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+        context.m_useMemoryMappedFiles = m_pResourceProvider->SupportsMemoryMappedFiles();
 
+        auto IsParallelStage = [] ( ResourceRequest const* pRequest, ResourceRequest::Stage stage )
+        {
+            return pRequest->GetStage() == stage && pRequest->SupportsParallelLoading();
+        };
+
+        // Update all requests that are not reading or loading, these stages are cheap (or require ordering i.e. the provider requests and installs)
         //-------------------------------------------------------------------------
 
-        // We dont have to worry about this loop even if the m_activeRequests array is modified from another thread since we only access the array in 2 places and both use locks
-        for ( int32_t i = (int32_t) m_activeRequests.size() - 1; i >= 0; i-- )
+        for ( ResourceRequest* pRequest : m_activeRequests )
         {
-            ResourceRequest::RequestContext context;
-            context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
-            context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
-            context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
-            context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+            if ( pRequest->IsActive() && !IsParallelStage( pRequest, ResourceRequest::Stage::ReadResourceFile ) && !IsParallelStage( pRequest, ResourceRequest::Stage::LoadResource ) )
+            {
+                pRequest->Update( context );
+            }
+        }
 
-            //-------------------------------------------------------------------------
+        // Read resource files
+        //-------------------------------------------------------------------------
+        // We limit the number of reads in flight, since issuing lots of reads at once just thrashes the disk and occupies all the workers
+        // Each task partition is a read "lane" that keeps pulling requests until there are none left
 
-            bool isRequestComplete = false;
+        struct ReadResourceFilesTask : public ITaskSet
+        {
+            ReadResourceFilesTask( ResourceRequest::RequestContext& context, TVector<ResourceRequest*>& requests, uint32_t maxConcurrentReads )
+                : m_context( context )
+                , m_requests( requests )
+            {
+                m_SetSize = Math::Min( (uint32_t) m_requests.size(), maxConcurrentReads );
+            }
 
-            ResourceRequest* pRequest = m_activeRequests[i];
-            if ( pRequest->IsActive() )
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
-                isRequestComplete = pRequest->Update( context );
+                EE_PROFILE_SCOPE_IO( "Read Resource Files" );
+                EE_MEMORY_TAG_SCOPE( Resource );
+
+                uint32_t requestIdx = m_nextRequestIdx++;
+                while ( requestIdx < (uint32_t) m_requests.size() )
+                {
+                    m_requests[requestIdx]->Update( m_context );
+                    requestIdx = m_nextRequestIdx++;
+                }
             }
-            else
+
+        private:
+
+            ResourceRequest::RequestContext&        m_context;
+            TVector<ResourceRequest*>&              m_requests;
+            std::atomic<uint32_t>                   m_nextRequestIdx = 0;
+        };
+
+        m_parallelRequests.clear();
+        for ( ResourceRequest* pRequest : m_activeRequests )
+        {
+            if ( IsParallelStage( pRequest, ResourceRequest::Stage::ReadResourceFile ) )
             {
-                isRequestComplete = true;
+                m_parallelRequests.emplace_back( pRequest );
             }
+        }
 
-            //-------------------------------------------------------------------------
+        if ( !m_parallelRequests.empty() )
+        {
+            ReadResourceFilesTask readTask( context, m_parallelRequests, GetSettings().m_maxConcurrentFileReads );
+            m_taskSystem.ScheduleTask( &readTask );
+            m_taskSystem.WaitForTask( &readTask );
+        }
 
-            if ( isRequestComplete )
+        // Load resources
+        //-------------------------------------------------------------------------
+        // Deserialization is CPU bound so spread it across all the workers, this includes all the files we've just read
+
+        struct LoadResourcesTask : public ITaskSet
+        {
+            LoadResourcesTask( ResourceRequest::RequestContext& context, TVector<ResourceRequest*>& requests )
+                : m_context( context )
+                , m_requests( requests )
+            {
+                m_SetSize = (uint32_t) m_requests.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_RESOURCE( "Load Resources" );
+                EE_MEMORY_TAG_SCOPE( Resource );
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_requests[i]->Update( m_context );
+                }
+            }
+
+        private:
+
+            ResourceRequest::RequestContext&        m_context;
+            TVector<ResourceRequest*>&              m_requests;
+        };
+
+        m_parallelRequests.clear();
+        for ( ResourceRequest* pRequest : m_activeRequests )
+        {
+            if ( IsParallelStage( pRequest, ResourceRequest::Stage::LoadResource ) )
+            {
+                m_parallelRequests.emplace_back( pRequest );
+            }
+        }
+
+        if ( !m_parallelRequests.empty() )
+        {
+            LoadResourcesTask loadTask( context, m_parallelRequests );
+            m_taskSystem.ScheduleTask( &loadTask );
+            m_taskSystem.WaitForTask( &loadTask );
+        }
+
+        m_parallelRequests.clear();
+
+        // Gather completed requests
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = (int32_t) m_activeRequests.size() - 1; i >= 0; i-- )
+        {
+            // We need to process and remove completed requests at the next update stage since unload task may have queued unload requests which refer to the request's allocated memory
+            ResourceRequest* pRequest = m_activeRequests[i];
+            if ( pRequest->IsComplete() )
             {
-                // We need to process and remove completed requests at the next update stage since unload task may have queued unload requests which refer to the request's allocated memory
                 m_completedRequests.emplace_back( pRequest );
                 m_activeRequests.erase_unsorted( m_activeRequests.begin() + i );
             }
@@ -423,7 +584,7 @@ namespace EE::Resource
     #if EE_DEVELOPMENT_TOOLS
     void ResourceSystem::RequestResourceHotReload( ResourceID const& resourceID )
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        Threading::ScopeLock lock( m_recordsLock );
 
         // If the resource is not currently in use then just early-out
         auto const recordIter = m_resourceRecords.find( resourceID );
@@ -442,8 +603,8 @@ namespace EE::Resource
 
     void ResourceSystem::ClearHotReloadRequests()
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
-        m_usersThatRequireReload.clear(); 
+        EE_ASSERT( Threading::IsMainThread() );
+        m_usersThatRequireReload.clear();
         m_externallyUpdatedResources.clear();
     }
     #endif
@@ -8,6 +8,7 @@
 #include "Base/Types/Event.h"
 #include "Base/Time/TimeStamp.h"
 #include "Base/Types/HashMap.h"
+#include "Base/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -125,13 +126,18 @@ namespace EE::Resource
         ResourceSystem& operator=( const ResourceSystem& ) = delete;
         ResourceSystem& operator=( const ResourceSystem&& ) = delete;
 
+        // The records lock needs to be held when calling these functions
         ResourceRecord* FindOrCreateResourceRecord( ResourceID const& resourceID );
         ResourceRecord* FindExistingResourceRecord( ResourceID const& resourceID );
 
+        // Delete a record if nothing references it anymore and there is no request (pending or active) for it
+        void DestroyResourceRecordIfUnused( ResourceID const& resourceID );
+
+        // The record lock needs to be held when calling this function
         void AddPendingRequest( PendingRequest&& request );
         ResourceRequest* TryFindActiveRequest( ResourceRecord const* pResourceRecord ) const;
 
-        // Returns a list of all unique external references for the given resource
+        // Returns a list of all unique external references for the given resource (the records lock needs to be held)
         void GetUsersForResource( ResourceRecord const* pResourceRecord, TVector<ResourceRequesterID>& requesterIDs ) const;
 
         // Process all queued resource requests
@@ -139,16 +145,22 @@ namespace EE::Resource
 
     private:
 
+        // Locking: the records lock guards the record map, each record's mutex guards its references and the pending requests lock guards the pending request list
+        // These are always acquired in that order (records -> record -> pending requests) and the active/completed request lists are only modified by the main thread while the async task is not running
+
         TaskSystem&                                             m_taskSystem;
         ResourceProvider*                                       m_pResourceProvider = nullptr;
         THashMap<ResourceTypeID, ResourceLoader*>               m_resourceLoaders;
-        THashMap<ResourceID, ResourceRecord*>                   m_resourceRecords;
-        mutable Threading::RecursiveMutex                       m_accessLock;
+        TFlatHashMap<ResourceID, ResourceRecord*>               m_resourceRecords;
+        mutable Threading::Mutex                                m_recordsLock;
+        mutable Threading::Mutex                                m_pendingRequestsLock;
 
         // Requests
         TVector<PendingRequest>                                 m_pendingRequests;
+        TVector<PendingRequest>                                 m_pendingRequestsToProcess;
         TVector<ResourceRequest*>                               m_activeRequests;
         TVector<ResourceRequest*>                               m_completedRequests;
+        TVector<ResourceRequest*>                               m_parallelRequests;         // Temporary list used by the async task
 
         // ASync
         AsyncTask                                               m_asyncProcessingTask;
@@ -2,6 +2,9 @@
 #include "Base/Types/String.h"
 #include "Base/Types/StringID.h"
 #include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Types/MappedArray.h"
+#include "Base/Types/FlatHashMap.h"
+#include "Base/Math/Math.h"
 
 #include "Base/ThirdParty/mpack/mpack.h"
 
@@ -11,7 +14,36 @@ namespace EE::Serialization
 {
     int32_t GetBinarySerializationVersion()
     {
-        return 5;
+        return 7;
+    }
+
+    //-------------------------------------------------------------------------
+    // Flat Format
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // 0xC1 is the one byte that is never used by msgpack, so it can never be the start of an mpack stream
+        constexpr static uint8_t const g_flatMagic[4] = { 0xC1, 'E', 'E', 'F' };
+
+        // The data section is aligned relative to the start of the written data, so this is the max alignment we support for aligned binary data
+        constexpr static size_t const g_flatDataSectionAlignment = 64;
+
+        // Binary data (i.e. blobs and arrays) is aligned so that it can be copied efficiently
+        constexpr static size_t const g_flatBinaryDataAlignment = 16;
+
+        struct FlatHeader
+        {
+            uint8_t     m_magic[4];
+            uint32_t    m_fieldsSize;
+            uint32_t    m_dataOffset;           // From the start of the data
+            uint32_t    m_dataSize;
+            uint32_t    m_stringTableOffset;    // From the start of the data section
+            uint32_t    m_numStrings;
+            uint32_t    m_padding[2];
+        };
+
+        static_assert( sizeof( FlatHeader ) == 32, "The field stream is expected to directly follow the header" );
     }
 
     //-------------------------------------------------------------------------
@@ -26,87 +58,349 @@ namespace EE::Serialization
         Reset();
     }
 
+    BinaryReader::BinaryReader( BinaryReader&& rhs )
+    {
+        *this = eastl::move( rhs );
+    }
+
+    BinaryReader& BinaryReader::operator=( BinaryReader&& rhs )
+    {
+        Reset();
+
+        m_pReader = rhs.m_pReader;
+        m_pFlatCursor = rhs.m_pFlatCursor;
+        m_pFlatFieldsEnd = rhs.m_pFlatFieldsEnd;
+        m_pFlatData = rhs.m_pFlatData;
+        m_flatDataSize = rhs.m_flatDataSize;
+        m_format = rhs.m_format;
+        m_isReading = rhs.m_isReading;
+        m_isDataPersistent = rhs.m_isDataPersistent;
+        m_hasReferencedPersistentData = rhs.m_hasReferencedPersistentData;
+        m_hasReadError = rhs.m_hasReadError;
+
+        rhs.m_pReader = nullptr;
+        rhs.m_pFlatCursor = rhs.m_pFlatFieldsEnd = rhs.m_pFlatData = nullptr;
+        rhs.m_flatDataSize = 0;
+        rhs.m_isReading = false;
+        return *this;
+    }
+
     void BinaryReader::Reset()
     {
-        if ( m_pReader != nullptr )
+        if ( m_isReading )
         {
             EndReading();
         }
     }
 
-    void BinaryReader::BeginReading( char const* pData, size_t size )
+    void BinaryReader::BeginReading( char const* pData, size_t size, bool isDataPersistent )
     {
         EE_ASSERT( pData != nullptr );
-        EE_ASSERT( m_pReader == nullptr );
-        m_pReader = EE::New<mpack_reader_t>();
-        mpack_reader_init_data( m_pReader, pData, size );
-        mpack_reader_set_error_handler( m_pReader, &MPackReaderError );
+        EE_ASSERT( !m_isReading );
+        m_isDataPersistent = isDataPersistent;
+        m_hasReferencedPersistentData = false;
+        m_hasReadError = false;
+        m_isReading = true;
+
+        if ( size >= sizeof( FlatHeader ) && memcmp( pData, g_flatMagic, sizeof( g_flatMagic ) ) == 0 )
+        {
+            m_format = BinaryFormat::Flat;
+            if ( !BeginReadingFlat( pData, size ) )
+            {
+                // Leave the cursor empty so that all reads fail
+                m_pFlatCursor = m_pFlatFieldsEnd = m_pFlatData = nullptr;
+                m_flatDataSize = 0;
+                m_hasReadError = true;
+            }
+        }
+        else
+        {
+            m_format = BinaryFormat::MessagePack;
+            m_pReader = EE::New<mpack_reader_t>();
+            mpack_reader_init_data( m_pReader, pData, size );
+            mpack_reader_set_error_handler( m_pReader, &MPackReaderError );
+        }
+    }
+
+    bool BinaryReader::BeginReadingFlat( char const* pData, size_t size )
+    {
+        FlatHeader header;
+        memcpy( &header, pData, sizeof( FlatHeader ) );
+
+        size_t const fieldsEnd = sizeof( FlatHeader ) + header.m_fieldsSize;
+        if ( fieldsEnd > header.m_dataOffset || size_t( header.m_dataOffset ) + header.m_dataSize > size || header.m_stringTableOffset > header.m_dataSize )
+        {
+            return false;
+        }
+
+        m_pFlatCursor = pData + sizeof( FlatHeader );
+        m_pFlatFieldsEnd = pData + fieldsEnd;
+        m_pFlatData = pData + header.m_dataOffset;
+        m_flatDataSize = header.m_dataSize;
+
+        // Intern all the strings used by the string IDs, so that we can directly read the IDs
+        char const* pEntry = m_pFlatData + header.m_stringTableOffset;
+        char const* const pDataEnd = m_pFlatData + m_flatDataSize;
+        for ( uint32_t i = 0; i < header.m_numStrings; i++ )
+        {
+            uint32_t entry[2]; // ID, Length
+            if ( pEntry + sizeof( entry ) > pDataEnd )
+            {
+                return false;
+            }
+
+            memcpy( entry, pEntry, sizeof( entry ) );
+            char const* pString = pEntry + sizeof( entry );
+            if ( pString + entry[1] + 1 > pDataEnd || pString[entry[1]] != 0 )
+            {
+                return false;
+            }
+
+            StringID const ID( pString );
+            if ( ID.ToUint() != entry[0] )
+            {
+                return false;
+            }
+
+            pEntry = pString + entry[1] + 1;
+        }
+
+        return true;
+    }
+
+    bool BinaryReader::EndReading()
+    {
+        EE_ASSERT( m_isReading );
+
+        if ( m_pReader != nullptr )
+        {
+            m_hasReadError |= ( mpack_reader_destroy( m_pReader ) != mpack_ok );
+            EE::Delete( m_pReader );
+        }
+
+        m_pFlatCursor = m_pFlatFieldsEnd = m_pFlatData = nullptr;
+        m_flatDataSize = 0;
+        m_isReading = false;
+        return !m_hasReadError;
+    }
+
+    void BinaryReader::SetReadError()
+    {
+        EE_ASSERT( m_isReading );
+        m_hasReadError = true;
+
+        // Stop reading so that we dont interpret the remaining data out of sync
+        if ( IsFlat() )
+        {
+            m_pFlatCursor = m_pFlatFieldsEnd;
+        }
+        else
+        {
+            mpack_reader_flag_error( m_pReader, mpack_error_data );
+        }
+    }
+
+    size_t BinaryReader::GetRemainingSize()
+    {
+        return IsFlat() ? size_t( m_pFlatFieldsEnd - m_pFlatCursor ) + m_flatDataSize : mpack_reader_remaining( m_pReader, nullptr );
+    }
+
+    // All flat reads are bounds checked in all builds, since the data comes from disk. Invalid reads return zeroed data and flag an error that fails the load.
+    // Once a read fails, the cursor is moved to the end so all subsequent reads will also fail.
+
+    template<typename T>
+    EE_FORCE_INLINE void BinaryReader::ReadFlatValue( T& v )
+    {
+        if ( size_t( m_pFlatFieldsEnd - m_pFlatCursor ) < sizeof( T ) )
+        {
+            SetReadError();
+            memset( &v, 0, sizeof( T ) );
+            return;
+        }
+
+        memcpy( &v, m_pFlatCursor, sizeof( T ) );
+        m_pFlatCursor += sizeof( T );
+    }
+
+    char const* BinaryReader::ReadFlatRelativePointer( uint32_t& outSize )
+    {
+        uint32_t offset = 0;
+        ReadFlatValue( offset );
+        ReadFlatValue( outSize );
+
+        if ( size_t( offset ) + outSize > m_flatDataSize )
+        {
+            SetReadError();
+            outSize = 0;
+            return m_pFlatData;
+        }
+
+        return m_pFlatData + offset;
     }
 
-    void BinaryReader::EndReading()
+    void BinaryReader::ReadFlatPodData( void* pData, size_t size )
     {
-        EE_ASSERT( m_pReader != nullptr );
-        mpack_reader_destroy( m_pReader );
-        EE::Delete( m_pReader );
+        EE_ASSERT( IsFlat() );
+
+        if ( size_t( m_pFlatFieldsEnd - m_pFlatCursor ) < size )
+        {
+            SetReadError();
+            memset( pData, 0, size );
+            return;
+        }
+
+        memcpy( pData, m_pFlatCursor, size );
+        m_pFlatCursor += size;
     }
 
     void BinaryReader::ReadValue( bool& v )
     {
-        v = mpack_expect_bool( m_pReader );
+        if ( IsFlat() )
+        {
+            uint8_t value = 0;
+            ReadFlatValue( value );
+            v = ( value != 0 );
+        }
+        else
+        {
+            v = mpack_expect_bool( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( int8_t& v )
     {
-        v = mpack_expect_i8( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_i8( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( int16_t& v )
     {
-        v = mpack_expect_i16( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_i16( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( int32_t& v )
     {
-        v = mpack_expect_i32( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_i32( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( int64_t& v )
     {
-        v = mpack_expect_i64( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_i64( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( uint8_t& v )
     {
-        v = mpack_expect_u8( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_u8( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( uint16_t& v )
     {
-        v = mpack_expect_u16( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_u16( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( uint32_t& v )
     {
-        v = mpack_expect_u32( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_u32( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( uint64_t& v )
     {
-        v = mpack_expect_u64( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_u64( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( float& v )
     {
-        v = mpack_expect_float( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_float( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( double& v )
     {
-        v = mpack_expect_double( m_pReader );
+        if ( IsFlat() )
+        {
+            ReadFlatValue( v );
+        }
+        else
+        {
+            v = mpack_expect_double( m_pReader );
+        }
     }
 
     void BinaryReader::ReadValue( Blob& blob )
     {
+        if ( IsFlat() )
+        {
+            uint32_t size = 0;
+            char const* pData = ReadFlatRelativePointer( size );
+            blob.resize( size );
+            if ( size > 0 )
+            {
+                memcpy( blob.data(), pData, size );
+            }
+            return;
+        }
+
         size_t const expectedSize = mpack_expect_bin( m_pReader );
         blob.resize( expectedSize );
 
@@ -116,6 +410,28 @@ namespace EE::Serialization
 
     void BinaryReader::ReadValue( String& v )
     {
+        if ( IsFlat() )
+        {
+            uint32_t length = 0;
+            char const* pString = ReadFlatRelativePointer( length );
+
+            // Match the message pack read (i.e. non-empty strings include the null terminator which is stored in the data section)
+            if ( length == 0 )
+            {
+                v.clear();
+            }
+            else if ( size_t( pString - m_pFlatData ) + length < m_flatDataSize && pString[length] == 0 )
+            {
+                v.assign( pString, length + 1 );
+            }
+            else
+            {
+                SetReadError();
+                v.clear();
+            }
+            return;
+        }
+
         if ( mpack_peek_tag( m_pReader ).type == mpack_type_nil )
         {
             mpack_expect_nil( m_pReader );
@@ -134,6 +450,15 @@ namespace EE::Serialization
 
     void BinaryReader::ReadValue( StringID& v )
     {
+        // The strings were interned when we started reading
+        if ( IsFlat() )
+        {
+            uint32_t ID = 0;
+            ReadFlatValue( ID );
+            v = StringID( ID );
+            return;
+        }
+
         if ( mpack_peek_tag( m_pReader ).type == mpack_type_nil )
         {
             mpack_expect_nil( m_pReader );
@@ -156,12 +481,61 @@ namespace EE::Serialization
 
     void BinaryReader::ReadBinaryData( void* pData, size_t size )
     {
+        if ( IsFlat() )
+        {
+            uint32_t storedSize = 0;
+            char const* pStoredData = ReadFlatRelativePointer( storedSize );
+            if ( storedSize != size )
+            {
+                SetReadError();
+                memset( pData, 0, size );
+                return;
+            }
+
+            memcpy( pData, pStoredData, size );
+            return;
+        }
+
         size_t const expectedSize = mpack_expect_bin( m_pReader );
-        EE_ASSERT( expectedSize == size );
+        if ( expectedSize != size )
+        {
+            SetReadError();
+            memset( pData, 0, size );
+            return;
+        }
+
         mpack_read_bytes( m_pReader, (char*) pData, expectedSize );
         mpack_done_bin( m_pReader );
     }
 
+    void const* BinaryReader::ReadAlignedBinaryData( size_t& outSize )
+    {
+        if ( IsFlat() )
+        {
+            uint32_t size = 0;
+            char const* pData = ReadFlatRelativePointer( size );
+            outSize = size;
+            m_hasReferencedPersistentData |= ( m_isDataPersistent && outSize > 0 );
+            return ( outSize > 0 ) ? pData : nullptr;
+        }
+
+        // Skip padding
+        size_t const paddingSize = mpack_expect_bin( m_pReader );
+        if ( paddingSize > 0 )
+        {
+            mpack_skip_bytes( m_pReader, paddingSize );
+        }
+        mpack_done_bin( m_pReader );
+
+        // We are always reading from a buffer so we can read the data in-place
+        outSize = mpack_expect_bin( m_pReader );
+        char const* pData = ( outSize > 0 ) ? mpack_read_bytes_inplace( m_pReader, outSize ) : nullptr;
+        mpack_done_bin( m_pReader );
+
+        m_hasReferencedPersistentData |= ( m_isDataPersistent && outSize > 0 );
+        return pData;
+    }
+
     //-------------------------------------------------------------------------
 
     static void MPackWriterError( mpack_writer_t* pWriter, mpack_error_t error )
@@ -169,15 +543,52 @@ namespace EE::Serialization
         EE_HALT();
     };
 
+    struct BinaryWriter::FlatWriterState
+    {
+        TVector<char>                   m_fields;
+        TVector<char>                   m_data;
+        TVector<StringID>               m_stringIDs; // In the order they were first written
+        TFlatHashSet<uint32_t>          m_recordedStringIDs;
+    };
+
+    //-------------------------------------------------------------------------
+
     BinaryWriter::~BinaryWriter()
     {
         Reset();
         EE_ASSERT( m_pData == nullptr );
     }
 
+    BinaryWriter::BinaryWriter( BinaryWriter&& rhs )
+    {
+        *this = eastl::move( rhs );
+    }
+
+    BinaryWriter& BinaryWriter::operator=( BinaryWriter&& rhs )
+    {
+        Reset();
+
+        m_pWriter = rhs.m_pWriter;
+        m_pFlatState = rhs.m_pFlatState;
+        m_pData = rhs.m_pData;
+        m_dataSize = rhs.m_dataSize;
+        m_flatGatherDepth = rhs.m_flatGatherDepth;
+        m_format = rhs.m_format;
+
+        // The mpack writer references our data members so we can only move it once writing has ended
+        EE_ASSERT( m_pWriter == nullptr );
+
+        rhs.m_pWriter = nullptr;
+        rhs.m_pFlatState = nullptr;
+        rhs.m_pData = nullptr;
+        rhs.m_dataSize = 0;
+        rhs.m_flatGatherDepth = 0;
+        return *this;
+    }
+
     void BinaryWriter::Reset()
     {
-        if ( m_pWriter != nullptr )
+        if ( IsWriting() )
         {
             EndWriting();
         }
@@ -187,84 +598,282 @@ namespace EE::Serialization
         m_dataSize = 0;
     }
 
-    void BinaryWriter::BeginWriting()
+    void BinaryWriter::BeginWriting( BinaryFormat format )
     {
-        EE_ASSERT( m_pWriter == nullptr );
-        m_pWriter = EE::New<mpack_writer_t>();
-        mpack_writer_init_growable( m_pWriter, &m_pData, &m_dataSize );
-        mpack_writer_set_error_handler( m_pWriter, &MPackWriterError );
+        EE_ASSERT( !IsWriting() );
+        m_format = format;
+
+        if ( m_format == BinaryFormat::Flat )
+        {
+            m_pFlatState = EE::New<FlatWriterState>();
+            m_flatGatherDepth = 0;
+        }
+        else
+        {
+            m_pWriter = EE::New<mpack_writer_t>();
+            mpack_writer_init_growable( m_pWriter, &m_pData, &m_dataSize );
+            mpack_writer_set_error_handler( m_pWriter, &MPackWriterError );
+        }
     }
 
     void BinaryWriter::EndWriting()
     {
-        EE_ASSERT( m_pWriter != nullptr );
-        mpack_writer_destroy( m_pWriter );
-        EE::Delete( m_pWriter );
+        EE_ASSERT( IsWriting() );
+
+        if ( m_format == BinaryFormat::Flat )
+        {
+            EndWritingFlat();
+        }
+        else
+        {
+            mpack_writer_destroy( m_pWriter );
+            EE::Delete( m_pWriter );
+        }
+    }
+
+    void BinaryWriter::EndWritingFlat()
+    {
+        EE_ASSERT( m_pFlatState != nullptr && m_flatGatherDepth == 0 );
+        TVector<char>& data = m_pFlatState->m_data;
+
+        // Append the string table to the data section
+        size_t const stringTableOffset = data.size() + Memory::CalculatePaddingForAlignment( data.size(), alignof( uint32_t ) );
+        data.resize( stringTableOffset, 0 );
+        for ( StringID const& ID : m_pFlatState->m_stringIDs )
+        {
+            char const* pString = ID.c_str();
+            EE_ASSERT( pString != nullptr );
+
+            uint32_t const entry[2] = { ID.ToUint(), (uint32_t) strlen( pString ) };
+            data.insert( data.end(), reinterpret_cast<char const*>( entry ), reinterpret_cast<char const*>( entry ) + sizeof( entry ) );
+            data.insert( data.end(), pString, pString + entry[1] + 1 );
+        }
+
+        // Assemble the final data
+        size_t const fieldsEnd = sizeof( FlatHeader ) + m_pFlatState->m_fields.size();
+        size_t const dataOffset = fieldsEnd + Memory::CalculatePaddingForAlignment( fieldsEnd, g_flatDataSectionAlignment );
+        EE_ASSERT( dataOffset + data.size() <= UINT32_MAX );
+
+        FlatHeader header;
+        memcpy( header.m_magic, g_flatMagic, sizeof( g_flatMagic ) );
+        header.m_fieldsSize = (uint32_t) m_pFlatState->m_fields.size();
+        header.m_dataOffset = (uint32_t) dataOffset;
+        header.m_dataSize = (uint32_t) data.size();
+        header.m_stringTableOffset = (uint32_t) stringTableOffset;
+        header.m_numStrings = (uint32_t) m_pFlatState->m_stringIDs.size();
+        header.m_padding[0] = header.m_padding[1] = 0;
+
+        MPACK_FREE( m_pData );
+        m_dataSize = dataOffset + data.size();
+        m_pData = (char*) MPACK_MALLOC( m_dataSize );
+        memcpy( m_pData, &header, sizeof( FlatHeader ) );
+        if ( !m_pFlatState->m_fields.empty() )
+        {
+            memcpy( m_pData + sizeof( FlatHeader ), m_pFlatState->m_fields.data(), m_pFlatState->m_fields.size() );
+        }
+        memset( m_pData + fieldsEnd, 0, dataOffset - fieldsEnd );
+        if ( !data.empty() )
+        {
+            memcpy( m_pData + dataOffset, data.data(), data.size() );
+        }
+
+        EE::Delete( m_pFlatState );
+    }
+
+    void BinaryWriter::WriteFlatFieldData( void const* pData, size_t size )
+    {
+        EE_ASSERT( m_pFlatState != nullptr );
+        char const* pBytes = reinterpret_cast<char const*>( pData );
+        m_pFlatState->m_fields.insert( m_pFlatState->m_fields.end(), pBytes, pBytes + size );
+    }
+
+    void BinaryWriter::WriteFlatRelativePointer( void const* pData, size_t size, size_t alignment )
+    {
+        if ( m_flatGatherDepth > 0 )
+        {
+            return;
+        }
+
+        size_t offset = 0;
+        if ( size > 0 )
+        {
+            TVector<char>& data = m_pFlatState->m_data;
+            offset = data.size() + Memory::CalculatePaddingForAlignment( data.size(), alignment );
+            data.resize( offset + size, 0 );
+            memcpy( data.data() + offset, pData, size );
+        }
+
+        EE_ASSERT( offset + size <= UINT32_MAX );
+        WriteFlatValue( (uint32_t) offset );
+        WriteFlatValue( (uint32_t) size );
+    }
+
+    void BinaryWriter::WriteFlatPodData( void const* pData, size_t size )
+    {
+        EE_ASSERT( IsFlat() );
+        if ( m_flatGatherDepth == 0 )
+        {
+            WriteFlatFieldData( pData, size );
+        }
     }
 
     void BinaryWriter::WriteValue( bool v )
     {
-        mpack_write_bool( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( (uint8_t) ( v ? 1 : 0 ) );
+        }
+        else
+        {
+            mpack_write_bool( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( int8_t v )
     {
-        mpack_write_i8( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_i8( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( int16_t v )
     {
-        mpack_write_i16( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_i16( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( int32_t v )
     {
-        mpack_write_i32( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_i32( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( int64_t v )
     {
-        mpack_write_i64( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_i64( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( uint8_t v )
     {
-        mpack_write_u8( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_u8( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( uint16_t v )
     {
-        mpack_write_u16( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_u16( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( uint32_t v )
     {
-        mpack_write_u32( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_u32( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( uint64_t v )
     {
-        mpack_write_u64( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_u64( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( float v )
     {
-        mpack_write_float( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_float( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( double v )
     {
-        mpack_write_double( m_pWriter, v );
+        if ( IsFlat() )
+        {
+            WriteFlatValue( v );
+        }
+        else
+        {
+            mpack_write_double( m_pWriter, v );
+        }
     }
 
     void BinaryWriter::WriteValue( Blob const& blob )
     {
+        if ( IsFlat() )
+        {
+            WriteFlatRelativePointer( blob.data(), blob.size(), g_flatBinaryDataAlignment );
+            return;
+        }
+
         EE_ASSERT( !blob.empty() );
         mpack_write_bin( m_pWriter, (char*) blob.data(), (uint32_t) blob.size() );
     }
 
     void BinaryWriter::WriteValue( String const& v )
     {
+        // Strings are null terminated in the data section
+        if ( IsFlat() )
+        {
+            WriteFlatRelativePointer( v.c_str(), v.length(), 1 );
+            if ( !v.empty() && m_flatGatherDepth == 0 )
+            {
+                m_pFlatState->m_data.push_back( 0 );
+            }
+            return;
+        }
+
         if ( v.empty() )
         {
             mpack_write_cstr_or_nil( m_pWriter, nullptr );
@@ -278,6 +887,18 @@ namespace EE::Serialization
 
     void BinaryWriter::WriteValue( StringID const& v )
     {
+        // We always record the string (even when gathering) so that it is added to the string table
+        if ( IsFlat() )
+        {
+            if ( v.IsValid() && m_pFlatState->m_recordedStringIDs.insert( v.ToUint() ).second )
+            {
+                m_pFlatState->m_stringIDs.emplace_back( v );
+            }
+
+            WriteFlatValue( v.ToUint() );
+            return;
+        }
+
         if ( v.IsValid() )
         {
             mpack_write_cstr_or_nil( m_pWriter, v.c_str() );
@@ -291,9 +912,42 @@ namespace EE::Serialization
     void BinaryWriter::WriteBinaryData( void const* pData, size_t size )
     {
         EE_ASSERT( pData != nullptr && size != 0 );
+
+        if ( IsFlat() )
+        {
+            WriteFlatRelativePointer( pData, size, g_flatBinaryDataAlignment );
+            return;
+        }
+
         mpack_write_bin( m_pWriter, (char*) pData, (uint32_t) size );
     }
 
+    void BinaryWriter::WriteAlignedBinaryData( void const* pData, size_t size, size_t alignment )
+    {
+        EE_ASSERT( alignment > 0 && alignment < 256 && Math::IsPowerOf2( (int32_t) alignment ) );
+        EE_ASSERT( pData != nullptr || size == 0 );
+
+        // The data section is aligned so we only need to align the data within it
+        if ( IsFlat() )
+        {
+            EE_ASSERT( alignment <= g_flatDataSectionAlignment );
+            WriteFlatRelativePointer( pData, size, alignment );
+            return;
+        }
+
+        // We write a padding bin followed by the data bin, the padding is sized so that the data starts on an aligned offset
+        // The padding is always less than 256 bytes so uses a bin8 header (2 bytes), the data header size depends on the data size (bin8/16/32)
+        size_t const paddingHeaderSize = 2;
+        size_t const dataHeaderSize = ( size <= UINT8_MAX ) ? 2 : ( size <= UINT16_MAX ) ? 3 : 5;
+        size_t const dataOffset = mpack_writer_buffer_used( m_pWriter ) + paddingHeaderSize + dataHeaderSize;
+        size_t const paddingSize = Memory::CalculatePaddingForAlignment( dataOffset, alignment );
+
+        static char const padding[256] = {};
+        mpack_write_bin( m_pWriter, padding, (uint32_t) paddingSize );
+        mpack_write_bin( m_pWriter, ( size > 0 ) ? (char const*) pData : padding, (uint32_t) size );
+        EE_ASSERT( ( ( mpack_writer_buffer_used( m_pWriter ) - size ) % alignment ) == 0 );
+    }
+
     //-------------------------------------------------------------------------
 
     BinaryInputArchive::~BinaryInputArchive()
@@ -316,7 +970,19 @@ namespace EE::Serialization
         }
 
         m_serializer.BeginReading( (char const*) pData, size );
-        return true;
+        return !m_serializer.HasReadError();
+    }
+
+    bool BinaryInputArchive::ReadFromMappedData( uint8_t const* pData, size_t size )
+    {
+        if ( m_serializer.IsReading() )
+        {
+            m_serializer.Reset();
+            EE::Free( m_pFileData );
+        }
+
+        m_serializer.BeginReading( (char const*) pData, size, true );
+        return !m_serializer.HasReadError();
     }
 
     bool BinaryInputArchive::ReadFromFile( FileSystem::Path const& filePath )
@@ -355,7 +1021,7 @@ namespace EE::Serialization
 
             m_serializer.BeginReading( (char*) m_pFileData, m_fileDataSize );
 
-            return true;
+            return !m_serializer.HasReadError();
         }
 
         return false;
@@ -366,17 +1032,24 @@ namespace EE::Serialization
         return ReadFromData( blob.data(), blob.size() );
     }
 
+    bool BinaryInputArchive::EndReading()
+    {
+        EE_ASSERT( m_serializer.IsReading() );
+        return m_serializer.EndReading();
+    }
+
     //-------------------------------------------------------------------------
 
-    BinaryOutputArchive::BinaryOutputArchive()
+    BinaryOutputArchive::BinaryOutputArchive( BinaryFormat format )
     {
-        m_serializer.BeginWriting();
+        m_serializer.BeginWriting( format );
     }
 
     void BinaryOutputArchive::Reset()
     {
+        BinaryFormat const format = m_serializer.GetFormat();
         m_serializer.Reset();
-        m_serializer.BeginWriting();
+        m_serializer.BeginWriting( format );
     }
 
     bool BinaryOutputArchive::WriteToFile( FileSystem::Path const& outPath )
@@ -9,6 +9,7 @@ struct mpack_reader_t;
 struct mpack_writer_t;
 
 namespace EE { class StringID; }
+namespace EE { template<typename T> class TMappedArray; }
 namespace EE::FileSystem { class Path; }
 
 //-------------------------------------------------------------------------
@@ -22,6 +23,26 @@ namespace EE::Serialization
 
     EE_BASE_API int32_t GetBinarySerializationVersion();
 
+    //-------------------------------------------------------------------------
+    // Binary Formats
+    //-------------------------------------------------------------------------
+    // MessagePack: self-describing tagged stream, every value is parsed and validated on read (used for tools/editor data)
+    // Flat: fixed-layout little-endian stream with no type tags, intended for compiled resources (i.e. data written and read by the same build)
+    //
+    // Flat layout: [header][field stream][data section]
+    //  * The field stream contains the raw scalar values in serialization order (bools are a byte, array counts are uint64, string IDs are the uint32 ID)
+    //  * Strings, blobs and binary data are stored as relative pointers (uint32 offset into the data section, uint32 size) in the field stream
+    //  * The data section also contains the string table (the ID + string for every string ID in the stream), this is interned when we start reading
+    //  * Flat POD types (see EE_SERIALIZE_FLAT_POD) and arrays of them are written to the field stream as raw memory and read with a single copy (so they can't contain any padding)
+    //
+    // The reader detects the format from the data so both formats can always be read
+
+    enum class BinaryFormat : uint8_t
+    {
+        MessagePack,
+        Flat
+    };
+
     //-------------------------------------------------------------------------
     // Binary Reader/Writer
     //-------------------------------------------------------------------------
@@ -37,14 +58,44 @@ namespace EE::Serialization
 
         BinaryReader( BinaryReader const& rhs ) = delete;
         BinaryReader& operator=( BinaryReader const& rhs ) = delete;
-        BinaryReader( BinaryReader&& rhs ) { m_pReader = rhs.m_pReader; rhs.m_pReader = nullptr; }
-        BinaryReader& operator=( BinaryReader&& rhs ) { m_pReader = rhs.m_pReader; rhs.m_pReader = nullptr; return *this; }
+        BinaryReader( BinaryReader&& rhs );
+        BinaryReader& operator=( BinaryReader&& rhs );
 
         void Reset();
 
-        inline bool IsReading() const { return m_pReader != nullptr; }
-        void BeginReading( char const* pData, size_t size );
-        void EndReading();
+        inline bool IsReading() const { return m_isReading; }
+        void BeginReading( char const* pData, size_t size, bool isDataPersistent = false );
+
+        // Returns false if the data was invalid (e.g. truncated or corrupted), in which case anything read from it should be discarded
+        bool EndReading();
+
+        // Did any read so far fail (invalid reads return zeroed values)
+        inline bool HasReadError() const { return m_hasReadError; }
+
+        // Flag the data as invalid (e.g. an array count mismatch), all subsequent reads will fail
+        void SetReadError();
+
+        // Read a container element count, every element takes up at least a byte so counts that cannot fit in the remaining data flag an error and return zero
+        template<typename T>
+        void ReadElementCount( T& numElements )
+        {
+            ReadValue( numElements );
+            if ( numElements > GetRemainingSize() )
+            {
+                SetReadError();
+                numElements = 0;
+            }
+        }
+
+        // The format of the data we are reading (detected when we begin reading)
+        inline BinaryFormat GetFormat() const { return m_format; }
+        inline bool IsFlat() const { return m_format == BinaryFormat::Flat; }
+
+        // Is the data we are reading from guaranteed to outlive the deserialized objects (i.e. can we reference it in-place)
+        inline bool IsDataPersistent() const { return m_isDataPersistent; }
+
+        // Has any of the read data been referenced in-place (i.e. does the source data need to be kept alive)
+        inline bool HasReferencedPersistentData() const { return m_hasReferencedPersistentData; }
 
         void ReadValue( bool& v );
         void ReadValue( int8_t& v );
@@ -63,9 +114,32 @@ namespace EE::Serialization
 
         void ReadBinaryData( void* pData, size_t size );
 
+        // Returns a ptr to the aligned data in the source buffer, the data is only aligned if the source buffer is (i.e. memory mapped data)
+        void const* ReadAlignedBinaryData( size_t& outSize );
+
+        // Flat format only: copy the raw memory of a flat POD value (or array of values)
+        void ReadFlatPodData( void* pData, size_t size );
+
     private:
 
-        mpack_reader_t* m_pReader = nullptr;
+        bool BeginReadingFlat( char const* pData, size_t size );
+        char const* ReadFlatRelativePointer( uint32_t& outSize );
+        size_t GetRemainingSize();
+
+        template<typename T> void ReadFlatValue( T& v );
+
+    private:
+
+        mpack_reader_t*     m_pReader = nullptr;
+        char const*         m_pFlatCursor = nullptr;
+        char const*         m_pFlatFieldsEnd = nullptr;
+        char const*         m_pFlatData = nullptr;
+        size_t              m_flatDataSize = 0;
+        BinaryFormat        m_format = BinaryFormat::MessagePack;
+        bool                m_isReading = false;
+        bool                m_isDataPersistent = false;
+        bool                m_hasReferencedPersistentData = false;
+        bool                m_hasReadError = false;
     };
 
     //-------------------------------------------------------------------------
@@ -79,15 +153,18 @@ namespace EE::Serialization
 
         BinaryWriter( BinaryWriter const& rhs ) = delete;
         BinaryWriter& operator=( BinaryWriter const& rhs ) = delete;
-        BinaryWriter( BinaryWriter&& rhs ) { m_pWriter = rhs.m_pWriter; rhs.m_pWriter = nullptr; }
-        BinaryWriter& operator=( BinaryWriter&& rhs ) { m_pWriter = rhs.m_pWriter; rhs.m_pWriter = nullptr; return *this; }
+        BinaryWriter( BinaryWriter&& rhs );
+        BinaryWriter& operator=( BinaryWriter&& rhs );
 
         void Reset();
 
-        inline bool IsWriting() const { return m_pWriter != nullptr; }
-        void BeginWriting();
+        inline bool IsWriting() const { return m_pWriter != nullptr || m_pFlatState != nullptr; }
+        void BeginWriting( BinaryFormat format = BinaryFormat::MessagePack );
         void EndWriting();
 
+        inline BinaryFormat GetFormat() const { return m_format; }
+        inline bool IsFlat() const { return m_format == BinaryFormat::Flat; }
+
         inline char* GetData() const { return m_pData; }
         inline size_t GetSize() const { return m_dataSize; }
 
@@ -108,13 +185,60 @@ namespace EE::Serialization
 
         void WriteBinaryData( void const* pData, size_t size );
 
+        // Write binary data so that it is aligned relative to the start of the written data (this writes some padding before the data)
+        void WriteAlignedBinaryData( void const* pData, size_t size, size_t alignment );
+
+        // Flat format only: write the raw memory of a flat POD value (or array of values)
+        void WriteFlatPodData( void const* pData, size_t size );
+
+        // Flat format only: flat POD values are written as raw memory so we never see any string IDs they contain
+        // While gathering, the values are re-serialized but only the string IDs are recorded (everything else is ignored)
+        inline void BeginGatheringStringIDs() { m_flatGatherDepth++; }
+        inline void EndGatheringStringIDs() { EE_ASSERT( m_flatGatherDepth > 0 ); m_flatGatherDepth--; }
+
+    private:
+
+        struct FlatWriterState;
+
+        void EndWritingFlat();
+        void WriteFlatRelativePointer( void const* pData, size_t size, size_t alignment );
+
+        template<typename T>
+        inline void WriteFlatValue( T v )
+        {
+            if ( m_flatGatherDepth == 0 )
+            {
+                WriteFlatFieldData( &v, sizeof( T ) );
+            }
+        }
+
+        void WriteFlatFieldData( void const* pData, size_t size );
+
     private:
 
         mpack_writer_t*     m_pWriter = nullptr;
+        FlatWriterState*    m_pFlatState = nullptr;
         char*               m_pData = nullptr;
-        size_t              m_dataSize;
+        size_t              m_dataSize = 0;
+        uint32_t            m_flatGatherDepth = 0;
+        BinaryFormat        m_format = BinaryFormat::MessagePack;
     };
 
+    //-------------------------------------------------------------------------
+    // Flat POD Types
+    //-------------------------------------------------------------------------
+    // Types that can be written/read as raw memory when using the flat format (EE_SERIALIZE_FLAT_POD)
+    // These need to be trivially copyable and may only contain other flat POD types (no pointers, strings or containers)
+
+    template<typename T, typename = void>
+    struct IsFlatPodType : std::bool_constant<std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+
+    template<typename T>
+    struct IsFlatPodType<T, std::void_t<typename T::FlatPodSerializationType>> : std::is_same<T, typename T::FlatPodSerializationType> {};
+
+    template<>
+    struct IsFlatPodType<StringID> : std::true_type {};
+
     //-------------------------------------------------------------------------
     // Serialization Archive
     //-------------------------------------------------------------------------
@@ -131,6 +255,10 @@ namespace EE::Serialization
             Base& m_instance;
         };
 
+        // Helper to get the combined size of a set of fields at compile time (only used in an unevaluated context)
+        template<typename... Fields>
+        std::integral_constant<size_t, ( sizeof( Fields ) + ... )> GetTotalFieldSize( Fields const&... );
+
         // Primary archive interface
         template<typename Serializer>
         class Archive
@@ -161,6 +289,15 @@ namespace EE::Serialization
                 // If this is a structure and not a string, try to call the explicit serialize method on it
                 else if constexpr ( std::is_class<T>::value && !std::is_same<T, EE::String>::value && !std::is_same<T, EE::StringID>::value )
                 {
+                    if constexpr ( IsFlatPodType<T>::value )
+                    {
+                        if ( m_serializer.IsFlat() )
+                        {
+                            SerializeFlatPodArray( &value, 1 );
+                            return *this;
+                        }
+                    }
+
                     value.Serialize( *this );
                 }
                 else // Directly serialize POD types (and strings)
@@ -205,7 +342,11 @@ namespace EE::Serialization
                 if constexpr ( std::is_same<Serializer, BinaryReader>::value )
                 {
                     m_serializer.ReadValue( numElements );
-                    EE_ASSERT( numElements == S );
+                    if ( numElements != S )
+                    {
+                        m_serializer.SetReadError();
+                        return *this;
+                    }
                 }
                 else
                 {
@@ -241,7 +382,7 @@ namespace EE::Serialization
                 // Serialize size
                 if constexpr ( std::is_same<Serializer, BinaryReader>::value )
                 {
-                    m_serializer.ReadValue( numElements );
+                    m_serializer.ReadElementCount( numElements );
                     arr.resize( numElements );
                 }
                 else
@@ -272,7 +413,7 @@ namespace EE::Serialization
                 // Serialize size
                 if constexpr ( std::is_same<Serializer, BinaryReader>::value )
                 {
-                    m_serializer.ReadValue( numElements );
+                    m_serializer.ReadElementCount( numElements );
                     arr.resize( numElements );
                 }
                 else
@@ -291,6 +432,52 @@ namespace EE::Serialization
                 return operator<<( const_cast<TInlineVector<T, S>&>( arr ) );
             }
 
+            // Serialize mapped arrays
+            //-------------------------------------------------------------------------
+            // These are stored as aligned binary data so that we can reference them in-place when reading from persistent data
+
+            template<typename T>
+            Archive& operator<<( TMappedArray<T>& arr )
+            {
+                if constexpr ( std::is_same<Serializer, BinaryReader>::value )
+                {
+                    size_t dataSize = 0;
+                    T const* pData = reinterpret_cast<T const*>( m_serializer.ReadAlignedBinaryData( dataSize ) );
+                    if ( ( dataSize % sizeof( T ) ) != 0 )
+                    {
+                        m_serializer.SetReadError();
+                        arr.clear();
+                        return *this;
+                    }
+
+                    size_t const numElements = dataSize / sizeof( T );
+                    if ( numElements == 0 )
+                    {
+                        arr.clear();
+                    }
+                    else if ( m_serializer.IsDataPersistent() && ( reinterpret_cast<uintptr_t>( pData ) % alignof( T ) ) == 0 )
+                    {
+                        arr.SetExternalData( pData, numElements );
+                    }
+                    else
+                    {
+                        arr.assign( pData, numElements );
+                    }
+                }
+                else
+                {
+                    m_serializer.WriteAlignedBinaryData( arr.data(), sizeof( T ) * arr.size(), TMappedArray<T>::s_dataAlignment );
+                }
+
+                return *this;
+            }
+
+            template<typename T>
+            Archive& operator<<( TMappedArray<T> const& arr )
+            {
+                return operator<<( const_cast<TMappedArray<T>&>( arr ) );
+            }
+
             // Serialize hash maps
             //-------------------------------------------------------------------------
 
@@ -300,7 +487,7 @@ namespace EE::Serialization
                 if constexpr ( std::is_same<Serializer, BinaryReader>::value )
                 {
                     uint32_t size = 0;
-                    m_serializer.ReadValue( size );
+                    m_serializer.ReadElementCount( size );
                     map.reserve( size );
 
                     K key;
@@ -382,6 +569,16 @@ namespace EE::Serialization
                     return;
                 }
 
+                // Flat POD types are directly copied when using the flat format
+                if constexpr ( IsFlatPodType<T>::value )
+                {
+                    if ( m_serializer.IsFlat() )
+                    {
+                        SerializeFlatPodArray( pArrayData, numElements );
+                        return;
+                    }
+                }
+
                 // If we are a basic type, then serialize as a block of binary data
                 if constexpr ( std::is_integral<T>::value || std::is_floating_point<T>::value )
                 {
@@ -406,6 +603,41 @@ namespace EE::Serialization
                 }
             }
 
+            template<typename T>
+            void SerializeFlatPodArray( T* pArrayData, size_t numElements )
+            {
+                static_assert( std::is_trivially_copyable<T>::value, "Flat POD types need to be trivially copyable" );
+
+                if constexpr ( std::is_same<Serializer, BinaryReader>::value )
+                {
+                    m_serializer.ReadFlatPodData( pArrayData, sizeof( T ) * numElements );
+                }
+                else
+                {
+                    m_serializer.WriteFlatPodData( pArrayData, sizeof( T ) * numElements );
+
+                    // Record any string IDs stored in the raw memory, so that they are added to the string table
+                    if constexpr ( std::is_class<T>::value && !std::is_same<T, EE::StringID>::value )
+                    {
+                        m_serializer.BeginGatheringStringIDs();
+                        for ( auto i = 0u; i < numElements; i++ )
+                        {
+                            pArrayData[i].Serialize( *this );
+                        }
+                        m_serializer.EndGatheringStringIDs();
+                    }
+                    else if constexpr ( std::is_same<T, EE::StringID>::value )
+                    {
+                        m_serializer.BeginGatheringStringIDs();
+                        for ( auto i = 0u; i < numElements; i++ )
+                        {
+                            m_serializer.WriteValue( pArrayData[i] );
+                        }
+                        m_serializer.EndGatheringStringIDs();
+                    }
+                }
+            }
+
         protected:
 
             Serializer m_serializer;
@@ -429,6 +661,16 @@ namespace EE::Serialization
         bool ReadFromBlob( Blob const& blob );
         bool ReadFromFile( FileSystem::Path const& filePath );
 
+        // Read from data that will outlive all the objects we deserialize (i.e. a memory mapped file)
+        // Mapped arrays will reference this data directly rather than copying it
+        bool ReadFromMappedData( uint8_t const* pData, size_t size );
+
+        // Did we reference any of the mapped data (i.e. does the mapping need to be kept alive)
+        inline bool HasReferencedMappedData() const { return m_serializer.HasReferencedPersistentData(); }
+
+        // Stops reading, returns false if the data was invalid so anything deserialized from it should be discarded
+        bool EndReading();
+
     private:
 
         void*       m_pFileData = nullptr;
@@ -443,7 +685,7 @@ namespace EE::Serialization
     {
     public:
 
-        BinaryOutputArchive();
+        BinaryOutputArchive( BinaryFormat format = BinaryFormat::MessagePack );
 
         // Clears all written data and begins writing again
         void Reset();
@@ -472,6 +714,12 @@ Serialization::Internal::Archive<Serialization::BinaryWriter>& Serialize( Serial
 
 #define EE_SERIALIZE_BASE( BaseTypeName ) Serialization::Internal::SerializeBaseType<BaseTypeName>( this )
 
+// Flag a type as flat POD, i.e. it will be copied as raw memory when using the flat binary format (needs to be in a public section)
+// All the serialized fields need to be listed so that we can validate that the type has no padding, padded types should just use the per-field serialization
+#define EE_SERIALIZE_FLAT_POD( TypeName, ... )\
+static void ValidateFlatPodLayout() { static_assert( sizeof( TypeName ) == decltype( Serialization::Internal::GetTotalFieldSize( __VA_ARGS__ ) )::value, "Flat POD types cannot contain padding!" ); }\
+using FlatPodSerializationType = TypeName
+
 //-------------------------------------------------------------------------
 
 #define EE_CUSTOM_SERIALIZE_READ_FUNCTION( archive )\
@@ -1,5 +1,7 @@
 #include "TypeDescriptors.h"
 #include "TypeRegistry.h"
+#include "Base/Resource/ResourcePtr.h"
+#include "Base/Serialization/BinarySerialization.h"
 #include "Base/Math/Math.h"
 
 
@@ -163,6 +165,7 @@ namespace EE::TypeSystem
         // Reset descriptor
         m_typeID = pTypeInstance->GetTypeID();
         m_properties.clear();
+        ClearCompiledPropertySetters();
 
         // Fill property values
         PropertyPath path;
@@ -170,6 +173,13 @@ namespace EE::TypeSystem
     }
 
     PropertyDescriptor* TypeDescriptor::GetProperty( PropertyPath const& path )
+    {
+        // The returned property might be modified
+        ClearCompiledPropertySetters();
+        return const_cast<PropertyDescriptor*>( const_cast<TypeDescriptor const*>( this )->GetProperty( path ) );
+    }
+
+    PropertyDescriptor const* TypeDescriptor::GetProperty( PropertyPath const& path ) const
     {
         for ( auto& prop : m_properties )
         {
@@ -184,6 +194,8 @@ namespace EE::TypeSystem
 
     void TypeDescriptor::RemovePropertyValue( TypeSystem::PropertyPath const& path )
     {
+        ClearCompiledPropertySetters();
+
         for ( int32_t i = (int32_t) m_properties.size() - 1; i >= 0; i-- )
         {
             if ( m_properties[i].m_path == path )
@@ -193,29 +205,279 @@ namespace EE::TypeSystem
         }
     }
 
+    void TypeDescriptor::SetPropertyValue( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, PropertyDescriptor const& propertyValue ) const
+    {
+        EE_ASSERT( propertyValue.IsValid() );
+
+        // Resolve a property path for a given instance
+        auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInfo, (uint8_t*) pTypeInstance, propertyValue.m_path );
+        if ( !resolvedPath.IsValid() )
+        {
+            EE_LOG_ERROR( "TypeSystem", "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyValue.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+            return;
+        }
+
+        // Set actual property value
+        auto const& resolvedProperty = resolvedPath.m_pathElements.back();
+        Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
+    }
+
     void* TypeDescriptor::SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const
     {
         EE_ASSERT( pTypeInfo != nullptr );
         EE_ASSERT( IsValid() && pTypeInfo->m_ID == m_typeID );
 
-        for ( auto const& propertyValue : m_properties )
+        if ( m_isCompiled )
+        {
+            ExecutePropertySetters( typeRegistry, pTypeInfo, pTypeInstance );
+        }
+        else
+        {
+            for ( auto const& propertyValue : m_properties )
+            {
+                SetPropertyValue( typeRegistry, pTypeInfo, pTypeInstance, propertyValue );
+            }
+        }
+
+        return pTypeInstance;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Core types that are plain data, so their decoded value can be copied directly into an instance
+        static bool IsTriviallyCopyableCoreType( CoreTypeID coreType )
+        {
+            switch ( coreType )
+            {
+                case CoreTypeID::Bool:
+                case CoreTypeID::Uint8:
+                case CoreTypeID::Int8:
+                case CoreTypeID::Uint16:
+                case CoreTypeID::Int16:
+                case CoreTypeID::Uint32:
+                case CoreTypeID::Int32:
+                case CoreTypeID::Uint64:
+                case CoreTypeID::Int64:
+                case CoreTypeID::Float:
+                case CoreTypeID::Double:
+                case CoreTypeID::UUID:
+                case CoreTypeID::StringID:
+                case CoreTypeID::TypeID:
+                case CoreTypeID::Color:
+                case CoreTypeID::Float2:
+                case CoreTypeID::Float3:
+                case CoreTypeID::Float4:
+                case CoreTypeID::Vector:
+                case CoreTypeID::Quaternion:
+                case CoreTypeID::Matrix:
+                case CoreTypeID::Transform:
+                case CoreTypeID::Microseconds:
+                case CoreTypeID::Milliseconds:
+                case CoreTypeID::Seconds:
+                case CoreTypeID::Percentage:
+                case CoreTypeID::Degrees:
+                case CoreTypeID::Radians:
+                case CoreTypeID::EulerAngles:
+                case CoreTypeID::IntRange:
+                case CoreTypeID::FloatRange:
+                case CoreTypeID::BitFlags:
+                case CoreTypeID::TBitFlags:
+                case CoreTypeID::ResourceTypeID:
+                return true;
+
+                default:
+                return false;
+            }
+        }
+    }
+
+    void TypeDescriptor::ClearCompiledPropertySetters()
+    {
+        m_compiledSetters.clear();
+        m_compiledValueData.clear();
+        m_compiledResourceIDs.clear();
+        m_isCompiled = false;
+    }
+
+    void TypeDescriptor::CompilePropertySetters( TypeRegistry const& typeRegistry )
+    {
+        ClearCompiledPropertySetters();
+
+        TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( m_typeID );
+        EE_ASSERT( pTypeInfo != nullptr );
+
+        m_compiledSetters.reserve( m_properties.size() );
+
+        int32_t const numProperties = (int32_t) m_properties.size();
+        for ( int32_t propertyIdx = 0; propertyIdx < numProperties; propertyIdx++ )
         {
+            PropertyDescriptor const& propertyValue = m_properties[propertyIdx];
             EE_ASSERT( propertyValue.IsValid() );
 
-            // Resolve a property path for a given instance
-            auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInfo, (uint8_t*) pTypeInstance, propertyValue.m_path );
-            if ( !resolvedPath.IsValid() )
+            PropertySetter setter;
+            setter.m_dataIdx = propertyIdx;
+
+            // Resolve the path to an offset
+            //-------------------------------------------------------------------------
+            // We can only handle a single array element in the path, since the element address depends on the instance's array data
+
+            TypeInfo const* pResolvedTypeInfo = pTypeInfo;
+            bool isValidPath = true;
+
+            size_t const numPathElements = propertyValue.m_path.GetNumElements();
+            for ( size_t i = 0; i < numPathElements; i++ )
+            {
+                if ( pResolvedTypeInfo == nullptr )
+                {
+                    isValidPath = false;
+                    break;
+                }
+
+                PropertyPath::PathElement const& pathElement = propertyValue.m_path[i];
+                setter.m_pPropertyInfo = pResolvedTypeInfo->GetPropertyInfo( pathElement.m_propertyID );
+                if ( setter.m_pPropertyInfo == nullptr )
+                {
+                    isValidPath = false;
+                    break;
+                }
+
+                if ( setter.m_pPropertyInfo->IsArrayProperty() )
+                {
+                    if ( setter.m_pArrayOwnerTypeInfo != nullptr )
+                    {
+                        setter.m_operation = PropertySetter::Operation::Resolve;
+                        break;
+                    }
+
+                    setter.m_pArrayOwnerTypeInfo = pResolvedTypeInfo;
+                    setter.m_arrayOwnerOffset = setter.m_offset;
+                    setter.m_arrayID = pathElement.m_propertyID.ToUint();
+                    setter.m_arrayElementIdx = pathElement.m_arrayElementIdx;
+                    setter.m_offset = 0;
+                }
+                else
+                {
+                    setter.m_offset += setter.m_pPropertyInfo->m_offset;
+                }
+
+                pResolvedTypeInfo = IsCoreType( setter.m_pPropertyInfo->m_typeID ) ? nullptr : typeRegistry.GetTypeInfo( setter.m_pPropertyInfo->m_typeID );
+            }
+
+            if ( !isValidPath )
             {
                 EE_LOG_ERROR( "TypeSystem", "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyValue.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
                 continue;
             }
 
-            // Set actual property value
-            auto const& resolvedProperty = resolvedPath.m_pathElements.back();
-            Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
+            if ( setter.m_operation == PropertySetter::Operation::Resolve )
+            {
+                m_compiledSetters.emplace_back( setter );
+                continue;
+            }
+
+            // Select the set operation
+            //-------------------------------------------------------------------------
+
+            PropertyInfo const& propertyInfo = *setter.m_pPropertyInfo;
+            CoreTypeID const coreType = IsCoreType( propertyInfo.m_typeID ) ? GetCoreType( propertyInfo.m_typeID ) : CoreTypeID::Invalid;
+
+            if ( propertyInfo.IsEnumProperty() || IsTriviallyCopyableCoreType( coreType ) )
+            {
+                // Decode the value now and store the native bytes
+                alignas( 16 ) uint8_t decodedValue[128] = {};
+                setter.m_dataSize = (uint32_t) ( propertyInfo.IsArrayProperty() ? propertyInfo.m_arrayElementSize : propertyInfo.m_size );
+                EE_ASSERT( setter.m_dataSize > 0 && setter.m_dataSize <= sizeof( decodedValue ) );
+                Conversion::ConvertBinaryToNativeType( typeRegistry, propertyInfo, propertyValue.m_byteValue, decodedValue );
+
+                setter.m_operation = PropertySetter::Operation::Copy;
+                setter.m_dataIdx = (uint32_t) m_compiledValueData.size();
+                m_compiledValueData.insert( m_compiledValueData.end(), decodedValue, decodedValue + setter.m_dataSize );
+            }
+            else if ( coreType == CoreTypeID::ResourceID || coreType == CoreTypeID::ResourcePtr || coreType == CoreTypeID::TResourcePtr )
+            {
+                // Resource IDs require parsing and hashing the path, so only do it once
+                ResourceID& resourceID = m_compiledResourceIDs.emplace_back();
+                Serialization::BinaryInputArchive archive;
+                archive.ReadFromBlob( propertyValue.m_byteValue );
+                archive << resourceID;
+
+                setter.m_operation = PropertySetter::Operation::SetResourceID;
+                setter.m_dataIdx = (uint32_t) m_compiledResourceIDs.size() - 1;
+            }
+            else
+            {
+                setter.m_operation = PropertySetter::Operation::Convert;
+            }
+
+            m_compiledSetters.emplace_back( setter );
         }
 
-        return pTypeInstance;
+        m_isCompiled = true;
+    }
+
+    void TypeDescriptor::ExecutePropertySetters( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const
+    {
+        EE_ASSERT( m_isCompiled );
+        uint8_t* const pInstanceAddress = reinterpret_cast<uint8_t*>( pTypeInstance );
+
+        for ( PropertySetter const& setter : m_compiledSetters )
+        {
+            if ( setter.m_operation == PropertySetter::Operation::Resolve )
+            {
+                SetPropertyValue( typeRegistry, pTypeInfo, pTypeInstance, m_properties[setter.m_dataIdx] );
+                continue;
+            }
+
+            // Calculate the property address, array elements need to be looked up per instance (dynamic arrays might need to be resized)
+            uint8_t* pPropertyAddress = nullptr;
+            if ( setter.m_pArrayOwnerTypeInfo != nullptr )
+            {
+                IReflectedType* pArrayOwner = reinterpret_cast<IReflectedType*>( pInstanceAddress + setter.m_arrayOwnerOffset );
+                pPropertyAddress = setter.m_pArrayOwnerTypeInfo->GetArrayElementDataPtr( pArrayOwner, setter.m_arrayID, setter.m_arrayElementIdx ) + setter.m_offset;
+            }
+            else
+            {
+                pPropertyAddress = pInstanceAddress + setter.m_offset;
+            }
+
+            // Set the value
+            switch ( setter.m_operation )
+            {
+                case PropertySetter::Operation::Copy:
+                {
+                    memcpy( pPropertyAddress, m_compiledValueData.data() + setter.m_dataIdx, setter.m_dataSize );
+                }
+                break;
+
+                case PropertySetter::Operation::SetResourceID:
+                {
+                    ResourceID const& resourceID = m_compiledResourceIDs[setter.m_dataIdx];
+                    if ( GetCoreType( setter.m_pPropertyInfo->m_typeID ) == CoreTypeID::ResourceID )
+                    {
+                        *reinterpret_cast<ResourceID*>( pPropertyAddress ) = resourceID;
+                    }
+                    else
+                    {
+                        *reinterpret_cast<Resource::ResourcePtr*>( pPropertyAddress ) = Resource::ResourcePtr( resourceID );
+                    }
+                }
+                break;
+
+                case PropertySetter::Operation::Convert:
+                {
+                    Conversion::ConvertBinaryToNativeType( typeRegistry, *setter.m_pPropertyInfo, m_properties[setter.m_dataIdx].m_byteValue, pPropertyAddress );
+                }
+                break;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                }
+                break;
+            }
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -270,5 +532,11 @@ namespace EE::TypeSystem
         }
 
         m_totalRequiredSize = (uint32_t) predictedMemoryOffset;
+
+        // The collection will be instantiated as is, so compile the descriptors
+        for ( auto& typeDesc : m_descriptors )
+        {
+            typeDesc.CompilePropertySetters( typeRegistry );
+        }
     }
 }
\ No newline at end of file
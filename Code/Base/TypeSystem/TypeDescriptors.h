@@ -5,6 +5,8 @@
 #include "CoreTypeIDs.h"
 #include "CoreTypeConversions.h"
 #include "TypeRegistry.h"
+#include "TypeInstancePool.h"
+#include "Base/Resource/ResourceID.h"
 
 //-------------------------------------------------------------------------
 // Basic descriptor of a reflected property
@@ -100,6 +102,30 @@ namespace EE::TypeSystem
     {
         EE_SERIALIZE( m_typeID, m_properties );
 
+        // A single precompiled property set operation, the property path has already been resolved to a byte offset
+        struct PropertySetter
+        {
+            enum class Operation : uint8_t
+            {
+                Copy,               // Copy a pre-decoded trivially copyable value
+                SetResourceID,      // Assign a pre-decoded resource ID (resource IDs and resource ptrs)
+                Convert,            // Decode the serialized value directly into the property
+                Resolve,            // The path contains nested arrays so we need to resolve it per instance
+            };
+
+        public:
+
+            PropertyInfo const*                                     m_pPropertyInfo = nullptr;
+            TypeInfo const*                                         m_pArrayOwnerTypeInfo = nullptr; // Set if the path contains an array element
+            uint32_t                                                m_arrayOwnerOffset = 0; // The offset of the type that owns the array
+            uint32_t                                                m_arrayID = 0;
+            int32_t                                                 m_arrayElementIdx = InvalidIndex;
+            uint32_t                                                m_offset = 0; // The offset of the property from the instance (or from the array element if we have one)
+            uint32_t                                                m_dataIdx = 0; // The offset into the value data for copies, the index of the resource ID for resource sets and the property index otherwise
+            uint32_t                                                m_dataSize = 0;
+            Operation                                               m_operation = Operation::Convert;
+        };
+
     public:
 
         TypeDescriptor() = default;
@@ -140,6 +166,21 @@ namespace EE::TypeSystem
             return CreateTypeInstance<T>( typeRegistry, pTypeInfo );
         }
 
+        // Create a new instance of the described type from the supplied pool, the instance needs to be destroyed via the pool
+        template<typename T>
+        [[nodiscard]] inline T* CreateTypeInstance( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, TypeInstancePool& pool ) const
+        {
+            EE_ASSERT( pTypeInfo != nullptr && pTypeInfo->m_ID == m_typeID );
+
+            // Create new instance
+            T* pTypeInstance = pool.CreateType<T>( pTypeInfo );
+            EE_ASSERT( pTypeInstance != nullptr );
+
+            // Set properties
+            SetPropertyValues( typeRegistry, pTypeInfo, pTypeInstance );
+            return pTypeInstance;
+        }
+
         // This will create a new instance of the described type in the memory block provided
         // WARNING! Do not use this function on an existing type instance of type T since it will not call the destructor and so will leak, only use on uninitialized memory
         template<typename T>
@@ -179,18 +220,39 @@ namespace EE::TypeSystem
         // Properties
         //-------------------------------------------------------------------------
 
+        // Modifying the property values will clear any compiled property setters
         PropertyDescriptor* GetProperty( PropertyPath const& path );
-        inline PropertyDescriptor const* GetProperty( PropertyPath const& path ) const { return const_cast<TypeDescriptor*>( this )->GetProperty( path ); }
+        PropertyDescriptor const* GetProperty( PropertyPath const& path ) const;
         void RemovePropertyValue( PropertyPath const& path );
 
+        // Compiled Property Setters
+        //-------------------------------------------------------------------------
+        // Resolving property paths and decoding the values is expensive, so for descriptors that are instantiated many times (i.e. loaded resources)
+        // we can compile the property values into a flat list of offsets and pre-decoded values, instantiation then becomes mostly a series of copies
+        // The compiled setters need to be recompiled if the property values are modified directly
+
+        void CompilePropertySetters( TypeRegistry const& typeRegistry );
+        inline bool HasCompiledPropertySetters() const { return m_isCompiled; }
+        void ClearCompiledPropertySetters();
+
     private:
 
         void* SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const;
+        void SetPropertyValue( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, PropertyDescriptor const& propertyValue ) const;
+        void ExecutePropertySetters( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const;
 
     public:
 
         TypeID                                                      m_typeID;
         TInlineVector<PropertyDescriptor, 6>                        m_properties;
+
+    private:
+
+        // Not-serialized - created by compiling the properties
+        TVector<PropertySetter>                                     m_compiledSetters;
+        TVector<uint8_t>                                            m_compiledValueData;
+        TVector<ResourceID>                                         m_compiledResourceIDs;
+        bool                                                        m_isCompiled = false;
     };
 
     //-------------------------------------------------------------------------
@@ -200,6 +262,7 @@ namespace EE::TypeSystem
     // This collection can be instantiate in one of two ways
     // * Statically - all types are created in a single contiguous array of memory, this is immutable
     // * Dynamically - each type is individually allocated, these types can be destroyed individually at runtime
+    // * Pooled - each type is allocated from a type instance pool, all slots needed are reserved up front so types can be destroyed individually at runtime
 
     struct EE_BASE_API TypeDescriptorCollection
     {
@@ -258,11 +321,34 @@ namespace EE::TypeSystem
             types.clear();
         }
 
+        template<typename T>
+        static void InstantiatePooledCollection( TypeRegistry const& typeRegistry, TypeDescriptorCollection const& collection, TypeInstancePool& pool, TVector<T*>& outTypes )
+        {
+            pool.Reserve( collection );
+
+            int32_t const numDescs = (int32_t) collection.m_descriptors.size();
+            for ( int32_t i = 0; i < numDescs; i++ )
+            {
+                outTypes.emplace_back( collection.m_descriptors[i].CreateTypeInstance<T>( typeRegistry, collection.m_typeInfos[i], pool ) );
+            }
+        }
+
+        template<typename T>
+        static void DestroyPooledCollection( TypeInstancePool& pool, TVector<T*>& types )
+        {
+            for ( auto pType : types )
+            {
+                pool.DestroyType( pType );
+            }
+            types.clear();
+        }
+
     public:
 
         void Reset();
 
         // Calculates all the necessary information needed to instantiate this collection statically (aka in a single immutable block)
+        // This also compiles the property setters for all descriptors since the collection is assumed to be immutable from this point
         void CalculateCollectionRequirements( TypeRegistry const& typeRegistry );
 
     public:
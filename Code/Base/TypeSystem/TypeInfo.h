@@ -3,6 +3,7 @@
 #include "PropertyInfo.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Types/HashMap.h"
+#include "Base/Types/FlatHashMap.h"
 #include "Base/Types/LoadingStatus.h"
 
 //-------------------------------------------------------------------------
@@ -115,7 +116,7 @@ namespace EE::TypeSystem
         IReflectedType const*                   m_pDefaultInstance;
         TypeInfo const*                         m_pParentTypeInfo = nullptr;
         TVector<PropertyInfo>                   m_properties;
-        THashMap<StringID, int32_t>             m_propertyMap;
+        TFlatHashMap<StringID, int32_t>         m_propertyMap;
         int32_t                                 m_size = -1;
         int32_t                                 m_alignment = -1;
         bool                                    m_isAbstract = false;
@@ -0,0 +1,294 @@
+#include "TypeInstancePool.h"
+#include "TypeDescriptors.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem
+{
+    TypeInstancePool::TypeInstancePool( int32_t numSlotsPerSlab )
+        : m_numSlotsPerSlab( numSlotsPerSlab )
+    {
+        EE_ASSERT( m_numSlotsPerSlab > 0 );
+    }
+
+    TypeInstancePool::~TypeInstancePool()
+    {
+        for ( TypePool* pTypePool : m_typePools )
+        {
+            EE_ASSERT( pTypePool->m_numLiveInstances == 0 ); // Instances are not destroyed with the pool, did you leak something?
+
+            for ( Slab& slab : pTypePool->m_slabs )
+            {
+                EE::Free( (void*&) slab.m_pMemory );
+            }
+
+            EE::Delete( pTypePool );
+        }
+
+        m_typePools.clear();
+
+        //-------------------------------------------------------------------------
+
+        m_retiredTypePoolTables.emplace_back( m_pTypePoolTable.exchange( nullptr ) );
+        for ( TypePoolTable* pTable : m_retiredTypePoolTables )
+        {
+            if ( pTable != nullptr )
+            {
+                EE::Free( (void*&) pTable->m_pEntries );
+                EE::Delete( pTable );
+            }
+        }
+
+        m_retiredTypePoolTables.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    TypeInstancePool::TypePool* TypeInstancePool::FindTypePool( TypeID typeID ) const
+    {
+        TypePoolTable const* pTable = m_pTypePoolTable.load( std::memory_order_acquire );
+        if ( pTable == nullptr )
+        {
+            return nullptr;
+        }
+
+        // The table is never more than half full, so there is always an empty entry to end the probe
+        uint32_t const mask = pTable->m_capacity - 1;
+        for ( uint32_t idx = typeID.ToUint() & mask; ; idx = ( idx + 1 ) & mask )
+        {
+            TypePool* pTypePool = pTable->m_pEntries[idx].load( std::memory_order_acquire );
+            if ( pTypePool == nullptr || pTypePool->m_pTypeInfo->m_ID == typeID )
+            {
+                return pTypePool;
+            }
+        }
+    }
+
+    void TypeInstancePool::AddToTypePoolTable( TypePool* pTypePool )
+    {
+        auto InsertIntoTable = [] ( TypePoolTable* pTable, TypePool* pTypePoolToInsert )
+        {
+            uint32_t const mask = pTable->m_capacity - 1;
+            uint32_t idx = pTypePoolToInsert->m_pTypeInfo->m_ID.ToUint() & mask;
+            while ( pTable->m_pEntries[idx].load( std::memory_order_relaxed ) != nullptr )
+            {
+                idx = ( idx + 1 ) & mask;
+            }
+
+            pTable->m_pEntries[idx].store( pTypePoolToInsert, std::memory_order_release );
+            pTable->m_numEntries++;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Grow the table if needed, the new table is fully populated before it is published
+        TypePoolTable* pTable = m_pTypePoolTable.load( std::memory_order_relaxed );
+        if ( pTable == nullptr || ( pTable->m_numEntries + 1 ) * 2 > pTable->m_capacity )
+        {
+            uint32_t const newCapacity = ( pTable != nullptr ) ? pTable->m_capacity * 2 : s_initialTypePoolTableCapacity;
+
+            TypePoolTable* pNewTable = EE::New<TypePoolTable>();
+            pNewTable->m_pEntries = (std::atomic<TypePool*>*) EE::Alloc( sizeof( std::atomic<TypePool*> ) * newCapacity, alignof( std::atomic<TypePool*> ) );
+            pNewTable->m_capacity = newCapacity;
+            for ( uint32_t i = 0; i < newCapacity; i++ )
+            {
+                new ( &pNewTable->m_pEntries[i] ) std::atomic<TypePool*>( nullptr );
+            }
+
+            for ( TypePool* pExistingTypePool : m_typePools )
+            {
+                InsertIntoTable( pNewTable, pExistingTypePool );
+            }
+
+            m_pTypePoolTable.store( pNewTable, std::memory_order_release );
+
+            // Other threads might still be reading the old table, so we only release it with the pool
+            if ( pTable != nullptr )
+            {
+                m_retiredTypePoolTables.emplace_back( pTable );
+            }
+
+            pTable = pNewTable;
+        }
+
+        InsertIntoTable( pTable, pTypePool );
+    }
+
+    TypeInstancePool::TypePool* TypeInstancePool::GetOrCreateTypePool( TypeInfo const* pTypeInfo )
+    {
+        EE_ASSERT( pTypeInfo != nullptr );
+        EE_ASSERT( pTypeInfo->m_size > 0 && pTypeInfo->m_alignment > 0 );
+
+        TypePool* pTypePool = FindTypePool( pTypeInfo->m_ID );
+        if ( pTypePool != nullptr )
+        {
+            return pTypePool;
+        }
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock lock( m_mutex );
+
+        // Another thread might have created the type pool while we were waiting for the lock
+        pTypePool = FindTypePool( pTypeInfo->m_ID );
+        if ( pTypePool != nullptr )
+        {
+            return pTypePool;
+        }
+
+        // Each slot stores the owning type pool in a header before the instance
+        // Free slots store the free list link in the instance memory so each instance needs to be able to hold a pointer
+        uint32_t const slotAlignment = (uint32_t) Math::Max( (size_t) pTypeInfo->m_alignment, alignof( void* ) );
+        uint32_t const instanceOffset = (uint32_t) ( sizeof( TypePool* ) + Memory::CalculatePaddingForAlignment( sizeof( TypePool* ), slotAlignment ) );
+        uint32_t const slotSize = instanceOffset + (uint32_t) Math::Max( (size_t) pTypeInfo->m_size, sizeof( void* ) );
+
+        pTypePool = EE::New<TypePool>();
+        pTypePool->m_pTypeInfo = pTypeInfo;
+        pTypePool->m_slotAlignment = slotAlignment;
+        pTypePool->m_slotSize = slotSize + (uint32_t) Memory::CalculatePaddingForAlignment( slotSize, slotAlignment );
+        pTypePool->m_instanceOffset = instanceOffset;
+
+        AddToTypePoolTable( pTypePool );
+        m_typePools.emplace_back( pTypePool );
+        return pTypePool;
+    }
+
+    void TypeInstancePool::AllocateSlab( TypePool* pTypePool, int32_t numSlots )
+    {
+        EE_ASSERT( numSlots > 0 );
+
+        Slab& slab = pTypePool->m_slabs.emplace_back();
+        slab.m_pMemory = (uint8_t*) EE::Alloc( (size_t) pTypePool->m_slotSize * numSlots, pTypePool->m_slotAlignment );
+        slab.m_numSlots = numSlots;
+
+        // Write the slot headers and link the slots in order so that consecutive allocations are contiguous in memory
+        for ( int32_t i = numSlots - 1; i >= 0; i-- )
+        {
+            uint8_t* pInstance = slab.m_pMemory + (size_t) pTypePool->m_slotSize * i + pTypePool->m_instanceOffset;
+            *( reinterpret_cast<TypePool**>( pInstance ) - 1 ) = pTypePool;
+            *reinterpret_cast<void**>( pInstance ) = pTypePool->m_pFreeList;
+            pTypePool->m_pFreeList = pInstance;
+        }
+
+        pTypePool->m_numFreeSlots += numSlots;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* TypeInstancePool::AllocateSlot( TypeInfo const* pTypeInfo )
+    {
+        TypePool* pTypePool = GetOrCreateTypePool( pTypeInfo );
+        Threading::ScopeLock lock( pTypePool->m_mutex );
+
+        if ( pTypePool->m_pFreeList == nullptr )
+        {
+            AllocateSlab( pTypePool, m_numSlotsPerSlab );
+        }
+
+        void* pInstance = pTypePool->m_pFreeList;
+        pTypePool->m_pFreeList = *reinterpret_cast<void**>( pInstance );
+        pTypePool->m_numFreeSlots--;
+        pTypePool->m_numLiveInstances++;
+        pTypePool->m_numCreatedInstances++;
+        return pInstance;
+    }
+
+    void TypeInstancePool::DestroyType( IReflectedType* pTypeInstance )
+    {
+        EE_ASSERT( pTypeInstance != nullptr );
+        EE_ASSERT( Owns( pTypeInstance ) );
+
+        TypePool* pTypePool = GetOwningTypePool( pTypeInstance );
+        pTypeInstance->~IReflectedType();
+
+        Threading::ScopeLock lock( pTypePool->m_mutex );
+        *reinterpret_cast<void**>( pTypeInstance ) = pTypePool->m_pFreeList;
+        pTypePool->m_pFreeList = pTypeInstance;
+        pTypePool->m_numFreeSlots++;
+        pTypePool->m_numLiveInstances--;
+        pTypePool->m_numDestroyedInstances++;
+    }
+
+    bool TypeInstancePool::Owns( IReflectedType const* pTypeInstance ) const
+    {
+        EE_ASSERT( pTypeInstance != nullptr );
+
+        TypePool* pTypePool = FindTypePool( pTypeInstance->GetTypeID() );
+        if ( pTypePool == nullptr )
+        {
+            return false;
+        }
+
+        Threading::ScopeLock lock( pTypePool->m_mutex );
+        uint8_t const* pAddress = reinterpret_cast<uint8_t const*>( pTypeInstance );
+        for ( Slab const& slab : pTypePool->m_slabs )
+        {
+            if ( pAddress >= slab.m_pMemory && pAddress < slab.m_pMemory + (size_t) pTypePool->m_slotSize * slab.m_numSlots )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TypeInstancePool::Reserve( TypeInfo const* pTypeInfo, int32_t numInstances )
+    {
+        EE_ASSERT( numInstances >= 0 );
+
+        TypePool* pTypePool = GetOrCreateTypePool( pTypeInfo );
+        Threading::ScopeLock lock( pTypePool->m_mutex );
+
+        int32_t const numSlotsRequired = numInstances - pTypePool->m_numFreeSlots;
+        if ( numSlotsRequired > 0 )
+        {
+            AllocateSlab( pTypePool, Math::Max( numSlotsRequired, m_numSlotsPerSlab ) );
+        }
+    }
+
+    void TypeInstancePool::Reserve( TypeDescriptorCollection const& collection, int32_t numInstances )
+    {
+        EE_ASSERT( collection.m_typeInfos.size() == collection.m_descriptors.size() ); // Did you forget to run the calculate requirements function?
+
+        // Collections often contain multiple instances of the same type, so count them before reserving
+        THashMap<TypeInfo const*, int32_t> numInstancesPerType;
+        for ( TypeInfo const* pTypeInfo : collection.m_typeInfos )
+        {
+            numInstancesPerType[pTypeInfo] += numInstances;
+        }
+
+        for ( auto const& pair : numInstancesPerType )
+        {
+            Reserve( pair.first, pair.second );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    TypeInstancePool::Stats TypeInstancePool::GetStats() const
+    {
+        Stats stats;
+
+        Threading::ScopeLock lock( m_mutex );
+        for ( TypePool* pTypePool : m_typePools )
+        {
+            Threading::ScopeLock typeLock( pTypePool->m_mutex );
+
+            for ( Slab const& slab : pTypePool->m_slabs )
+            {
+                stats.m_reservedMemory += (size_t) pTypePool->m_slotSize * slab.m_numSlots;
+            }
+
+            stats.m_usedMemory += (size_t) pTypePool->m_slotSize * pTypePool->m_numLiveInstances;
+            stats.m_numSlabs += (int32_t) pTypePool->m_slabs.size();
+            stats.m_numLiveInstances += pTypePool->m_numLiveInstances;
+            stats.m_numCreatedInstances += pTypePool->m_numCreatedInstances;
+            stats.m_numDestroyedInstances += pTypePool->m_numDestroyedInstances;
+        }
+
+        stats.m_numTypes = (int32_t) m_typePools.size();
+        return stats;
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "TypeInfo.h"
+#include "ReflectedType.h"
+#include "Base/Threading/Threading.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Type Instance Pool
+//-------------------------------------------------------------------------
+// Per-type slab pools for reflected type instances
+// Instances of the same type are packed together in fixed size slots (using the type info's size/alignment) and freed slots are recycled via a free list
+// Each slot starts with a small header that stores the owning type pool, so destroying an instance never needs to look up its type pool
+// Creation and destruction of an instance are O(1), slab memory is only released when the pool is destroyed
+// The pool is thread-safe, each type has its own lock so instantiation of different types doesnt contend
+// The type pool lookup is lock-free, only the first instantiation (or reservation) of a type takes the pool-wide lock
+
+namespace EE::TypeSystem
+{
+    struct TypeDescriptorCollection;
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API TypeInstancePool
+    {
+        constexpr static int32_t const s_defaultNumSlotsPerSlab = 32;
+        constexpr static uint32_t const s_initialTypePoolTableCapacity = 64;
+
+    public:
+
+        struct Stats
+        {
+            size_t                                  m_reservedMemory = 0;
+            size_t                                  m_usedMemory = 0;
+            int32_t                                 m_numTypes = 0;
+            int32_t                                 m_numSlabs = 0;
+            int32_t                                 m_numLiveInstances = 0;
+            uint64_t                                m_numCreatedInstances = 0;
+            uint64_t                                m_numDestroyedInstances = 0;
+        };
+
+    private:
+
+        struct Slab
+        {
+            uint8_t*                                m_pMemory = nullptr;
+            int32_t                                 m_numSlots = 0;
+        };
+
+        struct TypePool
+        {
+            TypeInfo const*                         m_pTypeInfo = nullptr;
+            Threading::Mutex                        m_mutex;
+            TVector<Slab>                           m_slabs;
+            void*                                   m_pFreeList = nullptr;         // The free list links the instance addresses of the free slots
+            uint32_t                                m_slotSize = 0;
+            uint32_t                                m_slotAlignment = 0;
+            uint32_t                                m_instanceOffset = 0;          // The offset of the instance from the start of the slot, the owning type pool is stored just before the instance
+            int32_t                                 m_numFreeSlots = 0;
+            int32_t                                 m_numLiveInstances = 0;
+            uint64_t                                m_numCreatedInstances = 0;
+            uint64_t                                m_numDestroyedInstances = 0;
+        };
+
+        // Open addressing lookup table from type ID to type pool, entries are only ever added so it can be read without locking
+        // When the table needs to grow, a new table is published and the old one is kept alive until the pool is destroyed
+        struct TypePoolTable
+        {
+            std::atomic<TypePool*>*                 m_pEntries = nullptr;
+            uint32_t                                m_capacity = 0;                // Always a power of two
+            uint32_t                                m_numEntries = 0;
+        };
+
+    public:
+
+        TypeInstancePool( int32_t numSlotsPerSlab = s_defaultNumSlotsPerSlab );
+        ~TypeInstancePool();
+
+        TypeInstancePool( TypeInstancePool const& ) = delete;
+        TypeInstancePool& operator=( TypeInstancePool const& ) = delete;
+
+        // Create a default constructed instance of the specified type
+        template<typename T>
+        [[nodiscard]] inline T* CreateType( TypeInfo const* pTypeInfo )
+        {
+            EE_ASSERT( pTypeInfo != nullptr && pTypeInfo->IsDerivedFrom<T>() );
+            IReflectedType* pTypeInstance = reinterpret_cast<IReflectedType*>( AllocateSlot( pTypeInfo ) );
+            pTypeInfo->CreateTypeInPlace( pTypeInstance );
+            return reinterpret_cast<T*>( pTypeInstance );
+        }
+
+        // Destroy an instance created by this pool, the slot will be reused by the next instance of the same type
+        void DestroyType( IReflectedType* pTypeInstance );
+
+        // Is this instance allocated from this pool - this is slow and is only meant for validation
+        bool Owns( IReflectedType const* pTypeInstance ) const;
+
+        // Destroy an instance that was either created from the supplied pool or, if no pool is supplied, created via its type info
+        template<typename T>
+        static inline void DestroyInstance( TypeInstancePool* pPool, T*& pTypeInstance )
+        {
+            EE_ASSERT( pTypeInstance != nullptr );
+            if ( pPool != nullptr )
+            {
+                pPool->DestroyType( pTypeInstance );
+                pTypeInstance = nullptr;
+            }
+            else
+            {
+                EE::Delete( pTypeInstance );
+            }
+        }
+
+        // Memory
+        //-------------------------------------------------------------------------
+
+        // Ensure that we have enough free slots for the specified number of instances of a type, any new slots are allocated as a single slab
+        void Reserve( TypeInfo const* pTypeInfo, int32_t numInstances );
+
+        // Ensure that we have enough free slots to instantiate the collection 'numInstances' times
+        // The collection requirements need to have been calculated (i.e. 'CalculateCollectionRequirements') since we use the cached type infos
+        void Reserve( TypeDescriptorCollection const& collection, int32_t numInstances = 1 );
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        Stats GetStats() const;
+
+    private:
+
+        void* AllocateSlot( TypeInfo const* pTypeInfo );
+        TypePool* GetOrCreateTypePool( TypeInfo const* pTypeInfo );
+
+        // Lock-free type pool lookup
+        TypePool* FindTypePool( TypeID typeID ) const;
+
+        // Add a type pool to the lookup table, growing it if needed, assumes the pool is locked
+        void AddToTypePoolTable( TypePool* pTypePool );
+
+        // Allocate a new slab with the specified number of slots and add all its slots to the free list, assumes the type pool is locked
+        static void AllocateSlab( TypePool* pTypePool, int32_t numSlots );
+
+        // Get the type pool that owns the slot for a pool allocated instance
+        EE_FORCE_INLINE static TypePool* GetOwningTypePool( IReflectedType const* pTypeInstance ) { return *( reinterpret_cast<TypePool* const*>( pTypeInstance ) - 1 ); }
+
+    private:
+
+        mutable Threading::Mutex                    m_mutex;                        // Only needed to create type pools
+        TVector<TypePool*>                          m_typePools;
+        std::atomic<TypePoolTable*>                 m_pTypePoolTable = nullptr;
+        TVector<TypePoolTable*>                     m_retiredTypePoolTables;        // Tables that might still be read by other threads
+        int32_t const                               m_numSlotsPerSlab;
+    };
+}
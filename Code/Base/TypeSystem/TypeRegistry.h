@@ -104,7 +104,7 @@ namespace EE::TypeSystem
 
     private:
 
-        THashMap<TypeID, TypeInfo const*>       m_registeredTypes;
+        TFlatHashMap<TypeID, TypeInfo const*>   m_registeredTypes;
         THashMap<TypeID, EnumInfo*>             m_registeredEnums;
         THashMap<TypeID, ResourceInfo>          m_registeredResourceTypes;
     };
@@ -23,6 +23,7 @@ namespace EE
     struct Color
     {
         EE_SERIALIZE( m_color );
+        EE_SERIALIZE_FLAT_POD( Color, m_color );
 
         union
         {
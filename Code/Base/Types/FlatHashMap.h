@@ -0,0 +1,621 @@
+#pragma once
+
+#include "Base/Memory/Memory.h"
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+#include <immintrin.h>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+//-------------------------------------------------------------------------
+// Flat Hash Map/Set
+//-------------------------------------------------------------------------
+// Open addressing hash tables (Swiss table style), intended to replace THashMap on hot lookup paths
+//
+// All elements are stored inline in a single allocation alongside a control byte per slot
+// The control byte stores 7 bits of the hash for occupied slots, so a group of 16 slots can be checked with a couple of SSE instructions
+// and we only compare keys for slots that are very likely to match
+//
+// Differences to THashMap:
+// * Any insert can move existing elements, so insertions invalidate all iterators and element pointers
+// * Erasing an element only invalidates iterators/pointers to that element
+// * Iteration order is arbitrary and not stable across inserts
+
+namespace EE
+{
+    namespace Internal
+    {
+        using FlatHashControlByte = int8_t;
+
+        // Empty and deleted are the only values smaller than the sentinel, occupied slots store the 7-bit hash (i.e. always >= 0)
+        constexpr static FlatHashControlByte const g_flatHashEmpty = -128;
+        constexpr static FlatHashControlByte const g_flatHashDeleted = -2;
+        constexpr static FlatHashControlByte const g_flatHashSentinel = -1;
+
+        constexpr static size_t const g_flatHashGroupWidth = 16;
+        constexpr static size_t const g_flatHashMinCapacity = g_flatHashGroupWidth;
+        constexpr static size_t const g_flatHashNotFound = ~size_t( 0 );
+
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE uint32_t FlatHashCountTrailingZeros( uint32_t mask )
+        {
+            #ifdef _WIN32
+            unsigned long index;
+            _BitScanForward( &index, (unsigned long) mask );
+            return index;
+            #else
+            return (uint32_t) __builtin_ctz( mask );
+            #endif
+        }
+
+        // Most of our hashes are IDs (or already hashed values), so mix them to ensure that both the high and low bits are usable
+        EE_FORCE_INLINE uint64_t FlatHashMix( size_t hash )
+        {
+            uint64_t const h = uint64_t( hash ) * 0x9E3779B97F4A7C15ull;
+            return h ^ ( h >> 32 );
+        }
+
+        EE_FORCE_INLINE FlatHashControlByte FlatHashH2( uint64_t hash ) { return FlatHashControlByte( hash & 0x7F ); }
+        EE_FORCE_INLINE size_t FlatHashH1( uint64_t hash ) { return size_t( hash >> 7 ); }
+
+        // A group of 16 control bytes
+        struct FlatHashGroup
+        {
+            EE_FORCE_INLINE explicit FlatHashGroup( FlatHashControlByte const* pControl ) : m_control( _mm_load_si128( reinterpret_cast<__m128i const*>( pControl ) ) ) {}
+
+            EE_FORCE_INLINE uint32_t Match( FlatHashControlByte h2 ) const { return (uint32_t) _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_set1_epi8( h2 ), m_control ) ); }
+            EE_FORCE_INLINE uint32_t MatchEmpty() const { return Match( g_flatHashEmpty ); }
+            EE_FORCE_INLINE uint32_t MatchEmptyOrDeleted() const { return (uint32_t) _mm_movemask_epi8( _mm_cmpgt_epi8( _mm_set1_epi8( g_flatHashSentinel ), m_control ) ); }
+
+            __m128i m_control;
+        };
+
+        // We allow up to 7/8 of the slots to be used (including deleted ones)
+        EE_FORCE_INLINE size_t FlatHashGetMaxLoad( size_t capacity ) { return capacity - capacity / 8; }
+
+        //-------------------------------------------------------------------------
+
+        struct FlatHashMapKeyOf
+        {
+            template<typename Pair>
+            EE_FORCE_INLINE typename Pair::first_type const& operator()( Pair const& pair ) const { return pair.first; }
+        };
+
+        struct FlatHashSetKeyOf
+        {
+            template<typename Key>
+            EE_FORCE_INLINE Key const& operator()( Key const& key ) const { return key; }
+        };
+
+        //-------------------------------------------------------------------------
+        // Shared hash table implementation for the map and set
+        //-------------------------------------------------------------------------
+
+        template<typename Value, typename Key, typename KeyOf, typename Hash, typename Equal>
+        class TFlatHashTable
+        {
+        public:
+
+            template<bool IsConst>
+            class TIterator
+            {
+                friend TFlatHashTable;
+
+            public:
+
+                using iterator_category = eastl::forward_iterator_tag;
+                using value_type = Value;
+                using difference_type = ptrdiff_t;
+                using pointer = std::conditional_t<IsConst, Value const*, Value*>;
+                using reference = std::conditional_t<IsConst, Value const&, Value&>;
+
+            public:
+
+                TIterator() = default;
+
+                // Allow conversion from a non-const iterator to a const one
+                template<bool OtherIsConst, typename = std::enable_if_t<IsConst && !OtherIsConst>>
+                TIterator( TIterator<OtherIsConst> const& other ) : m_pControl( other.m_pControl ), m_pSlot( other.m_pSlot ) {}
+
+                EE_FORCE_INLINE reference operator*() const { return *m_pSlot; }
+                EE_FORCE_INLINE pointer operator->() const { return m_pSlot; }
+
+                EE_FORCE_INLINE TIterator& operator++() { ++m_pControl; ++m_pSlot; SkipUnoccupiedSlots(); return *this; }
+                EE_FORCE_INLINE TIterator operator++( int ) { TIterator tmp = *this; ++( *this ); return tmp; }
+
+                EE_FORCE_INLINE bool operator==( TIterator const& rhs ) const { return m_pSlot == rhs.m_pSlot; }
+                EE_FORCE_INLINE bool operator!=( TIterator const& rhs ) const { return m_pSlot != rhs.m_pSlot; }
+
+            private:
+
+                TIterator( FlatHashControlByte const* pControl, pointer pSlot ) : m_pControl( pControl ), m_pSlot( pSlot ) {}
+
+                // The control bytes are terminated by a sentinel, so this will always stop at the end
+                EE_FORCE_INLINE void SkipUnoccupiedSlots()
+                {
+                    while ( *m_pControl < g_flatHashSentinel )
+                    {
+                        ++m_pControl;
+                        ++m_pSlot;
+                    }
+                }
+
+            private:
+
+                template<bool> friend class TIterator;
+
+                FlatHashControlByte const*      m_pControl = nullptr;
+                pointer                         m_pSlot = nullptr;
+            };
+
+            using key_type = Key;
+            using value_type = Value;
+            using size_type = size_t;
+            using hasher = Hash;
+            using key_equal = Equal;
+            using iterator = TIterator<false>;
+            using const_iterator = TIterator<true>;
+
+        public:
+
+            TFlatHashTable() = default;
+
+            TFlatHashTable( TFlatHashTable const& rhs )
+            {
+                CopyFrom( rhs );
+            }
+
+            TFlatHashTable( TFlatHashTable&& rhs )
+            {
+                swap( rhs );
+            }
+
+            ~TFlatHashTable()
+            {
+                DestroyAllElements();
+                Deallocate();
+            }
+
+            TFlatHashTable& operator=( TFlatHashTable const& rhs )
+            {
+                if ( this != &rhs )
+                {
+                    DestroyAllElements();
+                    Deallocate();
+                    CopyFrom( rhs );
+                }
+                return *this;
+            }
+
+            TFlatHashTable& operator=( TFlatHashTable&& rhs )
+            {
+                swap( rhs );
+                return *this;
+            }
+
+            void swap( TFlatHashTable& rhs )
+            {
+                eastl::swap( m_pControl, rhs.m_pControl );
+                eastl::swap( m_pSlots, rhs.m_pSlots );
+                eastl::swap( m_capacity, rhs.m_capacity );
+                eastl::swap( m_size, rhs.m_size );
+                eastl::swap( m_growthLeft, rhs.m_growthLeft );
+            }
+
+            //-------------------------------------------------------------------------
+
+            EE_FORCE_INLINE iterator begin() { return ( m_capacity == 0 ) ? end() : MakeIteratorAndSkip( 0 ); }
+            EE_FORCE_INLINE const_iterator begin() const { return ( m_capacity == 0 ) ? end() : MakeIteratorAndSkip( 0 ); }
+            EE_FORCE_INLINE const_iterator cbegin() const { return begin(); }
+            EE_FORCE_INLINE iterator end() { return iterator( m_pControl + m_capacity, m_pSlots + m_capacity ); }
+            EE_FORCE_INLINE const_iterator end() const { return const_iterator( m_pControl + m_capacity, m_pSlots + m_capacity ); }
+            EE_FORCE_INLINE const_iterator cend() const { return end(); }
+
+            EE_FORCE_INLINE size_t size() const { return m_size; }
+            EE_FORCE_INLINE bool empty() const { return m_size == 0; }
+            EE_FORCE_INLINE size_t capacity() const { return m_capacity; }
+
+            // Destroys all elements but keeps the allocated memory
+            void clear()
+            {
+                if ( m_capacity == 0 )
+                {
+                    return;
+                }
+
+                DestroyAllElements();
+                ResetControlBytes();
+                m_size = 0;
+                m_growthLeft = FlatHashGetMaxLoad( m_capacity );
+            }
+
+            // Ensure that we can store 'count' elements without needing to grow
+            void reserve( size_t count )
+            {
+                size_t requiredCapacity = g_flatHashMinCapacity;
+                while ( FlatHashGetMaxLoad( requiredCapacity ) < count )
+                {
+                    requiredCapacity *= 2;
+                }
+
+                if ( requiredCapacity > m_capacity )
+                {
+                    Resize( requiredCapacity );
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            EE_FORCE_INLINE iterator find( Key const& key )
+            {
+                size_t const idx = FindIndex( key, FlatHashMix( Hash()( key ) ), Equal() );
+                return ( idx == g_flatHashNotFound ) ? end() : MakeIterator( idx );
+            }
+
+            EE_FORCE_INLINE const_iterator find( Key const& key ) const
+            {
+                size_t const idx = FindIndex( key, FlatHashMix( Hash()( key ) ), Equal() );
+                return ( idx == g_flatHashNotFound ) ? end() : MakeIterator( idx );
+            }
+
+            // Find using a different key type, the hash for the other type needs to match the hash of the equivalent key
+            template<typename U, typename UHash = eastl::hash<U>, typename UEqual = eastl::equal_to_2<Key, U>>
+            EE_FORCE_INLINE iterator find_as( U const& key, UHash uhash = UHash(), UEqual uequal = UEqual() )
+            {
+                size_t const idx = FindIndex( key, FlatHashMix( uhash( key ) ), uequal );
+                return ( idx == g_flatHashNotFound ) ? end() : MakeIterator( idx );
+            }
+
+            template<typename U, typename UHash = eastl::hash<U>, typename UEqual = eastl::equal_to_2<Key, U>>
+            EE_FORCE_INLINE const_iterator find_as( U const& key, UHash uhash = UHash(), UEqual uequal = UEqual() ) const
+            {
+                size_t const idx = FindIndex( key, FlatHashMix( uhash( key ) ), uequal );
+                return ( idx == g_flatHashNotFound ) ? end() : MakeIterator( idx );
+            }
+
+            EE_FORCE_INLINE bool contains( Key const& key ) const { return FindIndex( key, FlatHashMix( Hash()( key ) ), Equal() ) != g_flatHashNotFound; }
+            EE_FORCE_INLINE size_t count( Key const& key ) const { return contains( key ) ? 1 : 0; }
+
+            //-------------------------------------------------------------------------
+
+            eastl::pair<iterator, bool> insert( Value const& value )
+            {
+                return FindOrInsert( KeyOf()( value ), [&value] ( Value* pSlot ) { new( pSlot ) Value( value ); } );
+            }
+
+            eastl::pair<iterator, bool> insert( Value&& value )
+            {
+                return FindOrInsert( KeyOf()( value ), [&value] ( Value* pSlot ) { new( pSlot ) Value( eastl::move( value ) ); } );
+            }
+
+            //-------------------------------------------------------------------------
+
+            // Returns the iterator to the next element
+            iterator erase( const_iterator iter )
+            {
+                EE_ASSERT( iter != end() );
+                size_t const idx = size_t( iter.m_pSlot - m_pSlots );
+                EraseAtIndex( idx );
+                return MakeIteratorAndSkip( idx + 1 );
+            }
+
+            size_t erase( Key const& key )
+            {
+                size_t const idx = FindIndex( key, FlatHashMix( Hash()( key ) ), Equal() );
+                if ( idx == g_flatHashNotFound )
+                {
+                    return 0;
+                }
+
+                EraseAtIndex( idx );
+                return 1;
+            }
+
+        protected:
+
+            EE_FORCE_INLINE iterator MakeIterator( size_t idx ) { return iterator( m_pControl + idx, m_pSlots + idx ); }
+            EE_FORCE_INLINE const_iterator MakeIterator( size_t idx ) const { return const_iterator( m_pControl + idx, m_pSlots + idx ); }
+            EE_FORCE_INLINE iterator MakeIteratorAndSkip( size_t idx ) { iterator iter( m_pControl + idx, m_pSlots + idx ); iter.SkipUnoccupiedSlots(); return iter; }
+            EE_FORCE_INLINE const_iterator MakeIteratorAndSkip( size_t idx ) const { const_iterator iter( m_pControl + idx, m_pSlots + idx ); iter.SkipUnoccupiedSlots(); return iter; }
+
+            // Probes the groups quadratically (triangular numbers), this visits every group since the number of groups is a power of two
+            template<typename U, typename UEqual>
+            size_t FindIndex( U const& key, uint64_t hash, UEqual const& equal ) const
+            {
+                if ( m_capacity == 0 )
+                {
+                    return g_flatHashNotFound;
+                }
+
+                FlatHashControlByte const h2 = FlatHashH2( hash );
+                size_t const groupMask = ( m_capacity / g_flatHashGroupWidth ) - 1;
+                size_t groupIdx = FlatHashH1( hash ) & groupMask;
+
+                for ( size_t probeIdx = 1; ; probeIdx++ )
+                {
+                    size_t const groupStartIdx = groupIdx * g_flatHashGroupWidth;
+                    FlatHashGroup const group( m_pControl + groupStartIdx );
+
+                    for ( uint32_t matches = group.Match( h2 ); matches != 0; matches &= matches - 1 )
+                    {
+                        size_t const idx = groupStartIdx + FlatHashCountTrailingZeros( matches );
+                        if ( equal( KeyOf()( m_pSlots[idx] ), key ) )
+                        {
+                            return idx;
+                        }
+                    }
+
+                    // An empty slot means that the key was never inserted past this group
+                    if ( group.MatchEmpty() != 0 )
+                    {
+                        return g_flatHashNotFound;
+                    }
+
+                    EE_ASSERT( probeIdx <= groupMask + 1 );
+                    groupIdx = ( groupIdx + probeIdx ) & groupMask;
+                }
+            }
+
+            size_t FindFirstNonOccupiedIndex( uint64_t hash ) const
+            {
+                EE_ASSERT( m_capacity > 0 );
+
+                size_t const groupMask = ( m_capacity / g_flatHashGroupWidth ) - 1;
+                size_t groupIdx = FlatHashH1( hash ) & groupMask;
+
+                for ( size_t probeIdx = 1; ; probeIdx++ )
+                {
+                    size_t const groupStartIdx = groupIdx * g_flatHashGroupWidth;
+                    uint32_t const available = FlatHashGroup( m_pControl + groupStartIdx ).MatchEmptyOrDeleted();
+                    if ( available != 0 )
+                    {
+                        return groupStartIdx + FlatHashCountTrailingZeros( available );
+                    }
+
+                    EE_ASSERT( probeIdx <= groupMask + 1 );
+                    groupIdx = ( groupIdx + probeIdx ) & groupMask;
+                }
+            }
+
+            template<typename ConstructFunction>
+            eastl::pair<iterator, bool> FindOrInsert( Key const& key, ConstructFunction&& constructFunction )
+            {
+                uint64_t const hash = FlatHashMix( Hash()( key ) );
+                size_t idx = FindIndex( key, hash, Equal() );
+                if ( idx != g_flatHashNotFound )
+                {
+                    return eastl::pair<iterator, bool>( MakeIterator( idx ), false );
+                }
+
+                //-------------------------------------------------------------------------
+
+                if ( m_capacity == 0 )
+                {
+                    Resize( g_flatHashMinCapacity );
+                }
+
+                idx = FindFirstNonOccupiedIndex( hash );
+
+                // Reusing a deleted slot doesnt change the load, otherwise we might need to grow (or just clear out the deleted slots)
+                if ( m_growthLeft == 0 && m_pControl[idx] != g_flatHashDeleted )
+                {
+                    bool const isMostlyDeleted = m_size < FlatHashGetMaxLoad( m_capacity ) / 2;
+                    Resize( isMostlyDeleted ? m_capacity : m_capacity * 2 );
+                    idx = FindFirstNonOccupiedIndex( hash );
+                }
+
+                if ( m_pControl[idx] == g_flatHashEmpty )
+                {
+                    m_growthLeft--;
+                }
+
+                constructFunction( m_pSlots + idx );
+                m_pControl[idx] = FlatHashH2( hash );
+                m_size++;
+
+                return eastl::pair<iterator, bool>( MakeIterator( idx ), true );
+            }
+
+            void EraseAtIndex( size_t idx )
+            {
+                EE_ASSERT( idx < m_capacity && m_pControl[idx] >= 0 );
+                m_pSlots[idx].~Value();
+                m_size--;
+
+                // If the group still has an empty slot, no probe ever went past it, so we can mark the slot as empty rather than deleted
+                size_t const groupStartIdx = idx & ~( g_flatHashGroupWidth - 1 );
+                if ( FlatHashGroup( m_pControl + groupStartIdx ).MatchEmpty() != 0 )
+                {
+                    m_pControl[idx] = g_flatHashEmpty;
+                    m_growthLeft++;
+                }
+                else
+                {
+                    m_pControl[idx] = g_flatHashDeleted;
+                }
+            }
+
+        private:
+
+            // The control bytes and the slots share a single allocation, the control bytes have an extra group at the end to store the sentinel
+            EE_FORCE_INLINE static size_t GetSlotsOffset( size_t capacity )
+            {
+                size_t const controlSize = capacity + g_flatHashGroupWidth;
+                return ( controlSize + alignof( Value ) - 1 ) & ~( alignof( Value ) - 1 );
+            }
+
+            EE_FORCE_INLINE static size_t GetAllocationAlignment()
+            {
+                return alignof( Value ) > g_flatHashGroupWidth ? alignof( Value ) : g_flatHashGroupWidth;
+            }
+
+            void Allocate( size_t capacity )
+            {
+                EE_ASSERT( capacity >= g_flatHashMinCapacity && ( capacity & ( capacity - 1 ) ) == 0 );
+
+                uint8_t* pMemory = (uint8_t*) EE::Alloc( GetSlotsOffset( capacity ) + sizeof( Value ) * capacity, GetAllocationAlignment() );
+                m_pControl = reinterpret_cast<FlatHashControlByte*>( pMemory );
+                m_pSlots = reinterpret_cast<Value*>( pMemory + GetSlotsOffset( capacity ) );
+                m_capacity = capacity;
+                ResetControlBytes();
+            }
+
+            void Deallocate()
+            {
+                if ( m_pControl != nullptr )
+                {
+                    EE::Free( (void*&) m_pControl );
+                }
+
+                m_pControl = nullptr;
+                m_pSlots = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+
+            void ResetControlBytes()
+            {
+                memset( m_pControl, (uint8_t) g_flatHashEmpty, m_capacity + g_flatHashGroupWidth );
+                m_pControl[m_capacity] = g_flatHashSentinel;
+            }
+
+            void DestroyAllElements()
+            {
+                if constexpr ( !std::is_trivially_destructible_v<Value> )
+                {
+                    for ( size_t i = 0; i < m_capacity; i++ )
+                    {
+                        if ( m_pControl[i] >= 0 )
+                        {
+                            m_pSlots[i].~Value();
+                        }
+                    }
+                }
+            }
+
+            // Moves all elements into a new allocation, this also gets rid of all the deleted slots
+            void Resize( size_t newCapacity )
+            {
+                FlatHashControlByte* pOldControl = m_pControl;
+                Value* pOldSlots = m_pSlots;
+                size_t const oldCapacity = m_capacity;
+                size_t const numElements = m_size;
+
+                Allocate( newCapacity );
+                m_size = numElements;
+                m_growthLeft = FlatHashGetMaxLoad( newCapacity ) - numElements;
+
+                for ( size_t i = 0; i < oldCapacity; i++ )
+                {
+                    if ( pOldControl[i] >= 0 )
+                    {
+                        uint64_t const hash = FlatHashMix( Hash()( KeyOf()( pOldSlots[i] ) ) );
+                        size_t const newIdx = FindFirstNonOccupiedIndex( hash );
+                        new( m_pSlots + newIdx ) Value( eastl::move( pOldSlots[i] ) );
+                        m_pControl[newIdx] = FlatHashH2( hash );
+                        pOldSlots[i].~Value();
+                    }
+                }
+
+                if ( pOldControl != nullptr )
+                {
+                    EE::Free( (void*&) pOldControl );
+                }
+            }
+
+            // Copies the layout as is, so no rehashing is required
+            void CopyFrom( TFlatHashTable const& rhs )
+            {
+                if ( rhs.m_capacity == 0 )
+                {
+                    return;
+                }
+
+                Allocate( rhs.m_capacity );
+                memcpy( m_pControl, rhs.m_pControl, m_capacity + g_flatHashGroupWidth );
+
+                for ( size_t i = 0; i < m_capacity; i++ )
+                {
+                    if ( m_pControl[i] >= 0 )
+                    {
+                        new( m_pSlots + i ) Value( rhs.m_pSlots[i] );
+                    }
+                }
+
+                m_size = rhs.m_size;
+                m_growthLeft = rhs.m_growthLeft;
+            }
+
+        private:
+
+            FlatHashControlByte*                m_pControl = nullptr;
+            Value*                              m_pSlots = nullptr;
+            size_t                              m_capacity = 0;
+            size_t                              m_size = 0;
+            size_t                              m_growthLeft = 0;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+    // Flat Hash Map
+    //-------------------------------------------------------------------------
+
+    template<typename K, typename V, typename Hash = eastl::hash<K>, typename Equal = eastl::equal_to<K>>
+    class TFlatHashMap : public Internal::TFlatHashTable<eastl::pair<K, V>, K, Internal::FlatHashMapKeyOf, Hash, Equal>
+    {
+        using BaseTable = Internal::TFlatHashTable<eastl::pair<K, V>, K, Internal::FlatHashMapKeyOf, Hash, Equal>;
+
+    public:
+
+        using mapped_type = V;
+        using typename BaseTable::value_type;
+        using typename BaseTable::iterator;
+        using typename BaseTable::const_iterator;
+
+    public:
+
+        using BaseTable::BaseTable;
+
+        // Only constructs the value if the key is not present
+        template<typename... Args>
+        eastl::pair<iterator, bool> try_emplace( K const& key, Args&&... args )
+        {
+            return this->FindOrInsert( key, [&] ( value_type* pSlot ) { new( pSlot ) value_type( key, V( eastl::forward<Args>( args )... ) ); } );
+        }
+
+        template<typename M>
+        eastl::pair<iterator, bool> insert_or_assign( K const& key, M&& value )
+        {
+            auto result = try_emplace( key, eastl::forward<M>( value ) );
+            if ( !result.second )
+            {
+                result.first->second = eastl::forward<M>( value );
+            }
+            return result;
+        }
+
+        EE_FORCE_INLINE V& operator[]( K const& key )
+        {
+            return try_emplace( key ).first->second;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    // Flat Hash Set
+    //-------------------------------------------------------------------------
+
+    template<typename K, typename Hash = eastl::hash<K>, typename Equal = eastl::equal_to<K>>
+    class TFlatHashSet : public Internal::TFlatHashTable<K, K, Internal::FlatHashSetKeyOf, Hash, Equal>
+    {
+        using BaseTable = Internal::TFlatHashTable<K, K, Internal::FlatHashSetKeyOf, Hash, Equal>;
+
+    public:
+
+        using BaseTable::BaseTable;
+    };
+}
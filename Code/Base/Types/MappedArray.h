@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Base/Types/Arrays.h"
+#include <type_traits>
+
+//-------------------------------------------------------------------------
+// Mapped Array
+//-------------------------------------------------------------------------
+// An array of POD types that either owns its data or references data owned by someone else (i.e. a memory mapped resource file)
+// This is serialized as an aligned block of binary data, so when reading from persistent data (see 'BinaryInputArchive::ReadFromMappedData')
+// we can reference the data in-place instead of copying it, in that case the array is read-only until it is modified (which creates a copy)
+
+namespace EE
+{
+    template<typename T>
+    class TMappedArray
+    {
+        static_assert( std::is_trivially_copyable<T>::value, "Mapped arrays only support trivially copyable types" );
+
+    public:
+
+        // The alignment used for the serialized data, this is enough for any SIMD type
+        constexpr static size_t const s_dataAlignment = 16;
+
+    public:
+
+        TMappedArray() = default;
+
+        TMappedArray( TMappedArray const& rhs ) { *this = rhs; }
+        TMappedArray( TMappedArray&& rhs ) { *this = eastl::move( rhs ); }
+
+        TMappedArray& operator=( TMappedArray const& rhs )
+        {
+            // Copying always creates an owning array
+            m_ownedData.assign( rhs.begin(), rhs.end() );
+            m_pExternalData = nullptr;
+            m_numExternalElements = 0;
+            return *this;
+        }
+
+        TMappedArray& operator=( TMappedArray&& rhs )
+        {
+            m_ownedData = eastl::move( rhs.m_ownedData );
+            m_pExternalData = rhs.m_pExternalData;
+            m_numExternalElements = rhs.m_numExternalElements;
+            rhs.m_pExternalData = nullptr;
+            rhs.m_numExternalElements = 0;
+            return *this;
+        }
+
+        // Does this array reference external memory
+        inline bool IsMapped() const { return m_pExternalData != nullptr; }
+
+        // Reference external data, the data needs to outlive this array
+        inline void SetExternalData( T const* pData, size_t numElements )
+        {
+            EE_ASSERT( pData != nullptr && numElements > 0 );
+            m_ownedData.clear();
+            m_ownedData.shrink_to_fit();
+            m_pExternalData = pData;
+            m_numExternalElements = numElements;
+        }
+
+        // Read-only access
+        //-------------------------------------------------------------------------
+
+        inline size_t size() const { return IsMapped() ? m_numExternalElements : m_ownedData.size(); }
+        inline bool empty() const { return size() == 0; }
+        inline T const* data() const { return IsMapped() ? m_pExternalData : m_ownedData.data(); }
+        inline T const* begin() const { return data(); }
+        inline T const* end() const { return data() + size(); }
+        inline T const& operator[]( size_t i ) const { EE_ASSERT( i < size() ); return data()[i]; }
+
+        // Modification - this will copy any referenced data into owned memory
+        //-------------------------------------------------------------------------
+
+        inline T* data() { MakeOwned(); return m_ownedData.data(); }
+        inline T* begin() { MakeOwned(); return m_ownedData.begin(); }
+        inline T* end() { MakeOwned(); return m_ownedData.end(); }
+        inline T& operator[]( size_t i ) { MakeOwned(); return m_ownedData[i]; }
+
+        inline void resize( size_t numElements ) { MakeOwned(); m_ownedData.resize( numElements ); }
+        inline void reserve( size_t numElements ) { MakeOwned(); m_ownedData.reserve( numElements ); }
+        inline void push_back( T const& value ) { MakeOwned(); m_ownedData.push_back( value ); }
+        inline T& emplace_back( T const& value ) { MakeOwned(); return m_ownedData.emplace_back( value ); }
+
+        inline void clear()
+        {
+            m_ownedData.clear();
+            m_pExternalData = nullptr;
+            m_numExternalElements = 0;
+        }
+
+        inline void assign( T const* pData, size_t numElements )
+        {
+            m_pExternalData = nullptr;
+            m_numExternalElements = 0;
+            m_ownedData.assign( pData, pData + numElements );
+        }
+
+    private:
+
+        inline void MakeOwned()
+        {
+            if ( IsMapped() )
+            {
+                T const* pExternalData = m_pExternalData;
+                m_pExternalData = nullptr;
+                m_ownedData.assign( pExternalData, pExternalData + m_numExternalElements );
+                m_numExternalElements = 0;
+            }
+        }
+
+    private:
+
+        TVector<T>                  m_ownedData;
+        T const*                    m_pExternalData = nullptr;
+        size_t                      m_numExternalElements = 0;
+    };
+}
@@ -1,102 +1,258 @@
 #include "StringID.h"
 #include "Base/Memory/Memory.h"
+#include "Base/Math/Math.h"
 #include "Base/Encoding/Hash.h"
 #include "Base/Threading/Threading.h"
 #include "String.h"
-#include "EASTL/hash_map.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
+// String Table
+//-------------------------------------------------------------------------
+// The table is split into shards (selected by the low bits of the ID), each shard is an open-addressing hash table of entry pointers
+// Readers never lock: they load the current table and probe it, slots are only ever written once (null -> entry) and tables are never freed while running
+// Writers lock the shard, allocate the entry from the shard's append-only arena and then publish it to the table
+// When a table gets too full we create a new larger table and publish that instead, the old tables are kept alive until shutdown since readers might still be probing them
+//
+// Note: StringIDs are created during static initialization so this cannot use the engine allocators
 
 namespace EE
 {
-    class StringID_CustomAllocator
+    namespace
     {
-    public:
+        constexpr static uint32_t const g_numShardBits = 6;
+        constexpr static uint32_t const g_numShards = 1u << g_numShardBits;
+        constexpr static uint32_t const g_initialTableCapacity = 256;
+        constexpr static size_t const g_arenaBlockSize = 16 * 1024;
+    }
 
-        EASTL_ALLOCATOR_EXPLICIT StringID_CustomAllocator( const char* pName = EASTL_NAME_VAL( EASTL_ALLOCATOR_DEFAULT_NAME ) ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x, const char* pName ) {}
-        StringID_CustomAllocator& operator=( const StringID_CustomAllocator& x ) { return *this; }
-        const char* get_name() const { return "StringID"; }
-        void set_name( const char* pName ) {}
+    //-------------------------------------------------------------------------
 
-        void* allocate( size_t n, int flags = 0 )
+    struct StringIDTable
+    {
+        // Capacity is always a power of two and we keep the load factor under 50% so probe sequences are short
+        static StringIDTable* Create( uint32_t capacity )
         {
-            return allocate( n, EASTL_SYSTEM_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
+            EE_ASSERT( Math::IsPowerOf2( capacity ) );
+
+            size_t const requiredMemory = sizeof( StringIDTable ) + sizeof( std::atomic<StringID::StringTableEntry const*> ) * capacity;
+            auto pTable = new ( new uint8_t[requiredMemory] ) StringIDTable();
+            pTable->m_capacity = capacity;
+
+            auto pSlots = pTable->GetSlots();
+            for ( uint32_t i = 0; i < capacity; i++ )
+            {
+                new ( &pSlots[i] ) std::atomic<StringID::StringTableEntry const*>( nullptr );
+            }
+
+            return pTable;
         }
 
-        void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        static void Destroy( StringIDTable* pTable )
         {
-            size_t adjustedAlignment = ( alignment > EA_PLATFORM_PTR_SIZE ) ? alignment : EA_PLATFORM_PTR_SIZE;
+            pTable->~StringIDTable();
+            delete[] reinterpret_cast<uint8_t*>( pTable );
+        }
+
+        inline std::atomic<StringID::StringTableEntry const*>* GetSlots() { return reinterpret_cast<std::atomic<StringID::StringTableEntry const*>*>( this + 1 ); }
+        inline std::atomic<StringID::StringTableEntry const*> const* GetSlots() const { return reinterpret_cast<std::atomic<StringID::StringTableEntry const*> const*>( this + 1 ); }
+
+        // The lower bits of the ID are used to select the shard so skip them
+        inline uint32_t GetStartIndex( uint32_t ID ) const { return ( ID >> g_numShardBits ) & ( m_capacity - 1 ); }
 
-            void* p = new char[n + adjustedAlignment + EA_PLATFORM_PTR_SIZE];
-            void* pPlusPointerSize = (void*) ( (uintptr_t) p + EA_PLATFORM_PTR_SIZE );
-            void* pAligned = (void*) ( ( (uintptr_t) pPlusPointerSize + adjustedAlignment - 1 ) & ~( adjustedAlignment - 1 ) );
+        StringID::StringTableEntry const* Find( uint32_t ID ) const
+        {
+            auto pSlots = GetSlots();
+            uint32_t const mask = m_capacity - 1;
+            for ( uint32_t i = GetStartIndex( ID ), numProbes = 0; numProbes < m_capacity; i = ( i + 1 ) & mask, numProbes++ )
+            {
+                StringID::StringTableEntry const* pEntry = pSlots[i].load( std::memory_order_acquire );
+                if ( pEntry == nullptr )
+                {
+                    return nullptr;
+                }
 
-            void** pStoredPtr = (void**) pAligned - 1;
-            EASTL_ASSERT( pStoredPtr >= p );
-            *( pStoredPtr ) = p;
+                if ( pEntry->m_ID == ID )
+                {
+                    return pEntry;
+                }
+            }
 
-            EASTL_ASSERT( ( (size_t) pAligned & ~( alignment - 1 ) ) == (size_t) pAligned );
-            return pAligned;
+            return nullptr;
         }
 
-        void deallocate( void* p, size_t n )
+        // Only called with the shard locked
+        void Insert( StringID::StringTableEntry const* pEntry )
         {
-            if ( p != nullptr )
+            auto pSlots = GetSlots();
+            uint32_t const mask = m_capacity - 1;
+            uint32_t i = GetStartIndex( pEntry->m_ID );
+            while ( pSlots[i].load( std::memory_order_relaxed ) != nullptr )
             {
-                void* pOriginalAllocation = *( (void**) p - 1 );
-                delete[]( char* )pOriginalAllocation;
+                i = ( i + 1 ) & mask;
             }
+
+            pSlots[i].store( pEntry, std::memory_order_release );
+            m_numEntries++;
         }
-    };
 
-    inline bool operator==( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return true; }
-    inline bool operator!=( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return false; }
+    public:
+
+        StringIDTable*                                  m_pPreviousTable = nullptr; // Retired tables, freed on shutdown
+        uint32_t                                        m_capacity = 0;
+        uint32_t                                        m_numEntries = 0;
+    };
 
     //-------------------------------------------------------------------------
 
-    using CachedString = eastl::basic_string<char, StringID_CustomAllocator>;
-
-    class StringIDHashMap : public eastl::hash_map<uint32_t, CachedString, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>, StringID_CustomAllocator>
+    struct StringID::StringTableShard
     {
+        struct ArenaBlock
+        {
+            ArenaBlock*                                 m_pPreviousBlock = nullptr;
+            size_t                                      m_size = 0;
+            size_t                                      m_used = 0;
+        };
+
     public:
-      
-        eastl::hash_node<value_type, false> const* const* GetBuckets() const { return mpBucketArray; }
+
+        ~StringTableShard()
+        {
+            StringIDTable* pTable = m_pTable.load( std::memory_order_relaxed );
+            while ( pTable != nullptr )
+            {
+                StringIDTable* pPreviousTable = pTable->m_pPreviousTable;
+                StringIDTable::Destroy( pTable );
+                pTable = pPreviousTable;
+            }
+
+            while ( m_pArenaBlock != nullptr )
+            {
+                ArenaBlock* pPreviousBlock = m_pArenaBlock->m_pPreviousBlock;
+                delete[] reinterpret_cast<uint8_t*>( m_pArenaBlock );
+                m_pArenaBlock = pPreviousBlock;
+            }
+        }
+
+        inline StringTableEntry const* Find( uint32_t ID ) const
+        {
+            StringIDTable const* pTable = m_pTable.load( std::memory_order_acquire );
+            return ( pTable != nullptr ) ? pTable->Find( ID ) : nullptr;
+        }
+
+        // Copy the string into the arena, only called with the shard locked
+        StringTableEntry* AllocateEntry( uint32_t ID, char const* pStr, size_t length )
+        {
+            size_t const requiredMemory = Memory::CalculatePaddingForAlignment( sizeof( StringTableEntry ) + length + 1, alignof( StringTableEntry ) ) + sizeof( StringTableEntry ) + length + 1;
+
+            if ( m_pArenaBlock == nullptr || ( m_pArenaBlock->m_size - m_pArenaBlock->m_used ) < requiredMemory )
+            {
+                size_t const blockSize = Math::Max( g_arenaBlockSize, sizeof( ArenaBlock ) + requiredMemory );
+                ArenaBlock* pNewBlock = new ( new uint8_t[blockSize] ) ArenaBlock();
+                pNewBlock->m_pPreviousBlock = m_pArenaBlock;
+                pNewBlock->m_size = blockSize;
+                pNewBlock->m_used = sizeof( ArenaBlock );
+                m_pArenaBlock = pNewBlock;
+            }
+
+            auto pEntry = reinterpret_cast<StringTableEntry*>( reinterpret_cast<uint8_t*>( m_pArenaBlock ) + m_pArenaBlock->m_used );
+            m_pArenaBlock->m_used += requiredMemory;
+
+            pEntry->m_ID = ID;
+            pEntry->m_length = (uint32_t) length;
+            char* pEntryString = const_cast<char*>( pEntry->GetString() );
+            memcpy( pEntryString, pStr, length );
+            pEntryString[length] = 0;
+            return pEntry;
+        }
+
+        void Register( uint32_t ID, char const* pStr, size_t length )
+        {
+            Threading::ScopeLock lock( m_mutex );
+
+            // Someone else might have added it while we were waiting for the lock
+            StringIDTable* pTable = m_pTable.load( std::memory_order_relaxed );
+            if ( pTable != nullptr && pTable->Find( ID ) != nullptr )
+            {
+                return;
+            }
+
+            // Grow the table if needed, the new table is fully populated before it is published
+            if ( pTable == nullptr || ( pTable->m_numEntries + 1 ) * 2 > pTable->m_capacity )
+            {
+                StringIDTable* pNewTable = StringIDTable::Create( ( pTable == nullptr ) ? g_initialTableCapacity : pTable->m_capacity * 2 );
+                if ( pTable != nullptr )
+                {
+                    auto pSlots = pTable->GetSlots();
+                    for ( uint32_t i = 0; i < pTable->m_capacity; i++ )
+                    {
+                        if ( StringTableEntry const* pEntry = pSlots[i].load( std::memory_order_relaxed ) )
+                        {
+                            pNewTable->Insert( pEntry );
+                        }
+                    }
+                }
+
+                pNewTable->m_pPreviousTable = pTable;
+                m_pTable.store( pNewTable, std::memory_order_release );
+                pTable = pNewTable;
+            }
+
+            pTable->Insert( AllocateEntry( ID, pStr, length ) );
+        }
+
+    public:
+
+        std::atomic<StringIDTable*>                     m_pTable = nullptr;
+        Threading::Mutex                                m_mutex;
+        ArenaBlock*                                     m_pArenaBlock = nullptr;
     };
 
     //-------------------------------------------------------------------------
 
-    StringIDHashMap g_stringCache;
-    Threading::Mutex g_stringCacheMutex;
+    // All members are constant initialized so this is safe to use during static initialization
+    static StringID::StringTableShard g_stringTableShards[g_numShards];
 
     // Natvis/Debugger info to print out human-readable strings
-    StringID::DebuggerInfo g_debuggerInfo;
+    static StringID::DebuggerInfo const g_debuggerInfo = { g_stringTableShards, g_numShards, g_numShardBits };
     EE::StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
 
+    EE_FORCE_INLINE static StringID::StringTableShard& GetShard( uint32_t ID )
+    {
+        return g_stringTableShards[ID & ( g_numShards - 1 )];
+    }
+
     //-------------------------------------------------------------------------
 
-    StringID::StringID( char const* pStr )
+    void StringID::RegisterString( uint32_t ID, char const* pStr, size_t length )
     {
-        if ( pStr != nullptr && strlen( pStr ) > 0 )
+        EE_ASSERT( ID != 0 && pStr != nullptr );
+
+        StringTableShard& shard = GetShard( ID );
+        if ( shard.Find( ID ) == nullptr )
         {
-            m_ID = Hash::GetHash32( pStr );
+            shard.Register( ID, pStr, length );
+        }
+    }
 
-            // Cache the string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter == g_stringCache.end() )
-            {
-                g_stringCache[m_ID] = CachedString( pStr );
-                g_debuggerInfo.m_pBuckets = g_stringCache.GetBuckets();
-                g_debuggerInfo.m_numBuckets = g_stringCache.bucket_count();
-            }
+    StringID::StringID( char const* pStr )
+    {
+        if ( pStr != nullptr && pStr[0] != 0 )
+        {
+            size_t const length = strlen( pStr );
+            m_ID = Hash::XXHash::GetHash32( pStr, length );
+            RegisterString( m_ID, pStr, length );
         }
     }
 
     StringID::StringID( String const& str )
-        : StringID( str.c_str() )
-    {}
+    {
+        if ( !str.empty() )
+        {
+            m_ID = Hash::XXHash::GetHash32( str.c_str(), str.length() );
+            RegisterString( m_ID, str.c_str(), str.length() );
+        }
+    }
 
     char const* StringID::c_str() const
     {
@@ -105,17 +261,8 @@ namespace EE
             return nullptr;
         }
 
-        {
-            // Get cached string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter != g_stringCache.end() )
-            {
-                return iter->second.c_str();
-            }
-        }
-
-        // ID likely directly created via uint32_t
-        return nullptr;
+        // Returns null if the ID was directly created via uint32_t or via a literal in a release build
+        StringTableEntry const* pEntry = GetShard( m_ID ).Find( m_ID );
+        return ( pEntry != nullptr ) ? pEntry->GetString() : nullptr;
     }
-}
\ No newline at end of file
+}
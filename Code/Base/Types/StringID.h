@@ -2,6 +2,7 @@
 
 #include "Base/_Module/API.h"
 #include "Base/Types/Containers_ForwardDecl.h"
+#include "Base/Encoding/Hash.h"
 #include "Base/Esoterica.h"
 
 //-------------------------------------------------------------------------
@@ -10,56 +11,86 @@
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
 // Uses the 32bit default hash
+//
+// The strings are interned in a global string table so that we can get them back from the IDs
+// The table is sharded by ID and the strings are stored in append-only arenas, lookups are lock-free and only new strings take a (per-shard) lock
+// String literals can use 'StringID::FromLiteral' which calculates the ID at compile time, in release builds this skips the string table entirely
 
-namespace eastl
-{
-    template <typename Value, bool bCacheHashCode>
-    struct hash_node;
-
-    template <typename T1, typename T2>
-    struct pair;
-}
+#if EE_DEVELOPMENT_TOOLS
+    #define EE_STRINGID_LITERAL_CONSTEXPR inline
+#else
+    #define EE_STRINGID_LITERAL_CONSTEXPR constexpr
+#endif
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
-    class StringID_CustomAllocator;
-
-    //-------------------------------------------------------------------------
-
     class EE_BASE_API StringID
     {
     public:
 
-        using StringIDHashNode = eastl::hash_node<eastl::pair<const uint32_t, eastl::basic_string<char, EE::StringID_CustomAllocator>>, false>;
+        // An interned string, the string data immediately follows the entry
+        struct StringTableEntry
+        {
+            inline char const* GetString() const { return reinterpret_cast<char const*>( this + 1 ); }
+
+            uint32_t                        m_ID;
+            uint32_t                        m_length;
+        };
+
+        struct StringTableShard;
 
         struct DebuggerInfo
         {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
-            size_t                          m_numBuckets = 0;
+            StringTableShard const*         m_pShards = nullptr;
+            uint32_t                        m_numShards = 0;
+            uint32_t                        m_numShardBits = 0;
         };
 
         static DebuggerInfo const*          s_pDebuggerInfo;
 
     public:
 
-        StringID() = default;
-        explicit StringID( nullptr_t ) : m_ID( 0 ) {}
+        // Create a string ID from a string literal, the ID is calculated at compile time
+        // In development builds we still need to register the string (so that we can get it back for debugging) so this is only constexpr in release builds
+        template<size_t N>
+        EE_STRINGID_LITERAL_CONSTEXPR static StringID FromLiteral( char const ( &str )[N] )
+        {
+            static_assert( N > 1, "Empty strings are not valid string IDs" );
+
+            StringID ID( Hash::XXHash::ConstExpr::GetHash32( str ) );
+
+            #if EE_DEVELOPMENT_TOOLS
+            RegisterString( ID.m_ID, str, N - 1 );
+            #endif
+
+            return ID;
+        }
+
+    public:
+
+        constexpr StringID() = default;
+        constexpr explicit StringID( nullptr_t ) : m_ID( 0 ) {}
         explicit StringID( char const* pStr );
-        explicit StringID( uint32_t ID ) : m_ID( ID ) {}
+        constexpr explicit StringID( uint32_t ID ) : m_ID( ID ) {}
         explicit StringID( String const& str );
 
-        inline bool IsValid() const { return m_ID != 0; }
-        inline uint32_t ToUint() const { return m_ID; }
-        inline operator uint32_t() const { return m_ID; }
+        constexpr inline bool IsValid() const { return m_ID != 0; }
+        constexpr inline uint32_t ToUint() const { return m_ID; }
+        constexpr inline operator uint32_t() const { return m_ID; }
 
         inline void Clear() { m_ID = 0; }
 
         char const* c_str() const;
 
-        inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
-        inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
+        constexpr inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
+        constexpr inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
+
+    private:
+
+        // Add a string to the string table (if it isnt already present)
+        static void RegisterString( uint32_t ID, char const* pStr, size_t length );
 
     private:
 
@@ -28,6 +28,8 @@ namespace EE
 
     public:
 
+        EE_SERIALIZE_FLAT_POD( UUID, m_data.m_U64 );
+
         static UUID GenerateID();
         static bool IsValidUUIDString( char const* pString );
 
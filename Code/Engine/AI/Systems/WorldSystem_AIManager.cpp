@@ -44,6 +44,12 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccess const& AIManager::GetDataAccess( UpdateStage stage ) const
+    {
+        static WorldSystemDataAccess const access( WritesData( "EntityMaps" ), ReadsData( SpatialEntityComponent::GetStaticTypeID() ) );
+        return access;
+    }
+
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
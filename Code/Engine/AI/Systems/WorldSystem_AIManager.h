@@ -26,6 +26,7 @@ namespace EE::AI
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccess const& GetDataAccess( UpdateStage stage ) const override;
 
         bool TrySpawnAI( EntityWorldUpdateContext const& ctx );
 
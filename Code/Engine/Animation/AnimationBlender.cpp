@@ -1,4 +1,5 @@
 #include "AnimationBlender.h"
+#include "Base/Memory/ScratchAllocator.h"
 
 //-------------------------------------------------------------------------
 
@@ -23,22 +24,23 @@ namespace EE::Animation
         TVector<int32_t> const& parentIndices = pBasePose->GetSkeleton()->GetParentBoneIndices();
         int32_t const numBones = pResultPose->GetNumBones();
 
-        TInlineVector<Quaternion, 200> baseRotations;
-        TInlineVector<Quaternion, 200> layerRotations;
-        TInlineVector<Quaternion, 200> resultRotations;
+        Memory::ScopedScratchMarker const scratchMarker;
+        TScratchVector<Quaternion> baseRotations;
+        TScratchVector<Quaternion> layerRotations;
+        TScratchVector<Quaternion> resultRotations;
 
         baseRotations.resize( numBones );
         layerRotations.resize( numBones );
         resultRotations.resize( numBones );
 
-        baseRotations[0] = pBasePose->m_localTransforms[0].GetRotation();
-        layerRotations[0] = pLayerPose->m_localTransforms[0].GetRotation();
+        baseRotations[0] = pBasePose->m_pLocalTransforms[0].GetRotation();
+        layerRotations[0] = pLayerPose->m_pLocalTransforms[0].GetRotation();
 
         for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
         {
             int32_t const parentIdx = parentIndices[boneIdx];
-            baseRotations[boneIdx] = pBasePose->m_localTransforms[boneIdx].GetRotation() * baseRotations[parentIdx];
-            layerRotations[boneIdx] = pLayerPose->m_localTransforms[boneIdx].GetRotation() * layerRotations[parentIdx];
+            baseRotations[boneIdx] = pBasePose->m_pLocalTransforms[boneIdx].GetRotation() * baseRotations[parentIdx];
+            layerRotations[boneIdx] = pLayerPose->m_pLocalTransforms[boneIdx].GetRotation() * layerRotations[parentIdx];
         }
 
         // Blend the root separately - local space blend
@@ -47,12 +49,12 @@ namespace EE::Animation
         auto boneBlendWeight = pBoneMask->GetWeight( 0 );
         if ( boneBlendWeight != 0.0f )
         {
-            Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[0], BlendFunction::BlendTranslationAndScale( pBasePose->m_localTransforms[0].GetTranslationAndScale(), pLayerPose->m_localTransforms[0].GetTranslationAndScale(), boneBlendWeight ) );
-            resultRotations[0] = BlendFunctionFastSLerp::BlendRotation( pBasePose->m_localTransforms[0].GetRotation(), pLayerPose->m_localTransforms[0].GetRotation(), boneBlendWeight );
+            Transform::DirectlySetTranslationScale( pResultPose->m_pLocalTransforms[0], BlendFunction::BlendTranslationAndScale( pBasePose->m_pLocalTransforms[0].GetTranslationAndScale(), pLayerPose->m_pLocalTransforms[0].GetTranslationAndScale(), boneBlendWeight ) );
+            resultRotations[0] = BlendFunctionFastSLerp::BlendRotation( pBasePose->m_pLocalTransforms[0].GetRotation(), pLayerPose->m_pLocalTransforms[0].GetRotation(), boneBlendWeight );
         }
         else
         {
-            resultRotations[0] = pBasePose->m_localTransforms[0].GetRotation();
+            resultRotations[0] = pBasePose->m_pLocalTransforms[0].GetRotation();
         }
 
         // Blend global space poses together and convert back to local space
@@ -73,7 +75,7 @@ namespace EE::Animation
                 //-------------------------------------------------------------------------
                 // Translation blending is done in local space
 
-                Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( pBasePose->m_localTransforms[boneIdx].GetTranslationAndScale(), pLayerPose->m_localTransforms[boneIdx].GetTranslationAndScale(), boneBlendWeight ) );
+                Transform::DirectlySetTranslationScale( pResultPose->m_pLocalTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( pBasePose->m_pLocalTransforms[boneIdx].GetTranslationAndScale(), pLayerPose->m_pLocalTransforms[boneIdx].GetTranslationAndScale(), boneBlendWeight ) );
 
                 // Blend Rotation
                 //-------------------------------------------------------------------------
@@ -83,7 +85,7 @@ namespace EE::Animation
                 // Convert blended global space rotation to local space for the result pose
                 int32_t const parentIdx = parentIndices[boneIdx];
                 Quaternion const localRotation = Quaternion::Delta( resultRotations[parentIdx], resultRotations[boneIdx] );
-                Transform::DirectlySetRotation( pResultPose->m_localTransforms[boneIdx], localRotation );
+                Transform::DirectlySetRotation( pResultPose->m_pLocalTransforms[boneIdx], localRotation );
             }
         }
 
@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "AnimationBoneMask.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationTransformBatch.h"
 #include "Base/Math/Quaternion.h"
 #include "Base/Types/BitFlags.h"
 #include "Base/TypeSystem/ReflectedType.h"
@@ -41,6 +42,14 @@ namespace EE::Animation
     {
     private:
 
+        EE_FORCE_INLINE static void LerpTranslationsAndScales( TransformBatch const& batch0, TransformBatch const& batch1, __m128 t, TransformBatch& result )
+        {
+            result.m_translationX = SIMD::Float::MultiplyAdd( _mm_sub_ps( batch1.m_translationX, batch0.m_translationX ), t, batch0.m_translationX );
+            result.m_translationY = SIMD::Float::MultiplyAdd( _mm_sub_ps( batch1.m_translationY, batch0.m_translationY ), t, batch0.m_translationY );
+            result.m_translationZ = SIMD::Float::MultiplyAdd( _mm_sub_ps( batch1.m_translationZ, batch0.m_translationZ ), t, batch0.m_translationZ );
+            result.m_scale = SIMD::Float::MultiplyAdd( _mm_sub_ps( batch1.m_scale, batch0.m_scale ), t, batch0.m_scale );
+        }
+
         struct BlendFunction
         {
             EE_FORCE_INLINE static Quaternion BlendRotation( Quaternion const& quat0, Quaternion const& quat1, float t )
@@ -52,6 +61,14 @@ namespace EE::Animation
             {
                 return Vector::Lerp( translationScale0, translationScale1, t );
             }
+
+            EE_FORCE_INLINE static TransformBatch BlendTransforms( TransformBatch const& batch0, TransformBatch const& batch1, __m128 t )
+            {
+                TransformBatch result;
+                result.m_rotation = QuaternionBatch::SLerp( batch0.m_rotation, batch1.m_rotation, t );
+                LerpTranslationsAndScales( batch0, batch1, t, result );
+                return result;
+            }
         };
 
         struct BlendFunctionFastSLerp
@@ -65,6 +82,14 @@ namespace EE::Animation
             {
                 return Vector::Lerp( translationScale0, translationScale1, t );
             }
+
+            EE_FORCE_INLINE static TransformBatch BlendTransforms( TransformBatch const& batch0, TransformBatch const& batch1, __m128 t )
+            {
+                TransformBatch result;
+                result.m_rotation = QuaternionBatch::FastSLerp( batch0.m_rotation, batch1.m_rotation, t );
+                LerpTranslationsAndScales( batch0, batch1, t, result );
+                return result;
+            }
         };
 
         struct AdditiveBlendFunction
@@ -79,28 +104,41 @@ namespace EE::Animation
             {
                 return Vector::MultiplyAdd( translationScale1, Vector( t ), translationScale0 );
             }
+
+            EE_FORCE_INLINE static TransformBatch BlendTransforms( TransformBatch const& batch0, TransformBatch const& batch1, __m128 t )
+            {
+                TransformBatch result;
+                result.m_rotation = QuaternionBatch::SLerp( batch0.m_rotation, QuaternionBatch::Multiply( batch1.m_rotation, batch0.m_rotation ), t );
+                result.m_translationX = SIMD::Float::MultiplyAdd( batch1.m_translationX, t, batch0.m_translationX );
+                result.m_translationY = SIMD::Float::MultiplyAdd( batch1.m_translationY, t, batch0.m_translationY );
+                result.m_translationZ = SIMD::Float::MultiplyAdd( batch1.m_translationZ, t, batch0.m_translationZ );
+                result.m_scale = SIMD::Float::MultiplyAdd( batch1.m_scale, t, batch0.m_scale );
+                return result;
+            }
         };
 
     private:
 
         // Basic local space blend - the early out is a useful optimization for non-additive blends
         template<typename BlendFunction>
-        static inline void LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool canEarlyOutOfBlend );
+        static inline void LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool canEarlyOutOfBlend, BoneSet const* pRequiredBones = nullptr );
 
         // Basic local space masked blend - the early out is a useful optimization for non-additive blends
         template<typename BlendFunction>
-        static inline void LocalBlendMasked( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool canEarlyOutOfPerBoneBlend );
+        static inline void LocalBlendMasked( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool canEarlyOutOfPerBoneBlend, BoneSet const* pRequiredBones = nullptr );
 
     public:
 
         // Local Interpolative Blend
-        EE_FORCE_INLINE static void LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool useNLerp = false );
+        // The optional required bone set allows us to skip bones that are not needed (the transforms of skipped bones in the result are undefined)
+        EE_FORCE_INLINE static void LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool useNLerp = false, BoneSet const* pRequiredBones = nullptr );
 
         // Global Space Interpolative Blend
         static void GlobalBlend( Pose const* pBasePose, Pose const* pLayerPose, float layerWeight, BoneMask const* pBoneMask, Pose* pResultPose );
 
         // Local Additive Blend
-        EE_FORCE_INLINE static void AdditiveBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose );
+        // The optional required bone set allows us to skip bones that are not needed (the transforms of skipped bones in the result are undefined)
+        EE_FORCE_INLINE static void AdditiveBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, BoneSet const* pRequiredBones = nullptr );
 
         // Blend two root motion deltas together
         EE_FORCE_INLINE static Transform BlendRootMotionDeltas( Transform const& source, Transform const& target, float blendWeight, RootMotionBlendMode blendMode = RootMotionBlendMode::Blend );
@@ -108,7 +146,7 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
-    EE_FORCE_INLINE void Blender::LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool useFastSLerp )
+    EE_FORCE_INLINE void Blender::LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool useFastSLerp, BoneSet const* pRequiredBones )
     {
         // Fully in Source
         if ( blendWeight == 0.0f )
@@ -129,28 +167,28 @@ namespace EE::Animation
             {
                 if ( pBoneMask != nullptr )
                 {
-                    LocalBlendMasked<BlendFunctionFastSLerp>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, true );
+                    LocalBlendMasked<BlendFunctionFastSLerp>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, true, pRequiredBones );
                 }
                 else
                 {
-                    LocalBlend<BlendFunctionFastSLerp>( pSourcePose, pTargetPose, blendWeight, pResultPose, true );
+                    LocalBlend<BlendFunctionFastSLerp>( pSourcePose, pTargetPose, blendWeight, pResultPose, true, pRequiredBones );
                 }
             }
             else
             {
                 if ( pBoneMask != nullptr )
                 {
-                    LocalBlendMasked<BlendFunction>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, true );
+                    LocalBlendMasked<BlendFunction>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, true, pRequiredBones );
                 }
                 else
                 {
-                    LocalBlend<BlendFunction>( pSourcePose, pTargetPose, blendWeight, pResultPose, true );
+                    LocalBlend<BlendFunction>( pSourcePose, pTargetPose, blendWeight, pResultPose, true, pRequiredBones );
                 }
             }
         }
     }
 
-    EE_FORCE_INLINE void Blender::AdditiveBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose )
+    EE_FORCE_INLINE void Blender::AdditiveBlend( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, BoneSet const* pRequiredBones )
     {
         // Fully in Source
         if ( blendWeight == 0.0f )
@@ -169,11 +207,11 @@ namespace EE::Animation
         {
             if ( pBoneMask != nullptr )
             {
-                LocalBlendMasked<AdditiveBlendFunction>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, false );
+                LocalBlendMasked<AdditiveBlendFunction>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, false, pRequiredBones );
             }
             else
             {
-                LocalBlend<AdditiveBlendFunction>( pSourcePose, pTargetPose, blendWeight, pResultPose, false );
+                LocalBlend<AdditiveBlendFunction>( pSourcePose, pTargetPose, blendWeight, pResultPose, false, pRequiredBones );
             }
         }
     }
@@ -213,7 +251,7 @@ namespace EE::Animation
 
     // Local Blend
     template<typename BlendFunction>
-    void Blender::LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool canEarlyOutOfBlend )
+    void Blender::LocalBlend( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool canEarlyOutOfBlend, BoneSet const* pRequiredBones )
     {
         EE_ASSERT( blendWeight > 0.0f && blendWeight <= 1.0f );
         EE_ASSERT( pSourcePose != nullptr && pTargetPose != nullptr && pResultPose != nullptr );
@@ -231,13 +269,40 @@ namespace EE::Animation
         }
         else // Blend
         {
+            Transform const* pSourceTransforms = pSourcePose->m_pLocalTransforms;
+            Transform const* pTargetTransforms = pTargetPose->m_pLocalTransforms;
+            Transform* pResultTransforms = pResultPose->m_pLocalTransforms;
+
             int32_t const numBones = pResultPose->GetNumBones();
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            int32_t const numBatchedBones = numBones - ( numBones % TransformBatch::s_size );
+            __m128 const vBlendWeight = _mm_set1_ps( blendWeight );
+
+            // Blend four bones at a time, skipping any batches that dont contain any required bones
+            int32_t boneIdx = 0;
+            for ( ; boneIdx < numBatchedBones; boneIdx += TransformBatch::s_size )
             {
-                Transform const& sourceTransform = pSourcePose->m_localTransforms[boneIdx];
-                Transform const& targetTransform = pTargetPose->m_localTransforms[boneIdx];
-                Transform::DirectlySetRotation( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight ) );
-                Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), blendWeight ) );
+                if ( pRequiredBones != nullptr && !pRequiredBones->IsAnySet( boneIdx, TransformBatch::s_size ) )
+                {
+                    continue;
+                }
+
+                TransformBatch const sourceBatch = TransformBatch::Load( pSourceTransforms + boneIdx );
+                TransformBatch const targetBatch = TransformBatch::Load( pTargetTransforms + boneIdx );
+                BlendFunction::BlendTransforms( sourceBatch, targetBatch, vBlendWeight ).Store( pResultTransforms + boneIdx );
+            }
+
+            // Blend any remaining bones individually
+            for ( ; boneIdx < numBones; boneIdx++ )
+            {
+                if ( pRequiredBones != nullptr && !pRequiredBones->IsSet( boneIdx ) )
+                {
+                    continue;
+                }
+
+                Transform const& sourceTransform = pSourcePose->m_pLocalTransforms[boneIdx];
+                Transform const& targetTransform = pTargetPose->m_pLocalTransforms[boneIdx];
+                Transform::DirectlySetRotation( pResultPose->m_pLocalTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight ) );
+                Transform::DirectlySetTranslationScale( pResultPose->m_pLocalTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), blendWeight ) );
             }
 
             pResultPose->ClearGlobalTransforms();
@@ -250,15 +315,71 @@ namespace EE::Animation
 
     // Masked Local Blend
     template<typename BlendFunction>
-    void Blender::LocalBlendMasked( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool canEarlyOutOfPerBoneBlend )
+    void Blender::LocalBlendMasked( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool canEarlyOutOfPerBoneBlend, BoneSet const* pRequiredBones )
     {
         EE_ASSERT( blendWeight > 0.0f && blendWeight <= 1.0f );
         EE_ASSERT( pSourcePose != nullptr && pTargetPose != nullptr && pResultPose != nullptr );
         EE_ASSERT( pBoneMask != nullptr );
 
+        Transform const* pSourceTransforms = pSourcePose->m_pLocalTransforms;
+        Transform const* pTargetTransforms = pTargetPose->m_pLocalTransforms;
+        Transform* pResultTransforms = pResultPose->m_pLocalTransforms;
+        float const* pBoneWeights = pBoneMask->GetWeights();
+
         int32_t const numBones = pResultPose->GetNumBones();
-        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        int32_t const numBatchedBones = numBones - ( numBones % TransformBatch::s_size );
+        __m128 const vBlendWeight = _mm_set1_ps( blendWeight );
+        __m128 const vOne = _mm_set1_ps( 1.0f );
+
+        // Blend four bones at a time, skipping any batches that dont contain any required bones
+        int32_t boneIdx = 0;
+        for ( ; boneIdx < numBatchedBones; boneIdx += TransformBatch::s_size )
+        {
+            if ( pRequiredBones != nullptr && !pRequiredBones->IsAnySet( boneIdx, TransformBatch::s_size ) )
+            {
+                continue;
+            }
+
+            __m128 const boneBlendWeights = _mm_mul_ps( vBlendWeight, _mm_loadu_ps( pBoneWeights + boneIdx ) );
+            __m128 const isMaskedOut = _mm_cmpeq_ps( boneBlendWeights, _mm_setzero_ps() );
+            __m128 const isFullyInTarget = canEarlyOutOfPerBoneBlend ? _mm_cmpeq_ps( boneBlendWeights, vOne ) : _mm_setzero_ps();
+
+            // If all bones have been masked out, or are fully in the target, we can just copy the transforms
+            if ( _mm_movemask_ps( isMaskedOut ) == 0xF )
+            {
+                if ( pSourceTransforms != pResultTransforms )
+                {
+                    memcpy( pResultTransforms + boneIdx, pSourceTransforms + boneIdx, sizeof( Transform ) * TransformBatch::s_size );
+                }
+                continue;
+            }
+
+            if ( _mm_movemask_ps( isFullyInTarget ) == 0xF )
+            {
+                if ( pTargetTransforms != pResultTransforms )
+                {
+                    memcpy( pResultTransforms + boneIdx, pTargetTransforms + boneIdx, sizeof( Transform ) * TransformBatch::s_size );
+                }
+                continue;
+            }
+
+            // Perform blend, and then restore the exact source/target transforms for any bones that should not be blended
+            TransformBatch const sourceBatch = TransformBatch::Load( pSourceTransforms + boneIdx );
+            TransformBatch const targetBatch = TransformBatch::Load( pTargetTransforms + boneIdx );
+            TransformBatch resultBatch = BlendFunction::BlendTransforms( sourceBatch, targetBatch, boneBlendWeights );
+            resultBatch = TransformBatch::Select( resultBatch, sourceBatch, isMaskedOut );
+            resultBatch = TransformBatch::Select( resultBatch, targetBatch, isFullyInTarget );
+            resultBatch.Store( pResultTransforms + boneIdx );
+        }
+
+        // Blend any remaining bones individually
+        for ( ; boneIdx < numBones; boneIdx++ )
         {
+            if ( pRequiredBones != nullptr && !pRequiredBones->IsSet( boneIdx ) )
+            {
+                continue;
+            }
+
             // If the bone has been masked out
             float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
             if ( boneBlendWeight == 0.0f )
@@ -271,10 +392,10 @@ namespace EE::Animation
             }
             else // Perform Blend
             {
-                Transform const& sourceTransform = pSourcePose->m_localTransforms[boneIdx];
-                Transform const& targetTransform = pTargetPose->m_localTransforms[boneIdx];
-                Transform::DirectlySetRotation( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
-                Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
+                Transform const& sourceTransform = pSourcePose->m_pLocalTransforms[boneIdx];
+                Transform const& targetTransform = pTargetPose->m_pLocalTransforms[boneIdx];
+                Transform::DirectlySetRotation( pResultPose->m_pLocalTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
+                Transform::DirectlySetTranslationScale( pResultPose->m_pLocalTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
             }
         }
 
@@ -1,4 +1,5 @@
 #include "AnimationBoneMask.h"
+#include "Engine/Animation/AnimationBoneSet.h"
 #include "Engine/Animation/AnimationSkeleton.h"
 #include "Base/Profiling.h"
 
@@ -424,21 +425,25 @@ namespace EE::Animation
         : m_pSkeleton( pSkeleton )
         , m_firstFreePoolIdx( InvalidIndex )
     {
-        EE_ASSERT( m_pool.empty() && m_pSkeleton != nullptr );
-
-        m_pool.reserve( s_initialPoolSize * 2 );
+        EE_ASSERT( m_poolSize == 0 && m_pSkeleton != nullptr );
 
         for ( auto i = 0; i < s_initialPoolSize; i++ )
         {
-            m_pool.emplace_back( pSkeleton );
+            m_pool[i] = EE::New<Slot>( pSkeleton );
         }
 
+        m_poolSize = s_initialPoolSize;
         m_firstFreePoolIdx = 0;
     }
 
     BoneMaskPool::~BoneMaskPool()
     {
-        m_pool.clear();
+        for ( auto i = 0; i < m_poolSize; i++ )
+        {
+            EE::Delete( m_pool[i] );
+        }
+
+        m_poolSize = 0;
         m_firstFreePoolIdx = InvalidIndex;
     }
 
@@ -446,9 +451,9 @@ namespace EE::Animation
     void BoneMaskPool::PerformValidation() const
     {
         // Validate that all buffers have been released!
-        for ( auto const& slot : m_pool )
+        for ( auto i = 0; i < m_poolSize; i++ )
         {
-            EE_ASSERT( !slot.m_isUsed );
+            EE_ASSERT( !m_pool[i]->m_isUsed );
         }
 
         EE_ASSERT( m_firstFreePoolIdx == 0 );
@@ -457,25 +462,59 @@ namespace EE::Animation
 
     int8_t BoneMaskPool::AcquireMask( bool resetMask )
     {
-        int32_t const currentPoolSize = (int32_t) m_pool.size();
-        EE_ASSERT( m_firstFreePoolIdx < currentPoolSize );
-        
+        if ( m_isConcurrentAccessEnabled )
+        {
+            Threading::ScopeLock lock( m_mutex );
+            return AcquireMaskInternal( resetMask );
+        }
+
+        return AcquireMaskInternal( resetMask );
+    }
+
+    void BoneMaskPool::ReleaseMask( int8_t maskIdx )
+    {
+        if ( m_isConcurrentAccessEnabled )
+        {
+            Threading::ScopeLock lock( m_mutex );
+            ReleaseMaskInternal( maskIdx );
+            return;
+        }
+
+        ReleaseMaskInternal( maskIdx );
+    }
+
+    void BoneMaskPool::BeginConcurrentAccess()
+    {
+        EE_ASSERT( !m_isConcurrentAccessEnabled );
+        m_isConcurrentAccessEnabled = true;
+    }
+
+    void BoneMaskPool::EndConcurrentAccess()
+    {
+        EE_ASSERT( m_isConcurrentAccessEnabled );
+        m_isConcurrentAccessEnabled = false;
+    }
+
+    int8_t BoneMaskPool::AcquireMaskInternal( bool resetMask )
+    {
+        EE_ASSERT( m_firstFreePoolIdx >= 0 && m_firstFreePoolIdx < m_poolSize );
+
         // Set the mask as used
         int8_t maskIdx = m_firstFreePoolIdx;
-        EE_ASSERT( !m_pool[maskIdx].m_isUsed );
-        m_pool[maskIdx].m_isUsed = true;
+        EE_ASSERT( !m_pool[maskIdx]->m_isUsed );
+        m_pool[maskIdx]->m_isUsed = true;
 
         if ( resetMask )
         {
-            m_pool[maskIdx].m_mask.ResetWeights();
+            m_pool[maskIdx]->m_mask.ResetWeights();
         }
 
         // Update free idx
         int8_t const searchStartIdx = m_firstFreePoolIdx + 1;
         m_firstFreePoolIdx = InvalidIndex;
-        for ( int8_t i = searchStartIdx; i < currentPoolSize; i++ )
+        for ( int8_t i = searchStartIdx; i < m_poolSize; i++ )
         {
-            if ( !m_pool[i].m_isUsed )
+            if ( !m_pool[i]->m_isUsed )
             {
                 m_firstFreePoolIdx = i;
                 break;
@@ -483,40 +522,52 @@ namespace EE::Animation
         }
 
         // Grow the pool if needed
-        if ( m_firstFreePoolIdx == InvalidIndex )
+        if ( m_firstFreePoolIdx == InvalidIndex && m_poolSize < s_maxPoolSize )
         {
-            size_t const newPoolSize = Math::Max( 127, currentPoolSize * 2 );
-            size_t const numMasksToAdd = newPoolSize - currentPoolSize;
-
-            for ( auto i = 0; i < numMasksToAdd; i++ )
-            {
-                m_pool.emplace_back( m_pSkeleton );
-            }
-
-            m_firstFreePoolIdx = (int8_t) currentPoolSize + 1;
-            EE_ASSERT( m_firstFreePoolIdx < 127 );
+            GrowPool();
         }
 
         // Return the allocate mask pool index
-        EE_ASSERT( maskIdx >= 0 && maskIdx < m_pool.size() );
+        EE_ASSERT( maskIdx >= 0 && maskIdx < m_poolSize );
         return maskIdx;
     }
 
-    void BoneMaskPool::ReleaseMask( int8_t maskIdx )
+    void BoneMaskPool::ReleaseMaskInternal( int8_t maskIdx )
     {
-        EE_ASSERT( maskIdx < m_pool.size() );
-        EE_ASSERT( m_pool[maskIdx].m_isUsed );
+        EE_ASSERT( maskIdx >= 0 && maskIdx < m_poolSize );
+        EE_ASSERT( m_pool[maskIdx]->m_isUsed );
 
         // Clear the flag
-        m_pool[maskIdx].m_isUsed = false;
+        m_pool[maskIdx]->m_isUsed = false;
 
         // Update the free index
-        if ( maskIdx < m_firstFreePoolIdx )
+        if ( m_firstFreePoolIdx == InvalidIndex || maskIdx < m_firstFreePoolIdx )
         {
             m_firstFreePoolIdx = maskIdx;
         }
     }
 
+    void BoneMaskPool::GrowPool()
+    {
+        // The pool only grows to the peak number of simultaneously used masks, existing slots are never moved so masks in use stay valid
+        EE_ASSERT( m_poolSize < s_maxPoolSize );
+        int32_t const newPoolSize = Math::Min( s_maxPoolSize, m_poolSize * 2 );
+        for ( auto i = m_poolSize; i < newPoolSize; i++ )
+        {
+            m_pool[i] = EE::New<Slot>( m_pSkeleton );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_poolSize <= s_poolSizeWarningThreshold && newPoolSize > s_poolSizeWarningThreshold )
+        {
+            EE_LOG_WARNING( "Animation", "Bone Mask Pool", "Bone mask pool for skeleton (%s) has grown to %d masks (%.2fKB), check the graph for excessive simultaneous bone mask usage!", m_pSkeleton->GetResourceID().c_str(), newPoolSize, float( newPoolSize * m_pSkeleton->GetNumBones() * sizeof( float ) ) / 1024.0f );
+        }
+        #endif
+
+        m_firstFreePoolIdx = (int8_t) m_poolSize;
+        m_poolSize = newPoolSize;
+    }
+
     //-------------------------------------------------------------------------
     // Task List
     //-------------------------------------------------------------------------
@@ -806,6 +857,79 @@ namespace EE::Animation
         }
     }
 
+    void BoneMaskTaskList::CalculateAffectedBones( Skeleton const* pSkeleton, BoneSet& outAffectedBones ) const
+    {
+        EE_ASSERT( pSkeleton != nullptr );
+
+        int32_t const numBones = pSkeleton->GetNumBones();
+        int32_t const numTasks = (int32_t) m_tasks.size();
+        EE_ASSERT( numTasks > 0 && numTasks < s_maxTasks );
+
+        // Evaluate the task list symbolically, tracking which bones could have a non-zero weight after each task
+        TInlineVector<BoneSet, 10> taskResults;
+        taskResults.resize( numTasks );
+
+        for ( auto i = 0; i < numTasks; i++ )
+        {
+            BoneMaskTask const& task = m_tasks[i];
+            EE_ASSERT( task.IsValid() );
+
+            BoneSet& result = taskResults[i];
+            switch ( task.m_type )
+            {
+                case BoneMaskTask::Type::Mask:
+                {
+                    result.Reset( numBones );
+                    result.SetFromBoneMask( *pSkeleton->GetBoneMask( task.m_maskIdx ) );
+                }
+                break;
+
+                case BoneMaskTask::Type::GenerateMask:
+                {
+                    result.Reset( numBones, task.m_weight > 0.0f );
+                }
+                break;
+
+                case BoneMaskTask::Type::Scale:
+                {
+                    result = taskResults[task.m_sourceTaskIdx];
+                    if ( task.m_weight == 0.0f )
+                    {
+                        result.ClearAll();
+                    }
+                }
+                break;
+
+                case BoneMaskTask::Type::Combine:
+                {
+                    result = taskResults[task.m_sourceTaskIdx];
+                    result &= taskResults[task.m_targetTaskIdx];
+                }
+                break;
+
+                case BoneMaskTask::Type::Blend:
+                {
+                    if ( task.m_weight == 0.0f )
+                    {
+                        result = taskResults[task.m_sourceTaskIdx];
+                    }
+                    else if ( task.m_weight == 1.0f )
+                    {
+                        result = taskResults[task.m_targetTaskIdx];
+                    }
+                    else
+                    {
+                        result = taskResults[task.m_sourceTaskIdx];
+                        result |= taskResults[task.m_targetTaskIdx];
+                    }
+                }
+                break;
+            }
+        }
+
+        outAffectedBones = taskResults.back();
+    }
+
     void BoneMaskTaskList::Serialize( Serialization::BitArchive<1280>& archive, uint32_t maxBitsForMaskIndex ) const
     {
         uint8_t const numTasks = (uint8_t) m_tasks.size();
@@ -7,12 +7,14 @@
 #include "Base/TypeSystem/ReflectedType.h"
 #include "Base/Serialization/BitSerialization.h"
 #include "Base/Types/Color.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
     class Skeleton;
+    class BoneSet;
 
     //-------------------------------------------------------------------------
     // Bone Mask Definition
@@ -109,6 +111,7 @@ namespace EE::Animation
         inline int32_t GetNumWeights() const { return (int32_t) m_weights.size(); }
         inline float GetWeight( uint32_t i ) const { EE_ASSERT( i < (uint32_t) m_weights.size() ); return m_weights[i]; }
         inline float operator[]( uint32_t i ) const { return GetWeight( i ); }
+        inline float const* GetWeights() const { return m_weights.data(); }
         BoneMask& operator*=( BoneMask const& rhs );
 
         //-------------------------------------------------------------------------
@@ -181,6 +184,8 @@ namespace EE::Animation
     class BoneMaskPool
     {
         constexpr static int32_t const s_initialPoolSize = 5;
+        constexpr static int32_t const s_maxPoolSize = 127;
+        constexpr static int32_t const s_poolSizeWarningThreshold = 20; // Each mask is a float per bone, so large pools get expensive quickly
 
         struct Slot
         {
@@ -208,18 +213,32 @@ namespace EE::Animation
         // Release a mask back into the pool
         void ReleaseMask( int8_t maskIdx );
 
+        // Acquiring and releasing masks is only thread-safe between these calls
+        // Masks are individually allocated so the pool can grow on demand without invalidating masks in use by other threads
+        void BeginConcurrentAccess();
+        void EndConcurrentAccess();
+
         // Get a used bone mask
         inline BoneMask* operator[]( size_t maskIdx )
         {
-            EE_ASSERT( m_pool[maskIdx].m_isUsed );
-            return &m_pool[maskIdx].m_mask;
+            EE_ASSERT( maskIdx < (size_t) m_poolSize && m_pool[maskIdx]->m_isUsed );
+            return &m_pool[maskIdx]->m_mask;
         }
 
+    private:
+
+        int8_t AcquireMaskInternal( bool resetMask );
+        void ReleaseMaskInternal( int8_t maskIdx );
+        void GrowPool();
+
     private:
 
         Skeleton const*             m_pSkeleton = nullptr;
-        TVector<Slot>               m_pool;
+        Slot*                       m_pool[s_maxPoolSize] = {};
+        int32_t                     m_poolSize = 0;
+        Threading::Mutex            m_mutex;
         int8_t                      m_firstFreePoolIdx = InvalidIndex;
+        bool                        m_isConcurrentAccessEnabled = false;
     };
 
     //-------------------------------------------------------------------------
@@ -405,6 +424,10 @@ namespace EE::Animation
         // Execute the task list to generate a body mask
         Result GenerateBoneMask( BoneMaskPool& pool ) const;
 
+        // Calculate which bones will end up with a non-zero weight in the generated mask, without actually generating it
+        // This is conservative i.e. it may include some bones that end up with a zero weight but will never exclude any weighted bones
+        void CalculateAffectedBones( Skeleton const* pSkeleton, BoneSet& outAffectedBones ) const;
+
         //-------------------------------------------------------------------------
 
         void Serialize( Serialization::BitArchive<1280>& archive, uint32_t maxBitsForMaskIndex ) const;
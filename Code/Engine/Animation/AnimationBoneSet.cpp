@@ -0,0 +1,139 @@
+#include "AnimationBoneSet.h"
+#include "Engine/Animation/AnimationBoneMask.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    void BoneSet::Reset( int32_t numBones, bool setAllBones )
+    {
+        EE_ASSERT( numBones >= 0 );
+        m_numBones = numBones;
+        m_words.resize( ( numBones + s_numBitsPerWord - 1 ) / s_numBitsPerWord );
+
+        if ( setAllBones )
+        {
+            SetAll();
+        }
+        else
+        {
+            ClearAll();
+        }
+    }
+
+    void BoneSet::SetAll()
+    {
+        int32_t const numWords = (int32_t) m_words.size();
+        for ( int32_t i = 0; i < numWords; i++ )
+        {
+            m_words[i] = ~0ull;
+        }
+
+        // Ensure that the unused bits in the last word are always cleared
+        int32_t const numUsedBitsInLastWord = m_numBones % s_numBitsPerWord;
+        if ( numUsedBitsInLastWord != 0 )
+        {
+            m_words.back() = ( 1ull << numUsedBitsInLastWord ) - 1;
+        }
+    }
+
+    void BoneSet::ClearAll()
+    {
+        for ( auto& word : m_words )
+        {
+            word = 0;
+        }
+    }
+
+    bool BoneSet::IsEmpty() const
+    {
+        for ( auto const& word : m_words )
+        {
+            if ( word != 0 )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool BoneSet::AreAllSet() const
+    {
+        return GetNumSetBones() == m_numBones;
+    }
+
+    int32_t BoneSet::GetNumSetBones() const
+    {
+        int32_t numSetBones = 0;
+        for ( uint64_t word : m_words )
+        {
+            for ( ; word != 0; word &= ( word - 1 ) )
+            {
+                numSetBones++;
+            }
+        }
+
+        return numSetBones;
+    }
+
+    //-------------------------------------------------------------------------
+
+    BoneSet& BoneSet::operator|=( BoneSet const& rhs )
+    {
+        EE_ASSERT( m_numBones == rhs.m_numBones );
+
+        int32_t const numWords = (int32_t) m_words.size();
+        for ( int32_t i = 0; i < numWords; i++ )
+        {
+            m_words[i] |= rhs.m_words[i];
+        }
+
+        return *this;
+    }
+
+    BoneSet& BoneSet::operator&=( BoneSet const& rhs )
+    {
+        EE_ASSERT( m_numBones == rhs.m_numBones );
+
+        int32_t const numWords = (int32_t) m_words.size();
+        for ( int32_t i = 0; i < numWords; i++ )
+        {
+            m_words[i] &= rhs.m_words[i];
+        }
+
+        return *this;
+    }
+
+    void BoneSet::SetFromBoneMask( BoneMask const& mask )
+    {
+        EE_ASSERT( mask.IsValid() && mask.GetSkeleton()->GetNumBones() == m_numBones );
+
+        // The weight info is not maintained by all mask operations, so always check the actual weights
+        ClearAll();
+
+        for ( int32_t i = 0; i < m_numBones; i++ )
+        {
+            if ( mask.GetWeight( i ) > 0.0f )
+            {
+                Set( i );
+            }
+        }
+    }
+
+    void BoneSet::AddParentBones( Skeleton const* pSkeleton )
+    {
+        EE_ASSERT( pSkeleton != nullptr && pSkeleton->GetNumBones() == m_numBones );
+
+        // Parents always precede their children, so a single backwards pass will propagate through the whole chain
+        TVector<int32_t> const& parentIndices = pSkeleton->GetParentBoneIndices();
+        for ( int32_t i = m_numBones - 1; i > 0; i-- )
+        {
+            if ( IsSet( i ) && parentIndices[i] != InvalidIndex )
+            {
+                Set( parentIndices[i] );
+            }
+        }
+    }
+}
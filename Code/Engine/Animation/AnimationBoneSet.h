@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    class Skeleton;
+    class BoneMask;
+
+    //-------------------------------------------------------------------------
+    // Bone Set
+    //-------------------------------------------------------------------------
+    // A compact bitset of bone indices for a given skeleton
+    // Used to describe which bones a pose operation actually needs to produce (e.g. so we can skip decoding masked out bones)
+
+    class EE_ENGINE_API BoneSet
+    {
+        constexpr static int32_t const s_numBitsPerWord = 64;
+
+    public:
+
+        BoneSet() = default;
+        explicit BoneSet( int32_t numBones, bool setAllBones = false ) { Reset( numBones, setAllBones ); }
+
+        // Resize the set to the specified number of bones and either clear or set all bones
+        void Reset( int32_t numBones, bool setAllBones = false );
+
+        inline int32_t GetNumBones() const { return m_numBones; }
+
+        // Bones
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE bool IsSet( int32_t boneIdx ) const
+        {
+            EE_ASSERT( boneIdx >= 0 && boneIdx < m_numBones );
+            return ( m_words[boneIdx / s_numBitsPerWord] & ( 1ull << ( boneIdx % s_numBitsPerWord ) ) ) != 0;
+        }
+
+        EE_FORCE_INLINE void Set( int32_t boneIdx )
+        {
+            EE_ASSERT( boneIdx >= 0 && boneIdx < m_numBones );
+            m_words[boneIdx / s_numBitsPerWord] |= ( 1ull << ( boneIdx % s_numBitsPerWord ) );
+        }
+
+        EE_FORCE_INLINE void Clear( int32_t boneIdx )
+        {
+            EE_ASSERT( boneIdx >= 0 && boneIdx < m_numBones );
+            m_words[boneIdx / s_numBitsPerWord] &= ~( 1ull << ( boneIdx % s_numBitsPerWord ) );
+        }
+
+        // Are any of the bones in the specified range set? The range may not cross a 64 bone boundary
+        EE_FORCE_INLINE bool IsAnySet( int32_t firstBoneIdx, int32_t numBones ) const
+        {
+            EE_ASSERT( firstBoneIdx >= 0 && numBones > 0 && ( firstBoneIdx + numBones ) <= m_numBones );
+            EE_ASSERT( ( firstBoneIdx / s_numBitsPerWord ) == ( ( firstBoneIdx + numBones - 1 ) / s_numBitsPerWord ) );
+            uint64_t const rangeMask = ( numBones == s_numBitsPerWord ) ? ~0ull : ( ( 1ull << numBones ) - 1 );
+            return ( ( m_words[firstBoneIdx / s_numBitsPerWord] >> ( firstBoneIdx % s_numBitsPerWord ) ) & rangeMask ) != 0;
+        }
+
+        void SetAll();
+        void ClearAll();
+
+        // Are no bones set?
+        bool IsEmpty() const;
+
+        // Are all the bones set?
+        bool AreAllSet() const;
+
+        // Get the number of set bones
+        int32_t GetNumSetBones() const;
+
+        // Operations
+        //-------------------------------------------------------------------------
+
+        // Union
+        BoneSet& operator|=( BoneSet const& rhs );
+
+        // Intersection
+        BoneSet& operator&=( BoneSet const& rhs );
+
+        // Set all bones that have a non-zero weight in the supplied mask
+        void SetFromBoneMask( BoneMask const& mask );
+
+        // Add all the parents of any set bones, since a bone's global transform depends on its whole parent chain
+        void AddParentBones( Skeleton const* pSkeleton );
+
+    private:
+
+        TInlineVector<uint64_t, 4>      m_words;
+        int32_t                         m_numBones = 0;
+    };
+}
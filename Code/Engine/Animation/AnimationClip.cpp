@@ -1,93 +1,363 @@
 #include "AnimationClip.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationBoneSet.h"
+#include "Engine/Animation/AnimationTransformBatch.h"
+#include "Engine/Animation/AnimationClipFrameCache.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
+// Batched track decoding
+//-------------------------------------------------------------------------
+// Rotations are decoded four at a time in a structure-of-arrays layout (one register per quaternion component, one lane per bone)
+// This allows us to decode and interpolate the rotations without any per-bone shuffles or branches
 
 namespace EE::Animation
 {
-    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose ) const
+    namespace
     {
-        EE_ASSERT( IsValid() );
-        EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
-        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+        static int32_t const g_rotationBatchSize = 4;
 
-        pOutPose->ClearGlobalTransforms();
+        // Decode up to 4 animated rotations (specified by their index in the compressed pose), unused lanes duplicate the last valid rotation
+        EE_FORCE_INLINE QuaternionBatch DecodeRotationBatch( uint16_t const* pRotationData, int32_t const* pRotationIndices, int32_t numLanes )
+        {
+            alignas( 16 ) int32_t data0[g_rotationBatchSize];
+            alignas( 16 ) int32_t data1[g_rotationBatchSize];
+            alignas( 16 ) int32_t data2[g_rotationBatchSize];
+
+            for ( int32_t i = 0; i < g_rotationBatchSize; i++ )
+            {
+                uint16_t const* pEncodedRotation = pRotationData + pRotationIndices[Math::Min( i, numLanes - 1 )] * 3;
+                data0[i] = pEncodedRotation[0];
+                data1[i] = pEncodedRotation[1];
+                data2[i] = pEncodedRotation[2];
+            }
+
+            //-------------------------------------------------------------------------
+
+            __m128i const encoded0 = _mm_load_si128( (__m128i const*) data0 );
+            __m128i const encoded1 = _mm_load_si128( (__m128i const*) data1 );
+            __m128i const encoded2 = _mm_load_si128( (__m128i const*) data2 );
+
+            // Dequantize the three smallest components
+            __m128i const valueMask = _mm_set1_epi32( 0x7FFF );
+            __m128 const rangeMin = _mm_set1_ps( Quantization::EncodedQuaternion::s_valueRangeMin );
+            __m128 const rangeMultiplier = _mm_set1_ps( Quantization::EncodedQuaternion::s_valueRangeLength / float( 0x7FFF ) );
+
+            __m128 const a = SIMD::Float::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( encoded0, valueMask ) ), rangeMultiplier, rangeMin );
+            __m128 const b = SIMD::Float::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( encoded1, valueMask ) ), rangeMultiplier, rangeMin );
+            __m128 const c = SIMD::Float::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( encoded2, valueMask ) ), rangeMultiplier, rangeMin );
+
+            // Reconstruct the largest component
+            __m128 sum = _mm_mul_ps( a, a );
+            sum = SIMD::Float::MultiplyAdd( b, b, sum );
+            sum = SIMD::Float::MultiplyAdd( c, c, sum );
+            __m128 const d = _mm_sqrt_ps( _mm_max_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), sum ), _mm_setzero_ps() ) );
+
+            // Reorder the components based on the largest component index (see EncodedQuaternion::ToQuaternion)
+            __m128i const largestValueIndex = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( encoded0, 14 ), _mm_set1_epi32( 0x0002 ) ), _mm_srli_epi32( encoded1, 15 ) );
+            __m128 const isLargest0 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_setzero_si128() ) );
+            __m128 const isLargest1 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 1 ) ) );
+            __m128 const isLargest2 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 2 ) ) );
+            __m128 const isLargest3 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 3 ) ) );
+
+            QuaternionBatch result;
+            result.m_x = SIMD::Float::Select( a, d, isLargest0 );
+            result.m_y = SIMD::Float::Select( SIMD::Float::Select( b, d, isLargest1 ), a, isLargest0 );
+            result.m_z = SIMD::Float::Select( SIMD::Float::Select( b, d, isLargest2 ), c, isLargest3 );
+            result.m_w = SIMD::Float::Select( c, d, isLargest3 );
+            return result;
+        }
 
         //-------------------------------------------------------------------------
 
-        int32_t const numBones = m_skeleton->GetNumBones();
-        auto ReadCompressedPose = [&] ( int32_t poseIdx, Transform outTransforms[] )
+        EE_FORCE_INLINE void StoreRotationBatch( QuaternionBatch const& batch, int32_t const* pBoneIndices, int32_t numLanes, Transform* pOutTransforms )
         {
-            uint16_t const* pReadPtr = m_compressedPoseData2.data() + m_compressedPoseOffsets[poseIdx];
+            __m128 rotations[g_rotationBatchSize] = { batch.m_x, batch.m_y, batch.m_z, batch.m_w };
+            SIMD::Float::Transpose( rotations[0], rotations[1], rotations[2], rotations[3] );
 
-            // Read rotations
-            for ( auto i = 0; i < numBones; i++ )
+            for ( int32_t i = 0; i < numLanes; i++ )
             {
-                TrackCompressionSettings const& trackSettings = m_trackCompressionSettings[i];
-                if ( trackSettings.IsRotationTrackStatic() )
-                {
-                    Transform::DirectlySetRotation( outTransforms[i], trackSettings.GetStaticRotationValue() );
-                }
-                else
-                {
-                    Transform::DirectlySetRotation( outTransforms[i], DecodeRotation( pReadPtr ) );
-                    pReadPtr += 3; // Rotations are 48bits (3 x uint16_t)
-                }
+                Transform::DirectlySetRotation( pOutTransforms[pBoneIndices[i]], Quaternion( Vector( rotations[i] ) ) );
             }
+        }
+
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE Vector DecodeTranslation( uint16_t const* pData, Vector const& decodeScale, Vector const& decodeOffset )
+        {
+            Vector const encodedValues = _mm_cvtepi32_ps( _mm_setr_epi32( pData[0], pData[1], pData[2], 0 ) );
+            return Vector::MultiplyAdd( encodedValues, decodeScale, decodeOffset );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<bool Interpolate, bool DecodeAllBones>
+    void AnimationClip::DecodeAnimatedTracks( uint16_t const* pLowerPose, uint16_t const* pUpperPose, float percentageThrough, BoneSet const* pRequiredBones, Transform* pOutTransforms ) const
+    {
+        EE_ASSERT( DecodeAllBones || pRequiredBones != nullptr );
+
+        // Rotations
+        //-------------------------------------------------------------------------
+        // Required rotations are gathered into batches, so skipped bones dont leave any empty lanes
 
-            // Read translation/scale
-            for ( auto i = 0; i < numBones; i++ )
+        int32_t const numAnimatedRotations = (int32_t) m_animatedRotationBoneIndices.size();
+        if ( numAnimatedRotations > 0 )
+        {
+            FastSLerpCoefficients const coefficientsT( percentageThrough );
+            FastSLerpCoefficients const coefficientsOneMinusT( 1.0f - percentageThrough );
+
+            int32_t rotationIndices[g_rotationBatchSize];
+            int32_t boneIndices[g_rotationBatchSize];
+            int32_t numLanes = 0;
+
+            auto DecodeBatch = [&] ()
             {
-                TrackCompressionSettings const& trackSettings = m_trackCompressionSettings[i];
+                QuaternionBatch rotations = DecodeRotationBatch( pLowerPose, rotationIndices, numLanes );
+                if constexpr ( Interpolate )
+                {
+                    QuaternionBatch const upperRotations = DecodeRotationBatch( pUpperPose, rotationIndices, numLanes );
+                    rotations = QuaternionBatch::FastSLerp( rotations, upperRotations, coefficientsT, coefficientsOneMinusT );
+                }
 
-                Float4 translationScale;
+                StoreRotationBatch( rotations, boneIndices, numLanes, pOutTransforms );
+                numLanes = 0;
+            };
 
-                if ( trackSettings.IsTranslationTrackStatic() )
+            for ( int32_t i = 0; i < numAnimatedRotations; i++ )
+            {
+                int32_t const boneIdx = m_animatedRotationBoneIndices[i];
+                if constexpr ( !DecodeAllBones )
                 {
-                    translationScale = Float4( trackSettings.GetStaticTranslationValue() );
+                    if ( !pRequiredBones->IsSet( boneIdx ) )
+                    {
+                        continue;
+                    }
                 }
-                else
+
+                rotationIndices[numLanes] = i;
+                boneIndices[numLanes] = boneIdx;
+                if ( ++numLanes == g_rotationBatchSize )
                 {
-                    translationScale = DecodeTranslation( pReadPtr, trackSettings );
-                    pReadPtr += 3; // Translations are 48bits (3 x uint16_t)
+                    DecodeBatch();
                 }
+            }
 
-                if ( trackSettings.IsScaleTrackStatic() )
+            if ( numLanes > 0 )
+            {
+                DecodeBatch();
+            }
+        }
+
+        // Translations
+        //-------------------------------------------------------------------------
+        // Only the XYZ components are written, the W component holds the scale
+
+        for ( AnimatedTranslationTrack const& track : m_animatedTranslationTracks )
+        {
+            if constexpr ( !DecodeAllBones )
+            {
+                if ( !pRequiredBones->IsSet( track.m_boneIdx ) )
                 {
-                    translationScale.m_w = trackSettings.GetStaticScaleValue();
+                    continue;
                 }
-                else
+            }
+
+            Vector translation = DecodeTranslation( pLowerPose + track.m_dataOffset, track.m_decodeScale, track.m_decodeOffset );
+            if constexpr ( Interpolate )
+            {
+                Vector const upperTranslation = DecodeTranslation( pUpperPose + track.m_dataOffset, track.m_decodeScale, track.m_decodeOffset );
+                translation = Vector::Lerp( translation, upperTranslation, percentageThrough );
+            }
+
+            Transform& outTransform = pOutTransforms[track.m_boneIdx];
+            Transform::DirectlySetTranslationScale( outTransform, Vector::Select( translation, outTransform.GetTranslationAndScale(), Vector::Select0001 ) );
+        }
+
+        // Scales
+        //-------------------------------------------------------------------------
+
+        for ( AnimatedScaleTrack const& track : m_animatedScaleTracks )
+        {
+            if constexpr ( !DecodeAllBones )
+            {
+                if ( !pRequiredBones->IsSet( track.m_boneIdx ) )
                 {
-                    DecodeScale( pReadPtr, trackSettings );
-                    pReadPtr += 1; // Scales are 16bits (1 x uint16_t)
+                    continue;
                 }
+            }
 
-                Transform::DirectlySetTranslationScale( outTransforms[i], translationScale );
+            float scale = ( pLowerPose[track.m_dataOffset] * track.m_decodeScale ) + track.m_decodeOffset;
+            if constexpr ( Interpolate )
+            {
+                float const upperScale = ( pUpperPose[track.m_dataOffset] * track.m_decodeScale ) + track.m_decodeOffset;
+                scale = Math::Lerp( scale, upperScale, percentageThrough );
             }
-        };
+
+            pOutTransforms[track.m_boneIdx].SetScale( scale );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose, BoneSet const* pRequiredBones ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+        EE_ASSERT( m_staticTrackPose.size() == m_skeleton->GetNumBones() );
+        EE_ASSERT( pRequiredBones == nullptr || pRequiredBones->GetNumBones() == m_skeleton->GetNumBones() );
+
+        pOutPose->ClearGlobalTransforms();
 
         //-------------------------------------------------------------------------
 
-        // Read the lower frame pose into the output pose
-        ReadCompressedPose( frameTime.GetLowerBoundFrameIndex(), pOutPose->m_localTransforms.data() );
+        // Static tracks are identical for all frames so we can just copy them and only decode the animated tracks
+        // Any animated tracks that we skip are left at the placeholder values stored in the static track pose
+        Transform* pOutTransforms = pOutPose->m_pLocalTransforms;
+        memcpy( pOutTransforms, m_staticTrackPose.data(), sizeof( Transform ) * m_staticTrackPose.size() );
+
+        bool const decodeAllBones = ( pRequiredBones == nullptr ) || pRequiredBones->AreAllSet();
+        uint16_t const* pLowerPose = m_compressedPoseData2.data() + m_compressedPoseOffsets[frameTime.GetLowerBoundFrameIndex()];
 
         // If we're not exactly at a key frame we need to read the upper frame pose and blend
-        if ( !frameTime.IsExactlyAtKeyFrame() )
+        if ( frameTime.IsExactlyAtKeyFrame() )
+        {
+            if ( decodeAllBones )
+            {
+                DecodeAnimatedTracks<false, true>( pLowerPose, nullptr, 0.0f, nullptr, pOutTransforms );
+            }
+            else
+            {
+                DecodeAnimatedTracks<false, false>( pLowerPose, nullptr, 0.0f, pRequiredBones, pOutTransforms );
+            }
+        }
+        else
+        {
+            uint16_t const* pUpperPose = m_compressedPoseData2.data() + m_compressedPoseOffsets[frameTime.GetUpperBoundFrameIndex()];
+            float const percentageThrough = frameTime.GetPercentageThrough().ToFloat();
+
+            if ( decodeAllBones )
+            {
+                DecodeAnimatedTracks<true, true>( pLowerPose, pUpperPose, percentageThrough, nullptr, pOutTransforms );
+            }
+            else
+            {
+                DecodeAnimatedTracks<true, false>( pLowerPose, pUpperPose, percentageThrough, pRequiredBones, pOutTransforms );
+            }
+        }
+
+        // Flag the pose as being set
+        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::DecodeFrame( uint32_t frameIdx, Transform* pOutTransforms ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( frameIdx < m_numFrames && pOutTransforms != nullptr );
+
+        memcpy( pOutTransforms, m_staticTrackPose.data(), sizeof( Transform ) * m_staticTrackPose.size() );
+        uint16_t const* pPose = m_compressedPoseData2.data() + m_compressedPoseOffsets[frameIdx];
+        DecodeAnimatedTracks<false, true>( pPose, nullptr, 0.0f, nullptr, pOutTransforms );
+    }
+
+    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose, ClipFrameCache& frameCache, BoneSet const* pRequiredBones ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+        EE_ASSERT( m_staticTrackPose.size() == m_skeleton->GetNumBones() );
+        EE_ASSERT( pRequiredBones == nullptr || pRequiredBones->GetNumBones() == m_skeleton->GetNumBones() );
+
+        pOutPose->ClearGlobalTransforms();
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numBones = m_skeleton->GetNumBones();
+        Transform* pOutTransforms = pOutPose->m_pLocalTransforms;
+        bool const sampleAllBones = ( pRequiredBones == nullptr ) || pRequiredBones->AreAllSet();
+
+        auto pLowerFrame = frameCache.AcquireFrame( this, frameTime.GetLowerBoundFrameIndex() );
+        Transform const* pLowerTransforms = pLowerFrame->GetTransforms();
+
+        if ( frameTime.IsExactlyAtKeyFrame() )
+        {
+            memcpy( pOutTransforms, pLowerTransforms, sizeof( Transform ) * numBones );
+        }
+        else
         {
-            TInlineVector<Transform, 200> tmpPose;
-            tmpPose.resize( numBones );
-            ReadCompressedPose( frameTime.GetUpperBoundFrameIndex(), tmpPose.data() );
+            auto pUpperFrame = frameCache.AcquireFrame( this, frameTime.GetUpperBoundFrameIndex() );
+            Transform const* pUpperTransforms = pUpperFrame->GetTransforms();
 
             float const percentageThrough = frameTime.GetPercentageThrough().ToFloat();
-            for ( auto i = 0; i < numBones; i++ )
+            FastSLerpCoefficients const coefficientsT( percentageThrough );
+            FastSLerpCoefficients const coefficientsOneMinusT( 1.0f - percentageThrough );
+            __m128 const t = _mm_set1_ps( percentageThrough );
+
+            auto InterpolateBatch = [&] ( Transform const* pLower, Transform const* pUpper, Transform* pResult )
+            {
+                TransformBatch const lower = TransformBatch::Load( pLower );
+                TransformBatch const upper = TransformBatch::Load( pUpper );
+
+                TransformBatch result;
+                result.m_rotation = QuaternionBatch::FastSLerp( lower.m_rotation, upper.m_rotation, coefficientsT, coefficientsOneMinusT );
+                result.m_translationX = SIMD::Float::MultiplyAdd( _mm_sub_ps( upper.m_translationX, lower.m_translationX ), t, lower.m_translationX );
+                result.m_translationY = SIMD::Float::MultiplyAdd( _mm_sub_ps( upper.m_translationY, lower.m_translationY ), t, lower.m_translationY );
+                result.m_translationZ = SIMD::Float::MultiplyAdd( _mm_sub_ps( upper.m_translationZ, lower.m_translationZ ), t, lower.m_translationZ );
+                result.m_scale = SIMD::Float::MultiplyAdd( _mm_sub_ps( upper.m_scale, lower.m_scale ), t, lower.m_scale );
+                result.Store( pResult );
+            };
+
+            // Batches with no required bones are skipped, they are filled in with the rest of the unrequired bones below
+            int32_t const numBatchedBones = numBones - ( numBones % TransformBatch::s_size );
+            for ( int32_t boneIdx = 0; boneIdx < numBatchedBones; boneIdx += TransformBatch::s_size )
+            {
+                if ( sampleAllBones || pRequiredBones->IsAnySet( boneIdx, TransformBatch::s_size ) )
+                {
+                    InterpolateBatch( &pLowerTransforms[boneIdx], &pUpperTransforms[boneIdx], &pOutTransforms[boneIdx] );
+                }
+            }
+
+            // The remaining bones are padded out to a full batch, so that they are interpolated identically to the other bones
+            int32_t const numRemainingBones = numBones - numBatchedBones;
+            if ( numRemainingBones > 0 )
             {
-                pOutPose->m_localTransforms[i] = Transform::FastSlerp( pOutPose->m_localTransforms[i], tmpPose[i], percentageThrough );
+                Transform lower[TransformBatch::s_size];
+                Transform upper[TransformBatch::s_size];
+                Transform result[TransformBatch::s_size];
+
+                for ( int32_t i = 0; i < TransformBatch::s_size; i++ )
+                {
+                    int32_t const boneIdx = numBatchedBones + Math::Min( i, numRemainingBones - 1 );
+                    lower[i] = pLowerTransforms[boneIdx];
+                    upper[i] = pUpperTransforms[boneIdx];
+                }
+
+                InterpolateBatch( lower, upper, result );
+                memcpy( &pOutTransforms[numBatchedBones], result, sizeof( Transform ) * numRemainingBones );
+            }
+
+            frameCache.ReleaseFrame( pUpperFrame );
+        }
+
+        frameCache.ReleaseFrame( pLowerFrame );
+
+        // Bones that are not required are left at the reference pose (stored in the static track pose), exactly like the uncached sampling path
+        if ( !sampleAllBones )
+        {
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                if ( !pRequiredBones->IsSet( boneIdx ) )
+                {
+                    pOutTransforms[boneIdx] = m_staticTrackPose[boneIdx];
+                }
             }
         }
 
         // Flag the pose as being set
         pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
     }
-}
\ No newline at end of file
+}
@@ -9,6 +9,8 @@
 #include "Base/Math/NumericRange.h"
 #include "Base/Time/Time.h"
 #include "Base/Encoding/Quantization.h"
+#include "Base/Types/MappedArray.h"
+#include "Base/Memory/ScratchAllocator.h"
 
 //-------------------------------------------------------------------------
 
@@ -16,12 +18,15 @@ namespace EE::Animation
 {
     class Pose;
     class Event;
+    class BoneSet;
+    class ClipFrameCache;
 
     //-------------------------------------------------------------------------
 
     struct QuantizationRange
     {
         EE_SERIALIZE( m_rangeStart, m_rangeLength );
+        EE_SERIALIZE_FLAT_POD( QuantizationRange, m_rangeStart, m_rangeLength );
 
         QuantizationRange() = default;
 
@@ -92,24 +97,30 @@ namespace EE::Animation
 
     private:
 
-        EE_FORCE_INLINE static Quaternion DecodeRotation( uint16_t const* pData )
-        {
-            Quantization::EncodedQuaternion const encodedQuat( pData[0], pData[1], pData[2] );
-            return encodedQuat.ToQuaternion();
-        }
+        // Runtime-only decoding layout, generated by the loader from the track compression settings
+        // This lets the sampling code skip all static tracks and process the animated ones without any per-track branching
+        //-------------------------------------------------------------------------
 
-        EE_FORCE_INLINE static Vector DecodeTranslation( uint16_t const* pData, TrackCompressionSettings const& settings )
+        struct AnimatedTranslationTrack
         {
-            float const m_x = Quantization::DecodeFloat( pData[0], settings.m_translationRangeX.m_rangeStart, settings.m_translationRangeX.m_rangeLength );
-            float const m_y = Quantization::DecodeFloat( pData[1], settings.m_translationRangeY.m_rangeStart, settings.m_translationRangeY.m_rangeLength );
-            float const m_z = Quantization::DecodeFloat( pData[2], settings.m_translationRangeZ.m_rangeStart, settings.m_translationRangeZ.m_rangeLength );
-            return Vector( m_x, m_y, m_z );
-        }
+            Vector                              m_decodeScale; // Quantization range length / 65535 per component (W = 0)
+            Vector                              m_decodeOffset; // Quantization range start per component (W = 0)
+            uint32_t                            m_dataOffset = 0; // Offset from the start of each compressed pose
+            int32_t                             m_boneIdx = InvalidIndex;
+        };
 
-        EE_FORCE_INLINE static float DecodeScale( uint16_t const* pData, TrackCompressionSettings const& settings )
+        struct AnimatedScaleTrack
         {
-            return Quantization::DecodeFloat( pData[0], settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength );
-        }
+            float                               m_decodeScale = 0.0f;
+            float                               m_decodeOffset = 0.0f;
+            uint32_t                            m_dataOffset = 0; // Offset from the start of each compressed pose
+            int32_t                             m_boneIdx = InvalidIndex;
+        };
+
+        // Decode the animated tracks for the supplied compressed pose(s) into the output transforms, optionally interpolating towards the upper pose in the same pass
+        // If we are not decoding all bones, only the tracks for the bones in the required set are decoded
+        template<bool Interpolate, bool DecodeAllBones>
+        void DecodeAnimatedTracks( uint16_t const* pLowerPose, uint16_t const* pUpperPose, float percentageThrough, BoneSet const* pRequiredBones, Transform* pOutTransforms ) const;
 
     public:
 
@@ -119,6 +130,9 @@ namespace EE::Animation
         inline Skeleton const* GetSkeleton() const { return m_skeleton.GetPtr(); }
         inline int32_t GetNumBones() const { EE_ASSERT( m_skeleton != nullptr ); return m_skeleton->GetNumBones(); }
 
+        // A runtime-only ID that is unique for each loaded clip (zero is invalid), used to key any cached data for this clip
+        inline uint32_t GetInstanceID() const { return m_instanceID; }
+
         // Animation Info
         //-------------------------------------------------------------------------
 
@@ -137,8 +151,17 @@ namespace EE::Animation
         // Pose
         //-------------------------------------------------------------------------
 
-        void GetPose( FrameTime const& frameTime, Pose* pOutPose ) const;
-        inline void GetPose( Percentage percentageThrough, Pose* pOutPose ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose ); }
+        // Sample the pose at the specified time, optionally only decoding the tracks for the required bones
+        // Bones that are not required are left at the reference pose (or the zero pose for additive animations)
+        void GetPose( FrameTime const& frameTime, Pose* pOutPose, BoneSet const* pRequiredBones = nullptr ) const;
+        inline void GetPose( Percentage percentageThrough, Pose* pOutPose, BoneSet const* pRequiredBones = nullptr ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose, pRequiredBones ); }
+
+        // Sample the pose at the specified time using the decoded key frames in the supplied cache, so we only need to interpolate between the two frames
+        // Bones that are not required are left at the reference pose, exactly like the uncached version so using the cache never changes the result
+        void GetPose( FrameTime const& frameTime, Pose* pOutPose, ClipFrameCache& frameCache, BoneSet const* pRequiredBones = nullptr ) const;
+
+        // Decode all the bones for a single key frame into the supplied transforms (there must be enough space for all the bones)
+        void DecodeFrame( uint32_t frameIdx, Transform* pOutTransforms ) const;
 
         // Events
         //-------------------------------------------------------------------------
@@ -147,13 +170,13 @@ namespace EE::Animation
         inline TVector<Event*> const& GetEvents() const { return m_events; }
 
         // Get all the events for the specified range. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
-        inline void GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const;
+        inline void GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineScratchVector<Event const*, 10>& outEvents ) const;
 
         // Get all the events for the specified range. This function will append the results to the output array. DOES NOT SUPPORT LOOPING!
-        inline void GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const;
+        inline void GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineScratchVector<Event const*, 10>& outEvents ) const;
 
         // Helper function that converts percentage times to actual anim times
-        EE_FORCE_INLINE void GetEventsForRange( Percentage fromTime, Percentage toTime, TInlineVector<Event const*, 10>& outEvents ) const
+        EE_FORCE_INLINE void GetEventsForRange( Percentage fromTime, Percentage toTime, TInlineScratchVector<Event const*, 10>& outEvents ) const
         {
             EE_ASSERT( fromTime >= 0.0f && fromTime <= 1.0f );
             EE_ASSERT( toTime >= 0.0f && toTime <= 1.0f );
@@ -198,13 +221,21 @@ namespace EE::Animation
         TResourcePtr<Skeleton>                  m_skeleton;
         uint32_t                                m_numFrames = 0;
         Seconds                                 m_duration = 0.0f;
-        TVector<uint16_t>                       m_compressedPoseData2;
+        TMappedArray<uint16_t>                  m_compressedPoseData2; // Referenced in-place when loaded from a memory mapped file
         TVector<TrackCompressionSettings>       m_trackCompressionSettings;
         TVector<uint32_t>                       m_compressedPoseOffsets;
         TVector<Event*>                         m_events;
         SyncTrack                               m_syncTrack;
         RootMotionData                          m_rootMotion;
         bool                                    m_isAdditive = false;
+
+        uint32_t                                m_instanceID = 0; // Runtime-only, assigned by the loader
+
+        // Decoding layout (not serialized)
+        TVector<Transform>                      m_staticTrackPose; // All static track values, animated tracks hold the reference pose and are overwritten when sampling
+        TVector<int32_t>                        m_animatedRotationBoneIndices; // Rotations are stored contiguously at the start of each compressed pose
+        TVector<AnimatedTranslationTrack>       m_animatedTranslationTracks;
+        TVector<AnimatedScaleTrack>             m_animatedScaleTracks;
     };
 }
 
@@ -215,7 +246,7 @@ namespace EE::Animation
 
 namespace EE::Animation
 {
-    inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
+    inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineScratchVector<Event const*, 10>& outEvents ) const
     {
         EE_ASSERT( toTime >= fromTime );
 
@@ -234,7 +265,7 @@ namespace EE::Animation
         }
     }
 
-    EE_FORCE_INLINE void AnimationClip::GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
+    EE_FORCE_INLINE void AnimationClip::GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineScratchVector<Event const*, 10>& outEvents ) const
     {
         if ( fromTime <= toTime )
         {
@@ -0,0 +1,241 @@
+#include "AnimationClipFrameCache.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    ClipFrameCache::ClipFrameCache( size_t memoryBudget )
+        : m_shardMemoryBudget( memoryBudget / s_numShards )
+    {
+        EE_ASSERT( memoryBudget > 0 );
+    }
+
+    ClipFrameCache::~ClipFrameCache()
+    {
+        Clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    size_t ClipFrameCache::GetFrameMemorySize( int32_t numTransforms )
+    {
+        size_t const headerSize = ( sizeof( CachedFrame ) + s_frameAlignment - 1 ) & ~( s_frameAlignment - 1 );
+        return headerSize + sizeof( Transform ) * numTransforms;
+    }
+
+    ClipFrameCache::CachedFrame* ClipFrameCache::CreateFrame( int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms > 0 );
+
+        // The header and the transforms are stored in a single allocation
+        size_t const memorySize = GetFrameMemorySize( numTransforms );
+        uint8_t* pMemory = reinterpret_cast<uint8_t*>( EE::Alloc( memorySize, s_frameAlignment ) );
+
+        CachedFrame* pFrame = new ( pMemory ) CachedFrame();
+        pFrame->m_pTransforms = reinterpret_cast<Transform*>( pMemory + memorySize - sizeof( Transform ) * numTransforms );
+        pFrame->m_numTransforms = numTransforms;
+        return pFrame;
+    }
+
+    void ClipFrameCache::DestroyFrame( CachedFrame* pFrame )
+    {
+        EE_ASSERT( pFrame != nullptr && pFrame->m_numUsers == 0 );
+        pFrame->~CachedFrame();
+        EE::Free( (void*&) pFrame );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ClipFrameCache::LinkAsMostRecentlyUsed( Shard& shard, CachedFrame* pFrame )
+    {
+        pFrame->m_pPrev = nullptr;
+        pFrame->m_pNext = shard.m_pMostRecentlyUsed;
+
+        if ( shard.m_pMostRecentlyUsed != nullptr )
+        {
+            shard.m_pMostRecentlyUsed->m_pPrev = pFrame;
+        }
+        else
+        {
+            shard.m_pLeastRecentlyUsed = pFrame;
+        }
+
+        shard.m_pMostRecentlyUsed = pFrame;
+    }
+
+    void ClipFrameCache::Unlink( Shard& shard, CachedFrame* pFrame )
+    {
+        if ( pFrame->m_pPrev != nullptr )
+        {
+            pFrame->m_pPrev->m_pNext = pFrame->m_pNext;
+        }
+        else
+        {
+            shard.m_pMostRecentlyUsed = pFrame->m_pNext;
+        }
+
+        if ( pFrame->m_pNext != nullptr )
+        {
+            pFrame->m_pNext->m_pPrev = pFrame->m_pPrev;
+        }
+        else
+        {
+            shard.m_pLeastRecentlyUsed = pFrame->m_pPrev;
+        }
+
+        pFrame->m_pPrev = pFrame->m_pNext = nullptr;
+    }
+
+    ClipFrameCache::CachedFrame* ClipFrameCache::EvictFrames( Shard& shard, int32_t numTransformsRequired )
+    {
+        size_t const requiredMemorySize = GetFrameMemorySize( numTransformsRequired );
+        CachedFrame* pReusableFrame = nullptr;
+
+        CachedFrame* pCandidate = shard.m_pLeastRecentlyUsed;
+        while ( pCandidate != nullptr && ( shard.m_memoryUsed + requiredMemorySize ) > m_shardMemoryBudget )
+        {
+            CachedFrame* pNextCandidate = pCandidate->m_pPrev;
+
+            // Frames that are in use can't be evicted, so we may temporarily exceed the budget
+            if ( pCandidate->m_numUsers == 0 )
+            {
+                Unlink( shard, pCandidate );
+                shard.m_frames.erase( pCandidate->m_key );
+                shard.m_memoryUsed -= GetFrameMemorySize( pCandidate->m_numTransforms );
+                shard.m_numEvictions++;
+
+                if ( pReusableFrame == nullptr && pCandidate->m_numTransforms == numTransformsRequired )
+                {
+                    pReusableFrame = pCandidate;
+                }
+                else
+                {
+                    DestroyFrame( pCandidate );
+                }
+            }
+
+            pCandidate = pNextCandidate;
+        }
+
+        return pReusableFrame;
+    }
+
+    //-------------------------------------------------------------------------
+
+    ClipFrameCache::CachedFrame const* ClipFrameCache::AcquireFrame( AnimationClip const* pClip, uint32_t frameIdx )
+    {
+        EE_ASSERT( pClip != nullptr && pClip->IsValid() && pClip->GetInstanceID() != 0 );
+        EE_ASSERT( frameIdx < pClip->GetNumFrames() );
+
+        uint64_t const key = ( uint64_t( pClip->GetInstanceID() ) << 32 ) | frameIdx;
+        Shard& shard = GetShard( key );
+        Threading::ScopeLock lock( shard.m_mutex );
+
+        // Hit
+        //-------------------------------------------------------------------------
+
+        auto foundIter = shard.m_frames.find( key );
+        if ( foundIter != shard.m_frames.end() )
+        {
+            CachedFrame* pFrame = foundIter->second;
+            if ( pFrame != shard.m_pMostRecentlyUsed )
+            {
+                Unlink( shard, pFrame );
+                LinkAsMostRecentlyUsed( shard, pFrame );
+            }
+
+            pFrame->m_numUsers++;
+            shard.m_numHits++;
+            return pFrame;
+        }
+
+        // Miss
+        //-------------------------------------------------------------------------
+        // We decode while holding the shard lock, so that other threads requesting the same frame wait for this decode rather than duplicating it
+
+        EE_PROFILE_SCOPE_ANIMATION( "Frame Cache Decode" );
+
+        int32_t const numBones = pClip->GetNumBones();
+        CachedFrame* pFrame = EvictFrames( shard, numBones );
+        if ( pFrame == nullptr )
+        {
+            pFrame = CreateFrame( numBones );
+        }
+
+        pClip->DecodeFrame( frameIdx, pFrame->m_pTransforms );
+
+        pFrame->m_key = key;
+        pFrame->m_numUsers = 1;
+        LinkAsMostRecentlyUsed( shard, pFrame );
+        shard.m_frames.insert( { key, pFrame } );
+        shard.m_memoryUsed += GetFrameMemorySize( numBones );
+        shard.m_numMisses++;
+
+        return pFrame;
+    }
+
+    void ClipFrameCache::ReleaseFrame( CachedFrame const* pFrame )
+    {
+        EE_ASSERT( pFrame != nullptr );
+
+        Shard& shard = GetShard( pFrame->m_key );
+        Threading::ScopeLock lock( shard.m_mutex );
+
+        EE_ASSERT( pFrame->m_numUsers > 0 );
+        const_cast<CachedFrame*>( pFrame )->m_numUsers--;
+    }
+
+    void ClipFrameCache::Clear()
+    {
+        for ( Shard& shard : m_shards )
+        {
+            Threading::ScopeLock lock( shard.m_mutex );
+
+            CachedFrame* pFrame = shard.m_pMostRecentlyUsed;
+            while ( pFrame != nullptr )
+            {
+                CachedFrame* pNextFrame = pFrame->m_pNext;
+                DestroyFrame( pFrame );
+                pFrame = pNextFrame;
+            }
+
+            shard.m_frames.clear();
+            shard.m_pMostRecentlyUsed = nullptr;
+            shard.m_pLeastRecentlyUsed = nullptr;
+            shard.m_memoryUsed = 0;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    ClipFrameCache::Stats ClipFrameCache::GetStats() const
+    {
+        Stats stats;
+        stats.m_memoryBudget = GetMemoryBudget();
+
+        for ( Shard const& shard : m_shards )
+        {
+            Threading::ScopeLock lock( shard.m_mutex );
+            stats.m_numHits += shard.m_numHits;
+            stats.m_numMisses += shard.m_numMisses;
+            stats.m_numEvictions += shard.m_numEvictions;
+            stats.m_memoryUsed += shard.m_memoryUsed;
+            stats.m_numCachedFrames += (int32_t) shard.m_frames.size();
+        }
+
+        return stats;
+    }
+
+    void ClipFrameCache::ResetStats()
+    {
+        for ( Shard& shard : m_shards )
+        {
+            Threading::ScopeLock lock( shard.m_mutex );
+            shard.m_numHits = 0;
+            shard.m_numMisses = 0;
+            shard.m_numEvictions = 0;
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Transform.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    class AnimationClip;
+
+    //-------------------------------------------------------------------------
+    // Clip Frame Cache
+    //-------------------------------------------------------------------------
+    // A bounded LRU cache of decoded key frames (all bones), keyed by clip and frame index
+    // When many characters play the same clips, each key frame only needs to be decoded once and sampling is reduced to interpolating two cached frames
+    // The cache is split into shards (by key) each with its own lock and memory budget, so that it can be shared by all characters during the parallel update
+
+    class EE_ENGINE_API ClipFrameCache
+    {
+        constexpr static int32_t const s_numShards = 16;
+        constexpr static size_t const s_frameAlignment = 16;
+
+    public:
+
+        constexpr static size_t const s_defaultMemoryBudget = 8 * 1024 * 1024;
+
+        // A decoded key frame, this is only valid between the acquire and release calls
+        struct CachedFrame
+        {
+            friend class ClipFrameCache;
+
+        public:
+
+            inline Transform const* GetTransforms() const { return m_pTransforms; }
+            inline int32_t GetNumTransforms() const { return m_numTransforms; }
+
+        private:
+
+            uint64_t                                m_key = 0;
+            CachedFrame*                            m_pPrev = nullptr; // More recently used
+            CachedFrame*                            m_pNext = nullptr; // Less recently used
+            Transform*                              m_pTransforms = nullptr;
+            int32_t                                 m_numTransforms = 0;
+            int32_t                                 m_numUsers = 0;
+        };
+
+        struct Stats
+        {
+            inline float GetHitRate() const
+            {
+                uint64_t const numRequests = m_numHits + m_numMisses;
+                return ( numRequests > 0 ) ? float( m_numHits ) / numRequests : 0.0f;
+            }
+
+        public:
+
+            uint64_t                                m_numHits = 0;
+            uint64_t                                m_numMisses = 0;
+            uint64_t                                m_numEvictions = 0;
+            size_t                                  m_memoryUsed = 0;
+            size_t                                  m_memoryBudget = 0;
+            int32_t                                 m_numCachedFrames = 0;
+        };
+
+    private:
+
+        struct Shard
+        {
+            mutable Threading::Mutex                m_mutex;
+            THashMap<uint64_t, CachedFrame*>        m_frames;
+            CachedFrame*                            m_pMostRecentlyUsed = nullptr;
+            CachedFrame*                            m_pLeastRecentlyUsed = nullptr;
+            size_t                                  m_memoryUsed = 0;
+            uint64_t                                m_numHits = 0;
+            uint64_t                                m_numMisses = 0;
+            uint64_t                                m_numEvictions = 0;
+        };
+
+    public:
+
+        ClipFrameCache( size_t memoryBudget = s_defaultMemoryBudget );
+        ~ClipFrameCache();
+
+        // Get the decoded transforms for the specified key frame, decoding it on a miss
+        // The returned frame will not be evicted until it is released, so keep the time between these calls short
+        CachedFrame const* AcquireFrame( AnimationClip const* pClip, uint32_t frameIdx );
+        void ReleaseFrame( CachedFrame const* pFrame );
+
+        // Free all cached frames, none of the frames may be in use
+        void Clear();
+
+        inline size_t GetMemoryBudget() const { return m_shardMemoryBudget * s_numShards; }
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        Stats GetStats() const;
+        void ResetStats();
+
+    private:
+
+        inline Shard& GetShard( uint64_t key )
+        {
+            // Mix the key so that consecutive frames of the same clip are spread across the shards
+            return m_shards[( ( key * 0x9E3779B97F4A7C15ull ) >> 60 ) % s_numShards];
+        }
+
+        static size_t GetFrameMemorySize( int32_t numTransforms );
+        static CachedFrame* CreateFrame( int32_t numTransforms );
+        static void DestroyFrame( CachedFrame* pFrame );
+
+        static void LinkAsMostRecentlyUsed( Shard& shard, CachedFrame* pFrame );
+        static void Unlink( Shard& shard, CachedFrame* pFrame );
+
+        // Evict unused frames until the frame fits in the budget, returns an evicted frame of the same size (if any) so its memory can be reused
+        CachedFrame* EvictFrames( Shard& shard, int32_t numTransformsRequired );
+
+    private:
+
+        TArray<Shard, s_numShards>                  m_shards;
+        size_t                                      m_shardMemoryBudget = 0;
+    };
+}
@@ -7,50 +7,132 @@ namespace EE::Animation
 {
     Pose::Pose( Skeleton const* pSkeleton, Type initialState )
         : m_pSkeleton( pSkeleton )
-        , m_localTransforms( pSkeleton->GetNumBones() )
     {
         EE_ASSERT( pSkeleton != nullptr );
+        AllocateMemory();
         Reset( initialState );
     }
 
+    Pose::Pose( Skeleton const* pSkeleton, Transform* pMemory, Type initialState )
+        : m_pSkeleton( pSkeleton )
+        , m_pLocalTransforms( pMemory )
+        , m_pGlobalTransforms( pMemory + pSkeleton->GetNumBones() )
+        , m_dirtyBones( pSkeleton->GetNumBones() )
+    {
+        EE_ASSERT( pSkeleton != nullptr && pMemory != nullptr );
+        EE_ASSERT( Memory::IsAligned( pMemory ) );
+        Reset( initialState );
+    }
+
+    Pose::~Pose()
+    {
+        FreeMemory();
+    }
+
     Pose::Pose( Pose&& rhs )
     {
         EE_ASSERT( rhs.m_pSkeleton != nullptr );
-        operator=( eastl::move( rhs ) );
+
+        // Take ownership of the rhs memory, for externally owned memory we simply take over the reference
+        m_pSkeleton = rhs.m_pSkeleton;
+        m_pLocalTransforms = rhs.m_pLocalTransforms;
+        m_pGlobalTransforms = rhs.m_pGlobalTransforms;
+        m_dirtyBones = eastl::move( rhs.m_dirtyBones );
+        m_state = rhs.m_state;
+        m_hasGlobalTransforms = rhs.m_hasGlobalTransforms;
+        m_hasDirtyBones = rhs.m_hasDirtyBones;
+        m_ownsMemory = rhs.m_ownsMemory;
+
+        rhs.m_pLocalTransforms = nullptr;
+        rhs.m_pGlobalTransforms = nullptr;
+        rhs.m_hasGlobalTransforms = false;
+        rhs.m_hasDirtyBones = false;
+        rhs.m_ownsMemory = false;
     }
 
     Pose::Pose( Pose const& rhs )
+        : m_pSkeleton( rhs.m_pSkeleton )
     {
         EE_ASSERT( rhs.m_pSkeleton != nullptr );
-        operator=( rhs );
+        AllocateMemory();
+        CopyFrom( rhs );
     }
 
     Pose& Pose::operator=( Pose&& rhs )
     {
-        m_pSkeleton = rhs.m_pSkeleton;
-        m_localTransforms.swap( rhs.m_localTransforms );
-        m_globalTransforms.swap( rhs.m_globalTransforms );
-        m_state = rhs.m_state;
+        // We can only swap the memory if both poses own it, poses using external memory always copy the transforms
+        if ( m_ownsMemory && rhs.m_ownsMemory )
+        {
+            m_pSkeleton = rhs.m_pSkeleton;
+            eastl::swap( m_pLocalTransforms, rhs.m_pLocalTransforms );
+            eastl::swap( m_pGlobalTransforms, rhs.m_pGlobalTransforms );
+            m_dirtyBones = eastl::move( rhs.m_dirtyBones );
+            m_state = rhs.m_state;
+            m_hasGlobalTransforms = rhs.m_hasGlobalTransforms;
+            m_hasDirtyBones = rhs.m_hasDirtyBones;
+        }
+        else
+        {
+            CopyFrom( rhs );
+        }
 
         return *this;
     }
 
     Pose& Pose::operator=( Pose const& rhs )
     {
-        m_pSkeleton = rhs.m_pSkeleton;
-        m_localTransforms = rhs.m_localTransforms;
-        m_globalTransforms = rhs.m_globalTransforms;
-        m_state = rhs.m_state;
-
+        CopyFrom( rhs );
         return *this;
     }
 
     void Pose::CopyFrom( Pose const& rhs )
     {
+        EE_ASSERT( rhs.m_pSkeleton != nullptr && rhs.m_pLocalTransforms != nullptr );
+
+        int32_t const numBones = rhs.m_pSkeleton->GetNumBones();
+        if ( m_pLocalTransforms == nullptr || m_pSkeleton->GetNumBones() != numBones )
+        {
+            // Poses using external memory can only copy poses of the same size
+            EE_ASSERT( m_ownsMemory || m_pLocalTransforms == nullptr );
+            m_pSkeleton = rhs.m_pSkeleton;
+            AllocateMemory();
+        }
+
         m_pSkeleton = rhs.m_pSkeleton;
-        m_localTransforms = rhs.m_localTransforms;
-        m_globalTransforms = rhs.m_globalTransforms;
+        memcpy( m_pLocalTransforms, rhs.m_pLocalTransforms, sizeof( Transform ) * numBones );
+
+        if ( rhs.m_hasGlobalTransforms )
+        {
+            memcpy( m_pGlobalTransforms, rhs.m_pGlobalTransforms, sizeof( Transform ) * numBones );
+        }
+
+        m_dirtyBones = rhs.m_dirtyBones;
         m_state = rhs.m_state;
+        m_hasGlobalTransforms = rhs.m_hasGlobalTransforms;
+        m_hasDirtyBones = rhs.m_hasDirtyBones;
+    }
+
+    void Pose::AllocateMemory()
+    {
+        FreeMemory();
+
+        int32_t const numBones = m_pSkeleton->GetNumBones();
+        m_pLocalTransforms = reinterpret_cast<Transform*>( EE::Alloc( GetRequiredMemorySize( m_pSkeleton ), alignof( Transform ) ) );
+        m_pGlobalTransforms = m_pLocalTransforms + numBones;
+        m_dirtyBones.Reset( numBones );
+        m_hasGlobalTransforms = false;
+        m_hasDirtyBones = false;
+        m_ownsMemory = true;
+    }
+
+    void Pose::FreeMemory()
+    {
+        if ( m_ownsMemory )
+        {
+            EE::Free( m_pLocalTransforms );
+            m_pGlobalTransforms = nullptr;
+            m_ownsMemory = false;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -74,43 +156,70 @@ namespace EE::Animation
             default:
             {
                 // Leave memory intact, just change state
+                // Any cached global transforms would be stale once the pose is set again
+                ClearGlobalTransforms();
                 m_state = State::Unset;
             }
             break;
         }
     }
 
-    void Pose::SetToReferencePose( bool setGlobalPose )
+    void Pose::ResetExcludedBonesToReferencePose( BoneSet const& includedBones )
     {
-        m_localTransforms = m_pSkeleton->GetLocalReferencePose();
+        EE_ASSERT( includedBones.GetNumBones() == m_pSkeleton->GetNumBones() );
 
-        if ( setGlobalPose )
+        // Nothing to do for the reference or zero poses, since the excluded bones were never modified
+        if ( m_state != State::Pose )
         {
-            m_globalTransforms = m_pSkeleton->GetGlobalReferencePose();
+            return;
         }
-        else
+
+        TVector<Transform> const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        int32_t const numBones = m_pSkeleton->GetNumBones();
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
         {
-            m_globalTransforms.clear();
+            if ( !includedBones.IsSet( boneIdx ) )
+            {
+                m_pLocalTransforms[boneIdx] = referencePose[boneIdx];
+                MarkBoneAsDirty( boneIdx );
+            }
         }
+    }
 
+    void Pose::SetToReferencePose( bool setGlobalPose )
+    {
+        size_t const transformsSize = sizeof( Transform ) * m_pSkeleton->GetNumBones();
+        memcpy( m_pLocalTransforms, m_pSkeleton->GetLocalReferencePose().data(), transformsSize );
+
+        if ( setGlobalPose )
+        {
+            memcpy( m_pGlobalTransforms, m_pSkeleton->GetGlobalReferencePose().data(), transformsSize );
+        }
+
+        m_hasGlobalTransforms = setGlobalPose;
+
+        m_dirtyBones.ClearAll();
+        m_hasDirtyBones = false;
         m_state = State::ReferencePose;
     }
 
     void Pose::SetToZeroPose( bool setGlobalPose )
     {
         auto const numBones = m_pSkeleton->GetNumBones();
-        m_localTransforms.clear();
-        m_localTransforms.resize( numBones, Transform::Identity );
-
-        if ( setGlobalPose )
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
         {
-            m_globalTransforms = m_localTransforms;
+            m_pLocalTransforms[boneIdx] = Transform::Identity;
         }
-        else
+
+        if ( setGlobalPose )
         {
-            m_globalTransforms.clear();
+            memcpy( m_pGlobalTransforms, m_pLocalTransforms, sizeof( Transform ) * numBones );
         }
 
+        m_hasGlobalTransforms = setGlobalPose;
+
+        m_dirtyBones.ClearAll();
+        m_hasDirtyBones = false;
         m_state = State::ZeroPose;
     }
 
@@ -119,59 +228,164 @@ namespace EE::Animation
     void Pose::CalculateGlobalTransforms()
     {
         int32_t const numBones = m_pSkeleton->GetNumBones();
-        m_globalTransforms.resize( numBones );
 
-        m_globalTransforms[0] = m_localTransforms[0];
-        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        // Full update
+        //-------------------------------------------------------------------------
+
+        if ( !m_hasGlobalTransforms )
+        {
+            m_pGlobalTransforms[0] = m_pLocalTransforms[0];
+            for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+            {
+                int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
+                m_pGlobalTransforms[boneIdx] = m_pLocalTransforms[boneIdx] * m_pGlobalTransforms[parentIdx];
+            }
+
+            m_hasGlobalTransforms = true;
+            return;
+        }
+
+        // Incremental update
+        //-------------------------------------------------------------------------
+        // Parents always precede their children, so a single forward pass will propagate the dirty flags down through each dirty sub-tree
+
+        if ( !m_hasDirtyBones )
+        {
+            return;
+        }
+
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
         {
             int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
-            m_globalTransforms[boneIdx] = m_localTransforms[boneIdx] * m_globalTransforms[parentIdx];
+            if ( !m_dirtyBones.IsSet( boneIdx ) )
+            {
+                if ( parentIdx == InvalidIndex || !m_dirtyBones.IsSet( parentIdx ) )
+                {
+                    continue;
+                }
+
+                m_dirtyBones.Set( boneIdx );
+            }
+
+            m_pGlobalTransforms[boneIdx] = ( parentIdx == InvalidIndex ) ? m_pLocalTransforms[boneIdx] : m_pLocalTransforms[boneIdx] * m_pGlobalTransforms[parentIdx];
         }
+
+        m_dirtyBones.ClearAll();
+        m_hasDirtyBones = false;
     }
 
     Transform Pose::GetGlobalTransform( int32_t boneIdx ) const
     {
-        EE_ASSERT( boneIdx < m_pSkeleton->GetNumBones() );
+        EE_ASSERT( boneIdx >= 0 && boneIdx < m_pSkeleton->GetNumBones() );
 
-        Transform boneGlobalTransform;
-        if ( !m_globalTransforms.empty() )
+        bool const hasGlobalTransforms = m_hasGlobalTransforms;
+        if ( hasGlobalTransforms && !m_hasDirtyBones )
         {
-            boneGlobalTransform = m_globalTransforms[boneIdx];
+            return m_pGlobalTransforms[boneIdx];
         }
-        else
+
+        // Get the bone chain from the bone up to the root
+        // If we have cached global transforms, we only need to recalculate up to the highest dirty bone in the chain
+        auto boneChain = EE_STACK_ARRAY_ALLOC( int32_t, m_pSkeleton->GetNumBones() );
+        int32_t chainLength = 0;
+        int32_t numBonesToCalculate = 0;
+
+        for ( int32_t chainBoneIdx = boneIdx; chainBoneIdx != InvalidIndex; chainBoneIdx = m_pSkeleton->GetParentBoneIndex( chainBoneIdx ) )
+        {
+            boneChain[chainLength++] = chainBoneIdx;
+            if ( !hasGlobalTransforms || m_dirtyBones.IsSet( chainBoneIdx ) )
+            {
+                numBonesToCalculate = chainLength;
+            }
+        }
+
+        if ( numBonesToCalculate == 0 )
+        {
+            return m_pGlobalTransforms[boneIdx];
+        }
+
+        // Calculate the global transforms down the chain, starting from the cached parent transform if we have one
+        int32_t const topBoneIdx = boneChain[numBonesToCalculate - 1];
+        int32_t const topParentIdx = m_pSkeleton->GetParentBoneIndex( topBoneIdx );
+
+        Transform boneGlobalTransform = m_pLocalTransforms[topBoneIdx];
+        if ( hasGlobalTransforms && topParentIdx != InvalidIndex )
         {
-            auto boneParents = EE_STACK_ARRAY_ALLOC( int32_t, m_pSkeleton->GetNumBones() );
-            int32_t nextEntry = 0;
+            boneGlobalTransform = boneGlobalTransform * m_pGlobalTransforms[topParentIdx];
+        }
+
+        for ( int32_t chainIdx = numBonesToCalculate - 2; chainIdx >= 0; chainIdx-- )
+        {
+            boneGlobalTransform = m_pLocalTransforms[boneChain[chainIdx]] * boneGlobalTransform;
+        }
+
+        return boneGlobalTransform;
+    }
+
+    void Pose::GetGlobalTransforms( int32_t const* pBoneIndices, int32_t numBones, Transform* pOutTransforms ) const
+    {
+        EE_ASSERT( numBones >= 0 );
+        EE_ASSERT( numBones == 0 || ( pBoneIndices != nullptr && pOutTransforms != nullptr ) );
 
-            // Get parent list
-            int32_t parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
-            while ( parentIdx != InvalidIndex )
+        bool const hasGlobalTransforms = m_hasGlobalTransforms;
+        if ( hasGlobalTransforms && !m_hasDirtyBones )
+        {
+            for ( int32_t i = 0; i < numBones; i++ )
             {
-                boneParents[nextEntry++] = parentIdx;
-                parentIdx = m_pSkeleton->GetParentBoneIndex( parentIdx );
+                pOutTransforms[i] = m_pGlobalTransforms[pBoneIndices[i]];
             }
+            return;
+        }
+
+        if ( numBones == 1 )
+        {
+            pOutTransforms[0] = GetGlobalTransform( pBoneIndices[0] );
+            return;
+        }
+
+        // Calculate all the required transforms in a single forward pass, so any shared parents are only calculated once
+        //-------------------------------------------------------------------------
 
-            // If we have parents
-            boneGlobalTransform = m_localTransforms[boneIdx];
-            if ( nextEntry > 0 )
+        int32_t const numSkeletonBones = m_pSkeleton->GetNumBones();
+
+        BoneSet requiredBones( numSkeletonBones );
+        for ( int32_t i = 0; i < numBones; i++ )
+        {
+            requiredBones.Set( pBoneIndices[i] );
+        }
+        requiredBones.AddParentBones( m_pSkeleton );
+
+        // Any cached transforms can be reused as long as neither the bone nor any of its parents are dirty
+        BoneSet recalculatedBones( numSkeletonBones );
+        auto globalTransforms = EE_STACK_ARRAY_ALLOC( Transform, numSkeletonBones );
+
+        for ( auto boneIdx = 0; boneIdx < numSkeletonBones; boneIdx++ )
+        {
+            if ( !requiredBones.IsSet( boneIdx ) )
             {
-                // Calculate global transform of parent
-                int32_t arrayIdx = nextEntry - 1;
-                parentIdx = boneParents[arrayIdx--];
-                auto parentGlobalTransform = m_localTransforms[parentIdx];
-                for ( ; arrayIdx >= 0; arrayIdx-- )
+                continue;
+            }
+
+            int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
+            if ( hasGlobalTransforms )
+            {
+                bool const isParentRecalculated = ( parentIdx != InvalidIndex ) && recalculatedBones.IsSet( parentIdx );
+                if ( !isParentRecalculated && !m_dirtyBones.IsSet( boneIdx ) )
                 {
-                    int32_t const nextIdx = boneParents[arrayIdx];
-                    auto const nextTransform = m_localTransforms[nextIdx];
-                    parentGlobalTransform = nextTransform * parentGlobalTransform;
+                    globalTransforms[boneIdx] = m_pGlobalTransforms[boneIdx];
+                    continue;
                 }
 
-                // Calculate global transform of bone
-                boneGlobalTransform = boneGlobalTransform * parentGlobalTransform;
+                recalculatedBones.Set( boneIdx );
             }
+
+            globalTransforms[boneIdx] = ( parentIdx == InvalidIndex ) ? m_pLocalTransforms[boneIdx] : m_pLocalTransforms[boneIdx] * globalTransforms[parentIdx];
         }
 
-        return boneGlobalTransform;
+        for ( int32_t i = 0; i < numBones; i++ )
+        {
+            pOutTransforms[i] = globalTransforms[pBoneIndices[i]];
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -183,7 +397,7 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        auto const numBones = m_localTransforms.size();
+        auto const numBones = m_pSkeleton->GetNumBones();
         if ( numBones > 0 )
         {
             // Calculate bone world transforms
@@ -192,12 +406,12 @@ namespace EE::Animation
             TInlineVector<Transform, 256> worldTransforms;
             worldTransforms.resize( numBones );
 
-            worldTransforms[0] = m_localTransforms[0] * worldTransform;
+            worldTransforms[0] = m_pLocalTransforms[0] * worldTransform;
             for ( auto i = 1; i < numBones; i++ )
             {
                 auto const& parentIdx = parentIndices[i];
                 auto const& parentTransform = worldTransforms[parentIdx];
-                worldTransforms[i] = m_localTransforms[i] * parentTransform;
+                worldTransforms[i] = m_pLocalTransforms[i] * parentTransform;
             }
 
             // Draw bones
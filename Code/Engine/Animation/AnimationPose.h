@@ -47,10 +47,20 @@ namespace EE::Animation
             AdditivePose
         };
 
+    public:
+
+        // Get the memory required to store a pose (local and global transforms) for the specified skeleton
+        inline static size_t GetRequiredMemorySize( Skeleton const* pSkeleton ) { return sizeof( Transform ) * pSkeleton->GetNumBones() * 2; }
+
     public:
 
         Pose( Skeleton const* pSkeleton, Type initialPoseType = Type::ReferencePose );
 
+        // Create a pose that uses externally owned memory for its transforms, the memory needs to be at least 'GetRequiredMemorySize' bytes and must outlive the pose
+        Pose( Skeleton const* pSkeleton, Transform* pMemory, Type initialPoseType = Type::ReferencePose );
+
+        ~Pose();
+
         Pose( Pose&& rhs );
         Pose( Pose const& rhs );
         Pose& operator=( Pose&& rhs );
@@ -69,6 +79,9 @@ namespace EE::Animation
 
         void Reset( Type initState = Type::None, bool calcGlobalPose = false );
 
+        // Reset the local transforms of all bones that are not in the supplied set to the reference pose (e.g. for bones excluded by the current LOD)
+        void ResetExcludedBonesToReferencePose( BoneSet const& includedBones );
+
         inline bool IsPoseSet() const { return m_state != State::Unset; }
         inline bool IsReferencePose() const { return m_state == State::ReferencePose; }
         inline bool IsZeroPose() const { return m_state == State::ZeroPose; }
@@ -77,52 +90,77 @@ namespace EE::Animation
         // Local Transforms
         //-------------------------------------------------------------------------
 
-        TVector<Transform> const& GetTransforms() const { return m_localTransforms; }
+        inline Transform const* GetTransforms() const { return m_pLocalTransforms; }
 
         inline Transform const& GetTransform( int32_t boneIdx ) const
         {
             EE_ASSERT( boneIdx < GetNumBones() );
-            return m_localTransforms[boneIdx];
+            return m_pLocalTransforms[boneIdx];
         }
 
         inline void SetTransform( int32_t boneIdx, Transform const& transform )
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
-            m_localTransforms[boneIdx] = transform;
+            m_pLocalTransforms[boneIdx] = transform;
             MarkAsValidPose();
+            MarkBoneAsDirty( boneIdx );
         }
 
         inline void SetRotation( int32_t boneIdx, Quaternion const& rotation )
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
-            m_localTransforms[boneIdx].SetRotation( rotation );
+            m_pLocalTransforms[boneIdx].SetRotation( rotation );
             MarkAsValidPose();
+            MarkBoneAsDirty( boneIdx );
         }
 
         inline void SetTranslation( int32_t boneIdx, Float3 const& translation )
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
-            m_localTransforms[boneIdx].SetTranslation( translation );
+            m_pLocalTransforms[boneIdx].SetTranslation( translation );
             MarkAsValidPose();
+            MarkBoneAsDirty( boneIdx );
         }
 
         // Set the scale for a given bone, note will change pose state to "Pose" if not already set
         inline void SetScale( int32_t boneIdx, float uniformScale )
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
-            m_localTransforms[boneIdx].SetScale( uniformScale );
+            m_pLocalTransforms[boneIdx].SetScale( uniformScale );
             MarkAsValidPose();
+            MarkBoneAsDirty( boneIdx );
         }
 
         // Global Transform Cache
         //-------------------------------------------------------------------------
+        // Setting individual local transforms only marks those bones as dirty, the cached global transforms of their sub-trees are then updated incrementally
+        // Any bulk pose operations (sampling, blending) invalidate the whole cache
+
+        inline bool HasGlobalTransforms() const { return m_hasGlobalTransforms; }
+        inline void ClearGlobalTransforms() { m_hasGlobalTransforms = false; m_dirtyBones.ClearAll(); m_hasDirtyBones = false; }
+
+        // Have any local transforms been changed since we last calculated the global transforms
+        inline bool HasDirtyGlobalTransforms() const { return m_hasDirtyBones; }
 
-        inline bool HasGlobalTransforms() const { return !m_globalTransforms.empty(); }
-        inline void ClearGlobalTransforms() { m_globalTransforms.clear(); }
-        inline TVector<Transform> const& GetGlobalTransforms() const { return m_globalTransforms; }
+        // Get all the cached global transforms - these are only up to date if there are no dirty bones
+        inline Transform const* GetGlobalTransforms() const { EE_ASSERT( m_hasGlobalTransforms && !m_hasDirtyBones ); return m_pGlobalTransforms; }
+
+        // Calculate the global transforms - if we have a valid cache, only the dirty bones and their children will be recalculated
         void CalculateGlobalTransforms();
+
+        // Get the global transform for a single bone, this will use any valid cached transforms in the bone's parent chain
         Transform GetGlobalTransform( int32_t boneIdx ) const;
 
+        // Get the global transforms for a set of bones, this only calculates each required transform once so prefer this over multiple single bone queries
+        void GetGlobalTransforms( int32_t const* pBoneIndices, int32_t numBones, Transform* pOutTransforms ) const;
+
+        template<eastl_size_t N>
+        inline void GetGlobalTransforms( TInlineVector<int32_t, N> const& boneIndices, TInlineVector<Transform, N>& outTransforms ) const
+        {
+            outTransforms.resize( boneIndices.size() );
+            GetGlobalTransforms( boneIndices.data(), (int32_t) boneIndices.size(), outTransforms.data() );
+        }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -134,6 +172,9 @@ namespace EE::Animation
 
         Pose() = delete;
 
+        void AllocateMemory();
+        void FreeMemory();
+
         void SetToReferencePose( bool setGlobalPose );
         void SetToZeroPose( bool setGlobalPose );
 
@@ -145,11 +186,25 @@ namespace EE::Animation
             }
         }
 
+        // We only need to track dirty bones if we have global transforms to update
+        EE_FORCE_INLINE void MarkBoneAsDirty( int32_t boneIdx )
+        {
+            if ( m_hasGlobalTransforms )
+            {
+                m_dirtyBones.Set( boneIdx );
+                m_hasDirtyBones = true;
+            }
+        }
+
     private:
 
-        Skeleton const*             m_pSkeleton;                // The skeleton for this pose
-        TVector<Transform>          m_localTransforms;          // Parent-space transforms
-        TVector<Transform>          m_globalTransforms;         // Character-space transforms
-        State                       m_state = State::Unset;     // Pose state
+        Skeleton const*             m_pSkeleton;                        // The skeleton for this pose
+        Transform*                  m_pLocalTransforms = nullptr;       // Parent-space transforms
+        Transform*                  m_pGlobalTransforms = nullptr;      // Character-space transforms, only valid if 'm_hasGlobalTransforms' is set
+        BoneSet                     m_dirtyBones;                       // The bones whose local transforms have changed since the global transforms were calculated
+        State                       m_state = State::Unset;             // Pose state
+        bool                        m_hasGlobalTransforms = false;
+        bool                        m_hasDirtyBones = false;
+        bool                        m_ownsMemory = false;               // Did we allocate the transform memory or was it supplied externally
     };
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "AnimationSettings.h"
+#include "Base/IniFile.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    bool AnimationSettings::ReadSettings( IniFile const& ini )
+    {
+        m_lowLODDistance = ini.GetFloatOrDefault( "Animation:LowLODDistance", m_lowLODDistance );
+        if ( m_lowLODDistance <= 0.0f )
+        {
+            EE_LOG_ERROR( "Animation", "Animation Settings", "Invalid low LOD distance: %f", m_lowLODDistance );
+            return false;
+        }
+
+        m_characterBoundsExtents = ini.GetFloatOrDefault( "Animation:CharacterBoundsExtents", m_characterBoundsExtents );
+        if ( m_characterBoundsExtents <= 0.0f )
+        {
+            EE_LOG_ERROR( "Animation", "Animation Settings", "Invalid character bounds extents: %f", m_characterBoundsExtents );
+            return false;
+        }
+
+        return true;
+    }
+}
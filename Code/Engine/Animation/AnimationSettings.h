@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Systems.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class IniFile; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    class EE_ENGINE_API AnimationSettings final : public ISystem
+    {
+    public:
+
+        EE_SYSTEM( AnimationSettings );
+
+    public:
+
+        // All settings are optional, we use the default values if not set
+        bool ReadSettings( IniFile const& ini );
+
+    public:
+
+        float                   m_lowLODDistance = 25.0f;           // Characters further than this from the viewer will use the low skeleton LOD
+        float                   m_characterBoundsExtents = 2.0f;    // Approximate character bounds extents used for the LOD visibility test
+    };
+}
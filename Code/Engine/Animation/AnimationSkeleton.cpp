@@ -7,7 +7,7 @@ namespace EE::Animation
 {
     bool Skeleton::IsValid() const
     {
-        return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() );
+        return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() ) && ( m_boneIDs.size() == m_boneLODs.size() );
     }
 
     Transform Skeleton::GetBoneGlobalTransform( int32_t idx ) const
@@ -66,6 +66,21 @@ namespace EE::Animation
         return isChild;
     }
 
+    int32_t Skeleton::GetClosestBoneIndexInLOD( int32_t boneIdx, LOD lod ) const
+    {
+        EE_ASSERT( IsValidBoneIndex( boneIdx ) );
+
+        // The root is always present in all LODs
+        int32_t closestBoneIdx = boneIdx;
+        while ( !IsBoneInLOD( closestBoneIdx, lod ) )
+        {
+            closestBoneIdx = m_parentIndices[closestBoneIdx];
+            EE_ASSERT( closestBoneIdx != InvalidIndex );
+        }
+
+        return closestBoneIdx;
+    }
+
     int32_t Skeleton::GetBoneMaskIndex( StringID maskID ) const
     {
         int32_t const numMasks = (int32_t) m_boneMasks.size();
@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "AnimationBoneMask.h"
+#include "AnimationBoneSet.h"
 #include "Base/Resource/IResource.h"
 #include "Base/Math/Transform.h"
 #include "Base/Types/BitFlags.h"
@@ -27,11 +28,23 @@ namespace EE::Animation
     class EE_ENGINE_API Skeleton : public Resource::IResource
     {
         EE_RESOURCE( 'skel', "Animation Skeleton" );
-        EE_SERIALIZE( m_boneIDs, m_localReferencePose, m_parentIndices, m_boneFlags );
+        EE_SERIALIZE( m_boneIDs, m_localReferencePose, m_parentIndices, m_boneFlags, m_boneLODs );
 
         friend class SkeletonCompiler;
         friend class SkeletonLoader;
 
+    public:
+
+        // Skeleton level of detail, each lower LOD contains a subset of the bones of the higher LODs
+        // A bone's parent is always present in every LOD that the bone is present in
+        enum class LOD : uint8_t
+        {
+            High = 0,
+            Low,
+
+            NumLODs
+        };
+
     public:
 
         #if EE_DEVELOPMENT_TOOLS
@@ -94,6 +107,28 @@ namespace EE::Animation
 
         Transform GetBoneGlobalTransform( int32_t idx ) const;
 
+        // LOD
+        //-------------------------------------------------------------------------
+
+        // Get the lowest level of detail that still contains the specified bone
+        inline LOD GetBoneLOD( int32_t boneIdx ) const
+        {
+            EE_ASSERT( IsValidBoneIndex( boneIdx ) );
+            return m_boneLODs[boneIdx];
+        }
+
+        // Is the specified bone present at the specified LOD
+        EE_FORCE_INLINE bool IsBoneInLOD( int32_t boneIdx, LOD lod ) const { return GetBoneLOD( boneIdx ) >= lod; }
+
+        // Get the number of bones that are present at the specified LOD
+        inline int32_t GetNumBones( LOD lod ) const { return m_lodBoneSets[(int32_t) lod].GetNumSetBones(); }
+
+        // Get the set of bones that are present at the specified LOD
+        inline BoneSet const& GetLODBoneSet( LOD lod ) const { return m_lodBoneSets[(int32_t) lod]; }
+
+        // Get the index of the closest bone that is present at the specified LOD, i.e. either the bone itself or the closest parent that is present
+        int32_t GetClosestBoneIndexInLOD( int32_t boneIdx, LOD lod ) const;
+
         // Bone Masks
         //-------------------------------------------------------------------------
 
@@ -116,6 +151,8 @@ namespace EE::Animation
         TVector<Transform>                  m_localReferencePose;
         TVector<Transform>                  m_globalReferencePose;
         TVector<TBitFlags<BoneFlags>>       m_boneFlags;
+        TVector<LOD>                        m_boneLODs; // The lowest LOD that each bone is present in
         TVector<BoneMask>                   m_boneMasks;
+        TArray<BoneSet, (size_t) LOD::NumLODs> m_lodBoneSets;
     };
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "Base/Math/Transform.h"
+#include "Base/Math/SIMD.h"
+
+//-------------------------------------------------------------------------
+// Transform Batches
+//-------------------------------------------------------------------------
+// Helpers to process four bones at a time in a structure-of-arrays layout (one register per component, one lane per bone)
+// Poses are stored as arrays of transforms, so batches are transposed into registers when loaded and back out when stored
+
+namespace EE::Animation
+{
+    // Lane-wise coefficients for Quaternion::FastSLerp
+    // When the interpolation parameter is the same for all lanes, these only need to be calculated once per pose
+    struct FastSLerpCoefficients
+    {
+        static constexpr float const s_mu = 1.85298109240830f;
+
+        explicit FastSLerpCoefficients( float t ) : FastSLerpCoefficients( _mm_set1_ps( t ) ) {}
+
+        explicit FastSLerpCoefficients( __m128 t )
+        {
+            static float const u[8] = { 1.f / ( 1 * 3 ), 1.f / ( 2 * 5 ), 1.f / ( 3 * 7 ), 1.f / ( 4 * 9 ), 1.f / ( 5 * 11 ), 1.f / ( 6 * 13 ), 1.f / ( 7 * 15 ), s_mu / ( 8 * 17 ) };
+            static float const v[8] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, s_mu * 8 / 17 };
+
+            __m128 const tSquared = _mm_mul_ps( t, t );
+            for ( int32_t i = 0; i < 8; i++ )
+            {
+                m_terms[i] = _mm_sub_ps( _mm_mul_ps( _mm_set1_ps( u[i] ), tSquared ), _mm_set1_ps( v[i] ) );
+            }
+
+            m_t = t;
+        }
+
+        EE_FORCE_INLINE __m128 Evaluate( __m128 xm1 ) const
+        {
+            __m128 const one = _mm_set1_ps( 1.0f );
+            __m128 c = SIMD::Float::MultiplyAdd( m_terms[7], xm1, one );
+            for ( int32_t i = 6; i >= 0; i-- )
+            {
+                c = SIMD::Float::MultiplyAdd( _mm_mul_ps( m_terms[i], xm1 ), c, one );
+            }
+
+            return _mm_mul_ps( c, m_t );
+        }
+
+    public:
+
+        __m128  m_terms[8];
+        __m128  m_t;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct QuaternionBatch
+    {
+        EE_FORCE_INLINE static QuaternionBatch Select( QuaternionBatch const& a, QuaternionBatch const& b, __m128 control )
+        {
+            QuaternionBatch result;
+            result.m_x = SIMD::Float::Select( a.m_x, b.m_x, control );
+            result.m_y = SIMD::Float::Select( a.m_y, b.m_y, control );
+            result.m_z = SIMD::Float::Select( a.m_z, b.m_z, control );
+            result.m_w = SIMD::Float::Select( a.m_w, b.m_w, control );
+            return result;
+        }
+
+        // Lane-wise version of Quaternion::operator*
+        EE_FORCE_INLINE static QuaternionBatch Multiply( QuaternionBatch const& a, QuaternionBatch const& b )
+        {
+            QuaternionBatch result;
+            result.m_x = _mm_sub_ps( SIMD::Float::MultiplyAdd( b.m_y, a.m_z, SIMD::Float::MultiplyAdd( b.m_x, a.m_w, _mm_mul_ps( b.m_w, a.m_x ) ) ), _mm_mul_ps( b.m_z, a.m_y ) );
+            result.m_y = SIMD::Float::MultiplyAdd( b.m_z, a.m_x, SIMD::Float::MultiplyAdd( b.m_y, a.m_w, _mm_sub_ps( _mm_mul_ps( b.m_w, a.m_y ), _mm_mul_ps( b.m_x, a.m_z ) ) ) );
+            result.m_z = SIMD::Float::MultiplyAdd( b.m_z, a.m_w, _mm_sub_ps( SIMD::Float::MultiplyAdd( b.m_x, a.m_y, _mm_mul_ps( b.m_w, a.m_z ) ), _mm_mul_ps( b.m_y, a.m_x ) ) );
+            result.m_w = _mm_sub_ps( _mm_mul_ps( b.m_w, a.m_w ), SIMD::Float::MultiplyAdd( b.m_z, a.m_z, SIMD::Float::MultiplyAdd( b.m_y, a.m_y, _mm_mul_ps( b.m_x, a.m_x ) ) ) );
+            return result;
+        }
+
+        // Lane-wise version of Quaternion::SLerp
+        EE_FORCE_INLINE static QuaternionBatch SLerp( QuaternionBatch const& from, QuaternionBatch const& to, __m128 t )
+        {
+            __m128 const one = _mm_set1_ps( 1.0f );
+
+            // Ensure that the rotations are in the same direction
+            __m128 cosOmega = SIMD::Float::Dot4( from.m_x, from.m_y, from.m_z, from.m_w, to.m_x, to.m_y, to.m_z, to.m_w );
+            __m128 const sign = _mm_and_ps( _mm_set1_ps( -0.0f ), cosOmega );
+            cosOmega = _mm_xor_ps( sign, cosOmega );
+
+            // Fall back to a linear interpolation for nearly identical rotations
+            __m128 const useSLerp = _mm_cmplt_ps( cosOmega, _mm_set1_ps( 1.0f - 0.00001f ) );
+            __m128 const sinOmega = _mm_sqrt_ps( _mm_sub_ps( one, _mm_mul_ps( cosOmega, cosOmega ) ) );
+            __m128 const omega = Vector::ATan2( sinOmega, cosOmega );
+
+            __m128 const oneMinusT = _mm_sub_ps( one, t );
+            __m128 const s0 = SIMD::Float::Select( oneMinusT, _mm_div_ps( Vector::Sin( _mm_mul_ps( oneMinusT, omega ) ), sinOmega ), useSLerp );
+            __m128 const s1 = _mm_xor_ps( sign, SIMD::Float::Select( t, _mm_div_ps( Vector::Sin( _mm_mul_ps( t, omega ) ), sinOmega ), useSLerp ) );
+
+            QuaternionBatch result;
+            result.m_x = SIMD::Float::MultiplyAdd( s0, from.m_x, _mm_mul_ps( s1, to.m_x ) );
+            result.m_y = SIMD::Float::MultiplyAdd( s0, from.m_y, _mm_mul_ps( s1, to.m_y ) );
+            result.m_z = SIMD::Float::MultiplyAdd( s0, from.m_z, _mm_mul_ps( s1, to.m_z ) );
+            result.m_w = SIMD::Float::MultiplyAdd( s0, from.m_w, _mm_mul_ps( s1, to.m_w ) );
+            return result;
+        }
+
+        // Lane-wise version of Quaternion::FastSLerp
+        EE_FORCE_INLINE static QuaternionBatch FastSLerp( QuaternionBatch const& from, QuaternionBatch const& to, FastSLerpCoefficients const& coefficientsT, FastSLerpCoefficients const& coefficientsOneMinusT )
+        {
+            // Ensure that the rotations are in the same direction
+            __m128 x = SIMD::Float::Dot4( from.m_x, from.m_y, from.m_z, from.m_w, to.m_x, to.m_y, to.m_z, to.m_w );
+            __m128 const sign = _mm_and_ps( _mm_set1_ps( -0.0f ), x );
+            x = _mm_xor_ps( sign, x );
+
+            __m128 const xm1 = _mm_sub_ps( x, _mm_set1_ps( 1.0f ) );
+            __m128 const cT = _mm_xor_ps( sign, coefficientsT.Evaluate( xm1 ) );
+            __m128 const cD = coefficientsOneMinusT.Evaluate( xm1 );
+
+            QuaternionBatch result;
+            result.m_x = SIMD::Float::MultiplyAdd( cD, from.m_x, _mm_mul_ps( cT, to.m_x ) );
+            result.m_y = SIMD::Float::MultiplyAdd( cD, from.m_y, _mm_mul_ps( cT, to.m_y ) );
+            result.m_z = SIMD::Float::MultiplyAdd( cD, from.m_z, _mm_mul_ps( cT, to.m_z ) );
+            result.m_w = SIMD::Float::MultiplyAdd( cD, from.m_w, _mm_mul_ps( cT, to.m_w ) );
+            return result;
+        }
+
+        EE_FORCE_INLINE static QuaternionBatch FastSLerp( QuaternionBatch const& from, QuaternionBatch const& to, __m128 t )
+        {
+            return FastSLerp( from, to, FastSLerpCoefficients( t ), FastSLerpCoefficients( _mm_sub_ps( _mm_set1_ps( 1.0f ), t ) ) );
+        }
+
+    public:
+
+        __m128  m_x;
+        __m128  m_y;
+        __m128  m_z;
+        __m128  m_w;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct TransformBatch
+    {
+        constexpr static int32_t const s_size = 4;
+
+        // Load four consecutive transforms
+        EE_FORCE_INLINE static TransformBatch Load( Transform const* pTransforms )
+        {
+            TransformBatch batch;
+
+            batch.m_rotation.m_x = pTransforms[0].GetRotation();
+            batch.m_rotation.m_y = pTransforms[1].GetRotation();
+            batch.m_rotation.m_z = pTransforms[2].GetRotation();
+            batch.m_rotation.m_w = pTransforms[3].GetRotation();
+            SIMD::Float::Transpose( batch.m_rotation.m_x, batch.m_rotation.m_y, batch.m_rotation.m_z, batch.m_rotation.m_w );
+
+            batch.m_translationX = pTransforms[0].GetTranslationAndScale();
+            batch.m_translationY = pTransforms[1].GetTranslationAndScale();
+            batch.m_translationZ = pTransforms[2].GetTranslationAndScale();
+            batch.m_scale = pTransforms[3].GetTranslationAndScale();
+            SIMD::Float::Transpose( batch.m_translationX, batch.m_translationY, batch.m_translationZ, batch.m_scale );
+
+            return batch;
+        }
+
+        // Store the batch into four consecutive transforms
+        EE_FORCE_INLINE void Store( Transform* pTransforms ) const
+        {
+            __m128 rotations[s_size] = { m_rotation.m_x, m_rotation.m_y, m_rotation.m_z, m_rotation.m_w };
+            SIMD::Float::Transpose( rotations[0], rotations[1], rotations[2], rotations[3] );
+
+            __m128 translationScales[s_size] = { m_translationX, m_translationY, m_translationZ, m_scale };
+            SIMD::Float::Transpose( translationScales[0], translationScales[1], translationScales[2], translationScales[3] );
+
+            for ( int32_t i = 0; i < s_size; i++ )
+            {
+                Transform::DirectlySetRotation( pTransforms[i], Quaternion( Vector( rotations[i] ) ) );
+                Transform::DirectlySetTranslationScale( pTransforms[i], Vector( translationScales[i] ) );
+            }
+        }
+
+        // Returns b for every lane where the control mask is set, a otherwise
+        EE_FORCE_INLINE static TransformBatch Select( TransformBatch const& a, TransformBatch const& b, __m128 control )
+        {
+            TransformBatch result;
+            result.m_rotation = QuaternionBatch::Select( a.m_rotation, b.m_rotation, control );
+            result.m_translationX = SIMD::Float::Select( a.m_translationX, b.m_translationX, control );
+            result.m_translationY = SIMD::Float::Select( a.m_translationY, b.m_translationY, control );
+            result.m_translationZ = SIMD::Float::Select( a.m_translationZ, b.m_translationZ, control );
+            result.m_scale = SIMD::Float::Select( a.m_scale, b.m_scale, control );
+            return result;
+        }
+
+    public:
+
+        QuaternionBatch     m_rotation;
+        __m128              m_translationX;
+        __m128              m_translationY;
+        __m128              m_translationZ;
+        __m128              m_scale;
+    };
+}
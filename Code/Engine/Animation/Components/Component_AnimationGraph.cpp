@@ -67,6 +67,18 @@ namespace EE::Animation
     void GraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform )
     {
         EE_ASSERT( HasGraph() );
+        m_pGraphInstance->SetSkeletonLOD( m_skeletonLOD );
+
+        if ( m_pTaskScheduler != nullptr )
+        {
+            m_pGraphInstance->EnableParallelTaskExecution( m_pTaskScheduler );
+        }
+        else
+        {
+            m_pGraphInstance->DisableParallelTaskExecution();
+        }
+
+        m_pGraphInstance->SetFrameCache( m_pFrameCache );
         m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform );
     }
 
@@ -66,6 +66,24 @@ namespace EE::Animation
         // The function will execute the post-physics tasks (if any)
         void ExecutePostPhysicsTasks();
 
+        // LOD
+        //-------------------------------------------------------------------------
+
+        // Set the skeleton LOD to use for the next pose task execution
+        inline void SetSkeletonLOD( Skeleton::LOD lod ) { m_skeletonLOD = lod; }
+
+        // Get the skeleton LOD used for the pose
+        inline Skeleton::LOD GetSkeletonLOD() const { return m_skeletonLOD; }
+
+        // Set the task scheduler used to execute independent pose task branches in parallel, null means all tasks are executed serially
+        inline void SetTaskScheduler( EE::TaskSystem* pTaskScheduler ) { m_pTaskScheduler = pTaskScheduler; }
+
+        // Set the shared key frame cache used when sampling animations, null means all animations are decoded directly
+        inline void SetFrameCache( ClipFrameCache* pFrameCache ) { m_pFrameCache = pFrameCache; }
+
+        // Get the character world transform that was used for the last pose task execution
+        inline Transform const& GetCharacterWorldTransform() const { EE_ASSERT( m_pGraphInstance != nullptr ); return m_pGraphInstance->GetCharacterWorldTransform(); }
+
         // Control Parameters
         //-------------------------------------------------------------------------
 
@@ -139,6 +157,9 @@ namespace EE::Animation
         Transform                                               m_rootMotionDelta = Transform::Identity;
         EE_REFLECT() bool                                       m_requiresManualUpdate = false; // Does this component require a manual update via a custom entity system?
         EE_REFLECT() bool                                       m_applyRootMotionToEntity = false; // Should we apply the root motion delta automatically to the character once we evaluate the graph. (Note: only works if we dont require a manual update)
+        Skeleton::LOD                                           m_skeletonLOD = Skeleton::LOD::High;
+        EE::TaskSystem*                                         m_pTaskScheduler = nullptr;
+        ClipFrameCache*                                         m_pFrameCache = nullptr;
         bool                                                    m_graphStateResetRequested = false;
     };
 }
\ No newline at end of file
@@ -160,6 +160,10 @@ namespace EE::Animation
             return;
         }
 
+        PoseBufferPool const& posePool = pTaskSystem->m_posePool;
+        ImGui::Text( "Pose Buffers: %d, Cached Pose Buffers: %d, Memory: %.2fKB", posePool.GetNumPoseBuffers(), posePool.GetNumCachedPoseBuffers(), posePool.GetAllocatedMemorySize() / 1024.0f );
+        ImGui::TextColored( posePool.GetNumAllocationsSinceReset() > 0 ? Colors::Red.ToFloat4() : Colors::Lime.ToFloat4(), "Pose Buffer Allocations This Update: %d", posePool.GetNumAllocationsSinceReset() );
+
         if ( !pTaskSystem->HasTasks() )
         {
             ImGui::Text( "No Active Tasks" );
@@ -508,6 +512,25 @@ namespace EE::Animation
 
     void AnimationDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
+        ImGuiX::TextSeparator( "Frame Cache" );
+        {
+            bool isFrameCacheEnabled = m_pAnimationWorldSystem->IsFrameCacheEnabled();
+            if ( ImGui::Checkbox( "Enable Shared Frame Cache", &isFrameCacheEnabled ) )
+            {
+                m_pAnimationWorldSystem->SetFrameCacheEnabled( isFrameCacheEnabled );
+            }
+
+            if ( isFrameCacheEnabled )
+            {
+                ClipFrameCache::Stats const stats = m_pAnimationWorldSystem->GetFrameCacheStats();
+                ImGui::Text( "Hit Rate: %.1f%% (Hits: %llu, Misses: %llu)", stats.GetHitRate() * 100, stats.m_numHits, stats.m_numMisses );
+                ImGui::Text( "Cached Frames: %d, Evictions: %llu", stats.m_numCachedFrames, stats.m_numEvictions );
+                ImGui::Text( "Memory: %.2fKB / %.2fKB", stats.m_memoryUsed / 1024.0f, stats.m_memoryBudget / 1024.0f );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
         InlineString componentName;
         for ( GraphComponent* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
         {
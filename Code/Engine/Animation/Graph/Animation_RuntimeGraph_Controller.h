@@ -33,7 +33,9 @@ namespace EE::Animation
 
             public:
 
-                ControlParameter( char const* parameterName ) : m_ID( parameterName ) {}
+                // Parameter names are always literals, so the IDs are calculated at compile time
+                template<size_t N>
+                ControlParameter( char const ( &parameterName )[N] ) : m_ID( StringID::FromLiteral( parameterName ) ) {}
 
                 inline bool IsBound() const { return m_index != InvalidIndex; }
 
@@ -3,13 +3,13 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Animation/AnimationSkeleton.h"
 #include "Base/Resource/ResourcePtr.h"
-#include "Base/Types/HashMap.h"
+#include "Base/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
-    using ResourceLUT = THashMap<uint32_t, Resource::ResourcePtr>;
+    using ResourceLUT = TFlatHashMap<uint32_t, Resource::ResourcePtr>;
 
     //-------------------------------------------------------------------------
 
@@ -10,7 +10,7 @@ namespace EE::Animation
     class EE_ENGINE_API GraphDefinition final : public Resource::IResource
     {
         EE_RESOURCE( 'ag', "Animation Graph" );
-        EE_SERIALIZE( m_persistentNodeIndices, m_instanceNodeStartOffsets, m_instanceRequiredMemory, m_instanceRequiredAlignment, m_rootNodeIdx, m_controlParameterIDs, m_virtualParameterIDs, m_virtualParameterNodeIndices, m_childGraphSlots, m_externalGraphSlots );
+        EE_SERIALIZE( m_persistentNodeIndices, m_instanceNodeStartOffsets, m_instanceRequiredMemory, m_instanceRequiredAlignment, m_rootNodeIdx, m_numRequiredPoseBuffers, m_numRequiredCachedPoseBuffers, m_controlParameterIDs, m_virtualParameterIDs, m_virtualParameterNodeIndices, m_childGraphSlots, m_externalGraphSlots );
 
         friend class GraphDefinitionCompiler;
         friend class AnimationGraphCompiler;
@@ -56,6 +56,8 @@ namespace EE::Animation
         uint32_t                                    m_instanceRequiredMemory = 0;
         uint32_t                                    m_instanceRequiredAlignment = 0;
         int16_t                                     m_rootNodeIdx = InvalidIndex;
+        int16_t                                     m_numRequiredPoseBuffers = 0;       // The peak number of simultaneously used pose buffers, excluding any child graphs
+        int16_t                                     m_numRequiredCachedPoseBuffers = 0; // The peak number of simultaneously used cached pose buffers, excluding any child graphs
         TVector<StringID>                           m_controlParameterIDs;
         TVector<StringID>                           m_virtualParameterIDs;
         TVector<int16_t>                            m_virtualParameterNodeIndices;
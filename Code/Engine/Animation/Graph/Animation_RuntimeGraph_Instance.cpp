@@ -120,6 +120,16 @@ namespace EE::Animation
         // Set root node
         m_pRootNode = reinterpret_cast<PoseNode*>( m_nodes[pGraphDef->m_rootNodeIdx] );
         EE_ASSERT( !m_pRootNode->IsInitialized() );
+
+        // Size the pose buffer pool for the whole graph hierarchy, so that we dont need to allocate any buffers during updates
+        if ( isStandaloneGraphInstance )
+        {
+            int32_t numPoseBuffers = 0;
+            int32_t numCachedPoseBuffers = 0;
+            CalculateRequiredPoseBuffers( numPoseBuffers, numCachedPoseBuffers );
+
+            m_pTaskSystem->ReservePoseBuffers( numPoseBuffers, numCachedPoseBuffers );
+        }
     }
 
     GraphInstance::~GraphInstance()
@@ -191,6 +201,21 @@ namespace EE::Animation
         return m_pTaskSystem->RequiresUpdate();
     }
 
+    void GraphInstance::SetSkeletonLOD( Skeleton::LOD lod )
+    {
+        m_pTaskSystem->SetSkeletonLOD( lod );
+    }
+
+    Skeleton::LOD GraphInstance::GetSkeletonLOD() const
+    {
+        return m_pTaskSystem->GetSkeletonLOD();
+    }
+
+    Transform const& GraphInstance::GetCharacterWorldTransform() const
+    {
+        return m_pTaskSystem->GetCharacterWorldTransform();
+    }
+
     void GraphInstance::EnableTaskSystemSerialization( TypeSystem::TypeRegistry const& typeRegistry )
     {
         m_pTaskSystem->EnableSerialization( typeRegistry );
@@ -201,6 +226,21 @@ namespace EE::Animation
         m_pTaskSystem->DisableSerialization();
     }
 
+    void GraphInstance::EnableParallelTaskExecution( EE::TaskSystem* pTaskScheduler )
+    {
+        m_pTaskSystem->EnableParallelExecution( pTaskScheduler );
+    }
+
+    void GraphInstance::DisableParallelTaskExecution()
+    {
+        m_pTaskSystem->DisableParallelExecution();
+    }
+
+    void GraphInstance::SetFrameCache( ClipFrameCache* pFrameCache )
+    {
+        m_pTaskSystem->SetFrameCache( pFrameCache );
+    }
+
     void GraphInstance::SerializeTaskList( Blob& outBlob ) const
     {
         EE_ASSERT( !DoesTaskSystemNeedUpdate() );
@@ -260,6 +300,22 @@ namespace EE::Animation
         return InvalidIndex;
     }
 
+    void GraphInstance::CalculateRequiredPoseBuffers( int32_t& numPoseBuffers, int32_t& numCachedPoseBuffers ) const
+    {
+        // The peak usage is calculated when compiling the graph, child graphs are conservatively assumed to reach their peaks at the same time as their parent
+        auto pGraphDef = m_pGraphVariation->m_pGraphDefinition.GetPtr();
+        numPoseBuffers += pGraphDef->m_numRequiredPoseBuffers;
+        numCachedPoseBuffers += pGraphDef->m_numRequiredCachedPoseBuffers;
+
+        for ( auto const& childGraph : m_childGraphs )
+        {
+            if ( childGraph.m_pInstance != nullptr )
+            {
+                childGraph.m_pInstance->CalculateRequiredPoseBuffers( numPoseBuffers, numCachedPoseBuffers );
+            }
+        }
+    }
+
     GraphInstance* GraphInstance::ConnectExternalGraph( StringID slotID, GraphVariation const* pExternalGraphVariation )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Graph Instance - Connect External Graph" );
@@ -6,6 +6,11 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::Physics
 {
     class PhysicsWorld;
@@ -17,6 +22,7 @@ namespace EE::Animation
 {
     class GraphContext;
     class TaskSystem;
+    class ClipFrameCache;
     class GraphNode;
     class PoseNode;
     enum class TaskSystemDebugMode;
@@ -94,9 +100,27 @@ namespace EE::Animation
         // Disable task serialization
         void DisableTaskSystemSerialization();
 
+        // Enable parallel execution of independent pose task branches using the supplied task scheduler
+        void EnableParallelTaskExecution( EE::TaskSystem* pTaskScheduler );
+
+        // Disable parallel task execution
+        void DisableParallelTaskExecution();
+
+        // Set the shared key frame cache used when sampling animations (null to decode directly from the clips)
+        void SetFrameCache( ClipFrameCache* pFrameCache );
+
         // Does the task system have any pending pose tasks
         bool DoesTaskSystemNeedUpdate() const;
 
+        // Set the skeleton LOD that the task system should calculate the pose for
+        void SetSkeletonLOD( Skeleton::LOD lod );
+
+        // Get the skeleton LOD that the task system is calculating the pose for
+        Skeleton::LOD GetSkeletonLOD() const;
+
+        // Get the character world transform that was used for the last task system execution
+        Transform const& GetCharacterWorldTransform() const;
+
         // Serialize the currently registered pose tasks. Note: This can only be done after the task system has executed!
         void SerializeTaskList( Blob& outBlob ) const;
 
@@ -332,6 +356,9 @@ namespace EE::Animation
         int16_t GetExternalGraphNodeIndex( StringID slotID ) const;
         int32_t GetConnectedExternalGraphIndex( StringID slotID ) const;
 
+        // Calculate the peak number of pose buffers needed to evaluate this graph and all its child graphs
+        void CalculateRequiredPoseBuffers( int32_t& numPoseBuffers, int32_t& numCachedPoseBuffers ) const;
+
         GraphInstance( GraphInstance const& ) = delete;
         GraphInstance( GraphInstance&& ) = delete;
         GraphInstance& operator=( GraphInstance const& ) = delete;
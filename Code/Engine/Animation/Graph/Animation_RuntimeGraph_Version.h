@@ -5,5 +5,5 @@
 namespace EE::Animation
 {
     // This version needs to be bumped each time we change the layout of a runtime or tools node
-    static constexpr int const g_graphDataVersion = 21;
+    static constexpr int const g_graphDataVersion = 22;
 }
\ No newline at end of file
@@ -195,37 +195,40 @@ namespace EE::Animation::GraphNodes
         Percentage actualAnimationSampleStartTime = m_previousTime;
         Percentage actualAnimationSampleEndTime = m_currentTime;
 
-        // Invert times and swap the start and end times to create the correct sampling range for events
-        TInlineVector<Event const*, 10> sampledAnimationEvents;
-        if ( m_shouldPlayInReverse )
         {
-            actualAnimationSampleEndTime = 1.0f - m_currentTime;
-            actualAnimationSampleStartTime = 1.0f - m_previousTime;
-            m_pAnimation->GetEventsForRange( actualAnimationSampleEndTime, actualAnimationSampleStartTime, sampledAnimationEvents );
-        }
-        else
-        {
-            m_pAnimation->GetEventsForRange( actualAnimationSampleStartTime, actualAnimationSampleEndTime, sampledAnimationEvents );
-        }
-
-        // Post-process sampled events
-        for ( auto pEvent : sampledAnimationEvents )
-        {
-            Percentage percentageThroughEvent = 1.0f;
+            // Invert times and swap the start and end times to create the correct sampling range for events
+            Memory::ScopedScratchMarker const scratchMarker;
+            TInlineScratchVector<Event const*, 10> sampledAnimationEvents;
+            if ( m_shouldPlayInReverse )
+            {
+                actualAnimationSampleEndTime = 1.0f - m_currentTime;
+                actualAnimationSampleStartTime = 1.0f - m_previousTime;
+                m_pAnimation->GetEventsForRange( actualAnimationSampleEndTime, actualAnimationSampleStartTime, sampledAnimationEvents );
+            }
+            else
+            {
+                m_pAnimation->GetEventsForRange( actualAnimationSampleStartTime, actualAnimationSampleEndTime, sampledAnimationEvents );
+            }
 
-            if ( pEvent->IsDurationEvent() )
+            // Post-process sampled events
+            for ( auto pEvent : sampledAnimationEvents )
             {
-                Seconds const currentAnimTimeSeconds( m_pAnimation->GetDuration() * actualAnimationSampleEndTime.ToFloat() );
-                percentageThroughEvent = pEvent->GetTimeRange().GetPercentageThroughClamped( currentAnimTimeSeconds );
-                EE_ASSERT( percentageThroughEvent <= 1.0f );
+                Percentage percentageThroughEvent = 1.0f;
 
-                if ( m_shouldPlayInReverse )
+                if ( pEvent->IsDurationEvent() )
                 {
-                    percentageThroughEvent = 1.0f - percentageThroughEvent;
+                    Seconds const currentAnimTimeSeconds( m_pAnimation->GetDuration() * actualAnimationSampleEndTime.ToFloat() );
+                    percentageThroughEvent = pEvent->GetTimeRange().GetPercentageThroughClamped( currentAnimTimeSeconds );
+                    EE_ASSERT( percentageThroughEvent <= 1.0f );
+
+                    if ( m_shouldPlayInReverse )
+                    {
+                        percentageThroughEvent = 1.0f - percentageThroughEvent;
+                    }
                 }
-            }
 
-            context.m_sampledEventsBuffer.EmplaceAnimationEvent( GetNodeIndex(), pEvent, percentageThroughEvent, isFromActiveBranch );
+                context.m_sampledEventsBuffer.EmplaceAnimationEvent( GetNodeIndex(), pEvent, percentageThroughEvent, isFromActiveBranch );
+            }
         }
 
         result.m_sampledEventRange.m_endIdx = context.m_sampledEventsBuffer.GetNumSampledEvents();
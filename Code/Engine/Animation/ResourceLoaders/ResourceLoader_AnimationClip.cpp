@@ -2,11 +2,17 @@
 #include "Engine/Animation/AnimationClip.h"
 #include "Base/TypeSystem/TypeDescriptors.h"
 #include "Base/Serialization/BinarySerialization.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    // Clips can be loaded on any thread, zero is reserved as the invalid ID
+    static std::atomic<uint32_t> g_nextClipInstanceID = 1;
+
+    //-------------------------------------------------------------------------
+
     AnimationClipLoader::AnimationClipLoader()
     {
         m_loadableTypes.push_back( AnimationClip::GetStaticResourceTypeID() );
@@ -24,8 +30,63 @@ namespace EE::Animation
 
         auto pAnimation = EE::New<AnimationClip>();
         archive << *pAnimation;
+        pAnimation->m_instanceID = g_nextClipInstanceID++;
         pResourceRecord->SetResourceData( pAnimation );
 
+        // Generate decoding layout
+        //-------------------------------------------------------------------------
+        // Each compressed pose stores all animated rotations first (3 x uint16_t each), followed by the interleaved animated translations (3 x uint16_t) and scales (1 x uint16_t)
+
+        int32_t const numTracks = (int32_t) pAnimation->m_trackCompressionSettings.size();
+        pAnimation->m_staticTrackPose.resize( numTracks, Transform::Identity );
+
+        for ( int32_t i = 0; i < numTracks; i++ )
+        {
+            TrackCompressionSettings const& trackSettings = pAnimation->m_trackCompressionSettings[i];
+            if ( trackSettings.IsRotationTrackStatic() )
+            {
+                Transform::DirectlySetRotation( pAnimation->m_staticTrackPose[i], trackSettings.GetStaticRotationValue() );
+            }
+            else
+            {
+                pAnimation->m_animatedRotationBoneIndices.emplace_back( i );
+            }
+        }
+
+        uint32_t dataOffset = (uint32_t) pAnimation->m_animatedRotationBoneIndices.size() * 3;
+        for ( int32_t i = 0; i < numTracks; i++ )
+        {
+            TrackCompressionSettings const& trackSettings = pAnimation->m_trackCompressionSettings[i];
+
+            Float4 translationScale( trackSettings.GetStaticTranslationValue(), 1.0f );
+
+            if ( !trackSettings.IsTranslationTrackStatic() )
+            {
+                auto& track = pAnimation->m_animatedTranslationTracks.emplace_back();
+                track.m_decodeScale = Vector( trackSettings.m_translationRangeX.m_rangeLength, trackSettings.m_translationRangeY.m_rangeLength, trackSettings.m_translationRangeZ.m_rangeLength, 0.0f ) / 65535.0f;
+                track.m_decodeOffset = Vector( trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeStart, 0.0f );
+                track.m_dataOffset = dataOffset;
+                track.m_boneIdx = i;
+                dataOffset += 3;
+            }
+
+            if ( trackSettings.IsScaleTrackStatic() )
+            {
+                translationScale.m_w = trackSettings.GetStaticScaleValue();
+            }
+            else
+            {
+                auto& track = pAnimation->m_animatedScaleTracks.emplace_back();
+                track.m_decodeScale = trackSettings.m_scaleRange.m_rangeLength / 65535.0f;
+                track.m_decodeOffset = trackSettings.m_scaleRange.m_rangeStart;
+                track.m_dataOffset = dataOffset;
+                track.m_boneIdx = i;
+                dataOffset += 1;
+            }
+
+            Transform::DirectlySetTranslationScale( pAnimation->m_staticTrackPose[i], Vector( translationScale ) );
+        }
+
         // Read sync events
         //-------------------------------------------------------------------------
 
@@ -68,6 +129,30 @@ namespace EE::Animation
         pAnimData->m_skeleton = GetInstallDependency( installDependencies, pAnimData->m_skeleton.GetResourceID() );
         EE_ASSERT( pAnimData->IsValid() );
 
+        // Set the animated track placeholders in the static pose to the reference pose, so that any bones skipped when sampling a partial pose are still valid
+        // Additive animations leave these as identity (i.e. the zero pose)
+        if ( !pAnimData->m_isAdditive )
+        {
+            TVector<Transform> const& referencePose = pAnimData->m_skeleton->GetLocalReferencePose();
+            EE_ASSERT( referencePose.size() == pAnimData->m_staticTrackPose.size() );
+
+            for ( int32_t boneIdx : pAnimData->m_animatedRotationBoneIndices )
+            {
+                Transform::DirectlySetRotation( pAnimData->m_staticTrackPose[boneIdx], referencePose[boneIdx].GetRotation() );
+            }
+
+            for ( auto const& track : pAnimData->m_animatedTranslationTracks )
+            {
+                Transform& transform = pAnimData->m_staticTrackPose[track.m_boneIdx];
+                Transform::DirectlySetTranslationScale( transform, Vector::Select( referencePose[track.m_boneIdx].GetTranslation(), transform.GetTranslationAndScale(), Vector::Select0001 ) );
+            }
+
+            for ( auto const& track : pAnimData->m_animatedScaleTracks )
+            {
+                pAnimData->m_staticTrackPose[track.m_boneIdx].SetScale( referencePose[track.m_boneIdx].GetScale() );
+            }
+        }
+
         ResourceLoader::Install( resID, pResourceRecord, installDependencies );
 
         return Resource::InstallResult::Succeeded;
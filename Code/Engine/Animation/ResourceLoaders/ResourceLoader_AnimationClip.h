@@ -11,7 +11,7 @@ namespace EE::TypeSystem { class TypeRegistry; }
 
 namespace EE::Animation
 {
-    class AnimationClipLoader final : public Resource::ResourceLoader
+    class EE_ENGINE_API AnimationClipLoader final : public Resource::ResourceLoader
     {
     public:
 
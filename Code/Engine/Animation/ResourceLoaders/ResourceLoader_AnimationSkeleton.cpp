@@ -31,10 +31,27 @@ namespace EE::Animation
             pSkeleton->m_boneMasks.emplace_back( pSkeleton, def );
         }
 
-        // Calculate global reference pose
+        // Create LOD bone sets
         //-------------------------------------------------------------------------
 
         int32_t const numBones = pSkeleton->GetNumBones();
+        for ( int32_t lodIdx = 0; lodIdx < (int32_t) Skeleton::LOD::NumLODs; lodIdx++ )
+        {
+            BoneSet& lodBoneSet = pSkeleton->m_lodBoneSets[lodIdx];
+            lodBoneSet.Reset( numBones );
+
+            for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                if ( pSkeleton->IsBoneInLOD( boneIdx, (Skeleton::LOD) lodIdx ) )
+                {
+                    lodBoneSet.Set( boneIdx );
+                }
+            }
+        }
+
+        // Calculate global reference pose
+        //-------------------------------------------------------------------------
+
         pSkeleton->m_globalReferencePose.resize( numBones );
 
         pSkeleton->m_globalReferencePose[0] = pSkeleton->m_localReferencePose[0];
@@ -72,45 +72,83 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
-    void AnimationSystem::Update( EntityWorldUpdateContext const& ctx )
+    bool AnimationSystem::HasScheduledGraphs() const
     {
-        EE_PROFILE_SCOPE_ANIMATION( "Animation System");
-
-        if ( m_animPlayers.empty() && m_animGraphs.empty() )
+        for ( auto pAnimComponent : m_animGraphs )
         {
-            return;
+            if ( pAnimComponent->HasGraph() && !pAnimComponent->RequiresManualUpdate() )
+            {
+                return true;
+            }
         }
 
-        //-------------------------------------------------------------------------
+        return false;
+    }
 
-        Transform characterWorldTransform( NoInit );
+    Transform AnimationSystem::GetCharacterWorldTransform() const
+    {
         if ( m_meshComponents.empty() )
         {
-            characterWorldTransform = Transform::Identity;
+            return Transform::Identity;
         }
-        else
+
+        return m_meshComponents[0]->GetWorldTransform();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationSystem::Update( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Animation System");
+
+        if ( m_animPlayers.empty() && m_animGraphs.empty() )
         {
-            characterWorldTransform = m_meshComponents[0]->GetWorldTransform();
+            return;
         }
 
         //-------------------------------------------------------------------------
 
+        Transform const characterWorldTransform = GetCharacterWorldTransform();
         UpdateAnimPlayers( ctx, characterWorldTransform );
+
+        // Scheduled graphs are updated by the world system, which will also finalize the poses once the graphs have been evaluated
+        if ( IsGraphUpdateScheduled() )
+        {
+            return;
+        }
+
         UpdateAnimGraphs( ctx, characterWorldTransform );
 
         //-------------------------------------------------------------------------
 
         if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
         {
-            for ( auto pMeshComponent : m_meshComponents )
-            {
-                if ( !pMeshComponent->HasMeshResourceSet() )
-                {
-                    continue;
-                }
+            FinalizePoses();
+        }
+    }
+
+    void AnimationSystem::UpdateScheduledGraphs( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Animation System: Scheduled Graphs" );
+
+        UpdateAnimGraphs( ctx, GetCharacterWorldTransform() );
 
-                pMeshComponent->FinalizePose();
+        if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
+        {
+            FinalizePoses();
+        }
+    }
+
+    void AnimationSystem::FinalizePoses()
+    {
+        for ( auto pMeshComponent : m_meshComponents )
+        {
+            if ( !pMeshComponent->HasMeshResourceSet() )
+            {
+                continue;
             }
+
+            pMeshComponent->FinalizePose();
         }
     }
 
@@ -240,6 +278,7 @@ namespace EE::Animation
                     }
 
                     pMeshComponent->SetPose( pPose );
+                    pMeshComponent->SetSkeletonLOD( pAnimComponent->GetSkeletonLOD() );
                 }
             }
         }
@@ -29,10 +29,22 @@ namespace EE::Animation
     {
         EE_ENTITY_SYSTEM( AnimationSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Low ) );
 
+        friend class AnimationWorldSystem;
+
     public:
 
         virtual ~AnimationSystem();
 
+        // Does this entity have any graph components that are automatically updated?
+        bool HasScheduledGraphs() const;
+
+        // Is the update of the automatically updated graphs scheduled across all entities by the animation world system?
+        // Only entities that are not part of an attachment chain are scheduled, since attached entities need their parent's sockets to be updated before their own systems run
+        inline bool IsGraphUpdateScheduled() const { return m_isGraphUpdateScheduled && HasScheduledGraphs(); }
+
+        // Evaluate the graphs for the current update stage and set the final poses - called by the animation world system
+        void UpdateScheduledGraphs( EntityWorldUpdateContext const& ctx );
+
     private:
 
         virtual void RegisterComponent( EntityComponent* pComponent ) override;
@@ -41,6 +53,9 @@ namespace EE::Animation
 
         void UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
         void UpdateAnimGraphs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
+        void FinalizePoses();
+
+        Transform GetCharacterWorldTransform() const;
 
     private:
 
@@ -48,5 +63,6 @@ namespace EE::Animation
         TVector<GraphComponent*>                        m_animGraphs;
         TVector<Render::SkeletalMeshComponent*>         m_meshComponents;
         SpatialEntityComponent*                         m_pRootComponent = nullptr;
+        bool                                            m_isGraphUpdateScheduled = false; // Set by the animation world system at the end of each frame
     };
 }
\ No newline at end of file
@@ -1,15 +1,37 @@
 #include "WorldSystem_Animation.h"
+#include "EntitySystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Animation/AnimationSettings.h"
+#include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Systems.h"
+#include "Base/Render/RenderViewport.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    void AnimationWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        m_pSettings = systemRegistry.GetSystem<AnimationSettings>();
+        EE_ASSERT( m_pSettings != nullptr );
+    }
+
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+        EE_ASSERT( m_animatedEntities.empty() && m_numGraphComponentsPerEntity.empty() );
+        m_pTaskSystem = nullptr;
+        m_pSettings = nullptr;
+        m_frameCache.Clear();
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -17,6 +39,16 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+            pGraphComponent->SetTaskScheduler( m_pTaskSystem );
+            pGraphComponent->SetFrameCache( m_isFrameCacheEnabled ? &m_frameCache : nullptr );
+
+            int32_t& numGraphComponents = m_numGraphComponentsPerEntity[pEntity->GetID()];
+            if ( numGraphComponents == 0 )
+            {
+                // Registration only provides const access, but the world system is responsible for driving this entity's animation update
+                m_animatedEntities.emplace_back( const_cast<Entity*>( pEntity ) );
+            }
+            numGraphComponents++;
         }
     }
 
@@ -25,11 +57,69 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Remove( pGraphComponent->GetID() );
+            pGraphComponent->SetTaskScheduler( nullptr );
+            pGraphComponent->SetFrameCache( nullptr );
+
+            auto iter = m_numGraphComponentsPerEntity.find( pEntity->GetID() );
+            EE_ASSERT( iter != m_numGraphComponentsPerEntity.end() && iter->second > 0 );
+            iter->second--;
+            if ( iter->second == 0 )
+            {
+                m_numGraphComponentsPerEntity.erase( iter );
+                m_animatedEntities.erase_first_unsorted( const_cast<Entity*>( pEntity ) );
+            }
         }
     }
 
+    void AnimationWorldSystem::SetFrameCacheEnabled( bool isEnabled )
+    {
+        if ( m_isFrameCacheEnabled == isEnabled )
+        {
+            return;
+        }
+
+        m_isFrameCacheEnabled = isEnabled;
+
+        ClipFrameCache* pFrameCache = m_isFrameCacheEnabled ? &m_frameCache : nullptr;
+        for ( auto pGraphComponent : m_graphComponents )
+        {
+            pGraphComponent->SetFrameCache( pFrameCache );
+        }
+
+        // Release the cached frames and start the stats fresh
+        m_frameCache.Clear();
+        m_frameCache.ResetStats();
+    }
+
+    //-------------------------------------------------------------------------
+
+    WorldSystemDataAccess const& AnimationWorldSystem::GetDataAccess( UpdateStage stage ) const
+    {
+        // Graph updates pose the skeletal meshes and apply root motion to the entities
+        static WorldSystemDataAccess const graphUpdateAccess( WritesData( GraphComponent::GetStaticTypeID() ), WritesData( Render::SkeletalMeshComponent::GetStaticTypeID() ), WritesData( SpatialEntityComponent::GetStaticTypeID() ) );
+
+        // LOD selection only needs the last known character positions
+        static WorldSystemDataAccess const lodUpdateAccess( WritesData( GraphComponent::GetStaticTypeID() ), ReadsData( SpatialEntityComponent::GetStaticTypeID() ) );
+
+        return ( stage == UpdateStage::FrameEnd ) ? lodUpdateAccess : graphUpdateAccess;
+    }
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Animation );
+
+        UpdateStage const updateStage = ctx.GetUpdateStage();
+        if ( updateStage == UpdateStage::PrePhysics || updateStage == UpdateStage::PostPhysics )
+        {
+            UpdateScheduledGraphs( ctx );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        UpdateGraphSchedule();
+        UpdateSkeletonLODs( ctx );
+
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
         for ( auto pComponent : m_graphComponents )
@@ -38,4 +128,132 @@ namespace EE::Animation
         }
         #endif
     }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::UpdateScheduledGraphs( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        struct GraphUpdateTask final : public ITaskSet
+        {
+            GraphUpdateTask( EntityWorldUpdateContext const& context, TVector<ScheduledGraphUpdate> const& scheduledUpdates )
+                : m_context( context )
+                , m_scheduledUpdates( scheduledUpdates )
+            {
+                m_SetSize = (uint32_t) scheduledUpdates.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_MEMORY_TAG_SCOPE( Animation );
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    ScheduledGraphUpdate const& update = m_scheduledUpdates[i];
+                    if ( update.m_deltaTime > 0.0f )
+                    {
+                        EntityWorldUpdateContext reducedRateContext( m_context, update.m_deltaTime );
+                        update.m_pAnimationSystem->UpdateScheduledGraphs( reducedRateContext );
+                    }
+                    else
+                    {
+                        update.m_pAnimationSystem->UpdateScheduledGraphs( m_context );
+                    }
+                }
+            }
+
+        private:
+
+            EntityWorldUpdateContext const&             m_context;
+            TVector<ScheduledGraphUpdate> const&        m_scheduledUpdates;
+        };
+
+        // Gather all the scheduled graph updates
+        //-------------------------------------------------------------------------
+        // Entities in attachment chains are never scheduled (see UpdateGraphSchedule) so there are no ordering constraints between these updates
+        // Entities updated at a reduced rate follow the same update interval and accumulated delta time as their entity update
+
+        m_scheduledUpdates.clear();
+        for ( auto pEntity : m_animatedEntities )
+        {
+            if ( !pEntity->IsUpdateDue() )
+            {
+                continue;
+            }
+
+            AnimationSystem* pAnimationSystem = pEntity->GetSystem<AnimationSystem>();
+            if ( pAnimationSystem != nullptr && pAnimationSystem->IsGraphUpdateScheduled() )
+            {
+                m_scheduledUpdates.push_back( { pAnimationSystem, pEntity->GetUpdateDeltaTime() } );
+            }
+        }
+
+        if ( m_scheduledUpdates.empty() )
+        {
+            return;
+        }
+
+        // Update all graphs
+        //-------------------------------------------------------------------------
+
+        GraphUpdateTask graphUpdateTask( ctx, m_scheduledUpdates );
+        m_pTaskSystem->ScheduleTask( &graphUpdateTask );
+        m_pTaskSystem->WaitForTask( &graphUpdateTask );
+    }
+
+    void AnimationWorldSystem::UpdateGraphSchedule()
+    {
+        // Attached entities are updated by the entity world after their parent's systems, and their systems may read the parent's socket transforms
+        // Deferring either side of an attachment chain until after all the per-entity updates would mean those systems read last frame's sockets, so chains are always updated inline by the animation system
+        // This is done at the end of the frame so that both the entity and world systems agree on which graphs are scheduled for the whole of the next frame
+        for ( auto pEntity : m_animatedEntities )
+        {
+            AnimationSystem* pAnimationSystem = pEntity->GetSystem<AnimationSystem>();
+            if ( pAnimationSystem != nullptr )
+            {
+                pAnimationSystem->m_isGraphUpdateScheduled = !pEntity->HasSpatialParent() && !pEntity->HasAttachedEntities();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::UpdateSkeletonLODs( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        Render::Viewport const* pViewport = ctx.GetViewport();
+        if ( pViewport == nullptr )
+        {
+            return;
+        }
+
+        // The LOD is selected based on the last known character position and will be used for the next update
+        Math::ViewVolume const& viewVolume = pViewport->GetViewVolume();
+        Vector const viewPosition = pViewport->GetViewPosition();
+        float const lowLODDistanceSq = Math::Sqr( m_pSettings->m_lowLODDistance );
+
+        for ( auto pComponent : m_graphComponents )
+        {
+            if ( !pComponent->HasGraphInstance() )
+            {
+                continue;
+            }
+
+            Vector const characterPosition = pComponent->GetCharacterWorldTransform().GetTranslation();
+
+            Skeleton::LOD lod = Skeleton::LOD::High;
+            if ( viewPosition.GetDistanceSquared3( characterPosition ) > lowLODDistanceSq )
+            {
+                lod = Skeleton::LOD::Low;
+            }
+            else if ( !viewVolume.Contains( AABB( characterPosition, m_pSettings->m_characterBoundsExtents ) ) )
+            {
+                lod = Skeleton::LOD::Low;
+            }
+
+            pComponent->SetSkeletonLOD( lod );
+        }
+    }
 }
\ No newline at end of file
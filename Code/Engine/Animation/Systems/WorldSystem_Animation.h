@@ -2,13 +2,21 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Animation/AnimationClipFrameCache.h"
 #include "Base/Types/IDVector.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
     class GraphComponent;
+    class AnimationSettings;
+    class AnimationSystem;
 
     //-------------------------------------------------------------------------
 
@@ -16,23 +24,61 @@ namespace EE::Animation
     {
         friend class AnimationDebugView;
 
+        struct ScheduledGraphUpdate
+        {
+            AnimationSystem*                            m_pAnimationSystem = nullptr;
+            Seconds                                     m_deltaTime = 0.0f;             // The owning entity's reduced rate delta time, zero means use the frame delta time
+        };
+
     public:
 
-        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ) );
+        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::PostPhysics ), RequiresUpdate( UpdateStage::FrameEnd ) );
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<GraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
         #endif
 
+        // Frame Cache
+        //-------------------------------------------------------------------------
+        // An opt-in key frame cache shared by all characters in this world, useful when many characters play the same clips
+
+        inline bool IsFrameCacheEnabled() const { return m_isFrameCacheEnabled; }
+
+        // Enable/disable the shared frame cache, this may not be called during the world update
+        void SetFrameCacheEnabled( bool isEnabled );
+
+        inline ClipFrameCache::Stats GetFrameCacheStats() const { return m_frameCache.GetStats(); }
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccess const& GetDataAccess( UpdateStage stage ) const override;
+
+        void UpdateSkeletonLODs( EntityWorldUpdateContext const& ctx );
+
+        // Evaluate all automatically updated graphs for the current stage across all worker threads
+        void UpdateScheduledGraphs( EntityWorldUpdateContext const& ctx );
+
+        // Select which entities have their graph updates scheduled by this system for the next frame
+        void UpdateGraphSchedule();
 
     private:
 
-        TIDVector<ComponentID, GraphComponent*>          m_graphComponents;
+        EE::TaskSystem*                                 m_pTaskSystem = nullptr;
+        AnimationSettings const*                        m_pSettings = nullptr;
+        TIDVector<ComponentID, GraphComponent*>         m_graphComponents;
+        ClipFrameCache                                  m_frameCache;
+        bool                                            m_isFrameCacheEnabled = false;
+
+        // All entities with graph components, and the number of graph components each one has
+        TVector<Entity*>                                m_animatedEntities;
+        THashMap<EntityID, int32_t>                     m_numGraphComponentsPerEntity;
+
+        // The graph updates that are scheduled for the current stage
+        TVector<ScheduledGraphUpdate>                   m_scheduledUpdates;
     };
 } 
\ No newline at end of file
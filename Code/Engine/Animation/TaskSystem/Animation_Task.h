@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Animation_TaskPosePool.h"
+#include "Engine/Animation/AnimationBoneSet.h"
 #include "Base/Types/Color.h"
 #include "Base/Utils/GlobalRegistryBase.h"
 #include "Base/TypeSystem/ReflectedType.h"
@@ -13,6 +14,7 @@ namespace EE::Animation
     class Task;
     class BoneMaskPool;
     class TaskSerializer;
+    class ClipFrameCache;
 
     //-------------------------------------------------------------------------
 
@@ -43,6 +45,7 @@ namespace EE::Animation
         TInlineVector<Task*, 2>         m_dependencies = { nullptr, nullptr };
         PoseBufferPool&                 m_posePool;
         BoneMaskPool&                   m_boneMaskPool;
+        ClipFrameCache*                 m_pFrameCache = nullptr; // Optional shared key frame cache, used by the sample tasks
         float                           m_deltaTime = 0;
         TaskUpdateStage                 m_updateStage = TaskUpdateStage::Any;
         int8_t                          m_currentTaskIdx = InvalidIndex;
@@ -54,6 +57,8 @@ namespace EE::Animation
     {
         EE_REFLECT_TYPE( Task );
 
+        friend class TaskSystem;
+
     public:
 
         Task( TaskSourceID sourceID, TaskUpdateStage updateStage = TaskUpdateStage::Any, TaskDependencies const& dependencies = TaskDependencies() );
@@ -75,6 +80,25 @@ namespace EE::Animation
         // Do we have a dependency on the physics simulation?
         inline bool	HasPhysicsDependency() const { return m_updateStage != TaskUpdateStage::Any; }
 
+        // Does this task have side-effects outside of its dependencies (e.g. shared cached poses, physics state)?
+        // Ordered tasks are always executed in registration order relative to each other, even when the task system executes independent branches in parallel
+        virtual bool RequiresOrderedExecution() const { return false; }
+
+        // Required Bones
+        //-------------------------------------------------------------------------
+
+        // Get the set of bones that this task actually needs to produce, this is calculated by the task system prior to execution
+        // The values for any other bones in the result pose are undefined
+        inline BoneSet const& GetRequiredBones() const { return m_requiredBones; }
+
+        // Calculate the bones that we need from the specified dependency, based on the bones required from this task
+        // By default, we require the full pose from all our dependencies. Tasks that mask or ignore their inputs should narrow this down.
+        virtual void CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const { outRequiredBones.SetAll(); }
+
+        // Is the result of this task used outside of the task graph (e.g. written to a cached pose or sent to physics)?
+        // These tasks, and everything they depend on, always produce the full pose for the current LOD
+        virtual bool RequiresFullPose() const { return false; }
+
         // Serialization
         //-------------------------------------------------------------------------
 
@@ -180,5 +204,6 @@ namespace EE::Animation
         TaskUpdateStage                 m_actualUpdateStage = TaskUpdateStage::Any;
         bool                            m_isComplete = false;
         TaskDependencies                m_dependencies;
+        BoneSet                         m_requiredBones;
     };
 }
\ No newline at end of file
@@ -4,8 +4,8 @@
 
 namespace EE::Animation
 {
-    PoseBuffer::PoseBuffer( Skeleton const* pSkeleton )
-        : m_pose( pSkeleton )
+    PoseBuffer::PoseBuffer( Skeleton const* pSkeleton, Transform* pMemory )
+        : m_pose( pSkeleton, pMemory )
     {}
 
     void PoseBuffer::Reset()
@@ -27,21 +27,25 @@ namespace EE::Animation
     {
         EE_ASSERT( m_pSkeleton != nullptr );
 
+        // Round up the buffer size so that each buffer starts on a new cache line
+        size_t const requiredMemorySize = Pose::GetRequiredMemorySize( m_pSkeleton );
+        m_bufferMemorySize = ( requiredMemorySize + s_memoryBlockAlignment - 1 ) & ~( s_memoryBlockAlignment - 1 );
+
+        AllocatePoseBuffers( s_numInitialBuffers, s_numInitialBuffers );
+
+        #if EE_DEVELOPMENT_TOOLS
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
-            m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
-
-            #if EE_DEVELOPMENT_TOOLS
             m_debugBuffers.emplace_back( Pose( m_pSkeleton ) );
             m_debugBufferTaskIdxMapping.emplace_back( int8_t( 0 ) );
-            #endif
         }
+        #endif
     }
 
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+        FreePoseBuffers();
     }
 
     void PoseBufferPool::Reset()
@@ -53,6 +57,7 @@ namespace EE::Animation
         }
 
         m_firstFreeBuffer = 0;
+        m_numAllocationsSinceReset = 0;
 
         // Process all cached buffer destruction requests
         int8_t const numCachedBuffers = (int8_t) m_cachedBuffers.size();
@@ -74,15 +79,144 @@ namespace EE::Animation
         #endif
     }
 
+    void PoseBufferPool::ReservePoseBuffers( int32_t numPoseBuffers, int32_t numCachedPoseBuffers )
+    {
+        EE_ASSERT( !m_isConcurrentAccessEnabled );
+        EE_ASSERT( numPoseBuffers >= 0 && numCachedPoseBuffers >= 0 );
+
+        int32_t const numAdditionalPoseBuffers = Math::Max( 0, numPoseBuffers - (int32_t) m_poseBuffers.size() );
+        int32_t const numAdditionalCachedPoseBuffers = Math::Max( 0, numCachedPoseBuffers - (int32_t) m_cachedBuffers.size() );
+        if ( numAdditionalPoseBuffers == 0 && numAdditionalCachedPoseBuffers == 0 )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        bool isAnyBufferInUse = false;
+
+        for ( auto const& poseBuffer : m_poseBuffers )
+        {
+            isAnyBufferInUse |= poseBuffer.m_isUsed;
+        }
+
+        for ( auto const& cachedBuffer : m_cachedBuffers )
+        {
+            isAnyBufferInUse |= cachedBuffer.m_isUsed;
+        }
+
+        // If no buffers are in use, we can replace all the existing memory blocks with a single contiguous block
+        if ( !isAnyBufferInUse )
+        {
+            int32_t const totalNumPoseBuffers = (int32_t) m_poseBuffers.size() + numAdditionalPoseBuffers;
+            int32_t const totalNumCachedPoseBuffers = (int32_t) m_cachedBuffers.size() + numAdditionalCachedPoseBuffers;
+            FreePoseBuffers();
+            AllocatePoseBuffers( totalNumPoseBuffers, totalNumCachedPoseBuffers );
+        }
+        else
+        {
+            AllocatePoseBuffers( numAdditionalPoseBuffers, numAdditionalCachedPoseBuffers );
+        }
+    }
+
+    void PoseBufferPool::AllocatePoseBuffers( int32_t numPoseBuffers, int32_t numCachedPoseBuffers )
+    {
+        EE_ASSERT( !m_isConcurrentAccessEnabled ); // Growing the pool would invalidate any buffers in use by other threads
+        EE_ASSERT( numPoseBuffers >= 0 && numCachedPoseBuffers >= 0 );
+
+        int32_t const numBuffers = numPoseBuffers + numCachedPoseBuffers;
+        if ( numBuffers == 0 )
+        {
+            return;
+        }
+
+        // Buffer indices are stored as int8_t
+        EE_ASSERT( ( m_poseBuffers.size() + numPoseBuffers ) <= INT8_MAX );
+        EE_ASSERT( ( m_cachedBuffers.size() + numCachedPoseBuffers ) <= INT8_MAX );
+
+        // Allocate a single cache-aligned block for all the new buffers
+        size_t const blockSize = m_bufferMemorySize * numBuffers;
+        uint8_t* pMemory = reinterpret_cast<uint8_t*>( EE::Alloc( blockSize, s_memoryBlockAlignment ) );
+        m_memoryBlocks.emplace_back( pMemory );
+        m_allocatedMemorySize += blockSize;
+        m_numAllocationsSinceReset++;
+
+        // Create the buffers, we track any buffer array growth as well since this also hits the heap
+        if ( m_poseBuffers.capacity() < ( m_poseBuffers.size() + numPoseBuffers ) )
+        {
+            m_poseBuffers.reserve( m_poseBuffers.size() + numPoseBuffers );
+            m_numAllocationsSinceReset++;
+        }
+
+        for ( auto i = 0; i < numPoseBuffers; i++ )
+        {
+            m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton, reinterpret_cast<Transform*>( pMemory ) ) );
+            pMemory += m_bufferMemorySize;
+        }
+
+        if ( m_cachedBuffers.capacity() < ( m_cachedBuffers.size() + numCachedPoseBuffers ) )
+        {
+            m_cachedBuffers.reserve( m_cachedBuffers.size() + numCachedPoseBuffers );
+            m_numAllocationsSinceReset++;
+        }
+
+        for ( auto i = 0; i < numCachedPoseBuffers; i++ )
+        {
+            m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton, reinterpret_cast<Transform*>( pMemory ) ) );
+            pMemory += m_bufferMemorySize;
+        }
+    }
+
+    void PoseBufferPool::FreePoseBuffers()
+    {
+        EE_ASSERT( !m_isConcurrentAccessEnabled );
+
+        // The buffers reference the memory blocks, so they need to be destroyed first
+        m_poseBuffers.clear();
+        m_cachedBuffers.clear();
+        m_firstFreeBuffer = 0;
+        m_firstFreeCachedBuffer = 0;
+
+        for ( auto& pMemoryBlock : m_memoryBlocks )
+        {
+            EE::Free( pMemoryBlock );
+        }
+
+        m_memoryBlocks.clear();
+        m_allocatedMemorySize = 0;
+    }
+
+    //-------------------------------------------------------------------------
+
     int8_t PoseBufferPool::RequestPoseBuffer()
+    {
+        if ( m_isConcurrentAccessEnabled )
+        {
+            Threading::ScopeLock lock( m_mutex );
+            return RequestPoseBufferInternal();
+        }
+
+        return RequestPoseBufferInternal();
+    }
+
+    void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
+    {
+        if ( m_isConcurrentAccessEnabled )
+        {
+            Threading::ScopeLock lock( m_mutex );
+            ReleasePoseBufferInternal( bufferIdx );
+            return;
+        }
+
+        ReleasePoseBufferInternal( bufferIdx );
+    }
+
+    int8_t PoseBufferPool::RequestPoseBufferInternal()
     {
         if ( m_firstFreeBuffer == m_poseBuffers.size() )
         {
-            for ( auto i = 0; i < s_bufferGrowAmount; i++ )
-            {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
-            }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
+            EE_ASSERT( !m_isConcurrentAccessEnabled ); // We've run out of reserved buffers
+            AllocatePoseBuffers( s_bufferGrowAmount, 0 );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
@@ -102,32 +236,66 @@ namespace EE::Animation
         return freeBufferIdx;
     }
 
-    void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
+    void PoseBufferPool::ReleasePoseBufferInternal( int8_t bufferIdx )
     {
         EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
         m_poseBuffers[bufferIdx].m_isUsed = false;
         m_firstFreeBuffer = Math::Min( bufferIdx, m_firstFreeBuffer );
     }
 
-    UUID PoseBufferPool::CreateCachedPoseBuffer()
+    void PoseBufferPool::BeginConcurrentAccess( int32_t numPendingTasks, int32_t maxConcurrentTasks )
     {
-        CachedPoseBuffer* pCachedPoseBuffer = nullptr;
+        EE_ASSERT( !m_isConcurrentAccessEnabled );
+        EE_ASSERT( numPendingTasks >= 0 && maxConcurrentTasks >= 0 );
 
-        if ( m_firstFreeCachedBuffer == m_cachedBuffers.size() )
+        // Each pending task owns at most a single result buffer, and each running task may additionally need a temporary buffer
+        int32_t const numRequiredFreeBuffers = numPendingTasks + maxConcurrentTasks;
+
+        int32_t numFreeBuffers = 0;
+        for ( auto const& poseBuffer : m_poseBuffers )
         {
-            for ( auto i = 0; i < s_bufferGrowAmount; i++ )
+            if ( !poseBuffer.m_isUsed )
             {
-                pCachedPoseBuffer = &m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
+                numFreeBuffers++;
             }
+        }
+
+        AllocatePoseBuffers( Math::Max( 0, numRequiredFreeBuffers - numFreeBuffers ), 0 );
 
-            EE_ASSERT( m_cachedBuffers.size() < 255 );
+        // Each task records its result exactly once
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_isDebugRecordingEnabled )
+        {
+            while ( (int32_t) m_debugBuffers.size() < m_firstFreeDebugBuffer + numPendingTasks )
+            {
+                m_debugBuffers.emplace_back( Pose( m_pSkeleton ) );
+                m_debugBufferTaskIdxMapping.emplace_back( int8_t( -1 ) );
+            }
+            EE_ASSERT( m_debugBuffers.size() < 255 );
         }
-        else
+        #endif
+
+        m_isConcurrentAccessEnabled = true;
+    }
+
+    void PoseBufferPool::EndConcurrentAccess()
+    {
+        EE_ASSERT( m_isConcurrentAccessEnabled );
+        m_isConcurrentAccessEnabled = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    UUID PoseBufferPool::CreateCachedPoseBuffer()
+    {
+        if ( m_firstFreeCachedBuffer == m_cachedBuffers.size() )
         {
-            pCachedPoseBuffer = &m_cachedBuffers[m_firstFreeCachedBuffer];
-            EE_ASSERT( !pCachedPoseBuffer->m_isUsed );
+            AllocatePoseBuffers( 0, s_bufferGrowAmount );
         }
 
+        CachedPoseBuffer* pCachedPoseBuffer = &m_cachedBuffers[m_firstFreeCachedBuffer];
+        EE_ASSERT( !pCachedPoseBuffer->m_isUsed );
+
         //-------------------------------------------------------------------------
 
         // Create a new ID for the cached pose
@@ -207,9 +375,23 @@ namespace EE::Animation
             return;
         }
 
+        if ( m_isConcurrentAccessEnabled )
+        {
+            Threading::ScopeLock lock( m_mutex );
+            RecordPoseInternal( taskIdx, poseBufferIdx );
+            return;
+        }
+
+        RecordPoseInternal( taskIdx, poseBufferIdx );
+    }
+
+    void PoseBufferPool::RecordPoseInternal( int8_t taskIdx, int8_t poseBufferIdx )
+    {
         // If we are out of buffers, add additional debug buffers
         if ( m_firstFreeDebugBuffer == m_debugBuffers.size() )
         {
+            EE_ASSERT( !m_isConcurrentAccessEnabled ); // We've run out of reserved buffers
+
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
                 m_debugBuffers.emplace_back( Pose( m_pSkeleton ) );
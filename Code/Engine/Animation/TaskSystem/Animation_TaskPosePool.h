@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -12,7 +13,7 @@ namespace EE::Animation
 
     public:
 
-        PoseBuffer( Skeleton const* pSkeleton );
+        PoseBuffer( Skeleton const* pSkeleton, Transform* pMemory );
 
         void Reset();
 
@@ -53,10 +54,14 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    // All pose buffers are carved out of contiguous cache-aligned memory blocks, each block holds the transforms for a set of buffers
+    // The pool should be sized up front (see 'ReservePoseBuffers') so that we never need to allocate any memory during an update
+
     class EE_ENGINE_API PoseBufferPool
     {
         constexpr static int8_t const s_numInitialBuffers = 6;
         constexpr static int8_t const s_bufferGrowAmount = 3;
+        constexpr static size_t const s_memoryBlockAlignment = 64;
 
     public:
 
@@ -65,6 +70,10 @@ namespace EE::Animation
 
         void Reset();
 
+        // Ensure that we have at least the specified number of pose and cached pose buffers
+        // If none of the buffers are in use, the whole pool is reallocated as a single memory block
+        void ReservePoseBuffers( int32_t numPoseBuffers, int32_t numCachedPoseBuffers );
+
         // Poses
         //-------------------------------------------------------------------------
 
@@ -85,6 +94,28 @@ namespace EE::Animation
         void ResetCachedPoseBuffer( UUID const& cachedPoseID );
         PoseBuffer* GetCachedPoseBuffer( UUID const& cachedPoseID );
 
+        // Concurrent Access
+        //-------------------------------------------------------------------------
+        // Requesting and releasing buffers is only thread-safe between these calls
+        // Growing the pool would invalidate any buffers currently in use by other threads, so we reserve enough free buffers up front instead
+
+        // Reserve enough buffers to execute the specified number of tasks (with at most 'maxConcurrentTasks' running at once) and enable locking
+        void BeginConcurrentAccess( int32_t numPendingTasks, int32_t maxConcurrentTasks );
+        void EndConcurrentAccess();
+        inline bool IsConcurrentAccessEnabled() const { return m_isConcurrentAccessEnabled; }
+
+        // Allocation Stats
+        //-------------------------------------------------------------------------
+        // Once the pool is correctly sized, there should be no allocations during a steady state update
+
+        inline int32_t GetNumPoseBuffers() const { return (int32_t) m_poseBuffers.size(); }
+        inline int32_t GetNumCachedPoseBuffers() const { return (int32_t) m_cachedBuffers.size(); }
+        inline int32_t GetNumMemoryBlocks() const { return (int32_t) m_memoryBlocks.size(); }
+        inline size_t GetAllocatedMemorySize() const { return m_allocatedMemorySize; }
+
+        // Get the number of heap allocations made by the pool since the last reset (i.e. during the current update)
+        inline int32_t GetNumAllocationsSinceReset() const { return m_numAllocationsSinceReset; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -96,14 +127,31 @@ namespace EE::Animation
         Pose const* GetRecordedPoseForTask( int8_t taskIdx ) const;
         #endif
 
+    private:
+
+        void AllocatePoseBuffers( int32_t numPoseBuffers, int32_t numCachedPoseBuffers );
+        void FreePoseBuffers();
+        int8_t RequestPoseBufferInternal();
+        void ReleasePoseBufferInternal( int8_t bufferIdx );
+
+        #if EE_DEVELOPMENT_TOOLS
+        void RecordPoseInternal( int8_t taskIdx, int8_t poseBufferIdx );
+        #endif
+
     private:
 
         Skeleton const*                             m_pSkeleton = nullptr;
+        size_t                                      m_bufferMemorySize = 0; // The cache-line aligned memory size of a single buffer
+        TInlineVector<void*, 2>                     m_memoryBlocks;
+        size_t                                      m_allocatedMemorySize = 0;
+        int32_t                                     m_numAllocationsSinceReset = 0;
         TInlineVector<PoseBuffer, 10>               m_poseBuffers;
         TInlineVector<CachedPoseBuffer, 10>         m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
         int8_t                                      m_firstFreeBuffer = 0;
+        Threading::Mutex                            m_mutex;
+        bool                                        m_isConcurrentAccessEnabled = false;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<Pose>                               m_debugBuffers;
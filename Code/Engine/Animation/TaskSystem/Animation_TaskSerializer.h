@@ -2,6 +2,7 @@
 #include "Engine/_Module/API.h"
 #include "Base/Resource/ResourcePtr.h"
 #include "Base/Serialization/BitSerialization.h"
+#include "Base/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -12,7 +13,7 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
-    using ResourceLUT = THashMap<uint32_t, Resource::ResourcePtr>;
+    using ResourceLUT = TFlatHashMap<uint32_t, Resource::ResourcePtr>;
 
     // Single use serializer!
     //-------------------------------------------------------------------------
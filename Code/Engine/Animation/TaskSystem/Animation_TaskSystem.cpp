@@ -3,7 +3,9 @@
 #include "Engine/Animation/AnimationBlender.h"
 
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Memory/ScratchAllocator.h"
 #include "Base/Profiling.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 
 //-------------------------------------------------------------------------
@@ -135,6 +137,7 @@ namespace EE::Animation
         }
 
         m_tasks.clear();
+        m_taskLevels.clear();
         m_posePool.Reset();
         m_hasPhysicsDependency = false;
     }
@@ -150,6 +153,38 @@ namespace EE::Animation
             EE::Delete( m_tasks[t] );
             m_tasks.erase( m_tasks.begin() + t );
         }
+
+        m_taskLevels.resize( marker );
+    }
+
+    uint8_t TaskSystem::CalculateTaskLevel( TaskIndex taskIdx ) const
+    {
+        EE_ASSERT( taskIdx >= 0 && taskIdx < m_tasks.size() && m_taskLevels.size() >= taskIdx );
+        Task const* pTask = m_tasks[taskIdx];
+
+        // Dependencies are always registered before the tasks that use them, so their levels are already known
+        int32_t level = 0;
+        for ( auto depTaskIdx : pTask->GetDependencyIndices() )
+        {
+            EE_ASSERT( depTaskIdx < taskIdx );
+            level = Math::Max( level, m_taskLevels[depTaskIdx] + 1 );
+        }
+
+        // Ordered tasks always need to execute after the previously registered ordered task
+        if ( pTask->RequiresOrderedExecution() )
+        {
+            for ( int32_t i = taskIdx - 1; i >= 0; i-- )
+            {
+                if ( m_tasks[i]->RequiresOrderedExecution() )
+                {
+                    level = Math::Max( level, m_taskLevels[i] + 1 );
+                    break;
+                }
+            }
+        }
+
+        EE_ASSERT( level < 0xFF );
+        return (uint8_t) level;
     }
 
     //-------------------------------------------------------------------------
@@ -186,6 +221,80 @@ namespace EE::Animation
         return true;
     }
 
+    void TaskSystem::CalculateRequiredBones()
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        Skeleton const* pSkeleton = GetSkeleton();
+        int32_t const numBones = pSkeleton->GetNumBones();
+        int32_t const numTasks = (int32_t) m_tasks.size();
+
+        // Any task whose result isn't used by another task (i.e. the final task) needs to produce the full pose for the current LOD
+        BoneSet const& lodBoneSet = pSkeleton->GetLODBoneSet( m_skeletonLOD );
+
+        Memory::ScopedScratchMarker const scratchMarker;
+        TInlineScratchVector<bool, 16> isUsedAsDependency;
+        isUsedAsDependency.resize( numTasks, false );
+
+        for ( auto pTask : m_tasks )
+        {
+            for ( auto depTaskIdx : pTask->GetDependencyIndices() )
+            {
+                isUsedAsDependency[depTaskIdx] = true;
+            }
+        }
+
+        // Tasks whose result is used outside the task graph (cached poses, ragdolls) always need the full pose for the current LOD, as do all their dependencies
+        TInlineScratchVector<bool, 16> requiresFullPose;
+        requiresFullPose.resize( numTasks, false );
+
+        for ( int32_t i = 0; i < numTasks; i++ )
+        {
+            requiresFullPose[i] = m_tasks[i]->RequiresFullPose();
+
+            if ( isUsedAsDependency[i] && !requiresFullPose[i] )
+            {
+                m_tasks[i]->m_requiredBones.Reset( numBones );
+            }
+            else
+            {
+                m_tasks[i]->m_requiredBones = lodBoneSet;
+            }
+        }
+
+        // Dependencies are always registered before the tasks that use them, so a single backwards pass will propagate the requirements all the way down to the leaf tasks
+        BoneSet dependencyRequiredBones( numBones );
+        for ( int32_t i = numTasks - 1; i >= 0; i-- )
+        {
+            Task const* pTask = m_tasks[i];
+            if ( pTask->m_requiredBones.IsEmpty() )
+            {
+                continue;
+            }
+
+            int32_t const numDependencies = pTask->GetNumDependencies();
+
+            if ( requiresFullPose[i] )
+            {
+                for ( TaskIndex j = 0; j < numDependencies; j++ )
+                {
+                    TaskIndex const depTaskIdx = pTask->m_dependencies[j];
+                    m_tasks[depTaskIdx]->m_requiredBones = lodBoneSet;
+                    requiresFullPose[depTaskIdx] = true;
+                }
+                continue;
+            }
+
+            for ( TaskIndex j = 0; j < numDependencies; j++ )
+            {
+                dependencyRequiredBones.ClearAll();
+                pTask->CalculateRequiredDependencyBones( pSkeleton, j, dependencyRequiredBones );
+                dependencyRequiredBones &= lodBoneSet;
+                m_tasks[pTask->m_dependencies[j]]->m_requiredBones |= dependencyRequiredBones;
+            }
+        }
+    }
+
     void TaskSystem::UpdatePrePhysics( float deltaTime, Transform const& worldTransform, Transform const& worldTransformInverse )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Anim Pre-Physics Tasks" );
@@ -203,6 +312,9 @@ namespace EE::Animation
         m_prePhysicsTaskIndices.clear();
         m_hasCodependentPhysicsTasks = false;
 
+        // Figure out which bones each task actually needs to produce
+        CalculateRequiredBones();
+
         // Conditionally execute all pre-physics tasks
         //-------------------------------------------------------------------------
 
@@ -233,17 +345,7 @@ namespace EE::Animation
             {
                 for ( TaskIndex prePhysicsTaskIdx : m_prePhysicsTaskIndices )
                 {
-                    m_taskContext.m_currentTaskIdx = prePhysicsTaskIdx;
-
-                    // Set dependencies
-                    m_taskContext.m_dependencies.clear();
-                    for ( auto depTaskIdx : m_tasks[prePhysicsTaskIdx]->GetDependencyIndices() )
-                    {
-                        EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
-                        m_taskContext.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
-                    }
-
-                    m_tasks[prePhysicsTaskIdx]->Execute( m_taskContext );
+                    ExecuteTask( prePhysicsTaskIdx, m_taskContext );
                 }
             }
         }
@@ -295,6 +397,12 @@ namespace EE::Animation
                 m_finalPose.CopyFrom( pResultPoseBuffer->m_pose );
             }
 
+            // Bones excluded by the current LOD were never calculated, so hold them at the reference pose
+            if ( m_skeletonLOD != Skeleton::LOD::High )
+            {
+                m_finalPose.ResetExcludedBonesToReferencePose( GetSkeleton()->GetLODBoneSet( m_skeletonLOD ) );
+            }
+
             // Calculate the global transforms and release the task pose buffer
             m_finalPose.CalculateGlobalTransforms();
             m_posePool.ReleasePoseBuffer( pFinalTask->GetResultBufferIndex() );
@@ -305,29 +413,154 @@ namespace EE::Animation
         }
     }
 
+    void TaskSystem::ExecuteTask( TaskIndex taskIdx, TaskContext& context )
+    {
+        context.m_currentTaskIdx = taskIdx;
+
+        // Set dependencies
+        context.m_dependencies.clear();
+        for ( auto depTaskIdx : m_tasks[taskIdx]->GetDependencyIndices() )
+        {
+            EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
+            context.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
+        }
+
+        // Execute task
+        m_tasks[taskIdx]->Execute( context );
+    }
+
     void TaskSystem::ExecuteTasks()
     {
-        int16_t const numTasks = (int8_t) m_tasks.size();
-        for ( TaskIndex i = 0; i < numTasks; i++ )
+        if ( m_pTaskScheduler == nullptr || !TryExecuteTasksInParallel() )
         {
-            if ( !m_tasks[i]->IsComplete() )
+            int16_t const numTasks = (int8_t) m_tasks.size();
+            for ( TaskIndex i = 0; i < numTasks; i++ )
             {
-                m_taskContext.m_currentTaskIdx = i;
+                if ( !m_tasks[i]->IsComplete() )
+                {
+                    ExecuteTask( i, m_taskContext );
+                }
+            }
+        }
+
+        m_needsUpdate = false;
+    }
+
+    bool TaskSystem::TryExecuteTasksInParallel()
+    {
+        EE_ASSERT( m_pTaskScheduler != nullptr );
 
-                // Set dependencies
-                m_taskContext.m_dependencies.clear();
-                for ( auto DepTaskIdx : m_tasks[i]->GetDependencyIndices() )
+        struct TaskLevelExecutionTask final : public ITaskSet
+        {
+            TaskLevelExecutionTask( TaskSystem* pTaskSystem, TaskIndex const* pTaskIndices, int32_t numTasks )
+                : m_pTaskSystem( pTaskSystem )
+                , m_pTaskIndices( pTaskIndices )
+            {
+                m_SetSize = (uint32_t) numTasks;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                // Each partition needs its own context, since the current task index and dependencies are set per task
+                TaskContext context( m_pTaskSystem->m_taskContext );
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
                 {
-                    EE_ASSERT( m_tasks[DepTaskIdx]->IsComplete() );
-                    m_taskContext.m_dependencies.emplace_back( m_tasks[DepTaskIdx] );
+                    m_pTaskSystem->ExecuteTask( m_pTaskIndices[i], context );
                 }
+            }
+
+        private:
 
-                // Execute task
-                m_tasks[i]->Execute( m_taskContext );
+            TaskSystem*                                 m_pTaskSystem = nullptr;
+            TaskIndex const*                            m_pTaskIndices = nullptr;
+        };
+
+        // Sort all pending tasks by level
+        //-------------------------------------------------------------------------
+
+        int32_t const numTasks = (int32_t) m_tasks.size();
+        int32_t numPendingTasks = 0;
+        int32_t numLevels = 0;
+
+        for ( int32_t i = 0; i < numTasks; i++ )
+        {
+            if ( !m_tasks[i]->IsComplete() )
+            {
+                numLevels = Math::Max( numLevels, m_taskLevels[i] + 1 );
+                numPendingTasks++;
             }
         }
 
-        m_needsUpdate = false;
+        m_levelOffsets.clear();
+        m_levelOffsets.resize( numLevels + 1, 0 );
+
+        for ( int32_t i = 0; i < numTasks; i++ )
+        {
+            if ( !m_tasks[i]->IsComplete() )
+            {
+                m_levelOffsets[m_taskLevels[i] + 1]++;
+            }
+        }
+
+        int32_t maxLevelSize = 0;
+        for ( int32_t i = 0; i < numLevels; i++ )
+        {
+            maxLevelSize = Math::Max( maxLevelSize, (int32_t) m_levelOffsets[i + 1] );
+            m_levelOffsets[i + 1] += m_levelOffsets[i];
+        }
+
+        // If there are no independent tasks, there's nothing to gain from going wide
+        if ( maxLevelSize < s_minTasksForParallelExecution )
+        {
+            return false;
+        }
+
+        // Tasks within a level remain in registration order
+        Memory::ScopedScratchMarker const scratchMarker;
+        TInlineScratchVector<int16_t, 16> insertionOffsets( m_levelOffsets.begin(), m_levelOffsets.end() );
+        m_levelSortedTaskIndices.resize( numPendingTasks );
+
+        for ( int32_t i = 0; i < numTasks; i++ )
+        {
+            if ( !m_tasks[i]->IsComplete() )
+            {
+                m_levelSortedTaskIndices[insertionOffsets[m_taskLevels[i]]++] = (TaskIndex) i;
+            }
+        }
+
+        // Execute levels
+        //-------------------------------------------------------------------------
+
+        EE_PROFILE_SCOPE_ANIMATION( "Anim Parallel Tasks" );
+
+        m_posePool.BeginConcurrentAccess( numPendingTasks, maxLevelSize );
+        m_boneMaskPool.BeginConcurrentAccess();
+
+        for ( int32_t i = 0; i < numLevels; i++ )
+        {
+            int32_t const levelStartIdx = m_levelOffsets[i];
+            int32_t const levelSize = m_levelOffsets[i + 1] - levelStartIdx;
+
+            if ( levelSize < s_minTasksForParallelExecution )
+            {
+                for ( int32_t j = 0; j < levelSize; j++ )
+                {
+                    ExecuteTask( m_levelSortedTaskIndices[levelStartIdx + j], m_taskContext );
+                }
+            }
+            else
+            {
+                TaskLevelExecutionTask levelTask( this, &m_levelSortedTaskIndices[levelStartIdx], levelSize );
+                m_pTaskScheduler->ScheduleTask( &levelTask );
+                m_pTaskScheduler->WaitForTask( &levelTask );
+            }
+        }
+
+        m_boneMaskPool.EndConcurrentAccess();
+        m_posePool.EndConcurrentAccess();
+
+        return true;
     }
 
     //-------------------------------------------------------------------------
@@ -420,6 +653,13 @@ namespace EE::Animation
         {
             pTask->Deserialize( serializer );
         }
+
+        // Build the task levels once all the dependencies are known
+        EE_ASSERT( m_taskLevels.empty() );
+        for ( uint8_t i = 0; i < numTasks; i++ )
+        {
+            m_taskLevels.emplace_back( CalculateTaskLevel( (TaskIndex) i ) );
+        }
     }
 
     //-------------------------------------------------------------------------
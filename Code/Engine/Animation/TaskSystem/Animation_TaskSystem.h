@@ -6,6 +6,7 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
 namespace EE::TypeSystem { class TypeRegistry; }
 
 //-------------------------------------------------------------------------
@@ -32,6 +33,9 @@ namespace EE::Animation
     {
         friend class AnimationDebugView;
 
+        // The minimum number of tasks in a single level before we bother dispatching the level to the task scheduler
+        constexpr static int32_t const s_minTasksForParallelExecution = 2;
+
     public:
 
         TaskSystem( Skeleton const* pSkeleton );
@@ -48,6 +52,13 @@ namespace EE::Animation
         // Get the final pose generated by the task system
         Pose const* GetPose() const{ return &m_finalPose; }
 
+        // LOD
+        //-------------------------------------------------------------------------
+
+        // Set the skeleton LOD to use for the next update, only the bones present in the LOD will be calculated
+        inline void SetSkeletonLOD( Skeleton::LOD lod ) { EE_ASSERT( lod != Skeleton::LOD::NumLODs ); m_skeletonLOD = lod; }
+        inline Skeleton::LOD GetSkeletonLOD() const { return m_skeletonLOD; }
+
         // Execution
         //-------------------------------------------------------------------------
 
@@ -63,6 +74,35 @@ namespace EE::Animation
         // Run all post-physics tasks and fill out the final pose buffer
         void UpdatePostPhysics();
 
+        // Parallel Execution
+        //-------------------------------------------------------------------------
+        // Tasks are grouped into levels based on their dependencies, all tasks in a level are independent of each other and can be executed in parallel
+
+        // Have we enabled parallel execution
+        inline bool IsParallelExecutionEnabled() const { return m_pTaskScheduler != nullptr; }
+
+        // Enable parallel execution of independent task branches using the supplied task scheduler
+        inline void EnableParallelExecution( EE::TaskSystem* pTaskScheduler ) { EE_ASSERT( pTaskScheduler != nullptr ); m_pTaskScheduler = pTaskScheduler; }
+
+        // Disable parallel execution, all tasks will be executed serially on the calling thread
+        inline void DisableParallelExecution() { m_pTaskScheduler = nullptr; }
+
+        // Frame Cache
+        //-------------------------------------------------------------------------
+
+        // Set the shared key frame cache to use for any sampling tasks (optional), the cache must outlive the task system
+        inline void SetFrameCache( ClipFrameCache* pFrameCache ) { m_taskContext.m_pFrameCache = pFrameCache; }
+        inline ClipFrameCache* GetFrameCache() const { return m_taskContext.m_pFrameCache; }
+
+        // Pose Buffers
+        //-------------------------------------------------------------------------
+
+        // Size the pose buffer pool up front, so we dont need to allocate any buffers while updating
+        inline void ReservePoseBuffers( int32_t numPoseBuffers, int32_t numCachedPoseBuffers ) { m_posePool.ReservePoseBuffers( numPoseBuffers, numCachedPoseBuffers ); }
+
+        // Get the number of pose buffer pool allocations since the last reset, this should always be zero in a steady state
+        inline int32_t GetNumPoseBufferAllocationsSinceReset() const { return m_posePool.GetNumAllocationsSinceReset(); }
+
         // Cached Pose storage
         //-------------------------------------------------------------------------
 
@@ -82,6 +122,7 @@ namespace EE::Animation
             EE_ASSERT( m_tasks.size() < 0xFF );
             auto pNewTask = m_tasks.emplace_back( EE::New<T>( eastl::forward<ConstructorParams>( params )... ) );
             m_hasPhysicsDependency |= pNewTask->HasPhysicsDependency();
+            m_taskLevels.emplace_back( CalculateTaskLevel( (TaskIndex) ( m_tasks.size() - 1 ) ) );
             m_needsUpdate = true;
             return (TaskIndex) ( m_tasks.size() - 1 );
         }
@@ -121,22 +162,34 @@ namespace EE::Animation
     private:
 
         bool AddTaskChainToPrePhysicsList( TaskIndex taskIdx );
+        void CalculateRequiredBones();
+        uint8_t CalculateTaskLevel( TaskIndex taskIdx ) const;
+        void ExecuteTask( TaskIndex taskIdx, TaskContext& context );
         void ExecuteTasks();
+        bool TryExecuteTasksInParallel();
 
     private:
 
         TVector<Task*>                          m_tasks;
+        TVector<uint8_t>                        m_taskLevels; // The dependency depth of each task, a task's level is always greater than that of all its dependencies
         PoseBufferPool                          m_posePool;
         BoneMaskPool                            m_boneMaskPool;
         TaskContext                             m_taskContext;
         TInlineVector<TaskIndex, 16>            m_prePhysicsTaskIndices;
         Pose                                    m_finalPose;
+        Skeleton::LOD                           m_skeletonLOD = Skeleton::LOD::High;
         bool                                    m_hasPhysicsDependency = false;
         bool                                    m_hasCodependentPhysicsTasks = false;
         bool                                    m_needsUpdate = false;
 
         //-------------------------------------------------------------------------
 
+        EE::TaskSystem*                         m_pTaskScheduler = nullptr;
+        TVector<TaskIndex>                      m_levelSortedTaskIndices;
+        TInlineVector<int16_t, 16>              m_levelOffsets;
+
+        //-------------------------------------------------------------------------
+
         TVector<TypeSystem::TypeInfo const*>    m_taskTypeRemapTable;
         uint32_t                                m_maxBitsForTaskTypeID = 0;
         bool                                    m_serializationEnabled = false;
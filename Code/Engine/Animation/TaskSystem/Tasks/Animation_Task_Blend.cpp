@@ -1,5 +1,6 @@
 #include "Animation_Task_Blend.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSerializer.h"
+#include "Engine/Animation/AnimationSkeleton.h"
 #include "Base/Profiling.h"
 #include "Base/Drawing/DebugDrawing.h"
 
@@ -36,7 +37,7 @@ namespace EE::Animation::Tasks
         if ( m_boneMaskTaskList.HasTasks() )
         {
             auto const result = m_boneMaskTaskList.GenerateBoneMask( context.m_boneMaskPool );
-            Blender::LocalBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, result.m_pBoneMask, &pFinalBuffer->m_pose, true );
+            Blender::LocalBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, result.m_pBoneMask, &pFinalBuffer->m_pose, true, &m_requiredBones );
 
             #if EE_DEVELOPMENT_TOOLS
             if ( context.m_posePool.IsRecordingEnabled() )
@@ -52,13 +53,37 @@ namespace EE::Animation::Tasks
         }
         else // Perform a simple blend
         {
-            Blender::LocalBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, nullptr, &pFinalBuffer->m_pose, true );
+            Blender::LocalBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, nullptr, &pFinalBuffer->m_pose, true, &m_requiredBones );
         }
 
         ReleaseDependencyPoseBuffer( context, 1 );
         MarkTaskComplete( context );
     }
 
+    void BlendTask::CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const
+    {
+        // Source - only a full weight unmasked blend can completely ignore the source pose
+        if ( dependencyIdx == 0 )
+        {
+            if ( m_blendWeight != 1.0f || m_boneMaskTaskList.HasTasks() )
+            {
+                outRequiredBones = m_requiredBones;
+            }
+        }
+        // Target - a zero weight blend ignores the target pose, otherwise we only need the bones that are not masked out
+        else if ( m_blendWeight != 0.0f )
+        {
+            outRequiredBones = m_requiredBones;
+
+            if ( m_boneMaskTaskList.HasTasks() )
+            {
+                BoneSet affectedBones( pSkeleton->GetNumBones() );
+                m_boneMaskTaskList.CalculateAffectedBones( pSkeleton, affectedBones );
+                outRequiredBones &= affectedBones;
+            }
+        }
+    }
+
     void BlendTask::Serialize( TaskSerializer& serializer ) const
     {
         serializer.WriteDependencyIndex( m_dependencies[0] );
@@ -152,7 +177,7 @@ namespace EE::Animation::Tasks
         if ( m_boneMaskTaskList.HasTasks() )
         {
             auto const result = m_boneMaskTaskList.GenerateBoneMask( context.m_boneMaskPool );
-            Blender::AdditiveBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, result.m_pBoneMask, &pFinalBuffer->m_pose );
+            Blender::AdditiveBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, result.m_pBoneMask, &pFinalBuffer->m_pose, &m_requiredBones );
 
             #if EE_DEVELOPMENT_TOOLS
             if ( context.m_posePool.IsRecordingEnabled() )
@@ -168,13 +193,34 @@ namespace EE::Animation::Tasks
         }
         else // Perform a simple blend
         {
-            Blender::AdditiveBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, nullptr, &pFinalBuffer->m_pose );
+            Blender::AdditiveBlend( &pSourceBuffer->m_pose, &pTargetBuffer->m_pose, m_blendWeight, nullptr, &pFinalBuffer->m_pose, &m_requiredBones );
         }
 
         ReleaseDependencyPoseBuffer( context, 1 );
         MarkTaskComplete( context );
     }
 
+    void AdditiveBlendTask::CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const
+    {
+        // Source - always required since the additive is applied on top of it
+        if ( dependencyIdx == 0 )
+        {
+            outRequiredBones = m_requiredBones;
+        }
+        // Target - a zero weight blend ignores the additive pose, otherwise we only need the bones that are not masked out
+        else if ( m_blendWeight != 0.0f )
+        {
+            outRequiredBones = m_requiredBones;
+
+            if ( m_boneMaskTaskList.HasTasks() )
+            {
+                BoneSet affectedBones( pSkeleton->GetNumBones() );
+                m_boneMaskTaskList.CalculateAffectedBones( pSkeleton, affectedBones );
+                outRequiredBones &= affectedBones;
+            }
+        }
+    }
+
     void AdditiveBlendTask::Serialize( TaskSerializer& serializer ) const
     {
         serializer.WriteDependencyIndex( m_dependencies[0] );
@@ -279,6 +325,35 @@ namespace EE::Animation::Tasks
         MarkTaskComplete( context );
     }
 
+    void GlobalBlendTask::CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const
+    {
+        // Without a mask, no blend occurs and the layer pose is returned as is
+        if ( !m_boneMaskTaskList.HasTasks() )
+        {
+            if ( dependencyIdx == 1 )
+            {
+                outRequiredBones = m_requiredBones;
+            }
+
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+        // The blend is performed in global space, so we need the whole parent chain for every bone we use
+
+        outRequiredBones = m_requiredBones;
+
+        // Layer - only the bones that are not masked out
+        if ( dependencyIdx == 1 )
+        {
+            BoneSet affectedBones( pSkeleton->GetNumBones() );
+            m_boneMaskTaskList.CalculateAffectedBones( pSkeleton, affectedBones );
+            outRequiredBones &= affectedBones;
+        }
+
+        outRequiredBones.AddParentBones( pSkeleton );
+    }
+
     void GlobalBlendTask::Serialize( TaskSerializer& serializer ) const
     {
         serializer.WriteDependencyIndex( m_dependencies[0] );
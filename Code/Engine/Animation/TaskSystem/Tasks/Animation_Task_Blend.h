@@ -10,7 +10,7 @@ namespace EE::Drawing { class DrawContext; }
 
 namespace EE::Animation::Tasks
 {
-    class BlendTask final : public Task
+    class EE_ENGINE_API BlendTask final : public Task
     {
         EE_REFLECT_TYPE( BlendTask );
 
@@ -18,6 +18,7 @@ namespace EE::Animation::Tasks
 
         BlendTask( TaskSourceID sourceID, TaskIndex sourceTaskIdx, TaskIndex targetTaskIdx, float const blendWeight, BoneMaskTaskList const* pBoneMaskTaskList = nullptr );
         virtual void Execute( TaskContext const& context ) override;
+        virtual void CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const override;
 
         virtual bool AllowsSerialization() const override { return true; }
         virtual void Serialize( TaskSerializer& serializer ) const override;
@@ -45,7 +46,7 @@ namespace EE::Animation::Tasks
 
     //-------------------------------------------------------------------------
 
-    class AdditiveBlendTask final : public Task
+    class EE_ENGINE_API AdditiveBlendTask final : public Task
     {
         EE_REFLECT_TYPE( AdditiveBlendTask );
 
@@ -53,6 +54,7 @@ namespace EE::Animation::Tasks
 
         AdditiveBlendTask( TaskSourceID sourceID, TaskIndex sourceTaskIdx, TaskIndex targetTaskIdx, float const blendWeight, BoneMaskTaskList const* pBoneMaskTaskList = nullptr );
         virtual void Execute( TaskContext const& context ) override;
+        virtual void CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const override;
 
         virtual bool AllowsSerialization() const override { return true; }
         virtual void Serialize( TaskSerializer& serializer ) const override;
@@ -80,7 +82,7 @@ namespace EE::Animation::Tasks
 
     //-------------------------------------------------------------------------
 
-    class GlobalBlendTask final : public Task
+    class EE_ENGINE_API GlobalBlendTask final : public Task
     {
         EE_REFLECT_TYPE( GlobalBlendTask );
 
@@ -88,6 +90,7 @@ namespace EE::Animation::Tasks
 
         GlobalBlendTask( TaskSourceID sourceID, TaskIndex baseTaskIdx, TaskIndex layerTaskIdx, float const layerWeight, BoneMaskTaskList const& boneMaskTaskList );
         virtual void Execute( TaskContext const& context ) override;
+        virtual void CalculateRequiredDependencyBones( Skeleton const* pSkeleton, TaskIndex dependencyIdx, BoneSet& outRequiredBones ) const override;
 
         virtual bool AllowsSerialization() const override { return true; }
         virtual void Serialize( TaskSerializer& serializer ) const override;
@@ -15,6 +15,8 @@ namespace EE::Animation::Tasks
         CachedPoseWriteTask( TaskSourceID sourceID, TaskIndex sourceTaskIdx, UUID cachedPoseID );
         virtual void Execute( TaskContext const& context ) override;
         virtual bool AllowsSerialization() const override { return false; }
+        virtual bool RequiresOrderedExecution() const override { return true; }
+        virtual bool RequiresFullPose() const override { return true; }
 
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const override { return String( "Write Cached Pose" ); }
@@ -41,6 +43,7 @@ namespace EE::Animation::Tasks
         CachedPoseReadTask( TaskSourceID sourceID, UUID cachedPoseID );
         virtual void Execute( TaskContext const& context ) override;
         virtual bool AllowsSerialization() const override { return false; }
+        virtual bool RequiresOrderedExecution() const override { return true; }
 
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const override { return String( "Read Cached Pose" ); }
@@ -30,6 +30,8 @@ namespace EE::Animation::Tasks
         RagdollSetPoseTask( Physics::Ragdoll* pRagdoll, TaskSourceID sourceID, TaskIndex sourceTaskIdx, InitOption initOption = InitOption::DoNothing );
         virtual void Execute( TaskContext const& context ) override;
         virtual bool AllowsSerialization() const override { return false; }
+        virtual bool RequiresOrderedExecution() const override { return true; }
+        virtual bool RequiresFullPose() const override { return true; }
 
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const override { return "Set Ragdoll Pose"; }
@@ -58,6 +60,7 @@ namespace EE::Animation::Tasks
         RagdollGetPoseTask( Physics::Ragdoll* pRagdoll, TaskSourceID sourceID );
         virtual void Execute( TaskContext const& context ) override;
         virtual bool AllowsSerialization() const override { return false; }
+        virtual bool RequiresOrderedExecution() const override { return true; }
 
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const override;
@@ -20,7 +20,17 @@ namespace EE::Animation::Tasks
         EE_ASSERT( m_pAnimation != nullptr );
 
         auto pResultBuffer = GetNewPoseBuffer( context );
-        m_pAnimation->GetPose( m_time, &pResultBuffer->m_pose );
+
+        // If we have a shared frame cache, the key frames are only decoded once for all characters playing this clip and we just interpolate here
+        if ( context.m_pFrameCache != nullptr )
+        {
+            m_pAnimation->GetPose( m_pAnimation->GetFrameTime( m_time ), &pResultBuffer->m_pose, *context.m_pFrameCache, &m_requiredBones );
+        }
+        else
+        {
+            m_pAnimation->GetPose( m_time, &pResultBuffer->m_pose, &m_requiredBones );
+        }
+
         MarkTaskComplete( context );
     }
 
@@ -7,7 +7,7 @@
 
 namespace EE::Animation::Tasks
 {
-    class SampleTask : public Task
+    class EE_ENGINE_API SampleTask : public Task
     {
         EE_REFLECT_TYPE( SampleTask );
 
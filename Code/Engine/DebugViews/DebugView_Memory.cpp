@@ -0,0 +1,211 @@
+#include "DebugView_Memory.h"
+#include "Base/Imgui/ImguiX.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Memory
+{
+    static void DrawByteCount( double numBytes )
+    {
+        if ( numBytes >= 1024.0 * 1024.0 )
+        {
+            ImGui::Text( "%.2fMB", numBytes / ( 1024.0 * 1024.0 ) );
+        }
+        else if ( numBytes >= 1024.0 )
+        {
+            ImGui::Text( "%.2fKB", numBytes / 1024.0 );
+        }
+        else
+        {
+            ImGui::Text( "%.0fB", numBytes );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MemoryDebugView::DrawMemoryTags()
+    {
+        // A frame is considered a spike if it allocates more than this multiple of the average frame
+        constexpr static float const spikeThreshold = 2.0f;
+
+        ImGui::Text( "Total Requested: %.2fMB", GetTotalRequestedMemory() / ( 1024.0f * 1024.0f ) );
+        ImGui::SameLine();
+        ImGui::Text( "Total Allocated: %.2fMB", GetTotalAllocatedMemory() / ( 1024.0f * 1024.0f ) );
+
+        ImGui::Separator();
+
+        if ( ImGui::BeginTable( "Memory Tags Table", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "Tag", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Live", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableSetupColumn( "Live Allocs", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableSetupColumn( "Frame", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableSetupColumn( "Frame Allocs", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableSetupColumn( "Peak Frame", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableSetupColumn( "Frame History", ImGuiTableColumnFlags_WidthStretch );
+
+            //-------------------------------------------------------------------------
+
+            ImGui::TableHeadersRow();
+
+            //-------------------------------------------------------------------------
+
+            float history[g_memoryTrackingFrameHistorySize];
+            for ( uint8_t i = 0; i < (uint8_t) MemoryTag::Count; i++ )
+            {
+                MemoryTag const tag = (MemoryTag) i;
+                MemoryTagStats const stats = GetMemoryTagStats( tag );
+                GetMemoryTagFrameHistory( tag, history );
+
+                float averageFrameBytes = 0.0f;
+                for ( float const frameBytes : history )
+                {
+                    averageFrameBytes += frameBytes;
+                }
+                averageFrameBytes /= g_memoryTrackingFrameHistorySize;
+
+                bool const isSpike = stats.m_frameAllocatedBytes > 0 && stats.m_frameAllocatedBytes > averageFrameBytes * spikeThreshold;
+
+                //-------------------------------------------------------------------------
+
+                ImGui::PushID( i );
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex( 0 );
+                ImGui::Text( GetMemoryTagName( tag ) );
+
+                ImGui::TableSetColumnIndex( 1 );
+                DrawByteCount( (double) stats.m_liveBytes );
+
+                ImGui::TableSetColumnIndex( 2 );
+                ImGui::Text( "%lld", stats.m_numLiveAllocations );
+
+                ImGui::TableSetColumnIndex( 3 );
+                if ( isSpike )
+                {
+                    ImGui::PushStyleColor( ImGuiCol_Text, Colors::Red.ToFloat4() );
+                    DrawByteCount( (double) stats.m_frameAllocatedBytes );
+                    ImGui::PopStyleColor();
+                }
+                else
+                {
+                    DrawByteCount( (double) stats.m_frameAllocatedBytes );
+                }
+
+                ImGui::TableSetColumnIndex( 4 );
+                ImGui::Text( "%llu", stats.m_frameAllocations );
+
+                ImGui::TableSetColumnIndex( 5 );
+                DrawByteCount( (double) stats.m_peakFrameAllocatedBytes );
+
+                ImGui::TableSetColumnIndex( 6 );
+                ImGui::SetNextItemWidth( -1 );
+                ImGui::PlotHistogram( "##History", history, g_memoryTrackingFrameHistorySize, 0, nullptr, 0.0f, FLT_MAX, ImVec2( 0, 24 ) );
+                ImGui::PopID();
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    void MemoryDebugView::DrawAllocationSamples()
+    {
+        int32_t samplingRate = (int32_t) GetAllocationSamplingRate();
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text( "Sample Every Nth Allocation:" );
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth( 100 );
+        if ( ImGui::InputInt( "##SamplingRate", &samplingRate ) )
+        {
+            SetAllocationSamplingRate( (uint32_t) Math::Max( samplingRate, 0 ) );
+        }
+        ImGuiX::ItemTooltip( "0 disables sampling" );
+
+        ImGui::SameLine();
+        if ( ImGui::Button( "Capture" ) )
+        {
+            m_numSamples = GetAllocationSamples( m_samples, s_maxDisplayedSamples );
+            m_selectedSampleIdx = InvalidIndex;
+            m_selectedSampleSymbols.clear();
+        }
+
+        ImGui::SameLine();
+        if ( ImGui::Button( "Clear" ) )
+        {
+            ClearAllocationSamples();
+            m_numSamples = 0;
+            m_selectedSampleIdx = InvalidIndex;
+            m_selectedSampleSymbols.clear();
+        }
+
+        ImGui::Separator();
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginTable( "Allocation Samples Table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY, ImVec2( 0, ImGui::GetContentRegionAvail().y * 0.5f ) ) )
+        {
+            ImGui::TableSetupColumn( "Frame", ImGuiTableColumnFlags_WidthFixed, 60 );
+            ImGui::TableSetupColumn( "Tag", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Size", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupScrollFreeze( 0, 1 );
+            ImGui::TableHeadersRow();
+
+            for ( uint32_t i = 0; i < m_numSamples; i++ )
+            {
+                AllocationSample const& sample = m_samples[i];
+
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex( 0 );
+                ImGui::PushID( i );
+                InlineString const frameStr( InlineString::CtorSprintf(), "%llu", sample.m_frameIndex );
+                if ( ImGui::Selectable( frameStr.c_str(), m_selectedSampleIdx == (int32_t) i, ImGuiSelectableFlags_SpanAllColumns ) )
+                {
+                    m_selectedSampleIdx = (int32_t) i;
+                    ResolveCallstackSymbols( sample.m_callstack, sample.m_callstackDepth, m_selectedSampleSymbols );
+                }
+                ImGui::PopID();
+
+                ImGui::TableSetColumnIndex( 1 );
+                ImGui::Text( GetMemoryTagName( sample.m_tag ) );
+
+                ImGui::TableSetColumnIndex( 2 );
+                DrawByteCount( (double) sample.m_size );
+            }
+
+            ImGui::EndTable();
+        }
+
+        //-------------------------------------------------------------------------
+
+        ImGuiX::ScopedFont const sf( ImGuiX::Font::Tiny );
+        for ( auto const& symbol : m_selectedSampleSymbols )
+        {
+            ImGui::Text( symbol.c_str() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MemoryDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
+    {
+        DebugView::Initialize( systemRegistry, pWorld );
+        m_windows.emplace_back( "Memory Tags", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawMemoryTags(); } );
+        m_windows.emplace_back( "Allocation Samples", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawAllocationSamples(); } );
+    }
+
+    void MemoryDebugView::DrawMenu( EntityWorldUpdateContext const& context )
+    {
+        if ( ImGui::MenuItem( "Show Memory Tags" ) )
+        {
+            m_windows[0].m_isOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Show Allocation Samples" ) )
+        {
+            m_windows[1].m_isOpen = true;
+        }
+    }
+}
+#endif
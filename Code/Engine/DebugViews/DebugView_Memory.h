@@ -0,0 +1,40 @@
+#pragma once
+
+#include "DebugView.h"
+#include "Base/Memory/MemoryTracking.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Memory
+{
+    class EE_ENGINE_API MemoryDebugView : public DebugView
+    {
+        EE_REFLECT_TYPE( MemoryDebugView );
+
+        constexpr static uint32_t const s_maxDisplayedSamples = 64;
+
+    public:
+
+        static void DrawMemoryTags();
+
+    public:
+
+        MemoryDebugView() : DebugView( "System/Memory" ) {}
+
+    private:
+
+        virtual void Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld ) override;
+        virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
+
+        void DrawAllocationSamples();
+
+    private:
+
+        AllocationSample                m_samples[s_maxDisplayedSamples];
+        uint32_t                        m_numSamples = 0;
+        int32_t                         m_selectedSampleIdx = InvalidIndex;
+        TVector<String>                 m_selectedSampleSymbols;
+    };
+}
+#endif
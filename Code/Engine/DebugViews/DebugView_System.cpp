@@ -51,7 +51,7 @@ namespace EE
         // Check if there are more entries than we know about, if so updated the filtered list
         //-------------------------------------------------------------------------
 
-        if ( m_numLogEntriesWhenFiltered != Log::System::GetLogEntries().size() )
+        if ( m_numLogEntriesWhenFiltered != Log::System::GetNumProcessedEntries() )
         {
             UpdateFilteredList( context );
         }
@@ -147,33 +147,31 @@ namespace EE
 
     void SystemLogView::UpdateFilteredList( UpdateContext const& context )
     {
-        auto const& logEntries = Log::System::GetLogEntries();
-
         m_filteredEntries.clear();
-        m_filteredEntries.reserve( logEntries.size() );
+        m_numLogEntriesWhenFiltered = Log::System::GetNumProcessedEntries();
 
-        for ( auto const& entry : logEntries )
+        Log::System::ForEachLogEntry( [this] ( Log::LogEntry const& entry )
         {
             switch ( entry.m_severity )
             {
                 case Log::Severity::Warning:
                 if ( !m_showLogWarnings )
                 {
-                    continue;
+                    return;
                 }
                 break;
 
                 case Log::Severity::Error:
                 if ( !m_showLogErrors )
                 {
-                    continue;
+                    return;
                 }
                 break;
 
                 case Log::Severity::Message:
                 if ( !m_showLogMessages )
                 {
-                    continue;
+                    return;
                 }
                 break;
 
@@ -183,24 +181,11 @@ namespace EE
 
             //-------------------------------------------------------------------------
 
-            if ( m_filterWidget.MatchesFilter( entry.m_category ) )
-            {
-                m_filteredEntries.emplace_back( entry );
-                continue;
-            }
-
-            if ( m_filterWidget.MatchesFilter( entry.m_message ) )
+            if ( m_filterWidget.MatchesFilter( entry.m_category ) || m_filterWidget.MatchesFilter( entry.m_message ) || m_filterWidget.MatchesFilter( entry.m_sourceInfo ) )
             {
                 m_filteredEntries.emplace_back( entry );
-                continue;
             }
-
-            if ( m_filterWidget.MatchesFilter( entry.m_sourceInfo ) )
-            {
-                m_filteredEntries.emplace_back( entry );
-                continue;
-            }
-        }
+        } );
     }
 
     //-------------------------------------------------------------------------
@@ -34,7 +34,7 @@ namespace EE
 
         ImGuiX::FilterWidget                                m_filterWidget;
         TVector<Log::LogEntry>                              m_filteredEntries;
-        size_t                                              m_numLogEntriesWhenFiltered = 0;
+        uint64_t                                            m_numLogEntriesWhenFiltered = 0;
     };
 
     //-------------------------------------------------------------------------
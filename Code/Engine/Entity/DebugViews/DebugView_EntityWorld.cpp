@@ -1,10 +1,8 @@
 #include "DebugView_EntityWorld.h"
 #include "Base/Imgui/ImguiX.h"
-#include "Engine/Camera/Components/Component_Camera.h"
 #include "Engine/Entity/EntityWorld.h"
-#include "Engine/Entity/EntitySystem.h"
-#include "Engine/UpdateContext.h"
 #include "Engine/Entity/EntityWorldManager.h"
+#include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 
 //-------------------------------------------------------------------------
@@ -12,353 +10,255 @@
 #if EE_DEVELOPMENT_TOOLS
 namespace EE
 {
-    //EntityDebugView::EntityDebugView()
-    //{
-    //    m_menus.emplace_back( Menu( "Engine/World", [this] ( EntityWorldUpdateContext const& context ) { DrawMenu( context ); } ) );
-    //}
-
-    //void EntityDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
-    //{
-    //    EE_ASSERT( m_pWorld != nullptr );
-
-    //    if ( m_isWorldBrowserOpen )
-    //    {
-    //        if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
-    //        DrawWorldBrowser( context );
-    //    }
-
-    //    if ( m_isMapLoaderOpen )
-    //    {
-    //        if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
-    //        DrawMapLoader( context );
-    //    }
-    //}
-
-    //void EntityDebugView::DrawMenu( EntityWorldUpdateContext const& context )
-    //{
-    //    if ( ImGui::MenuItem( "Show World Browser" ) )
-    //    {
-    //        m_isWorldBrowserOpen = true;
-    //    }
-
-    //    if ( ImGui::MenuItem( "Show Map Loader" ) )
-    //    {
-    //        m_isMapLoaderOpen = true;
-    //    }
-    //}
-
-    ////-------------------------------------------------------------------------
-    //// Map Loader
-    ////-------------------------------------------------------------------------
-
-    //void EntityDebugView::DrawMapLoader( EntityWorldUpdateContext const& context )
-    //{
-    //    ImGui::SetNextWindowBgAlpha( 0.75f );
-    //    if ( ImGui::Begin( "Map Loader", &m_isMapLoaderOpen ) )
-    //    {
-    //        TInlineString<100> tempStr;
-
-    //        TPair<String, ResourceID> maps[] =
-    //        {
-    //            TPair<String, ResourceID>( "BR Minimal", ResourceID( "data://maps/BR_Minimal.map" ) ),
-    //            TPair<String, ResourceID>( "BR Full", ResourceID( "data://maps/BR_Full.map" ) ),
-    //            TPair<String, ResourceID>( "Anim Minimal", ResourceID( "data://maps/AnimTest_Minimal.map" ) ),
-    //            TPair<String, ResourceID>( "Anim Full", ResourceID( "data://maps/AnimTest_Full.map" ) ),
-    //        };
-
-    //        //-------------------------------------------------------------------------
-
-    //        for ( auto i = 0; i < 4; i++ )
-    //        {
-    //            if ( m_pWorld->HasMap( maps[i].second ) )
-    //            {
-    //                tempStr.sprintf( "Unload Map: %s", maps[i].first.c_str() );
-    //                if ( ImGui::Button( tempStr.c_str() ) )
-    //                {
-    //                    const_cast<EntityWorld*>( m_pWorld )->UnloadMap( maps[i].second );
-    //                }
-    //            }
-    //            else
-    //            {
-    //                tempStr.sprintf( "Load Map: %s", maps[i].first.c_str() );
-    //                if ( ImGui::Button( tempStr.c_str() ) )
-    //                {
-    //                    const_cast<EntityWorld*>( m_pWorld )->LoadMap( maps[i].second );
-    //                }
-    //            }
-    //        }
-    //    }
-    //    ImGui::End();
-    //}
-
-    ////-------------------------------------------------------------------------
-    //// World Browser
-    ////-------------------------------------------------------------------------
-
-    //void EntityDebugView::DrawComponentEntry( EntityComponent const* pComponent )
-    //{
-    //    EE_ASSERT( pComponent != nullptr );
-
-    //    ImGui::Text( pComponent->GetNameID().c_str() );
-    //    ImGui::SameLine();
-    //    ImGui::Text( " - %u - ", pComponent->GetID() );
-    //    ImGui::SameLine();
-
-    //    EntityComponent::Status const componentStatus = pComponent->GetStatus();
-    //    
-    //    switch ( componentStatus )
-    //    {
-    //        case EntityComponent::Status::LoadingFailed:
-    //        {
-    //            ImGui::PushStyleColor( ImGuiCol_Text, 0xFF0000FF );
-    //            ImGui::Text( "Load Failed" );
-    //            ImGui::PopStyleColor( 1 );
-    //        }
-    //        break;
-
-    //        case EntityComponent::Status::Unloaded:
-    //        {
-    //            ImGui::PushStyleColor( ImGuiCol_Text, 0xFF666666 );
-    //            ImGui::Text( "Unloaded" );
-    //            ImGui::PopStyleColor( 1 );
-    //        }
-    //        break;
-
-    //        case EntityComponent::Status::Loading:
-    //        {
-    //            ImGui::PushStyleColor( ImGuiCol_Text, 0xFFAAAAAA );
-    //            ImGui::Text( "Loading" );
-    //            ImGui::PopStyleColor( 1 );
-    //        }
-    //        break;
-
-    //        case EntityComponent::Status::Loaded:
-    //        {
-    //            ImGui::PushStyleColor( ImGuiCol_Text, 0xFF00FFFF );
-    //            ImGui::Text( "Loaded" );
-    //            ImGui::PopStyleColor( 1 );
-    //        }
-    //        break;
-
-    //        case EntityComponent::Status::Initialized:
-    //        {
-    //            ImGui::PushStyleColor( ImGuiCol_Text, 0xFF00FFFF );
-    //            ImGui::Text( "Initialized" );
-    //            ImGui::PopStyleColor( 1 );
-    //        }
-    //        break;
-    //    }
-    //}
-
-    //void EntityDebugView::DrawSpatialComponentTree( SpatialEntityComponent const* pComponent )
-    //{
-    //    EE_ASSERT( pComponent != nullptr );
-
-    //    bool const IsNodeExpanded = ImGui::TreeNodeEx( pComponent, ImGuiTreeNodeFlags_DefaultOpen, "" );
-    //    ImGui::SameLine();
-    //    DrawComponentEntry( pComponent );
-
-    //    if( IsNodeExpanded )
-    //    {
-    //        for ( auto pChildComponent : pComponent->m_spatialChildren )
-    //        {
-    //            DrawSpatialComponentTree( pChildComponent );
-    //        }
-
-    //        ImGui::TreePop();
-    //    }
-    //}
-
-    //void EntityDebugView::DrawWorldBrowser( EntityWorldUpdateContext const& context )
-    //{
-    //    EE_ASSERT( m_isWorldBrowserOpen );
-
-    //    auto drawingCtx = context.GetDrawingContext();
-
-    //    //-------------------------------------------------------------------------
-
-    //    m_entities.clear();
-
-    //    int32_t numEntities = 0 ;
-    //    int32_t numSpatialEntities = 0;
-    //    int32_t numComponents = 0;
-
-    //    bool foundSelectedEntity = false;
-
-    //    for ( auto& pLoadedMap : m_pWorld->m_maps )
-    //    {
-    //        if ( pLoadedMap->IsLoaded() )
-    //        {
-    //            numEntities += (int32_t) pLoadedMap->GetEntities().size();
-    //            m_entities.insert( m_entities.end(), pLoadedMap->GetEntities().begin(), pLoadedMap->GetEntities().end() );
-
-    //            for ( Entity* pEntity : pLoadedMap->GetEntities() )
-    //            {
-    //                if ( pEntity == m_pSelectedEntity )
-    //                {
-    //                    foundSelectedEntity = true;
-    //                }
-
-    //                numComponents += pEntity->GetNumComponents();
-
-    //                if ( pEntity->IsSpatialEntity() )
-    //                {
-    //                    numSpatialEntities++;
-    //                }
-    //            }
-    //        }
-    //    }
-
-    //    if ( !foundSelectedEntity )
-    //    {
-    //        m_pSelectedEntity = nullptr;
-    //    }
-
-    //    //-------------------------------------------------------------------------
-
-    //    ImGui::SetNextWindowBgAlpha( 0.5f );
-    //    if ( ImGui::Begin( "World", &m_isWorldBrowserOpen ) )
-    //    {
-    //        // Draw World Info
-    //        //-------------------------------------------------------------------------
-
-    //        ImGui::Text( "Total number of entities: %d", numEntities );
-    //        ImGui::Text( "Total number of components: %d", numComponents );
-    //        ImGui::Text( "Number of spatial entities: %d", numSpatialEntities );
-
-    //        ImGui::Separator();
-
-    //        // Draw Entity List
-    //        //-------------------------------------------------------------------------
-
-    //        ImGui::BeginGroup();
-
-    //        static ImGuiTextFilter filter;
-    //        filter.Draw( "##EntityFilter", 300 );
-
-    //        ImGui::SetNextWindowBgAlpha( 0.5f );
-    //        if ( ImGui::BeginChild( ImGui::GetID( (void*) (intptr_t) 0 ), ImVec2( 300, -1 ), true, 0 ) )
-    //        {
-    //            for ( auto i = 0u; i < m_entities.size(); i++ )
-    //            {
-    //                if ( !filter.PassFilter( m_entities[i]->GetNameID().c_str() ) )
-    //                {
-    //                    continue;
-    //                }
-
-    //                if ( m_pSelectedEntity == m_entities[i] )
-    //                {
-    //                    ImGui::PushStyleColor( ImGuiCol_Text, 0xFF00FFFF );
-    //                    ImGui::Button( m_entities[i]->GetNameID().c_str() );
-    //                    ImGui::PopStyleColor( 1 );
-    //                }
-    //                else
-    //                {
-    //                    String const buttonLabel = String( String::CtorSprintf(), "%u - %s##%d", m_entities[i]->GetID().m_value, m_entities[i]->GetNameID().c_str(), i );
-    //                    if ( ImGui::Button( buttonLabel.c_str() ) )
-    //                    {
-    //                        m_pSelectedEntity = m_entities[i];
-    //                    }
-    //                }
-
-    //                //-------------------------------------------------------------------------
-
-    //                if ( ImGui::IsItemHovered() )
-    //                {
-    //                    if ( m_entities[i]->IsSpatialEntity() )
-    //                    {
-    //                        drawingCtx.DrawPoint( m_entities[i]->GetWorldTransform().GetTranslation(), Colors::Yellow, 10.0f );
-    //                    }
-    //                }
-    //            }
-    //        }
-    //        ImGui::EndChild();
-
-    //        ImGui::EndGroup();
-
-    //        //-------------------------------------------------------------------------
-
-    //        ImGui::SameLine();
-
-    //        // Draw Entity Details
-    //        //-------------------------------------------------------------------------
-
-    //        ImGui::SetNextWindowBgAlpha( 0.5f );
-    //        if ( ImGui::BeginChild( ImGui::GetID( (void*) (intptr_t) 1 ), ImVec2( -1, -1 ), true, 0 ) )
-    //        {
-    //            if ( m_pSelectedEntity != nullptr )
-    //            {
-    //                ImGui::Text( "Entity Name: %s", m_pSelectedEntity->GetNameID().c_str() );
-    //                ImGui::Text( "Entity ID: %u", m_pSelectedEntity->GetID() );
-
-    //                ImGui::Separator();
-
-    //                //-------------------------------------------------------------------------
-
-    //                if ( m_pSelectedEntity->IsSpatialEntity() )
-    //                {
-    //                    if ( ImGui::CollapsingHeader( "Spatial Info", ImGuiTreeNodeFlags_DefaultOpen ) )
-    //                    {
-    //                        auto const& transform = m_pSelectedEntity->GetWorldTransform();
-    //                        auto const eulerAngles = transform.GetRotation().ToEulerAngles();
-    //                        ImGui::Text( "Rotation: %.2f %.2f %.2f", eulerAngles.m_x, eulerAngles.m_y, eulerAngles.m_z );
-    //                        ImGui::Text( "Translation: %.2f %.2f %.2f", transform.GetTranslation().GetX(), transform.GetTranslation().GetY(), transform.GetTranslation().GetZ() );
-    //                        ImGui::Text( "Scale: %.2f", transform.GetScale() );
-    //                    }
-    //                }
-
-    //                //-------------------------------------------------------------------------
-
-    //                if ( !m_pSelectedEntity->GetSystems().empty() )
-    //                {
-    //                    if ( ImGui::CollapsingHeader( "Systems", ImGuiTreeNodeFlags_DefaultOpen ) )
-    //                    {
-    //                        for ( auto pSystem : m_pSelectedEntity->GetSystems() )
-    //                        {
-    //                            ImGui::Text( pSystem->GetName() );
-    //                        }
-    //                    }
-    //                }
-
-    //                //-------------------------------------------------------------------------
-
-    //                TInlineVector<EntityComponent*, 10> components;
-    //                for ( auto pComponent : m_pSelectedEntity->GetComponents() )
-    //                {
-    //                    if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
-    //                    {
-    //                        continue;
-    //                    }
-
-    //                    components.emplace_back( pComponent );
-    //                }
-
-    //                if ( !components.empty() )
-    //                {
-    //                    if ( ImGui::CollapsingHeader( "Components", ImGuiTreeNodeFlags_DefaultOpen ) )
-    //                    {
-    //                        for ( auto pComponent : components )
-    //                        {
-    //                            DrawComponentEntry( pComponent );
-    //                        }
-    //                    }
-    //                }
-
-    //                //-------------------------------------------------------------------------
-
-    //                auto pRootComponent = m_pSelectedEntity->GetRootSpatialComponent();
-    //                if ( pRootComponent != nullptr )
-    //                {
-    //                    if ( ImGui::CollapsingHeader( "Spatial Components", ImGuiTreeNodeFlags_DefaultOpen ) )
-    //                    {
-    //                        DrawSpatialComponentTree( pRootComponent );
-    //                    }
-    //                }
-    //            }
-    //        }
-    //        ImGui::EndChild();
-    //    }
-    //    ImGui::End();
-    //}
+    static char const* const g_updateStageNames[] = { "Frame Start", "Pre-Physics", "Physics", "Post-Physics", "Frame End", "Paused" };
+    static_assert( sizeof( g_updateStageNames ) / sizeof( g_updateStageNames[0] ) == (int32_t) UpdateStage::NumStages );
+
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
+    {
+        DebugView::Initialize( systemRegistry, pWorld );
+        m_pWorldManager = systemRegistry.GetSystem<EntityWorldManager>();
+        m_windows.emplace_back( "World Systems", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawWorldSystemsWindow( context ); } );
+        m_windows.emplace_back( "Worlds", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawWorldsWindow( context ); } );
+        m_windows.emplace_back( "Entity Update Rates", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawUpdateRatesWindow( context ); } );
+    }
+
+    void EntityDebugView::Shutdown()
+    {
+        m_pWorldManager = nullptr;
+        DebugView::Shutdown();
+    }
+
+    void EntityDebugView::DrawMenu( EntityWorldUpdateContext const& context )
+    {
+        if ( ImGui::MenuItem( "World Systems" ) )
+        {
+            m_windows[0].m_isOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Worlds" ) )
+        {
+            m_windows[1].m_isOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Entity Update Rates" ) )
+        {
+            m_windows[2].m_isOpen = true;
+        }
+    }
+
+    void EntityDebugView::DrawWorldSystemsWindow( EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( m_pWorld != nullptr );
+
+        bool isParallelUpdateEnabled = m_pWorld->IsParallelSystemUpdateEnabled();
+        if ( ImGui::Checkbox( "Parallel System Update", &isParallelUpdateEnabled ) )
+        {
+            const_cast<EntityWorld*>( m_pWorld )->SetParallelSystemUpdateEnabled( isParallelUpdateEnabled );
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+        {
+            EntityWorld::SystemUpdateSchedule const& schedule = m_pWorld->m_systemUpdateSchedules[stageIdx];
+            if ( schedule.m_systems.empty() )
+            {
+                continue;
+            }
+
+            // The serial time is what the stage would cost on a single thread, the critical path is the best we can do with the current levels
+            float serialTime = 0.0f;
+            float criticalPathTime = 0.0f;
+            int32_t const numLevels = schedule.GetNumLevels();
+            for ( int32_t levelIdx = 0; levelIdx < numLevels; levelIdx++ )
+            {
+                float levelTime = 0.0f;
+                int32_t const levelStartIdx = schedule.GetLevelStartIndex( levelIdx );
+                int32_t const levelEndIdx = levelStartIdx + schedule.GetLevelSize( levelIdx );
+                for ( int32_t i = levelStartIdx; i < levelEndIdx; i++ )
+                {
+                    serialTime += schedule.m_systemUpdateTimes[i];
+                    levelTime = Math::Max( levelTime, (float) schedule.m_systemUpdateTimes[i] );
+                }
+
+                criticalPathTime += levelTime;
+            }
+
+            float const elapsedTime = schedule.m_elapsedTime;
+            float const recoveredTime = Math::Max( serialTime - elapsedTime, 0.0f );
+            float const recoveredPercentage = ( serialTime > 0.0f ) ? ( recoveredTime / serialTime ) * 100.0f : 0.0f;
+
+            //-------------------------------------------------------------------------
+
+            ImGui::PushFont( ImGuiX::GetFont( ImGuiX::Font::Large ) );
+            ImGui::Text( "%s", g_updateStageNames[stageIdx] );
+            ImGui::Separator();
+            ImGui::PopFont();
+
+            ImGui::Text( "Systems: %d, Levels: %d", (int32_t) schedule.m_systems.size(), numLevels );
+            ImGui::Text( "Serial: %.3fms, Critical Path: %.3fms, Elapsed: %.3fms", serialTime, criticalPathTime, elapsedTime );
+            ImGui::Text( "Recovered: %.3fms (%.1f%%)", recoveredTime, recoveredPercentage );
+
+            ImGui::PushID( stageIdx );
+            if ( ImGui::TreeNode( "Systems" ) )
+            {
+                for ( int32_t levelIdx = 0; levelIdx < numLevels; levelIdx++ )
+                {
+                    int32_t const levelStartIdx = schedule.GetLevelStartIndex( levelIdx );
+                    int32_t const levelEndIdx = levelStartIdx + schedule.GetLevelSize( levelIdx );
+                    for ( int32_t i = levelStartIdx; i < levelEndIdx; i++ )
+                    {
+                        ImGui::Text( "[%d] %s: %.3fms", levelIdx, schedule.m_systems[i]->GetTypeInfo()->GetFriendlyTypeName(), (float) schedule.m_systemUpdateTimes[i] );
+                    }
+                }
+
+                ImGui::TreePop();
+            }
+            ImGui::PopID();
+
+            ImGui::NewLine();
+        }
+    }
+
+    void EntityDebugView::DrawWorldsWindow( EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( m_pWorldManager != nullptr );
+
+        bool isConcurrentUpdateEnabled = m_pWorldManager->IsConcurrentWorldUpdateEnabled();
+        if ( ImGui::Checkbox( "Concurrent World Update", &isConcurrentUpdateEnabled ) )
+        {
+            m_pWorldManager->SetConcurrentWorldUpdateEnabled( isConcurrentUpdateEnabled );
+        }
+
+        // The total time is the wall-clock time for all worlds, with a concurrent update it should approach the slowest world's time
+        float totalTime = 0.0f;
+        for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+        {
+            totalTime += m_pWorldManager->GetLastUpdateTime( (UpdateStage) stageIdx );
+        }
+        ImGui::Text( "Total Update: %.3fms", totalTime );
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginTable( "WorldsTable", 4 + (int32_t) UpdateStage::NumStages, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "World" );
+            ImGui::TableSetupColumn( "Frame" );
+            for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+            {
+                ImGui::TableSetupColumn( g_updateStageNames[stageIdx] );
+            }
+            ImGui::TableSetupColumn( "Pooled Instances" );
+            ImGui::TableSetupColumn( "Pool Memory (Used/Reserved)" );
+            ImGui::TableHeadersRow();
+
+            for ( EntityWorld const* pWorld : m_pWorldManager->GetWorlds() )
+            {
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%s%s", pWorld->GetDebugName().c_str(), pWorld->IsSuspended() ? " (Suspended)" : "" );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3fms", (float) pWorld->GetLastFrameUpdateTime() );
+
+                for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3fms", (float) pWorld->GetLastUpdateTime( (UpdateStage) stageIdx ) );
+                }
+
+                TypeSystem::TypeInstancePool::Stats const poolStats = pWorld->GetInstancePoolStats();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d (%d types)", poolStats.m_numLiveInstances, poolStats.m_numTypes );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2fKB / %.2fKB", poolStats.m_usedMemory / 1024.0f, poolStats.m_reservedMemory / 1024.0f );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    void EntityDebugView::DrawUpdateRatesWindow( EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( m_pWorld != nullptr );
+        EntityWorld* pWorld = const_cast<EntityWorld*>( m_pWorld );
+
+        bool isUpdateRateLODEnabled = pWorld->IsUpdateRateLODEnabled();
+        if ( ImGui::Checkbox( "Enable Update Rate LOD", &isUpdateRateLODEnabled ) )
+        {
+            pWorld->SetUpdateRateLODEnabled( isUpdateRateLODEnabled );
+        }
+
+        // Settings
+        //-------------------------------------------------------------------------
+
+        EntityWorld::UpdateRateSettings settings = pWorld->GetUpdateRateSettings();
+        bool settingsChanged = false;
+        settingsChanged |= ImGui::DragFloat( "Half Rate Distance", &settings.m_halfRateDistance, 1.0f, 0.0f, 1000.0f, "%.1fm" );
+        settingsChanged |= ImGui::DragFloat( "Quarter Rate Distance", &settings.m_quarterRateDistance, 1.0f, 0.0f, 1000.0f, "%.1fm" );
+        settingsChanged |= ImGui::DragFloat( "Eighth Rate Distance", &settings.m_eighthRateDistance, 1.0f, 0.0f, 1000.0f, "%.1fm" );
+        settingsChanged |= ImGui::SliderInt( "Hidden Update Interval", &settings.m_hiddenUpdateInterval, 1, 16 );
+        settingsChanged |= ImGui::DragInt( "Update Budget", &settings.m_maxReducedRateUpdatesPerFrame, 1.0f, 0, 10000 );
+        if ( settingsChanged )
+        {
+            pWorld->SetUpdateRateSettings( settings );
+        }
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        ImGui::NewLine();
+        ImGui::PushFont( ImGuiX::GetFont( ImGuiX::Font::Large ) );
+        ImGui::Text( "Stats" );
+        ImGui::Separator();
+        ImGui::PopFont();
+
+        EntityWorld::UpdateRateStats const& stats = pWorld->GetUpdateRateStats();
+        ImGui::Text( "Entities: %d, Reduced Rate: %d", (int32_t) pWorld->m_entityUpdateList.size(), stats.m_numReducedRateEntities );
+        ImGui::Text( "Reduced Rate Updated: %d, Skipped: %d", stats.m_numUpdated, stats.m_numSkipped );
+
+        if ( stats.m_numDeferred > 0 )
+        {
+            ImGui::TextColored( Colors::Red.ToFloat4(), "Budget Overrun: %d updates deferred", stats.m_numDeferred );
+        }
+        else
+        {
+            ImGui::Text( "Budget Overrun: None" );
+        }
+
+        // Count the entities per interval
+        int32_t numEntitiesPerInterval[9] = {};
+        int32_t numEntitiesWithLongerIntervals = 0;
+        for ( Entity const* pEntity : pWorld->m_entityUpdateList )
+        {
+            int32_t const updateInterval = pEntity->GetUpdateInterval();
+            if ( updateInterval < 9 )
+            {
+                numEntitiesPerInterval[updateInterval]++;
+            }
+            else
+            {
+                numEntitiesWithLongerIntervals++;
+            }
+        }
+
+        for ( int32_t i = 1; i < 9; i++ )
+        {
+            if ( numEntitiesPerInterval[i] > 0 )
+            {
+                ImGui::BulletText( "Every %d frame(s): %d", i, numEntitiesPerInterval[i] );
+            }
+        }
+
+        if ( numEntitiesWithLongerIntervals > 0 )
+        {
+            ImGui::BulletText( "Longer intervals: %d", numEntitiesWithLongerIntervals );
+        }
+    }
 }
-#endif
\ No newline at end of file
+#endif
@@ -1,46 +1,38 @@
 #pragma once
 
-//#include "Engine/Entity/EntityWorldDebugView.h"
+#include "Engine/DebugViews/DebugView.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE
 {
-    //class EntityWorldManager;
-    //class Entity;
-    //class EntityComponent;
-    //class SpatialEntityComponent;
+    class EntityWorldManager;
 
-    ////-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
 
-    //class EntityDebugView : public DebugView
-    //{
-    //    EE_REFLECT_TYPE( EntityDebugView );
+    class EE_ENGINE_API EntityDebugView : public DebugView
+    {
+        EE_REFLECT_TYPE( EntityDebugView );
 
-    //public:
+    public:
 
-    //    EntityDebugView();
+        EntityDebugView() : DebugView( "Engine/Entity" ) {}
 
-    //private:
+    private:
 
-    //    virtual void DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass ) override;
+        virtual void Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld ) override;
+        virtual void Shutdown() override;
 
-    //    void DrawMenu( EntityWorldUpdateContext const& context );
-    //    void DrawWorldBrowser( EntityWorldUpdateContext const& context );
-    //    void DrawMapLoader( EntityWorldUpdateContext const& context );
+        void DrawMenu( EntityWorldUpdateContext const& context ) override;
 
-    //    void DrawComponentEntry( EntityComponent const* pComponent );
-    //    void DrawSpatialComponentTree( SpatialEntityComponent const* pComponent );
+        void DrawWorldSystemsWindow( EntityWorldUpdateContext const& context );
+        void DrawWorldsWindow( EntityWorldUpdateContext const& context );
+        void DrawUpdateRatesWindow( EntityWorldUpdateContext const& context );
 
-    //private:
+    private:
 
-    //    bool                    m_isWorldBrowserOpen = false;
-    //    bool                    m_isMapLoaderOpen = false;
-
-    //    // Browser Data
-    //    TVector<Entity*>        m_entities;
-    //    Entity*                 m_pSelectedEntity = nullptr;
-    //};
+        EntityWorldManager*             m_pWorldManager = nullptr;
+    };
 }
-#endif
\ No newline at end of file
+#endif
@@ -6,6 +6,7 @@
 #include "EntityLog.h"
 #include "Base/Resource/ResourceRequesterID.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/TypeSystem/TypeInstancePool.h"
 #include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
@@ -47,8 +48,8 @@ namespace EE
             // All other actions can be ignored
             if ( action.m_type == EntityInternalStateAction::Type::AddComponent )
             {
-                auto pComponent = reinterpret_cast<EntityComponent const*>( action.m_ptr );
-                EE::Delete( pComponent );
+                auto pComponent = (EntityComponent*) action.m_ptr;
+                TypeSystem::TypeInstancePool::DestroyInstance( pComponent->m_isCreatedFromInstancePool ? m_pInstancePool : nullptr, pComponent );
             }
         }
         m_deferredActions.clear();
@@ -56,7 +57,7 @@ namespace EE
         // Destroy Systems
         for ( auto& pSystem : m_systems )
         {
-            EE::Delete( pSystem );
+            TypeSystem::TypeInstancePool::DestroyInstance( m_pInstancePool, pSystem );
         }
 
         m_systems.clear();
@@ -64,7 +65,7 @@ namespace EE
         // Destroy components
         for ( auto& pComponent : m_components )
         {
-            EE::Delete( pComponent );
+            TypeSystem::TypeInstancePool::DestroyInstance( pComponent->m_isCreatedFromInstancePool ? m_pInstancePool : nullptr, pComponent );
         }
 
         m_components.clear();
@@ -796,7 +797,7 @@ namespace EE
         #endif
 
         // Create the new system and add it
-        auto pSystem = (EntitySystem*) pSystemTypeInfo->CreateType();
+        auto pSystem = ( m_pInstancePool != nullptr ) ? m_pInstancePool->CreateType<EntitySystem>( pSystemTypeInfo ) : (EntitySystem*) pSystemTypeInfo->CreateType();
         m_systems.emplace_back( pSystem );
 
         // If the entity is already initialized, then initialize the system
@@ -904,7 +905,7 @@ namespace EE
         }
 
         // Destroy the system
-        EE::Delete( pSystem );
+        TypeSystem::TypeInstancePool::DestroyInstance( m_pInstancePool, pSystem );
         m_systems.erase_unsorted( m_systems.begin() + systemIdx );
     }
     
@@ -915,7 +916,8 @@ namespace EE
     void Entity::CreateComponent( TypeSystem::TypeInfo const* pComponentTypeInfo, ComponentID const& parentSpatialComponentID )
     {
         EE_ASSERT( pComponentTypeInfo != nullptr && pComponentTypeInfo->IsDerivedFrom<EntityComponent>() );
-        EntityComponent* pComponent = Cast<EntityComponent>( pComponentTypeInfo->CreateType() );
+        EntityComponent* pComponent = ( m_pInstancePool != nullptr ) ? m_pInstancePool->CreateType<EntityComponent>( pComponentTypeInfo ) : Cast<EntityComponent>( pComponentTypeInfo->CreateType() );
+        pComponent->m_isCreatedFromInstancePool = ( m_pInstancePool != nullptr );
 
         #if EE_DEVELOPMENT_TOOLS
         pComponent->m_name = StringID( pComponentTypeInfo->GetFriendlyTypeName() );
@@ -1092,7 +1094,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_components.erase_unsorted( m_components.begin() + componentIdx );
-        EE::Delete( pComponent );
+        TypeSystem::TypeInstancePool::DestroyInstance( pComponent->m_isCreatedFromInstancePool ? m_pInstancePool : nullptr, pComponent );
     }
 
     void Entity::RemoveComponentFromSpatialHierarchy( SpatialEntityComponent* pSpatialComponent )
@@ -29,7 +29,9 @@ namespace EE
 {
     class SystemRegistry;
     class EntitySystem;
+    class EntityWorld;
     class EntityWorldUpdateContext;
+    namespace TypeSystem { class TypeInstancePool; }
 
     namespace EntityModel
     {
@@ -45,10 +47,24 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    // How often an entity is updated, the world selects the actual update interval each frame
+    enum class UpdateRatePolicy : uint8_t
+    {
+        EE_REFLECT_ENUM
+
+        EveryFrame = 0,     // Always updated
+        Distance,           // Updated less often the further it is from the world's viewport
+        Visibility,         // Updated less often when outside the world's view volume
+        FixedInterval,      // Updated every N frames
+    };
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API Entity : public IReflectedType
     {
         EE_REFLECT_TYPE( Entity );
 
+        friend EntityWorld;
         friend EntityModel::Serializer;
         friend EntityModel::EntityMap;
 
@@ -201,6 +217,27 @@ namespace EE
         inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
         inline bool HasStateChangeActionsPending() const { return !m_deferredActions.empty(); }
 
+        // Update Rate
+        //-------------------------------------------------------------------------
+        // Reduced rate entities skip frames and receive the accumulated delta time of the skipped frames when they are updated
+        // Attached entities are updated as part of their parent's chain, so they follow their parent's update rate
+
+        inline UpdateRatePolicy GetUpdateRatePolicy() const { return m_updateRatePolicy; }
+        inline void SetUpdateRatePolicy( UpdateRatePolicy policy ) { m_updateRatePolicy = policy; }
+
+        // The number of frames between updates, only used with the 'FixedInterval' policy
+        inline int32_t GetFixedUpdateInterval() const { return m_fixedUpdateInterval; }
+        inline void SetFixedUpdateInterval( int32_t interval ) { EE_ASSERT( interval >= 1 && interval <= 255 ); m_fixedUpdateInterval = (uint8_t) interval; }
+
+        // The number of frames between updates as selected by the world for the current frame
+        inline int32_t GetUpdateInterval() const { return m_updateInterval; }
+
+        // Is this entity due for an update this frame
+        inline bool IsUpdateDue() const { return m_isUpdateDue; }
+
+        // The delta time to use for this frame's update, zero means use the frame delta time
+        inline Seconds GetUpdateDeltaTime() const { return m_updateDeltaTime; }
+
         // Components
         //-------------------------------------------------------------------------
         // NB!!! Add and remove operations execute immediately for unloaded entities BUT will be deferred to the next loading phase for loaded entities
@@ -377,6 +414,16 @@ namespace EE
         EE_REFLECT() StringID                               m_parentAttachmentSocketID;                                             // The socket that we are attached to on the parent
         bool                                                m_isSpatialAttachmentCreated = false;                                   // Has the actual component-to-component attachment been created
 
+        EE_REFLECT() UpdateRatePolicy                       m_updateRatePolicy = UpdateRatePolicy::EveryFrame;                     // Serialized via the entity descriptor
+        EE_REFLECT() uint8_t                                m_fixedUpdateInterval = 1;                                              // Serialized via the entity descriptor, only used for the fixed interval policy
+        uint8_t                                             m_updateInterval = 1;                                                   // The number of frames between updates, selected by the world
+        uint8_t                                             m_framesUntilUpdate = 0;
+        bool                                                m_isUpdateDue = true;                                                   // Should this entity be updated this frame
+        Seconds                                             m_accumulatedDeltaTime = 0.0f;                                          // The delta time of the frames we skipped
+        Seconds                                             m_updateDeltaTime = 0.0f;                                               // The delta time to use for this frame's update, zero means use the frame delta time
+
+        TypeSystem::TypeInstancePool*                       m_pInstancePool = nullptr;                                              // The pool that the entity (and its serialized components and systems) were created from, if any
+
         TVector<EntityInternalStateAction>                  m_deferredActions;                                                      // The set of internal entity state changes that need to be executed
         Threading::RecursiveMutex                           m_internalStateMutex;                                                   // A mutex that needs to be lock due to internal state changes
     };
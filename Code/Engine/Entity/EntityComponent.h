@@ -93,6 +93,7 @@ namespace EE
         Status                                              m_status = Status::Unloaded;                    // Component status
         bool                                                m_isRegisteredWithEntity = false;               // Registered with its parent entity's local systems
         bool                                                m_isRegisteredWithWorld = false;                // Registered with the global systems in it's parent world
+        bool                                                m_isCreatedFromInstancePool = false;            // Was this component created from its entity's instance pool (components can also be created externally and added)
     };
 }
 
@@ -12,7 +12,7 @@ namespace EE
     class TaskSystem;
     class EntityWorldSystem;
     namespace Resource { class ResourceSystem; }
-    namespace TypeSystem { class TypeRegistry; }
+    namespace TypeSystem { class TypeRegistry; class TypeInstancePool; }
 }
 
 //-------------------------------------------------------------------------
@@ -23,10 +23,11 @@ namespace EE::EntityModel
     {
         LoadingContext() = default;
 
-        LoadingContext( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const* pTypeRegistry, Resource::ResourceSystem* pResourceSystem )
+        LoadingContext( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const* pTypeRegistry, Resource::ResourceSystem* pResourceSystem, TypeSystem::TypeInstancePool* pInstancePool = nullptr )
             : m_pTaskSystem( pTaskSystem )
             , m_pTypeRegistry( pTypeRegistry )
             , m_pResourceSystem( pResourceSystem )
+            , m_pInstancePool( pInstancePool )
         {
             EE_ASSERT( m_pTypeRegistry != nullptr && m_pResourceSystem != nullptr );
         }
@@ -41,6 +42,7 @@ namespace EE::EntityModel
         TaskSystem*                                                     m_pTaskSystem = nullptr;
         TypeSystem::TypeRegistry const*                                 m_pTypeRegistry = nullptr;
         Resource::ResourceSystem*                                       m_pResourceSystem = nullptr;
+        TypeSystem::TypeInstancePool*                                   m_pInstancePool = nullptr; // Optional, used to allocate entities, components and systems
     };
 
     //-------------------------------------------------------------------------
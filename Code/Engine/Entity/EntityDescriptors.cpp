@@ -74,6 +74,21 @@ namespace EE::EntityModel
         return foundComponents;
     }
 
+    void SerializedEntityCollection::CompilePropertySetters( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Compile Entity Collection" );
+
+        for ( auto& entityDesc : m_entityDescriptors )
+        {
+            for ( auto& componentDesc : entityDesc.m_components )
+            {
+                componentDesc.CompilePropertySetters( typeRegistry );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     void SerializedEntityCollection::Clear()
     {
@@ -63,7 +63,7 @@ namespace EE::EntityModel
 
     struct EE_ENGINE_API SerializedEntityDescriptor
     {
-        EE_SERIALIZE( m_name, m_spatialParentName, m_attachmentSocketID, m_systems, m_components, m_numSpatialComponents );
+        EE_SERIALIZE( m_name, m_spatialParentName, m_attachmentSocketID, m_systems, m_components, m_numSpatialComponents, m_updateRatePolicy, m_fixedUpdateInterval );
 
     public:
 
@@ -92,6 +92,8 @@ namespace EE::EntityModel
         TInlineVector<SerializedSystemDescriptor, 5>                m_systems;
         TVector<SerializedComponentDescriptor>                      m_components; // Ordered list of components: spatial components are first, followed by regular components
         int32_t                                                     m_numSpatialComponents = 0;
+        uint8_t                                                     m_updateRatePolicy = 0; // The entity's update rate policy (see UpdateRatePolicy)
+        uint8_t                                                     m_fixedUpdateInterval = 1;
 
         #if EE_DEVELOPMENT_TOOLS
         EntityID                                                    m_transientEntityID; // WARNING: this is not serialized, and it is only stored for undo/redo support in the tools
@@ -224,6 +226,10 @@ namespace EE::EntityModel
             return HasComponentsOfType( typeRegistry, T::GetStaticTypeID(), allowDerivedTypes );
         }
 
+        // Compile the property setters for all component descriptors, this makes instantiating the collection significantly cheaper
+        // This is done once at load time, the descriptors are immutable after that
+        void CompilePropertySetters( TypeSystem::TypeRegistry const& typeRegistry );
+
         // Collection Creation and Info
         //-------------------------------------------------------------------------
 
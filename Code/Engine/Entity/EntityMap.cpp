@@ -6,6 +6,7 @@
 #include "Entity.h"
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/TypeSystem/TypeInstancePool.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
@@ -76,6 +77,7 @@ namespace EE::EntityModel
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
         m_status = map.m_status;
+        m_pInstancePool = map.m_pInstancePool;
         const_cast<bool&>( m_isTransientMap ) = map.m_isTransientMap;
 
         // Clear source map
@@ -158,7 +160,7 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
 
         createdEntities.clear();
-        createdEntities = Serializer::CreateEntities( pTaskSystem, typeRegistry, entityCollectionDesc );
+        createdEntities = Serializer::CreateEntities( pTaskSystem, typeRegistry, entityCollectionDesc, m_pInstancePool );
         AddEntities( createdEntities, offsetTransform );
     }
 
@@ -221,7 +223,7 @@ namespace EE::EntityModel
 
             if ( destroyEntityOnceRemoved )
             {
-                EE::Delete( pEntityToRemove );
+                TypeSystem::TypeInstancePool::DestroyInstance( pEntityToRemove->m_pInstancePool, pEntityToRemove );
             }
         }
         else // Queue removal
@@ -276,6 +278,8 @@ namespace EE::EntityModel
 
         Threading::RecursiveScopeLock lock( m_mutex );
 
+        m_pInstancePool = loadingContext.m_pInstancePool;
+
         if ( m_isTransientMap )
         {
             m_status = Status::Loaded;
@@ -317,7 +321,7 @@ namespace EE::EntityModel
         if ( m_pMapDesc->IsValid() )
         {
             // Create all required entities
-            TVector<Entity*> const createdEntities = Serializer::CreateEntities( loadingContext.m_pTaskSystem, *loadingContext.m_pTypeRegistry, *m_pMapDesc.GetPtr() );
+            TVector<Entity*> const createdEntities = Serializer::CreateEntities( loadingContext.m_pTaskSystem, *loadingContext.m_pTypeRegistry, *m_pMapDesc.GetPtr(), m_pInstancePool );
 
             // Reserve memory for new entities in internal structures
             m_entities.reserve( m_entities.size() + createdEntities.size() );
@@ -429,7 +433,7 @@ namespace EE::EntityModel
             {
                 pEntity->UnloadComponents( loadingContext );
             }
-            EE::Delete( pEntity );
+            TypeSystem::TypeInstancePool::DestroyInstance( pEntity->m_pInstancePool, pEntity );
         }
 
         m_entities.clear();
@@ -487,7 +491,7 @@ namespace EE::EntityModel
             // Destroy the entity if this is a destruction request
             if ( removalRequest.m_shouldDestroy )
             {
-                EE::Delete( pEntityToRemove );
+                TypeSystem::TypeInstancePool::DestroyInstance( pEntityToRemove->m_pInstancePool, pEntityToRemove );
             }
 
             // Remove the request from the list
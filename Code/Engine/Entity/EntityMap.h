@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "EntityDescriptors.h"
 #include "Base/Types/Event.h"
+#include "Base/Types/FlatHashMap.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Resource/ResourcePtr.h"
 #include "Base/Math/Transform.h"
@@ -20,6 +21,7 @@
 namespace EE
 {
     class Entity;
+    namespace TypeSystem { class TypeInstancePool; }
 
     //-------------------------------------------------------------------------
 
@@ -188,16 +190,17 @@ namespace EE
             Threading::RecursiveMutex                   m_mutex;
             TResourcePtr<SerializedEntityMap>           m_pMapDesc;
             TVector<Entity*>                            m_entities;
-            THashMap<EntityID, Entity*>                 m_entityIDLookupMap;
+            TFlatHashMap<EntityID, Entity*>             m_entityIDLookupMap;
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToLoad;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
             EventBindingID                              m_entityUpdateEventBindingID;
             Status                                      m_status = Status::Unloaded;
+            TypeSystem::TypeInstancePool*               m_pInstancePool = nullptr; // The pool to create our entities from, set by the loading context
             bool const                                  m_isTransientMap = false; // If this is set, then this is a transient map i.e.created and managed at runtime and not loaded from disk
 
             #if EE_DEVELOPMENT_TOOLS
-            THashMap<StringID, Entity*>                 m_entityNameLookupMap; // All entities that have attempted to load
+            TFlatHashMap<StringID, Entity*>             m_entityNameLookupMap; // All entities that have attempted to load
             TVector<Entity*>                            m_entitiesToHotReload;
             TVector<Entity*>                            m_editedEntities;
             #endif
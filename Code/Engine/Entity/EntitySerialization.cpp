@@ -2,6 +2,7 @@
 #include "Entity.h"
 #include "EntityDescriptors.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/TypeSystem/TypeInstancePool.h"
 #include "Base/Profiling.h"
 #include "Base/Threading/TaskSystem.h"
 #include "EntityLog.h"
@@ -13,7 +14,7 @@
 
 namespace EE::EntityModel
 {
-    Entity* Serializer::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc )
+    Entity* Serializer::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc, TypeSystem::TypeInstancePool* pInstancePool )
     {
         EE_ASSERT( entityDesc.IsValid() );
 
@@ -23,8 +24,12 @@ namespace EE::EntityModel
         // Create new entity
         //-------------------------------------------------------------------------
 
-        auto pEntity = reinterpret_cast<Entity*>( pEntityTypeInfo->CreateType() );
+        auto pEntity = ( pInstancePool != nullptr ) ? pInstancePool->CreateType<Entity>( pEntityTypeInfo ) : reinterpret_cast<Entity*>( pEntityTypeInfo->CreateType() );
         pEntity->m_name = entityDesc.m_name;
+        pEntity->m_pInstancePool = pInstancePool;
+        EE_ASSERT( entityDesc.m_updateRatePolicy <= (uint8_t) UpdateRatePolicy::FixedInterval );
+        pEntity->m_updateRatePolicy = (UpdateRatePolicy) entityDesc.m_updateRatePolicy;
+        pEntity->m_fixedUpdateInterval = Math::Max( entityDesc.m_fixedUpdateInterval, (uint8_t) 1 );
 
         #if EE_DEVELOPMENT_TOOLS
         // Restore entity ID if valid
@@ -40,7 +45,16 @@ namespace EE::EntityModel
 
         for ( EntityModel::SerializedComponentDescriptor const& componentDesc : entityDesc.m_components )
         {
-            auto pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            EntityComponent* pEntityComponent = nullptr;
+            if ( pInstancePool != nullptr )
+            {
+                pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry, typeRegistry.GetTypeInfo( componentDesc.m_typeID ), *pInstancePool );
+                pEntityComponent->m_isCreatedFromInstancePool = true;
+            }
+            else
+            {
+                pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            }
             EE_ASSERT( pEntityComponent != nullptr );
 
             TypeSystem::TypeInfo const* pTypeInfo = pEntityComponent->GetTypeInfo();
@@ -119,7 +133,7 @@ namespace EE::EntityModel
         for ( auto const& systemDesc : entityDesc.m_systems )
         {
             TypeSystem::TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( systemDesc.m_typeID );
-            auto pEntitySystem = reinterpret_cast<EntitySystem*>( pTypeInfo->CreateType() );
+            auto pEntitySystem = ( pInstancePool != nullptr ) ? pInstancePool->CreateType<EntitySystem>( pTypeInfo ) : reinterpret_cast<EntitySystem*>( pTypeInfo->CreateType() );
             EE_ASSERT( pEntitySystem != nullptr );
 
             pEntity->m_systems.push_back( pEntitySystem );
@@ -131,7 +145,35 @@ namespace EE::EntityModel
         return pEntity;
     }
 
-    TVector<Entity*> Serializer::CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection )
+    void Serializer::ReserveInstances( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, TypeSystem::TypeInstancePool& instancePool )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Reserve Entity Collection Instances" );
+
+        THashMap<TypeSystem::TypeID, int32_t> numInstancesPerType;
+        for ( SerializedEntityDescriptor const& entityDesc : entityCollection.m_entityDescriptors )
+        {
+            for ( SerializedComponentDescriptor const& componentDesc : entityDesc.m_components )
+            {
+                numInstancesPerType[componentDesc.m_typeID]++;
+            }
+
+            for ( SerializedSystemDescriptor const& systemDesc : entityDesc.m_systems )
+            {
+                numInstancesPerType[systemDesc.m_typeID]++;
+            }
+        }
+
+        instancePool.Reserve( Entity::s_pTypeInfo, (int32_t) entityCollection.m_entityDescriptors.size() );
+
+        for ( auto const& pair : numInstancesPerType )
+        {
+            TypeSystem::TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( pair.first );
+            EE_ASSERT( pTypeInfo != nullptr );
+            instancePool.Reserve( pTypeInfo, pair.second );
+        }
+    }
+
+    TVector<Entity*> Serializer::CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, TypeSystem::TypeInstancePool* pInstancePool )
     {
         EE_PROFILE_SCOPE_ENTITY( "Instantiate Entity Collection" );
 
@@ -139,6 +181,12 @@ namespace EE::EntityModel
         TVector<Entity*> createdEntities;
         createdEntities.resize( numEntitiesToCreate );
 
+        // Reserve all the required memory up front so that the parallel creation doesnt contend on slab allocation
+        if ( pInstancePool != nullptr )
+        {
+            ReserveInstances( typeRegistry, entityCollection, *pInstancePool );
+        }
+
         //-------------------------------------------------------------------------
 
         // For small number of entities, just create them inline!
@@ -146,17 +194,18 @@ namespace EE::EntityModel
         {
             for ( auto i = 0; i < numEntitiesToCreate; i++ )
             {
-                createdEntities[i] = CreateEntity( typeRegistry, entityCollection.m_entityDescriptors[i] );
+                createdEntities[i] = CreateEntity( typeRegistry, entityCollection.m_entityDescriptors[i], pInstancePool );
             }
         }
         else // Go wide and create all entities in parallel
         {
             struct EntityCreationTask : public ITaskSet
             {
-                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<SerializedEntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities )
+                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<SerializedEntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities, TypeSystem::TypeInstancePool* pInstancePool )
                     : m_typeRegistry( typeRegistry )
                     , m_descriptors( descriptors )
                     , m_createdEntities( createdEntities )
+                    , m_pInstancePool( pInstancePool )
                 {
                     m_SetSize = (uint32_t) descriptors.size();
                     m_MinRange = 10;
@@ -167,7 +216,7 @@ namespace EE::EntityModel
                     EE_PROFILE_SCOPE_ENTITY( "Entity Creation Task" );
                     for ( uint64_t i = range.start; i < range.end; ++i )
                     {
-                        m_createdEntities[i] = CreateEntity( m_typeRegistry, m_descriptors[i] );
+                        m_createdEntities[i] = CreateEntity( m_typeRegistry, m_descriptors[i], m_pInstancePool );
                     }
                 }
 
@@ -176,12 +225,13 @@ namespace EE::EntityModel
                 TypeSystem::TypeRegistry const&                     m_typeRegistry;
                 TVector<SerializedEntityDescriptor> const&          m_descriptors;
                 TVector<Entity*>&                                   m_createdEntities;
+                TypeSystem::TypeInstancePool*                       m_pInstancePool = nullptr;
             };
 
             //-------------------------------------------------------------------------
 
             // Create all entities in parallel
-            EntityCreationTask updateTask( typeRegistry, entityCollection.m_entityDescriptors, createdEntities );
+            EntityCreationTask updateTask( typeRegistry, entityCollection.m_entityDescriptors, createdEntities, pInstancePool );
             pTaskSystem->ScheduleTask( &updateTask );
             pTaskSystem->WaitForTask( &updateTask );
         }
@@ -226,6 +276,8 @@ namespace EE::EntityModel
     {
         EE_ASSERT( !outDesc.IsValid() );
         outDesc.m_name = pEntity->m_name;
+        outDesc.m_updateRatePolicy = (uint8_t) pEntity->m_updateRatePolicy;
+        outDesc.m_fixedUpdateInterval = pEntity->m_fixedUpdateInterval;
 
         #if EE_DEVELOPMENT_TOOLS
         outDesc.m_transientEntityID = pEntity->m_ID;
@@ -8,7 +8,7 @@ namespace EE
 {
     class Entity;
     class TaskSystem;
-    namespace TypeSystem { class TypeRegistry; }
+    namespace TypeSystem { class TypeRegistry; class TypeInstancePool; }
     namespace EntityModel { class EntityMap; struct SerializedEntityDescriptor; class SerializedEntityCollection; struct SerializedComponentDescriptor; }
 }
 
@@ -18,8 +18,12 @@ namespace EE::EntityModel
 {
     struct EE_ENGINE_API Serializer
     {
-        static Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc );
-        static TVector<Entity*> CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection );
+        // If an instance pool is supplied, the entity, its components and its systems are all allocated from it
+        static Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc, TypeSystem::TypeInstancePool* pInstancePool = nullptr );
+        static TVector<Entity*> CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, TypeSystem::TypeInstancePool* pInstancePool = nullptr );
+
+        // Reserve enough pool memory to instantiate the entire collection, this ensures that each type in the collection requires at most a single allocation
+        static void ReserveInstances( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, TypeSystem::TypeInstancePool& instancePool );
 
         //-------------------------------------------------------------------------
 
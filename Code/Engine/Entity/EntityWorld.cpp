@@ -2,7 +2,9 @@
 #include "EntityWorldUpdateContext.h"
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Time/Timers.h"
 #include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
@@ -23,6 +25,7 @@ namespace EE
         for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
         {
             EE_ASSERT( m_systemUpdateLists[i].empty() );
+            EE_ASSERT( m_systemUpdateSchedules[i].m_systems.empty() );
         }
 
         //-------------------------------------------------------------------------
@@ -43,7 +46,7 @@ namespace EE
         // Set up Contexts
         //-------------------------------------------------------------------------
 
-        m_loadingContext = EntityModel::LoadingContext( m_pTaskSystem, systemsRegistry.GetSystem<TypeSystem::TypeRegistry>(), systemsRegistry.GetSystem<Resource::ResourceSystem>() );
+        m_loadingContext = EntityModel::LoadingContext( m_pTaskSystem, systemsRegistry.GetSystem<TypeSystem::TypeRegistry>(), systemsRegistry.GetSystem<Resource::ResourceSystem>(), &m_instancePool );
         EE_ASSERT( m_loadingContext.IsValid() );
 
         //-------------------------------------------------------------------------
@@ -88,6 +91,8 @@ namespace EE
             }
         }
 
+        CreateSystemUpdateSchedules();
+
         // Create and initialize the persistent map
         //-------------------------------------------------------------------------
 
@@ -120,6 +125,11 @@ namespace EE
         // Shutdown all world systems
         //-------------------------------------------------------------------------
 
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_systemUpdateSchedules[i] = SystemUpdateSchedule();
+        }
+
         for( auto pWorldSystem : m_worldSystems )
         {
             // Remove from update lists
@@ -164,6 +174,61 @@ namespace EE
         return nullptr;
     }
 
+    void EntityWorld::CreateSystemUpdateSchedules()
+    {
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            UpdateStage const updateStage = (UpdateStage) i;
+            TVector<EntityWorldSystem*> const& updateList = m_systemUpdateLists[i];
+            int32_t const numSystems = (int32_t) updateList.size();
+
+            // Each system needs to run after all earlier systems (in update order) that it conflicts with
+            TInlineVector<int32_t, 16> systemLevels;
+            systemLevels.resize( numSystems, 0 );
+            int32_t numLevels = 0;
+
+            for ( int32_t j = 0; j < numSystems; j++ )
+            {
+                WorldSystemDataAccess const& dataAccess = updateList[j]->GetDataAccess( updateStage );
+                for ( int32_t k = 0; k < j; k++ )
+                {
+                    if ( dataAccess.ConflictsWith( updateList[k]->GetDataAccess( updateStage ) ) )
+                    {
+                        systemLevels[j] = Math::Max( systemLevels[j], systemLevels[k] + 1 );
+                    }
+                }
+
+                numLevels = Math::Max( numLevels, systemLevels[j] + 1 );
+            }
+
+            // Sort the systems by level, keeping the update order within each level
+            SystemUpdateSchedule& schedule = m_systemUpdateSchedules[i];
+            schedule.m_levelOffsets.clear();
+            schedule.m_levelOffsets.resize( numLevels + 1, 0 );
+
+            for ( int32_t j = 0; j < numSystems; j++ )
+            {
+                schedule.m_levelOffsets[systemLevels[j] + 1]++;
+            }
+
+            for ( int32_t j = 0; j < numLevels; j++ )
+            {
+                schedule.m_levelOffsets[j + 1] += schedule.m_levelOffsets[j];
+            }
+
+            TInlineVector<int32_t, 8> insertionOffsets = schedule.m_levelOffsets;
+            schedule.m_systems.resize( numSystems );
+            for ( int32_t j = 0; j < numSystems; j++ )
+            {
+                schedule.m_systems[insertionOffsets[systemLevels[j]]++] = updateList[j];
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            schedule.m_systemUpdateTimes.resize( numSystems, 0.0f );
+            #endif
+        }
+    }
+
     //-------------------------------------------------------------------------
     // Frame Update
     //-------------------------------------------------------------------------
@@ -192,31 +257,47 @@ namespace EE
 
     void EntityWorld::Update( UpdateContext const& context )
     {
-        EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
         {
-            EntityUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*>& updateList )
+            EntityUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*>& updateList, bool skipReducedRateEntities )
                 : m_context( context )
                 , m_updateList( updateList )
+                , m_skipReducedRateEntities( skipReducedRateEntities )
             {
                 m_SetSize = (uint32_t) updateList.size();
             }
 
             // Only used for spatial dependency chain updates
-            inline void RecursiveEntityUpdate( Entity* pEntity )
+            inline void RecursiveEntityUpdate( Entity* pEntity, EntityWorldUpdateContext const& context )
             {
-                pEntity->UpdateSystems( m_context );
+                pEntity->UpdateSystems( context );
 
                 for ( auto pAttachedEntity : pEntity->GetAttachedEntities() )
                 {
-                    RecursiveEntityUpdate( pAttachedEntity );
+                    RecursiveEntityUpdate( pAttachedEntity, context );
+                }
+            }
+
+            inline void UpdateEntity( Entity* pEntity, EntityWorldUpdateContext const& context )
+            {
+                if ( pEntity->HasAttachedEntities() )
+                {
+                    EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
+                    RecursiveEntityUpdate( pEntity, context );
+                }
+                else // Direct entity update
+                {
+                    EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
+                    pEntity->UpdateSystems( context );
                 }
             }
 
             virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
+                EE_MEMORY_TAG_SCOPE( Entity );
+
                 for ( uint64_t i = range.start; i < range.end; ++i )
                 {
                     auto pEntity = m_updateList[i];
@@ -229,16 +310,23 @@ namespace EE
 
                     //-------------------------------------------------------------------------
 
-                    if ( pEntity->HasAttachedEntities() )
+                    if ( m_skipReducedRateEntities )
                     {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
-                        RecursiveEntityUpdate( pEntity );
-                    }
-                    else // Direct entity update
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
-                        pEntity->UpdateSystems( m_context );
+                        if ( !pEntity->m_isUpdateDue )
+                        {
+                            continue;
+                        }
+
+                        // Reduced rate entities need the delta time for all the frames they skipped
+                        if ( pEntity->m_updateDeltaTime > 0.0f )
+                        {
+                            EntityWorldUpdateContext reducedRateContext( m_context, pEntity->m_updateDeltaTime );
+                            UpdateEntity( pEntity, reducedRateContext );
+                            continue;
+                        }
                     }
+
+                    UpdateEntity( pEntity, m_context );
                 }
             }
 
@@ -246,6 +334,7 @@ namespace EE
 
             EntityWorldUpdateContext const&              m_context;
             TVector<Entity*>&                            m_updateList;
+            bool                                         m_skipReducedRateEntities = false;
         };
 
         //-------------------------------------------------------------------------
@@ -253,6 +342,8 @@ namespace EE
         UpdateStage const updateStage = context.GetUpdateStage();
         bool const isWorldPaused = IsPaused() && !m_timeStepRequested;
 
+        ScopedTimer<PlatformClock> timer( m_stageUpdateTimes[(int8_t) updateStage] );
+
         // Skip all non-pause updates for paused worlds
         if ( isWorldPaused && updateStage != UpdateStage::Paused )
         {
@@ -269,10 +360,19 @@ namespace EE
 
         EntityWorldUpdateContext entityWorldUpdateContext( context, this );
 
+        // Select which entities are updated this frame
+        //-------------------------------------------------------------------------
+
+        if ( updateStage == UpdateStage::FrameStart )
+        {
+            UpdateEntityUpdateRates( entityWorldUpdateContext );
+        }
+
         // Update entities
         //-------------------------------------------------------------------------
+        // The paused update ignores the update rates since no time passes
 
-        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
+        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList, updateStage != UpdateStage::Paused );
         m_pTaskSystem->ScheduleTask( &entityUpdateTask );
         m_pTaskSystem->WaitForTask( &entityUpdateTask );
 
@@ -282,12 +382,7 @@ namespace EE
         // Update systems
         //-------------------------------------------------------------------------
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
-        {
-            EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
-        }
+        UpdateWorldSystems( updateStage, entityWorldUpdateContext );
 
         //-------------------------------------------------------------------------
 
@@ -297,6 +392,239 @@ namespace EE
         }
     }
 
+    uint8_t EntityWorld::SelectUpdateInterval( Entity const* pEntity ) const
+    {
+        if ( !m_isUpdateRateLODEnabled || pEntity->HasSpatialParent() )
+        {
+            return 1;
+        }
+
+        switch ( pEntity->m_updateRatePolicy )
+        {
+            case UpdateRatePolicy::FixedInterval:
+            {
+                return pEntity->m_fixedUpdateInterval;
+            }
+
+            case UpdateRatePolicy::Distance:
+            {
+                if ( !pEntity->IsSpatialEntity() )
+                {
+                    return 1;
+                }
+
+                float const distanceSq = m_viewport.GetViewPosition().GetDistanceSquared3( pEntity->GetWorldTransform().GetTranslation() );
+                if ( distanceSq > Math::Sqr( m_updateRateSettings.m_eighthRateDistance ) )
+                {
+                    return 8;
+                }
+                else if ( distanceSq > Math::Sqr( m_updateRateSettings.m_quarterRateDistance ) )
+                {
+                    return 4;
+                }
+                else if ( distanceSq > Math::Sqr( m_updateRateSettings.m_halfRateDistance ) )
+                {
+                    return 2;
+                }
+            }
+            break;
+
+            case UpdateRatePolicy::Visibility:
+            {
+                if ( !pEntity->IsSpatialEntity() )
+                {
+                    return 1;
+                }
+
+                // This uses the last known bounds, the same test the renderer uses for culling
+                if ( !m_viewport.GetViewVolume().Contains( AABB( pEntity->GetRootSpatialComponentWorldBounds() ) ) )
+                {
+                    return (uint8_t) Math::Clamp( m_updateRateSettings.m_hiddenUpdateInterval, 1, 255 );
+                }
+            }
+            break;
+
+            default:
+            break;
+        }
+
+        return 1;
+    }
+
+    void EntityWorld::UpdateEntityUpdateRates( EntityWorldUpdateContext const& context )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update Entity Update Rates" );
+
+        m_updateRateStats = UpdateRateStats();
+
+        Seconds const deltaTime = context.GetDeltaTime();
+        int32_t numBudgetedUpdatesRemaining = ( m_updateRateSettings.m_maxReducedRateUpdatesPerFrame > 0 ) ? m_updateRateSettings.m_maxReducedRateUpdatesPerFrame : INT32_MAX;
+        int32_t firstDeferredIdx = InvalidIndex;
+
+        int32_t const numEntities = (int32_t) m_entityUpdateList.size();
+        if ( m_updateRateStartIdx >= numEntities )
+        {
+            m_updateRateStartIdx = 0;
+        }
+
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            int32_t const entityIdx = ( m_updateRateStartIdx + i ) % numEntities;
+            Entity* pEntity = m_entityUpdateList[entityIdx];
+
+            uint8_t const updateInterval = SelectUpdateInterval( pEntity );
+
+            // Full rate
+            //-------------------------------------------------------------------------
+            // If we were previously at a reduced rate, we need to apply the time we skipped
+
+            if ( updateInterval <= 1 )
+            {
+                pEntity->m_isUpdateDue = true;
+                pEntity->m_updateDeltaTime = ( pEntity->m_accumulatedDeltaTime > 0.0f ) ? pEntity->m_accumulatedDeltaTime + deltaTime : Seconds( 0.0f );
+                pEntity->m_accumulatedDeltaTime = 0.0f;
+                pEntity->m_updateInterval = 1;
+                pEntity->m_framesUntilUpdate = 0;
+                continue;
+            }
+
+            // Reduced rate
+            //-------------------------------------------------------------------------
+            // When the interval changes we assign a new phase, so that entities with the same interval are spread across the frames
+
+            if ( updateInterval != pEntity->m_updateInterval )
+            {
+                pEntity->m_updateInterval = updateInterval;
+                pEntity->m_framesUntilUpdate = uint8_t( m_nextUpdatePhase++ % updateInterval );
+            }
+
+            m_updateRateStats.m_numReducedRateEntities++;
+
+            bool isUpdateDue = ( pEntity->m_framesUntilUpdate == 0 );
+            if ( !isUpdateDue )
+            {
+                pEntity->m_framesUntilUpdate--;
+            }
+            else if ( numBudgetedUpdatesRemaining <= 0 )
+            {
+                // Stay due, we will be updated on the next frame
+                isUpdateDue = false;
+                m_updateRateStats.m_numDeferred++;
+
+                if ( firstDeferredIdx == InvalidIndex )
+                {
+                    firstDeferredIdx = entityIdx;
+                }
+            }
+
+            pEntity->m_isUpdateDue = isUpdateDue;
+            if ( isUpdateDue )
+            {
+                pEntity->m_updateDeltaTime = pEntity->m_accumulatedDeltaTime + deltaTime;
+                pEntity->m_accumulatedDeltaTime = 0.0f;
+                pEntity->m_framesUntilUpdate = updateInterval - 1;
+                numBudgetedUpdatesRemaining--;
+                m_updateRateStats.m_numUpdated++;
+            }
+            else
+            {
+                pEntity->m_accumulatedDeltaTime += deltaTime;
+                m_updateRateStats.m_numSkipped++;
+            }
+        }
+
+        // Deferred entities go first next frame so that they get a chance at the budget
+        if ( firstDeferredIdx != InvalidIndex )
+        {
+            m_updateRateStartIdx = firstDeferredIdx;
+        }
+    }
+
+    Milliseconds EntityWorld::GetLastFrameUpdateTime() const
+    {
+        Milliseconds frameUpdateTime = 0.0f;
+        for ( Milliseconds stageUpdateTime : m_stageUpdateTimes )
+        {
+            frameUpdateTime += stageUpdateTime;
+        }
+        return frameUpdateTime;
+    }
+
+    void EntityWorld::UpdateWorldSystems( UpdateStage updateStage, EntityWorldUpdateContext const& context )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
+
+        struct SystemUpdateTask final : public ITaskSet
+        {
+            SystemUpdateTask( EntityWorldUpdateContext const& context, SystemUpdateSchedule& schedule, int32_t levelStartIdx, int32_t levelSize )
+                : m_context( context )
+                , m_schedule( schedule )
+                , m_levelStartIdx( levelStartIdx )
+            {
+                m_SetSize = (uint32_t) levelSize;
+                m_MinRange = 1; // Each system is a separate job
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    UpdateWorldSystem( m_schedule, m_levelStartIdx + (int32_t) i, m_context );
+                }
+            }
+
+        private:
+
+            EntityWorldUpdateContext const&             m_context;
+            SystemUpdateSchedule&                       m_schedule;
+            int32_t                                     m_levelStartIdx = 0;
+        };
+
+        //-------------------------------------------------------------------------
+
+        SystemUpdateSchedule& schedule = m_systemUpdateSchedules[(int8_t) updateStage];
+
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> timer( schedule.m_elapsedTime );
+        #endif
+
+        int32_t const numLevels = schedule.GetNumLevels();
+        for ( int32_t i = 0; i < numLevels; i++ )
+        {
+            int32_t const levelStartIdx = schedule.GetLevelStartIndex( i );
+            int32_t const levelSize = schedule.GetLevelSize( i );
+
+            if ( levelSize == 1 || !m_isParallelSystemUpdateEnabled )
+            {
+                for ( int32_t j = 0; j < levelSize; j++ )
+                {
+                    UpdateWorldSystem( schedule, levelStartIdx + j, context );
+                }
+            }
+            else
+            {
+                SystemUpdateTask systemUpdateTask( context, schedule, levelStartIdx, levelSize );
+                m_pTaskSystem->ScheduleTask( &systemUpdateTask );
+                m_pTaskSystem->WaitForTask( &systemUpdateTask );
+            }
+        }
+    }
+
+    void EntityWorld::UpdateWorldSystem( SystemUpdateSchedule& schedule, int32_t systemIdx, EntityWorldUpdateContext const& context )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update World System" );
+        EE_MEMORY_TAG_SCOPE( Entity );
+
+        EntityWorldSystem* pSystem = schedule.m_systems[systemIdx];
+        EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( context.GetUpdateStage() ) );
+
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> timer( schedule.m_systemUpdateTimes[systemIdx] );
+        #endif
+
+        pSystem->UpdateSystem( context );
+    }
+
     //-------------------------------------------------------------------------
     // Maps
     //-------------------------------------------------------------------------
@@ -4,6 +4,7 @@
 #include "EntityContexts.h"
 #include "Entity.h"
 #include "EntityMap.h"
+#include "Base/TypeSystem/TypeInstancePool.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Drawing/DebugDrawingSystem.h"
@@ -24,6 +25,25 @@ namespace EE
         friend class EntityDebugView;
         friend class EntityWorldUpdateContext;
 
+        // The world system update for a single stage
+        // Systems are grouped into levels based on their declared data access, the systems in a level dont conflict and are updated in parallel
+        struct SystemUpdateSchedule
+        {
+            inline int32_t GetNumLevels() const { return (int32_t) m_levelOffsets.size() - 1; }
+            inline int32_t GetLevelStartIndex( int32_t levelIdx ) const { return m_levelOffsets[levelIdx]; }
+            inline int32_t GetLevelSize( int32_t levelIdx ) const { return m_levelOffsets[levelIdx + 1] - m_levelOffsets[levelIdx]; }
+
+        public:
+
+            TVector<EntityWorldSystem*>                                         m_systems; // Sorted by level, in update order within each level
+            TInlineVector<int32_t, 8>                                           m_levelOffsets; // The first system index of each level, followed by the end index
+
+            #if EE_DEVELOPMENT_TOOLS
+            TVector<Milliseconds>                                               m_systemUpdateTimes; // The last update time of each system
+            Milliseconds                                                        m_elapsedTime = 0.0f; // The last wall-clock time for the whole stage
+            #endif
+        };
+
     public:
 
         EntityWorld( EntityWorldType worldType = EntityWorldType::Game );
@@ -51,12 +71,50 @@ namespace EE
         void ResumeUpdates() { m_isSuspended = false; }
 
         // Run entity and system updates
+        // This is usually called on the main thread, but independent worlds may be updated concurrently (see EntityWorldManager)
         void Update( UpdateContext const& context );
 
+        // Get the time taken by the last update of the specified stage
+        inline Milliseconds GetLastUpdateTime( UpdateStage stage ) const { return m_stageUpdateTimes[(int8_t) stage]; }
+
+        // Get the total time taken by the last frame's updates
+        Milliseconds GetLastFrameUpdateTime() const;
+
         // This function will handle all actual loading/unloading operations for the world/maps.
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
 
+        //-------------------------------------------------------------------------
+        // Update Rate LOD
+        //-------------------------------------------------------------------------
+        // Entities with a reduced update rate policy are only updated every Nth frame, the updates are spread over the frames to keep the frame cost flat
+
+        struct UpdateRateSettings
+        {
+            float                                       m_halfRateDistance = 30.0f; // 'Distance' entities beyond this distance are updated every 2nd frame
+            float                                       m_quarterRateDistance = 60.0f; // 'Distance' entities beyond this distance are updated every 4th frame
+            float                                       m_eighthRateDistance = 120.0f; // 'Distance' entities beyond this distance are updated every 8th frame
+            int32_t                                     m_hiddenUpdateInterval = 4; // 'Visibility' entities outside the view volume are updated every N frames
+            int32_t                                     m_maxReducedRateUpdatesPerFrame = 0; // Due reduced rate updates over this budget are deferred to the next frame (0 = unlimited)
+        };
+
+        struct UpdateRateStats
+        {
+            int32_t                                     m_numReducedRateEntities = 0;
+            int32_t                                     m_numUpdated = 0;
+            int32_t                                     m_numSkipped = 0;
+            int32_t                                     m_numDeferred = 0; // The number of due updates that were over budget
+        };
+
+        inline bool IsUpdateRateLODEnabled() const { return m_isUpdateRateLODEnabled; }
+        inline void SetUpdateRateLODEnabled( bool isEnabled ) { m_isUpdateRateLODEnabled = isEnabled; }
+
+        inline UpdateRateSettings const& GetUpdateRateSettings() const { return m_updateRateSettings; }
+        inline void SetUpdateRateSettings( UpdateRateSettings const& settings ) { m_updateRateSettings = settings; }
+
+        // Get the reduced rate update stats for the current frame
+        inline UpdateRateStats const& GetUpdateRateStats() const { return m_updateRateStats; }
+
         //-------------------------------------------------------------------------
         // Systems
         //-------------------------------------------------------------------------
@@ -66,6 +124,10 @@ namespace EE
         template<typename T>
         inline T* GetWorldSystem() const { return reinterpret_cast<T*>( GetWorldSystem( T::s_entitySystemID ) ); }
 
+        // Should world systems with non-conflicting data access be updated in parallel, if disabled all systems are updated serially on the calling thread
+        inline bool IsParallelSystemUpdateEnabled() const { return m_isParallelSystemUpdateEnabled; }
+        inline void SetParallelSystemUpdateEnabled( bool isEnabled ) { m_isParallelSystemUpdateEnabled = isEnabled; }
+
         //-------------------------------------------------------------------------
         // Input
         //-------------------------------------------------------------------------
@@ -148,6 +210,9 @@ namespace EE
         // Get map for a given entity
         EntityModel::EntityMap* GetMapForEntity( Entity const* pEntity ) { return const_cast<EntityModel::EntityMap*>( const_cast<EntityWorld const*>( this )->GetMapForEntity( pEntity ) ); }
 
+        // Get the stats for the pool that all map entities (and their components/systems) are allocated from
+        inline TypeSystem::TypeInstancePool::Stats GetInstancePoolStats() const { return m_instancePool.GetStats(); }
+
         // Are we currently loading anything
         bool IsBusyLoading() const;
 
@@ -270,6 +335,18 @@ namespace EE
         void EndHotReload();
         #endif
 
+    private:
+
+        // Select the update interval for all entities and decide which ones are updated this frame
+        void UpdateEntityUpdateRates( EntityWorldUpdateContext const& context );
+        uint8_t SelectUpdateInterval( Entity const* pEntity ) const;
+
+        // Build the per-stage update schedules from the update lists and the systems' data access
+        void CreateSystemUpdateSchedules();
+
+        void UpdateWorldSystems( UpdateStage updateStage, EntityWorldUpdateContext const& context );
+        static void UpdateWorldSystem( SystemUpdateSchedule& schedule, int32_t systemIdx, EntityWorldUpdateContext const& context );
+
     private:
 
         EntityWorldID                                                           m_worldID = UUID::GenerateID();
@@ -277,6 +354,7 @@ namespace EE
         Input::InputState                                                       m_inputState;
         EntityModel::LoadingContext                                             m_loadingContext;
         EntityModel::InitializationContext                                      m_initializationContext;
+        TypeSystem::TypeInstancePool                                            m_instancePool; // Needs to outlive all maps
         TVector<EntityWorldSystem*>                                             m_worldSystems;
         EntityWorldType                                                         m_worldType = EntityWorldType::Game;
         bool                                                                    m_initialized = false;
@@ -289,6 +367,16 @@ namespace EE
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        SystemUpdateSchedule                                                    m_systemUpdateSchedules[(int8_t) UpdateStage::NumStages];
+        bool                                                                    m_isParallelSystemUpdateEnabled = true;
+        Milliseconds                                                            m_stageUpdateTimes[(int8_t) UpdateStage::NumStages];
+
+        // Update Rate LOD
+        UpdateRateSettings                                                      m_updateRateSettings;
+        UpdateRateStats                                                         m_updateRateStats;
+        int32_t                                                                 m_updateRateStartIdx = 0; // Rotated so deferred entities are first in line on the next frame
+        uint32_t                                                                m_nextUpdatePhase = 0; // Used to spread reduced rate entities across the frames
+        bool                                                                    m_isUpdateRateLODEnabled = true;
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
@@ -6,6 +6,8 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
@@ -20,6 +22,8 @@ namespace EE
     void EntityWorldManager::Initialize( SystemRegistry const& systemsRegistry )
     {
         m_pSystemsRegistry = &systemsRegistry;
+        m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -45,6 +49,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_worldSystemTypeInfos.clear();
+        m_pTaskSystem = nullptr;
         m_pSystemsRegistry = nullptr;
     }
 
@@ -155,63 +160,116 @@ namespace EE
         }
     }
 
-    void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
+    void EntityWorldManager::UpdateWorld( EntityWorld* pWorld, UpdateContext const& context )
     {
+        // Run world updates
         //-------------------------------------------------------------------------
-        // World Update
+
+        pWorld->Update( context );
+
+        // Update world view
         //-------------------------------------------------------------------------
+        // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
 
-        for ( auto const& pWorld : m_worlds )
+        if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
         {
-            if ( pWorld->IsSuspended() )
+            auto pViewport = pWorld->GetViewport();
+            auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
+            if ( pCameraManager->HasActiveCamera() )
             {
-                continue;
-            }
+                auto pActiveCamera = pCameraManager->GetActiveCamera();
 
-            // Reflect input state
-            //-------------------------------------------------------------------------
+                // Update camera view dimensions if needed
+                if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
+                {
+                    pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
+                }
 
-            if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+                // Update world viewport
+                pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
+            }
+        }
+    }
+
+    void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
+    {
+        struct WorldUpdateTask final : public ITaskSet
+        {
+            WorldUpdateTask( UpdateContext const& context, TInlineVector<EntityWorld*, 5> const& worlds )
+                : m_context( context )
+                , m_worlds( worlds )
             {
-                auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
-                auto pWorldInputState = pWorld->GetInputState();
+                m_SetSize = (uint32_t) worlds.size();
+                m_MinRange = 1; // Each world is a separate job
+            }
 
-                if ( pPlayerManager->IsPlayerEnabled() )
-                {
-                    auto pInputSystem = context.GetSystem<Input::InputSystem>();
-                    pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
-                }
-                else
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
                 {
-                    pWorldInputState->Clear();
+                    UpdateWorld( m_worlds[i], m_context );
                 }
             }
 
-            // Run world updates
-            //-------------------------------------------------------------------------
+        private:
 
-            pWorld->Update( context );
+            UpdateContext const&                        m_context;
+            TInlineVector<EntityWorld*, 5> const&       m_worlds;
+        };
 
-            // Update world view
-            //-------------------------------------------------------------------------
-            // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
+        //-------------------------------------------------------------------------
+        // World Update
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( m_stageUpdateTimes[(int8_t) context.GetUpdateStage()] );
 
-            if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
+            TInlineVector<EntityWorld*, 5> worldsToUpdate;
+            for ( auto const& pWorld : m_worlds )
             {
-                auto pViewport = pWorld->GetViewport();
-                auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
-                if ( pCameraManager->HasActiveCamera() )
+                if ( pWorld->IsSuspended() )
                 {
-                    auto pActiveCamera = pCameraManager->GetActiveCamera();
+                    continue;
+                }
+
+                // Reflect input state
+                //-------------------------------------------------------------------------
+                // The input system is shared by all worlds so this is always done serially
 
-                    // Update camera view dimensions if needed
-                    if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
+                if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+                {
+                    auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
+                    auto pWorldInputState = pWorld->GetInputState();
+
+                    if ( pPlayerManager->IsPlayerEnabled() )
                     {
-                        pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
+                        auto pInputSystem = context.GetSystem<Input::InputSystem>();
+                        pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
                     }
+                    else
+                    {
+                        pWorldInputState->Clear();
+                    }
+                }
+
+                worldsToUpdate.emplace_back( pWorld );
+            }
 
-                    // Update world viewport
-                    pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
+            // Run world updates
+            //-------------------------------------------------------------------------
+            // Worlds share no entity state, so each world's stage can be run as a separate task graph
+
+            if ( m_isConcurrentWorldUpdateEnabled && worldsToUpdate.size() > 1 )
+            {
+                WorldUpdateTask worldUpdateTask( context, worldsToUpdate );
+                m_pTaskSystem->ScheduleTask( &worldUpdateTask );
+                m_pTaskSystem->WaitForTask( &worldUpdateTask );
+            }
+            else
+            {
+                for ( auto const& pWorld : worldsToUpdate )
+                {
+                    UpdateWorld( pWorld, context );
                 }
             }
         }
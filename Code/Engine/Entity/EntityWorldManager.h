@@ -2,7 +2,9 @@
 
 #include "Engine/_Module/API.h"
 #include "EntityWorldType.h"
+#include "Engine/UpdateStage.h"
 #include "Base/Resource/ResourceRequesterID.h"
+#include "Base/Time/Time.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
@@ -11,6 +13,7 @@ namespace EE
 {
     class UpdateContext;
     class EntityWorld;
+    class TaskSystem;
     class SystemRegistry;
     namespace TypeSystem { class TypeInfo; }
     namespace Render { class Viewport; }
@@ -67,6 +70,14 @@ namespace EE
         // Run the world update - updates all entities, systems and camera
         void UpdateWorlds( UpdateContext const& context );
 
+        // Should independent worlds be updated concurrently, if enabled each world's stage update is run as a separate task
+        // Worlds share no entity state, but any system that touches global state from a world update must be thread-safe when this is enabled
+        inline bool IsConcurrentWorldUpdateEnabled() const { return m_isConcurrentWorldUpdateEnabled; }
+        inline void SetConcurrentWorldUpdateEnabled( bool isEnabled ) { m_isConcurrentWorldUpdateEnabled = isEnabled; }
+
+        // Get the wall-clock time taken to update all worlds for the specified stage
+        inline Milliseconds GetLastUpdateTime( UpdateStage stage ) const { return m_stageUpdateTimes[(int8_t) stage]; }
+
         // Hot Reload
         //-------------------------------------------------------------------------
 
@@ -75,10 +86,18 @@ namespace EE
         void EndHotReload();
         #endif
 
+    private:
+
+        // Update a single world and reflect its camera into its viewport
+        static void UpdateWorld( EntityWorld* pWorld, UpdateContext const& context );
+
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
+        Milliseconds                                        m_stageUpdateTimes[(int8_t) UpdateStage::NumStages];
+        bool                                                m_isConcurrentWorldUpdateEnabled = false;
     };
 }
\ No newline at end of file
@@ -5,6 +5,40 @@
 
 namespace EE
 {
+    WorldSystemDataAccess const& WorldSystemDataAccess::Exclusive()
+    {
+        static WorldSystemDataAccess const exclusiveAccess = [] () { WorldSystemDataAccess access; access.m_isExclusive = true; return access; }();
+        return exclusiveAccess;
+    }
+
+    bool WorldSystemDataAccess::ConflictsWith( WorldSystemDataAccess const& other ) const
+    {
+        if ( m_isExclusive || other.m_isExclusive )
+        {
+            return true;
+        }
+
+        for ( StringID const& writtenData : m_writes )
+        {
+            if ( VectorContains( other.m_reads, writtenData ) || VectorContains( other.m_writes, writtenData ) )
+            {
+                return true;
+            }
+        }
+
+        for ( StringID const& writtenData : other.m_writes )
+        {
+            if ( VectorContains( m_reads, writtenData ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
     bool EntityWorldSystem::IsInAGameWorld() const
     {
         return m_pWorld->GetWorldType() == EntityWorldType::Game;
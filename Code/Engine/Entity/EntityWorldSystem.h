@@ -6,6 +6,7 @@
 #include "Engine/Entity/EntityIDs.h"
 #include "Base/TypeSystem/ReflectedType.h"
 #include "Base/Types/Arrays.h"
+#include "Base/Types/StringID.h"
 #include "Base/Encoding/Hash.h"
 
 
@@ -22,6 +23,63 @@ namespace EE
     class EntityComponent;
     namespace EntityModel { class EntityMap; }
 
+    //-------------------------------------------------------------------------
+    // World System Data Access
+    //-------------------------------------------------------------------------
+    // World systems can declare the data they read and write during their update, using component/system type IDs or the name of any other shared data
+    // Systems in the same stage whose access doesnt conflict are updated in parallel, the update priorities still order any conflicting systems
+    // Systems that dont declare their data access are exclusive, i.e. they are updated on their own on the calling thread
+
+    struct ReadsData
+    {
+        ReadsData( TypeSystem::TypeID typeID ) : m_ID( typeID.ToStringID() ) {}
+        ReadsData( char const* pDataName ) : m_ID( pDataName ) {}
+
+        StringID        m_ID;
+    };
+
+    struct WritesData
+    {
+        WritesData( TypeSystem::TypeID typeID ) : m_ID( typeID.ToStringID() ) {}
+        WritesData( char const* pDataName ) : m_ID( pDataName ) {}
+
+        StringID        m_ID;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API WorldSystemDataAccess
+    {
+    public:
+
+        // Exclusive access conflicts with all other systems
+        static WorldSystemDataAccess const& Exclusive();
+
+    public:
+
+        template<typename... Args>
+        WorldSystemDataAccess( Args&&... args )
+        {
+            ( ( *this << eastl::forward<Args>( args ) ), ... );
+        }
+
+        inline bool IsExclusive() const { return m_isExclusive; }
+        inline TInlineVector<StringID, 4> const& GetReads() const { return m_reads; }
+        inline TInlineVector<StringID, 4> const& GetWrites() const { return m_writes; }
+
+        // Two systems conflict if either one writes data that the other one reads or writes
+        bool ConflictsWith( WorldSystemDataAccess const& other ) const;
+
+        inline WorldSystemDataAccess& operator<<( ReadsData&& reads ) { m_reads.emplace_back( reads.m_ID ); return *this; }
+        inline WorldSystemDataAccess& operator<<( WritesData&& writes ) { m_writes.emplace_back( writes.m_ID ); return *this; }
+
+    private:
+
+        TInlineVector<StringID, 4>      m_reads;
+        TInlineVector<StringID, 4>      m_writes;
+        bool                            m_isExclusive = false;
+    };
+
     //-------------------------------------------------------------------------
 
     class EE_ENGINE_API EntityWorldSystem : public IReflectedType
@@ -41,6 +99,9 @@ namespace EE
         // Is this world system in a tools-only world
         bool IsInAToolsWorld() const;
 
+        // Get the data that this system reads and writes when updated in the specified stage
+        virtual WorldSystemDataAccess const& GetDataAccess( UpdateStage stage ) const { return WorldSystemDataAccess::Exclusive(); }
+
     protected:
 
         // Get the required update stages and priorities for this component
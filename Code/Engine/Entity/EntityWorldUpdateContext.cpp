@@ -34,6 +34,17 @@ namespace EE
         EE_ASSERT( m_deltaTime >= 0.0f );
     }
 
+    EntityWorldUpdateContext::EntityWorldUpdateContext( EntityWorldUpdateContext const& context, Seconds deltaTime )
+        : UpdateContext( context )
+        , m_pWorld( context.m_pWorld )
+        , m_rawDeltaTime( context.m_rawDeltaTime )
+        , m_isGameWorld( context.m_isGameWorld )
+        , m_isPaused( context.m_isPaused )
+    {
+        EE_ASSERT( deltaTime >= 0.0f );
+        m_deltaTime = deltaTime;
+    }
+
     EntityWorldSystem* EntityWorldUpdateContext::GetWorldSystem( uint32_t worldSystemID ) const
     {
         return m_pWorld->GetWorldSystem( worldSystemID );
@@ -22,6 +22,9 @@ namespace EE
 
         EntityWorldUpdateContext( UpdateContext const& context, EntityWorld* pWorld );
 
+        // Create a copy of a context with a different delta time, used for entities that are updated at a reduced rate
+        EntityWorldUpdateContext( EntityWorldUpdateContext const& context, Seconds deltaTime );
+
         // Get the original delta time for this frame (without the world timescale applied)
         EE_FORCE_INLINE Seconds GetRawDeltaTime() const { return m_rawDeltaTime; }
 
@@ -37,6 +37,10 @@ namespace EE::EntityModel
             pCollectionDesc = pEC;
         }
 
+        // The collection is immutable from here on, so compile the component descriptors once rather than resolving all properties each time we instantiate
+        EE_ASSERT( pCollectionDesc != nullptr );
+        pCollectionDesc->CompilePropertySetters( *m_pTypeRegistry );
+
         // Set loaded resource
         pResourceRecord->SetResourceData( pCollectionDesc );
         return true;
@@ -38,6 +38,12 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccess const& EntityCollectionSpawner::GetDataAccess( UpdateStage stage ) const
+    {
+        static WorldSystemDataAccess const access( WritesData( "EntityMaps" ) );
+        return access;
+    }
+
     void EntityCollectionSpawner::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         auto pPersistentMap = ctx.GetPersistentMap();
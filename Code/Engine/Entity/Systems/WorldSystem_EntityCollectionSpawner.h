@@ -34,6 +34,7 @@ namespace EE::EntityModel
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccess const& GetDataAccess( UpdateStage stage ) const override;
 
     private:
 
@@ -5,6 +5,7 @@
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Drawing/DebugDrawingSystem.h"
 
@@ -226,6 +227,8 @@ namespace EE::Navmesh
 
     void NavmeshWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Navigation );
+
         #if EE_ENABLE_NAVPOWER
 
         {
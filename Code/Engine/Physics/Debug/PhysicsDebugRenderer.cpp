@@ -184,7 +184,8 @@ namespace EE::Physics
             // Get the glyph string and number of glyphs needed to render it
             //-------------------------------------------------------------------------
 
-            TInlineVector<int32_t, 100> glyphIndices;
+            Memory::ScopedScratchMarker const scratchMarker;
+            TInlineScratchVector<int32_t, 100> glyphIndices;
             m_textRS.m_fontAtlas.GetGlyphsForString( 0, debugText.string, glyphIndices );
 
             int32_t const glyphCount = (int32_t) glyphIndices.size();
@@ -6,6 +6,7 @@
 #include "Base/Types/Color.h"
 #include "Base/Time/Time.h"
 #include "Base/Memory/Memory.h"
+#include "Base/Memory/MemoryTracking.h"
 
 //-------------------------------------------------------------------------
 // WARNING!
@@ -65,6 +66,8 @@ namespace EE::Physics
         {
             virtual void* allocate( size_t size, const char* typeName, const char* filename, int line ) override
             {
+                // PhysX allocates from many threads and call sites, so we tag at the allocator rather than per scope
+                EE_MEMORY_TAG_SCOPE( Physics );
                 return EE::Alloc( size, 16 );
             }
 
@@ -25,6 +25,9 @@ namespace EE::Physics
 
         void ClearMaterialRegistryPtr() { m_pRegistry = nullptr; }
 
+        // Loading registers the materials with the (non-threadsafe) material registry
+        virtual bool SupportsParallelLoading() const override { return false; }
+
     private:
 
         virtual bool LoadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const override final;
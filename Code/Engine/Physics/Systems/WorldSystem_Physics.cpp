@@ -11,6 +11,7 @@
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityLog.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
 #include "Base/Drawing/DebugDrawing.h"
 
 //-------------------------------------------------------------------------
@@ -183,6 +184,8 @@ namespace EE::Physics
 
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Physics );
+
         // HACK HACK
         #if EE_DEVELOPMENT_TOOLS
         m_pWorld->AcquireReadLock();
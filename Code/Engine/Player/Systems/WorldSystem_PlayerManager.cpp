@@ -137,6 +137,12 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccess const& PlayerManager::GetDataAccess( UpdateStage stage ) const
+    {
+        static WorldSystemDataAccess const access( WritesData( Player::PlayerComponent::GetStaticTypeID() ), WritesData( "EntityMaps" ) );
+        return access;
+    }
+
     void PlayerManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.GetUpdateStage() == UpdateStage::FrameStart )
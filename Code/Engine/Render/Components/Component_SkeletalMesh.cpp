@@ -68,6 +68,8 @@ namespace EE::Render
         m_boneTransforms.clear();
         m_skinningTransforms.clear();
         m_animToMeshBoneMap.clear();
+        m_lodSkinningBoneRemap.clear();
+        m_skeletonLOD = Animation::Skeleton::LOD::High;
         MeshComponent::Shutdown();
     }
 
@@ -132,20 +134,34 @@ namespace EE::Render
         EE_ASSERT( IsInitialized() );
         EE_ASSERT( HasMeshResourceSet() && HasSkeletonResourceSet() );
         EE_ASSERT( !m_animToMeshBoneMap.empty() );
-        EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
+        EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() && !pPose->HasDirtyGlobalTransforms() );
 
+        // Read the cached global transforms directly rather than querying each bone individually
+        Transform const* pGlobalTransforms = pPose->GetGlobalTransforms();
         int32_t const numAnimBones = pPose->GetNumBones();
         for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
         {
             int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
             if ( meshBoneIdx != InvalidIndex )
             {
-                Transform const boneTransform = pPose->GetGlobalTransform( animBoneIdx );
-                m_boneTransforms[meshBoneIdx] = boneTransform;
+                m_boneTransforms[meshBoneIdx] = pGlobalTransforms[animBoneIdx];
             }
         }
     }
 
+    void SkeletalMeshComponent::SetSkeletonLOD( Animation::Skeleton::LOD lod )
+    {
+        EE_ASSERT( IsInitialized() );
+
+        if ( m_skeletonLOD == lod )
+        {
+            return;
+        }
+
+        m_skeletonLOD = lod;
+        GenerateLODSkinningBoneRemap();
+    }
+
     void SkeletalMeshComponent::ResetPose()
     {
         EE_ASSERT( IsInitialized() );
@@ -182,10 +198,36 @@ namespace EE::Render
         EE_ASSERT( m_skinningTransforms.size() == numBones );
 
         auto const& inverseBindPose = m_mesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
+
+        if ( m_lodSkinningBoneRemap.empty() )
         {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
+                m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            }
+        }
+        else // Only calculate the skinning transforms for the bones in the current LOD
+        {
+            // Excluded bones are held at the reference pose relative to their closest included parent, so their skinning transform is the parent's skinning transform offset by that reference pose delta
+            EE_ASSERT( m_lodSkinningBoneRemap.size() == numBones && m_lodSkinningBoneOffsets.size() == numBones );
+
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                if ( m_lodSkinningBoneRemap[i] == i )
+                {
+                    Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
+                    m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+                }
+            }
+
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                if ( m_lodSkinningBoneRemap[i] != i )
+                {
+                    m_skinningTransforms[i] = m_lodSkinningBoneOffsets[i] * m_skinningTransforms[m_lodSkinningBoneRemap[i]];
+                }
+            }
         }
     }
 
@@ -205,6 +247,54 @@ namespace EE::Render
         }
     }
 
+    void SkeletalMeshComponent::GenerateLODSkinningBoneRemap()
+    {
+        m_lodSkinningBoneRemap.clear();
+        m_lodSkinningBoneOffsets.clear();
+
+        if ( m_skeletonLOD == Animation::Skeleton::LOD::High || !HasMeshResourceSet() || !HasSkeletonResourceSet() )
+        {
+            return;
+        }
+
+        EE_ASSERT( !m_animToMeshBoneMap.empty() );
+
+        int32_t const numMeshBones = m_mesh->GetNumBones();
+        m_lodSkinningBoneRemap.resize( numMeshBones );
+        m_lodSkinningBoneOffsets.resize( numMeshBones, Matrix::Identity );
+        for ( auto i = 0; i < numMeshBones; i++ )
+        {
+            m_lodSkinningBoneRemap[i] = i;
+        }
+
+        auto const& bindPose = m_mesh->GetBindPose();
+        auto const& inverseBindPose = m_mesh->GetInverseBindPose();
+        auto const& globalReferencePose = m_skeleton->GetGlobalReferencePose();
+
+        auto const numAnimBones = m_skeleton->GetNumBones();
+        for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
+        {
+            int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
+            if ( meshBoneIdx == InvalidIndex || m_skeleton->IsBoneInLOD( animBoneIdx, m_skeletonLOD ) )
+            {
+                continue;
+            }
+
+            int32_t const closestAnimBoneIdx = m_skeleton->GetClosestBoneIndexInLOD( animBoneIdx, m_skeletonLOD );
+            int32_t const closestMeshBoneIdx = m_animToMeshBoneMap[closestAnimBoneIdx];
+            if ( closestMeshBoneIdx != InvalidIndex )
+            {
+                m_lodSkinningBoneRemap[meshBoneIdx] = closestMeshBoneIdx;
+
+                // skinning(excluded) = inverseBind(excluded) * referenceDelta * global(parent) = [inverseBind(excluded) * referenceDelta * bind(parent)] * skinning(parent)
+                // This reduces to identity when the bind pose matches the reference pose
+                Transform const referenceDelta = globalReferencePose[animBoneIdx] * globalReferencePose[closestAnimBoneIdx].GetInverse();
+                Transform const offset = inverseBindPose[meshBoneIdx] * referenceDelta * bindPose[closestMeshBoneIdx];
+                m_lodSkinningBoneOffsets[meshBoneIdx] = offset.ToMatrix();
+            }
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
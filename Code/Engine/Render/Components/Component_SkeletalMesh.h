@@ -69,6 +69,11 @@ namespace EE::Render
 
         void ResetPose();
 
+        // Set the skeleton LOD that the pose was calculated for
+        // Bones excluded from the LOD will reuse the skinning transform of their closest included parent
+        void SetSkeletonLOD( Animation::Skeleton::LOD lod );
+        inline Animation::Skeleton::LOD GetSkeletonLOD() const { return m_skeletonLOD; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -82,6 +87,7 @@ namespace EE::Render
 
         void UpdateSkinningTransforms();
         void GenerateAnimationBoneMap();
+        void GenerateLODSkinningBoneRemap();
 
         virtual OBB CalculateLocalBounds() const override final;
 
@@ -98,6 +104,9 @@ namespace EE::Render
         TVector<int32_t>                                m_animToMeshBoneMap;
         TVector<Transform>                              m_boneTransforms;
         TVector<Matrix>                                 m_skinningTransforms;
+        TVector<int32_t>                                m_lodSkinningBoneRemap; // The mesh bone whose skinning transform to use for each mesh bone at the current LOD
+        TVector<Matrix>                                 m_lodSkinningBoneOffsets; // The reference pose offset of each excluded mesh bone relative to its remapped bone, in skinning space
+        Animation::Skeleton::LOD                        m_skeletonLOD = Animation::Skeleton::LOD::High;
     };
 
     //-------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "Base/Resource/ResourcePtr.h"
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Types/StringID.h"
+#include "Base/Types/MappedArray.h"
 
 //-------------------------------------------------------------------------
 
@@ -35,6 +36,7 @@ namespace EE::Render
         struct EE_ENGINE_API GeometrySection
         {
             EE_SERIALIZE( m_ID, m_startIndex, m_numIndices );
+            EE_SERIALIZE_FLAT_POD( GeometrySection, m_ID, m_startIndex, m_numIndices );
 
             GeometrySection() = default;
             GeometrySection( StringID ID, uint32_t startIndex, uint32_t numIndices );
@@ -55,7 +57,7 @@ namespace EE::Render
         inline OBB const& GetBounds() const { return m_bounds; }
 
         // Vertices
-        inline Blob const& GetVertexData() const { return m_vertices; }
+        inline TMappedArray<uint8_t> const& GetVertexData() const { return m_vertices; }
         inline int32_t GetNumVertices() const { return m_vertexBuffer.m_byteSize / m_vertexBuffer.m_byteStride; }
         inline VertexFormat const& GetVertexFormat() const { return m_vertexBuffer.m_vertexFormat; }
         inline RenderBuffer const& GetVertexBuffer() const { return m_vertexBuffer; }
@@ -80,7 +82,7 @@ namespace EE::Render
 
     protected:
 
-        Blob                                m_vertices;
+        TMappedArray<uint8_t>               m_vertices;                 // Referenced in-place when loaded from a memory mapped file
         TVector<uint32_t>                   m_indices;
         TVector<GeometrySection>            m_sections;
         TVector<TResourcePtr<Material>>     m_materials;
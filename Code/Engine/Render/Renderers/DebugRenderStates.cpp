@@ -770,7 +770,7 @@ namespace EE::Render
         return true;
     }
 
-    void DebugTextFontAtlas::GetGlyphsForString( uint32_t fontIdx, TInlineString<24> const& str, TInlineVector<int32_t, 100>& outGlyphIndices ) const
+    void DebugTextFontAtlas::GetGlyphsForString( uint32_t fontIdx, TInlineString<24> const& str, TInlineScratchVector<int32_t, 100>& outGlyphIndices ) const
     {
         EE_ASSERT( fontIdx < m_fonts.size() );
         auto const& fontInfo = m_fonts[fontIdx];
@@ -800,7 +800,7 @@ namespace EE::Render
         }
     }
 
-    void DebugTextFontAtlas::GetGlyphsForString( uint32_t fontIdx, char const* pStr, TInlineVector<int32_t, 100>& outGlyphIndices ) const
+    void DebugTextFontAtlas::GetGlyphsForString( uint32_t fontIdx, char const* pStr, TInlineScratchVector<int32_t, 100>& outGlyphIndices ) const
     {
         EE_ASSERT( fontIdx < m_fonts.size() );
         auto const& fontInfo = m_fonts[fontIdx];
@@ -876,7 +876,7 @@ namespace EE::Render
         return extents;
     }
 
-    uint32_t DebugTextFontAtlas::WriteGlyphsToBuffer( DebugFontGlyphVertex* pVertexBuffer, uint16_t indexStartOffset, uint16_t* pIndexBuffer, uint32_t fontIdx, TInlineVector<int32_t, 100> const& glyphIndices, Float2 const& textPosTopLeft, Float4 const& color ) const
+    uint32_t DebugTextFontAtlas::WriteGlyphsToBuffer( DebugFontGlyphVertex* pVertexBuffer, uint16_t indexStartOffset, uint16_t* pIndexBuffer, uint32_t fontIdx, TInlineScratchVector<int32_t, 100> const& glyphIndices, Float2 const& textPosTopLeft, Float4 const& color ) const
     {
         EE_ASSERT( fontIdx < m_fonts.size() );
         auto const& fontInfo = m_fonts[fontIdx];
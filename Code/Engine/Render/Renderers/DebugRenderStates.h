@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Render/RenderViewport.h"
+#include "Base/Memory/ScratchAllocator.h"
 
 //-------------------------------------------------------------------------
 
@@ -155,16 +156,16 @@ namespace EE::Render
         inline uint8_t const* GetAtlasData() const { return m_atlasData.data(); }
 
         // Get a list of glyphs indices that correspond to the supplied string
-        void GetGlyphsForString( uint32_t fontIdx, TInlineString<24> const& str, TInlineVector<int32_t, 100>& outGlyphIndices ) const;
+        void GetGlyphsForString( uint32_t fontIdx, TInlineString<24> const& str, TInlineScratchVector<int32_t, 100>& outGlyphIndices ) const;
 
         // Get a list of glyphs indices that correspond to the supplied string
-        void GetGlyphsForString( uint32_t fontIdx, char const* pStr, TInlineVector<int32_t, 100>& outGlyphIndices ) const;
+        void GetGlyphsForString( uint32_t fontIdx, char const* pStr, TInlineScratchVector<int32_t, 100>& outGlyphIndices ) const;
 
         // Get the 2D pixel size of the string if it were rendered
         Int2 GetTextExtents( uint32_t fontIdx, char const* pText ) const;
 
         // Fill the supplied vertex and index buffer with the necessary data to render the supplied glyphs
-        uint32_t WriteGlyphsToBuffer( DebugFontGlyphVertex* pVertexBuffer, uint16_t indexStartOffset, uint16_t* pIndexBuffer, uint32_t fontIdx, TInlineVector<int32_t, 100> const& glyphIndices, Float2 const& textPosTopLeft, Float4 const& color ) const;
+        uint32_t WriteGlyphsToBuffer( DebugFontGlyphVertex* pVertexBuffer, uint16_t indexStartOffset, uint16_t* pIndexBuffer, uint32_t fontIdx, TInlineScratchVector<int32_t, 100> const& glyphIndices, Float2 const& textPosTopLeft, Float4 const& color ) const;
 
         // Writes a glyph with custom texture coords to the render buffers
         void WriteCustomGlyphToBuffer( DebugFontGlyphVertex* pVertexBuffer, uint16_t indexStartOffset, uint16_t* pIndexBuffer, uint32_t fontIdx, int32_t firstGlyphIdx, Float2 const& texCoords, Float2 const& baselinePos, Int2 const& textExtents, int32_t pixelPadding, Float4 const& color ) const;
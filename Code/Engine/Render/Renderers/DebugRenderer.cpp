@@ -181,7 +181,8 @@ namespace EE::Render
             // Get the glyph string and number of glyphs needed to render it
             //-------------------------------------------------------------------------
 
-            TInlineVector<int32_t, 100> glyphIndices;
+            Memory::ScopedScratchMarker const scratchMarker;
+            TInlineScratchVector<int32_t, 100> glyphIndices;
             m_textRS.m_fontAtlas.GetGlyphsForString( fontIdx, cmd.m_text, glyphIndices );
 
             int32_t numGlyphsToDraw = (int32_t) glyphIndices.size();
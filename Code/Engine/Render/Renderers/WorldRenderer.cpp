@@ -775,6 +775,12 @@ namespace EE::Render
         auto pWorldSystem = pWorld->GetWorldSystem<RendererWorldSystem>();
         EE_ASSERT( pWorldSystem != nullptr );
 
+        // If the world hasnt been updated recently (e.g. it is suspended), the visible lists refer to released frame memory
+        if ( !pWorldSystem->HasValidCullingResults() )
+        {
+            pWorldSystem->ResetCullingResults();
+        }
+
         //-------------------------------------------------------------------------
 
         RenderData renderData
@@ -3,6 +3,7 @@
 #include "Engine/Render/IRenderer.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/Matrix.h"
+#include "Base/Memory/FrameAllocator.h"
 
 //-------------------------------------------------------------------------
 
@@ -97,8 +98,8 @@ namespace EE::Render
             LightData                               m_lightData;
             CubemapTexture const*                   m_pSkyboxRadianceTexture;
             CubemapTexture const*                   m_pSkyboxTexture;
-            TVector<StaticMeshComponent const*>&    m_staticMeshComponents;
-            TVector<SkeletalMeshComponent const*>&  m_skeletalMeshComponents;
+            TFrameVector<StaticMeshComponent const*>&   m_staticMeshComponents;
+            TFrameVector<SkeletalMeshComponent const*>& m_skeletalMeshComponents;
         };
 
     public:
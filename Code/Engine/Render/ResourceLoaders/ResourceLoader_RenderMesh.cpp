@@ -55,7 +55,7 @@ namespace EE::Render
 
         m_pRenderDevice->LockDevice();
         {
-            m_pRenderDevice->CreateBuffer( pMesh->m_vertexBuffer, pMesh->m_vertices.data() );
+            m_pRenderDevice->CreateBuffer( pMesh->m_vertexBuffer, pMesh->GetVertexData().data() );
             EE_ASSERT( pMesh->m_vertexBuffer.IsValid() );
 
             m_pRenderDevice->CreateBuffer( pMesh->m_indexBuffer, pMesh->m_indices.data() );
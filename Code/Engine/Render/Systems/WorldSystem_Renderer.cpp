@@ -11,6 +11,7 @@
 #include "Base/Render/RenderViewport.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTracking.h"
 
 
 //-------------------------------------------------------------------------
@@ -238,9 +239,30 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    void RendererWorldSystem::ResetCullingResults()
+    {
+        // The previous lists live in frame memory that is released by the frame allocator, so we never free them
+        m_visibleStaticMeshComponents.reset_lose_memory();
+        m_visibleStaticMeshComponents.set_allocator( Memory::FrameAllocatorAdapter() );
+
+        m_visibleSkeletalMeshComponents.reset_lose_memory();
+        m_visibleSkeletalMeshComponents.set_allocator( Memory::FrameAllocatorAdapter() );
+
+        m_cullingFrameIndex = Memory::GetFrameAllocatorFrameIndex();
+    }
+
+    //-------------------------------------------------------------------------
+
+    WorldSystemDataAccess const& RendererWorldSystem::GetDataAccess( UpdateStage stage ) const
+    {
+        static WorldSystemDataAccess const access( ReadsData( StaticMeshComponent::GetStaticTypeID() ), ReadsData( SkeletalMeshComponent::GetStaticTypeID() ), ReadsData( LightComponent::GetStaticTypeID() ), ReadsData( SpatialEntityComponent::GetStaticTypeID() ) );
+        return access;
+    }
+
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_RENDER();
+        EE_MEMORY_TAG_SCOPE( Rendering );
 
         if ( ctx.IsWorldPaused() && ctx.GetUpdateStage() != UpdateStage::Paused )
         {
@@ -295,7 +317,7 @@ namespace EE::Render
 
         AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
 
-        m_visibleStaticMeshComponents.clear();
+        ResetCullingResults();
         {
             EE_PROFILE_SCOPE_RENDER( "Static Mesh AABB Cull" );
             m_staticMobilityTree.FindOverlaps( viewBounds, m_visibleStaticMeshComponents );
@@ -321,8 +343,6 @@ namespace EE::Render
 
         //-------------------------------------------------------------------------
 
-        m_visibleSkeletalMeshComponents.clear();
-
         for ( auto const& meshGroup : m_skeletalMeshGroups )
         {
             EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
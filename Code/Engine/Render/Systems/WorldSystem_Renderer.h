@@ -6,6 +6,7 @@
 #include "Engine/Render/Mesh/SkeletalMesh.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/AABBTree.h"
+#include "Base/Memory/FrameAllocator.h"
 #include "Base/Types/Event.h"
 #include "Base/Systems.h"
 #include "Base/Types/IDVector.h"
@@ -79,6 +80,7 @@ namespace EE::Render
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual WorldSystemDataAccess const& GetDataAccess( UpdateStage stage ) const override;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
@@ -96,13 +98,22 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        // The visible lists are allocated from frame memory, so they are only valid if we culled during this frame or the previous one
+        inline bool HasValidCullingResults() const { return Memory::IsFrameMemoryValid( m_cullingFrameIndex ); }
+
+        // Drop the visible lists (without releasing their memory) and bind them to the current frame
+        void ResetCullingResults();
+
     private:
 
         // Static meshes
         TIDVector<ComponentID, StaticMeshComponent*>                    m_registeredStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_staticStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_dynamicStaticMeshComponents;
-        TVector<StaticMeshComponent const*>                             m_visibleStaticMeshComponents;
+        TFrameVector<StaticMeshComponent const*>                        m_visibleStaticMeshComponents;
         EventBindingID                                                  m_staticMeshMobilityChangedEventBinding;
         EventBindingID                                                  m_staticMeshStaticTransformUpdatedEventBinding;
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
@@ -113,7 +124,8 @@ namespace EE::Render
         // Skeletal meshes
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
-        TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TFrameVector<SkeletalMeshComponent const*>                      m_visibleSkeletalMeshComponents;
+        uint32_t                                                        m_cullingFrameIndex = 0;                // The frame allocator frame during which the visible lists were built
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
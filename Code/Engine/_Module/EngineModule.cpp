@@ -3,8 +3,9 @@
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Physics/Physics.h"
 #include "Base/Resource/ResourceProviders/NetworkResourceProvider.h"
-#include "Base/Resource/ResourceProviders/PackagedResourceProvider.h"
+#include "Base/Resource/ResourceProviders/ArchiveResourceProvider.h"
 #include "Base/Network/NetworkSystem.h"
+#include "Base/Memory/FrameAllocator.h"
 
 //-------------------------------------------------------------------------
 
@@ -112,7 +113,7 @@ namespace EE
         }
         #else
         {
-            m_pResourceProvider = EE::New<Resource::PackagedResourceProvider>( settings );
+            m_pResourceProvider = EE::New<Resource::ArchiveResourceProvider>( settings );
         }
         #endif
 
@@ -129,6 +130,15 @@ namespace EE
             return false;
         }
 
+        // Read animation settings
+        //-------------------------------------------------------------------------
+
+        if ( !m_animationSettings.ReadSettings( iniFile ) )
+        {
+            EE_LOG_ERROR( "Animation", nullptr, "Failed to read animation settings from ini file!" );
+            return false;
+        }
+
         // Create and initialize render device
         //-------------------------------------------------------------------------
 
@@ -143,6 +153,7 @@ namespace EE
         // Initialize core systems
         //-------------------------------------------------------------------------
 
+        Memory::InitializeFrameAllocator();
         m_taskSystem.Initialize();
         m_resourceSystem.Initialize( m_pResourceProvider );
         m_inputSystem.Initialize();
@@ -261,6 +272,7 @@ namespace EE
             m_inputSystem.Shutdown();
             m_resourceSystem.Shutdown();
             m_taskSystem.Shutdown();
+            Memory::ShutdownFrameAllocator();
         }
 
         // Destroy render device and resource provider
@@ -301,6 +313,7 @@ namespace EE
         m_systemRegistry.RegisterSystem( &m_entityWorldManager );
         m_systemRegistry.RegisterSystem( &m_rendererRegistry );
         m_systemRegistry.RegisterSystem( &m_physicsMaterialRegistry );
+        m_systemRegistry.RegisterSystem( &m_animationSettings );
 
         // Register resource loaders
         //-------------------------------------------------------------------------
@@ -393,6 +406,7 @@ namespace EE
         // Unregister systems
         //-------------------------------------------------------------------------
 
+        m_systemRegistry.UnregisterSystem( &m_animationSettings );
         m_systemRegistry.UnregisterSystem( &m_physicsMaterialRegistry );
         m_systemRegistry.UnregisterSystem( &m_rendererRegistry );
         m_systemRegistry.UnregisterSystem( &m_entityWorldManager );
@@ -12,6 +12,7 @@
 #include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationSkeleton.h"
 #include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationClip.h"
 #include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationGraph.h"
+#include "Engine/Animation/AnimationSettings.h"
 #include "Engine/Navmesh/ResourceLoaders/ResourceLoader_Navmesh.h"
 #include "Engine/Render/RendererRegistry.h"
 #include "Engine/Render/Renderers/WorldRenderer.h"
@@ -115,6 +116,7 @@ namespace EE
         Animation::SkeletonLoader                       m_skeletonLoader;
         Animation::AnimationClipLoader                  m_animationClipLoader;
         Animation::GraphLoader                          m_graphLoader;
+        Animation::AnimationSettings                    m_animationSettings;
 
         // Physics
         Physics::CollisionMeshLoader                    m_physicsCollisionMeshLoader;
@@ -105,7 +105,7 @@ namespace EE::Animation
         Resource::ResourceHeader hdr( s_version, AnimationClip::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         hdr.AddInstallDependency( resourceDescriptor.m_skeleton.GetResourceID() );
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << animData;
         archive << eventData.m_syncEventMarkers;
         archive << eventData.m_collection;
@@ -122,7 +122,7 @@ namespace EE::Animation
 
         auto pRuntimeGraph = definitionCompiler.GetCompiledGraph();
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
 
         archive << Resource::ResourceHeader( s_version, GraphDefinition::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         archive << *pRuntimeGraph;
@@ -236,7 +236,7 @@ namespace EE::Animation
         // Serialize variation
         //-------------------------------------------------------------------------
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr;
         archive << variation;
 
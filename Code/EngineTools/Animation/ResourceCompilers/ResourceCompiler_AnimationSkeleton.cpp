@@ -54,10 +54,44 @@ namespace EE::Animation
             skeleton.m_localReferencePose.push_back( Transform( boneData.m_localTransform.GetRotation(), boneData.m_localTransform.GetTranslation(), boneData.m_localTransform.GetScale() ) );
         }
 
+        // Generate bone LODs
+        //-------------------------------------------------------------------------
+        // All bones are present in all LODs by default, the high LOD bones and all their descendants are removed from the lower LODs
+
+        skeleton.m_boneLODs.resize( numBones, Skeleton::LOD::Low );
+
+        for ( StringID const& boneID : resourceDescriptor.m_highLODBones )
+        {
+            int32_t const boneIdx = skeleton.GetBoneIndex( boneID );
+            if ( boneIdx == InvalidIndex )
+            {
+                Warning( "High LOD bone (%s) not found in skeleton", boneID.c_str() );
+                continue;
+            }
+
+            if ( boneIdx == 0 )
+            {
+                Warning( "Root bone cannot be set as a high LOD bone" );
+                continue;
+            }
+
+            skeleton.m_boneLODs[boneIdx] = Skeleton::LOD::High;
+        }
+
+        // Parents always precede their children, so a single forward pass will propagate the LOD to all descendants
+        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = skeleton.m_parentIndices[boneIdx];
+            if ( skeleton.m_boneLODs[parentIdx] < skeleton.m_boneLODs[boneIdx] )
+            {
+                skeleton.m_boneLODs[boneIdx] = skeleton.m_boneLODs[parentIdx];
+            }
+        }
+
         // Serialize skeleton
         //-------------------------------------------------------------------------
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << Resource::ResourceHeader( s_version, Skeleton::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         archive << skeleton;
         archive << resourceDescriptor.m_boneMaskDefinitions;
@@ -50,5 +50,9 @@ namespace EE::Animation
 
         EE_REFLECT();
         TVector<BoneMaskDefinition>                 m_boneMaskDefinitions;
+
+        // The set of bones (and their descendants) that are only present in the highest LOD, e.g. fingers, face bones, etc...
+        EE_REFLECT();
+        TVector<StringID>                           m_highLODBones;
     };
 }
\ No newline at end of file
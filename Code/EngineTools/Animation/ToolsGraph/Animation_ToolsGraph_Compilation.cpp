@@ -2,6 +2,8 @@
 #include "Animation_ToolsGraph_Definition.h"
 #include "Nodes/Animation_ToolsGraphNode_Parameters.h"
 #include "Nodes/Animation_ToolsGraphNode_Result.h"
+#include "Nodes/Animation_ToolsGraphNode_State.h"
+#include "Nodes/Animation_ToolsGraphNode_StateMachine.h"
 
 //-------------------------------------------------------------------------
 
@@ -53,6 +55,100 @@ namespace EE::Animation
         }
     }
 
+    //-------------------------------------------------------------------------
+    // Pose Buffer Usage
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct PoseBufferUsage
+        {
+            int32_t m_numPoseBuffers = 0;
+            int32_t m_numCachedPoseBuffers = 0;
+        };
+
+        using PoseBufferUsageMap = THashMap<UUID, PoseBufferUsage>;
+
+        PoseBufferUsage CalculatePeakPoseBufferUsage( FlowToolsNode const* pNode, PoseBufferUsageMap& calculatedUsage );
+
+        // During a transition both the source and target states are evaluated, and the source pose is held while the target is evaluated
+        // Chained transitions can exceed this estimate, in which case the pose buffer pool will grow on demand
+        PoseBufferUsage CalculatePeakStateMachinePoseBufferUsage( StateMachineToolsNode const* pStateMachineNode, PoseBufferUsageMap& calculatedUsage )
+        {
+            PoseBufferUsage maxStateUsage;
+
+            auto stateNodes = pStateMachineNode->GetChildGraph()->FindAllNodesOfType<StateToolsNode>( VisualGraph::SearchMode::Localized, VisualGraph::SearchTypeMatch::Derived );
+            for ( auto pStateNode : stateNodes )
+            {
+                if ( pStateNode->IsOffState() )
+                {
+                    continue;
+                }
+
+                auto resultNodes = pStateNode->GetChildGraph()->FindAllNodesOfType<ResultToolsNode>( VisualGraph::SearchMode::Localized, VisualGraph::SearchTypeMatch::Derived );
+                EE_ASSERT( resultNodes.size() == 1 );
+                PoseBufferUsage const stateUsage = CalculatePeakPoseBufferUsage( resultNodes[0], calculatedUsage );
+                maxStateUsage.m_numPoseBuffers = Math::Max( maxStateUsage.m_numPoseBuffers, stateUsage.m_numPoseBuffers );
+                maxStateUsage.m_numCachedPoseBuffers = Math::Max( maxStateUsage.m_numCachedPoseBuffers, stateUsage.m_numCachedPoseBuffers );
+            }
+
+            PoseBufferUsage usage;
+            usage.m_numPoseBuffers = Math::Max( 1, maxStateUsage.m_numPoseBuffers + 1 );
+            usage.m_numCachedPoseBuffers = ( maxStateUsage.m_numCachedPoseBuffers * 2 ) + 1;
+            return usage;
+        }
+
+        // Inputs are evaluated in order, and each evaluated input holds onto its result buffer while the subsequent inputs are evaluated
+        // Any nodes that can be active at the same time (e.g. layers) are assumed to need their cached pose buffers at the same time
+        PoseBufferUsage CalculatePeakPoseBufferUsage( FlowToolsNode const* pNode, PoseBufferUsageMap& calculatedUsage )
+        {
+            auto foundIter = calculatedUsage.find( pNode->GetID() );
+            if ( foundIter != calculatedUsage.end() )
+            {
+                return foundIter->second;
+            }
+
+            //-------------------------------------------------------------------------
+
+            PoseBufferUsage usage;
+
+            if ( auto pStateMachineNode = TryCast<StateMachineToolsNode>( pNode ) )
+            {
+                usage = CalculatePeakStateMachinePoseBufferUsage( pStateMachineNode, calculatedUsage );
+            }
+            else
+            {
+                int32_t numHeldResults = 0;
+                int32_t const numInputs = pNode->GetNumInputPins();
+                for ( int32_t i = 0; i < numInputs; i++ )
+                {
+                    auto pInputNode = pNode->GetConnectedInputNode<FlowToolsNode>( i );
+                    if ( pInputNode == nullptr )
+                    {
+                        continue;
+                    }
+
+                    PoseBufferUsage const inputUsage = CalculatePeakPoseBufferUsage( pInputNode, calculatedUsage );
+                    if ( inputUsage.m_numPoseBuffers > 0 )
+                    {
+                        usage.m_numPoseBuffers = Math::Max( usage.m_numPoseBuffers, numHeldResults + inputUsage.m_numPoseBuffers );
+                        numHeldResults++;
+                    }
+
+                    usage.m_numCachedPoseBuffers += inputUsage.m_numCachedPoseBuffers;
+                }
+
+                if ( pNode->GetValueType() == GraphValueType::Pose )
+                {
+                    usage.m_numPoseBuffers = Math::Max( 1, usage.m_numPoseBuffers );
+                }
+            }
+
+            calculatedUsage.insert( TPair<UUID, PoseBufferUsage>( pNode->GetID(), usage ) );
+            return usage;
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     bool GraphDefinitionCompiler::CompileGraph( ToolsGraphDefinition const& toolsGraph )
@@ -124,6 +220,12 @@ namespace EE::Animation
         m_runtimeGraph.m_instanceRequiredMemory = m_context.m_currentNodeMemoryOffset;
         m_runtimeGraph.m_instanceRequiredAlignment = m_context.m_graphInstanceRequiredAlignment;
         m_runtimeGraph.m_rootNodeIdx = rootNodeIdx;
+
+        // Calculate the peak pose buffer usage so that instances can size their pose buffer pools up front
+        PoseBufferUsageMap calculatedPoseBufferUsage;
+        PoseBufferUsage const poseBufferUsage = CalculatePeakPoseBufferUsage( resultNodes[0], calculatedPoseBufferUsage );
+        m_runtimeGraph.m_numRequiredPoseBuffers = (int16_t) poseBufferUsage.m_numPoseBuffers;
+        m_runtimeGraph.m_numRequiredCachedPoseBuffers = (int16_t) poseBufferUsage.m_numCachedPoseBuffers;
         m_runtimeGraph.m_childGraphSlots = m_context.m_registeredChildGraphSlots;
         m_runtimeGraph.m_externalGraphSlots = m_context.m_registeredExternalGraphSlots;
 
@@ -255,6 +255,21 @@ namespace EE::EntityModel
                 outEntityDesc.m_attachmentSocketID = StringID( attachmentSocketIter->value.GetString() );
             }
 
+            // Read update rate
+            //-------------------------------------------------------------------------
+
+            auto updateRatePolicyIter = entityObject.FindMember( "UpdateRatePolicy" );
+            if ( updateRatePolicyIter != entityObject.MemberEnd() && updateRatePolicyIter->value.IsUint() )
+            {
+                outEntityDesc.m_updateRatePolicy = (uint8_t) updateRatePolicyIter->value.GetUint();
+            }
+
+            auto fixedUpdateIntervalIter = entityObject.FindMember( "FixedUpdateInterval" );
+            if ( fixedUpdateIntervalIter != entityObject.MemberEnd() && fixedUpdateIntervalIter->value.IsUint() )
+            {
+                outEntityDesc.m_fixedUpdateInterval = (uint8_t) Math::Clamp( fixedUpdateIntervalIter->value.GetUint(), 1u, 255u );
+            }
+
             // Set parsing ctx ID
             //-------------------------------------------------------------------------
 
@@ -614,6 +629,18 @@ namespace EE::EntityModel
             writer.String( entityDesc.m_attachmentSocketID.c_str() );
         }
 
+        if ( entityDesc.m_updateRatePolicy != 0 )
+        {
+            writer.Key( "UpdateRatePolicy" );
+            writer.Uint( entityDesc.m_updateRatePolicy );
+        }
+
+        if ( entityDesc.m_fixedUpdateInterval != 1 )
+        {
+            writer.Key( "FixedUpdateInterval" );
+            writer.Uint( entityDesc.m_fixedUpdateInterval );
+        }
+
         //-------------------------------------------------------------------------
 
         if ( !entityDesc.m_components.empty() )
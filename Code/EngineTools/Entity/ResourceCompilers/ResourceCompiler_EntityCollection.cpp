@@ -39,7 +39,7 @@ namespace EE::EntityModel
         // Serialize
         //-------------------------------------------------------------------------
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << Resource::ResourceHeader( s_version, SerializedEntityCollection::GetStaticResourceTypeID(), ctx.m_sourceResourceHash ) << serializedCollection;
         
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
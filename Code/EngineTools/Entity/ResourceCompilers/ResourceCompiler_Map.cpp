@@ -66,7 +66,7 @@ namespace EE::EntityModel
         // Serialize
         //-------------------------------------------------------------------------
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << Resource::ResourceHeader( s_version, SerializedEntityMap::GetStaticResourceTypeID(), ctx.m_sourceResourceHash ) << map;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
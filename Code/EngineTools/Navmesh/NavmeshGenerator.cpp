@@ -401,7 +401,7 @@ namespace EE::Navmesh
         Printf( m_progressMessage, 256, "Step 4/4: Saving Navmesh" );
         m_progress = 1.0f;
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << Resource::ResourceHeader( s_version, Navmesh::NavmeshData::GetStaticResourceTypeID(), 0 ) << navmeshData;
 
         if ( archive.WriteToFile( m_outputPath ) )
@@ -133,7 +133,7 @@ namespace EE::Physics
         //-------------------------------------------------------------------------
 
         Resource::ResourceHeader hdr( s_version, CollisionMesh::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << physicsMesh << cookedMeshData;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
@@ -86,7 +86,7 @@ namespace EE::Physics
 
         Resource::ResourceHeader hdr( s_version, MaterialDatabase::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << db;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
@@ -42,7 +42,7 @@ namespace EE::Physics
         Resource::ResourceHeader hdr( s_version, RagdollDefinition::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         hdr.AddInstallDependency( definition.m_skeleton.GetResourceID() );
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << definition;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
@@ -70,7 +70,7 @@ namespace EE::Render
         // Serialize
         //-------------------------------------------------------------------------
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << material;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
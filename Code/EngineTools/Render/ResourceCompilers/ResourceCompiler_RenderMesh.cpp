@@ -265,7 +265,7 @@ namespace EE::Render
         Resource::ResourceHeader hdr( s_version, StaticMesh::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         SetMeshInstallDependencies( staticMesh, hdr );
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << staticMesh;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
@@ -335,7 +335,7 @@ namespace EE::Render
         Resource::ResourceHeader hdr( s_version, SkeletalMesh::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         SetMeshInstallDependencies( skeletalMesh, hdr );
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << skeletalMesh;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
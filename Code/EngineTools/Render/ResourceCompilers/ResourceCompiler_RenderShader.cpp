@@ -280,7 +280,7 @@ namespace EE::Render
         // Output shader resource
         //-------------------------------------------------------------------------
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
 
         if ( pShader->GetPipelineStage() == PipelineStage::Pixel )
         {
@@ -60,7 +60,7 @@ namespace EE::Render
 
         Resource::ResourceHeader hdr( s_version, Texture::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
         
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << texture;
         
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
@@ -102,7 +102,7 @@ namespace EE::Render
 
         Resource::ResourceHeader hdr( s_version, Texture::GetStaticResourceTypeID(), ctx.m_sourceResourceHash );
 
-        Serialization::BinaryOutputArchive archive;
+        Serialization::BinaryOutputArchive archive( Serialization::BinaryFormat::Flat );
         archive << hdr << texture;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
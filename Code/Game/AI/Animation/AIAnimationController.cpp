@@ -16,10 +16,10 @@ namespace EE::AI
     {
         static StringID const characterStates[(uint8_t) CharacterAnimationState::NumStates] =
         {
-            StringID( "Locomotion" ),
-            StringID( "Falling" ),
-            StringID( "Ability" ),
-            StringID( "DebugMode" ),
+            StringID::FromLiteral( "Locomotion" ),
+            StringID::FromLiteral( "Falling" ),
+            StringID::FromLiteral( "Ability" ),
+            StringID::FromLiteral( "DebugMode" ),
         };
 
         EE_ASSERT( state < CharacterAnimationState::NumStates );
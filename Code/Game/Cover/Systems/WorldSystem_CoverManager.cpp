@@ -31,6 +31,13 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccess const& CoverManager::GetDataAccess( UpdateStage stage ) const
+    {
+        // Only touches its own data
+        static WorldSystemDataAccess const access;
+        return access;
+    }
+
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
     }
@@ -21,11 +21,11 @@ namespace EE::Player
     {
         static StringID const characterStates[(uint8_t) CharacterAnimationState::NumStates] =
         {
-            StringID( "Locomotion" ),
-            StringID( "InAir" ),
-            StringID( "Ability" ),
-            StringID( "Interaction" ),
-            StringID( "GhostMode" ),
+            StringID::FromLiteral( "Locomotion" ),
+            StringID::FromLiteral( "InAir" ),
+            StringID::FromLiteral( "Ability" ),
+            StringID::FromLiteral( "Interaction" ),
+            StringID::FromLiteral( "GhostMode" ),
         };
 
         EE_ASSERT( state < CharacterAnimationState::NumStates );
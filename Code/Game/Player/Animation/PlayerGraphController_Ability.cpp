@@ -15,19 +15,19 @@ namespace EE::Player
 
     void AbilityGraphController::StartJump()
     {
-        static StringID const jumpID( "Jump" );
+        static StringID const jumpID = StringID::FromLiteral( "Jump" );
         m_abilityID.Set( jumpID );
     }
 
     void AbilityGraphController::StartDash()
     {
-        static StringID const dashID( "Dash" );
+        static StringID const dashID = StringID::FromLiteral( "Dash" );
         m_abilityID.Set( dashID );
     }
 
     void AbilityGraphController::StartSlide()
     {
-        static StringID const dashID( "Slide" );
+        static StringID const dashID = StringID::FromLiteral( "Slide" );
         m_abilityID.Set( dashID );
     }
 
@@ -7,22 +7,22 @@ namespace EE::Player
 {
     StringID const LocomotionGraphController::s_locomotionStateIDs[] =
     {
-        StringID( "Idle" ),
-        StringID( "TurnOnSpot" ),
-        StringID( "Start" ),
-        StringID( "Move" ),
-        StringID( "PlantedTurn" ),
-        StringID( "Stop" ),
+        StringID::FromLiteral( "Idle" ),
+        StringID::FromLiteral( "TurnOnSpot" ),
+        StringID::FromLiteral( "Start" ),
+        StringID::FromLiteral( "Move" ),
+        StringID::FromLiteral( "PlantedTurn" ),
+        StringID::FromLiteral( "Stop" ),
     };
 
     StringID const LocomotionGraphController::s_graphStateIDs[] =
     {
-        StringID( "Locomotion_Idle" ),
-        StringID( "Locomotion_TurnOnSpot" ),
-        StringID( "Locomotion_Start" ),
-        StringID( "Locomotion_Move" ),
-        StringID( "Locomotion_PlantedTurn" ),
-        StringID( "Locomotion_Stop" ),
+        StringID::FromLiteral( "Locomotion_Idle" ),
+        StringID::FromLiteral( "Locomotion_TurnOnSpot" ),
+        StringID::FromLiteral( "Locomotion_Start" ),
+        StringID::FromLiteral( "Locomotion_Move" ),
+        StringID::FromLiteral( "Locomotion_PlantedTurn" ),
+        StringID::FromLiteral( "Locomotion_Stop" ),
     };
 
     //-------------------------------------------------------------------------
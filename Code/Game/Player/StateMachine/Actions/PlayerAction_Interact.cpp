@@ -24,7 +24,7 @@ namespace EE::Player
         {
             Animation::ExternalGraphController::PostGraphUpdate( deltaTime );
 
-            static StringID const completionEventID( "InteractionComplete" );
+            static StringID const completionEventID = StringID::FromLiteral( "InteractionComplete" );
             m_isComplete = GetSampledEvents().ContainsStateEvent( completionEventID );
         }
 
@@ -52,7 +52,7 @@ namespace EE::Player
         if( ctx.m_pInputState->GetControllerState()->WasReleased( Input::ControllerButton::FaceButtonUp ) )
         {
             // Create external controller
-            m_pController = ctx.m_pAnimationController->TryCreateExternalGraphController<ExternalController>( StringID( "Interaction" ), ctx.m_pPlayerComponent->m_pAvailableInteraction, true );
+            m_pController = ctx.m_pAnimationController->TryCreateExternalGraphController<ExternalController>( StringID::FromLiteral( "Interaction" ), ctx.m_pPlayerComponent->m_pAvailableInteraction, true );
             if ( m_pController != nullptr )
             {
                 ctx.m_pAnimationController->SetCharacterState( Player::CharacterAnimationState::Interaction );
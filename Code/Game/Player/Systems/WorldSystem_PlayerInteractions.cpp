@@ -51,6 +51,12 @@ namespace EE::Player
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccess const& PlayerInteractionSystem::GetDataAccess( UpdateStage stage ) const
+    {
+        static WorldSystemDataAccess const access( ReadsData( SpatialEntityComponent::GetStaticTypeID() ), WritesData( MainPlayerComponent::GetStaticTypeID() ) );
+        return access;
+    }
+
     void PlayerInteractionSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( !ctx.IsGameWorld() )
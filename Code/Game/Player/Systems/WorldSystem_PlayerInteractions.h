@@ -35,6 +35,7 @@ namespace EE::Player
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccess const& GetDataAccess( UpdateStage stage ) const override;
 
     private:
 